@@ -0,0 +1,13 @@
+set(benchmark_executables_list
+  Kernels_benchmark
+  ModelGraph_benchmark
+  ModelInterpreter_benchmark
+  ModelTrainer_benchmark
+  OpToTensorOp_benchmark
+  Simulator_benchmark
+)
+
+### collect benchmark executables
+set(BENCHMARK_executables
+  ${benchmark_executables_list}
+)
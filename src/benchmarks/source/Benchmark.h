@@ -0,0 +1,284 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_BENCHMARK_H
+#define SMARTPEAK_BENCHMARK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+/*
+@brief Counters of the heap allocations
+
+With glibc, the C allocation functions (malloc, calloc, realloc, and the aligned variants) are interposed
+	so that all heap allocations are counted: those of operator new (e.g., std::vector, std::string, std::shared_ptr, and std::map)
+	and those of Eigen (e.g., the tensors that are allocated with `Eigen::internal::aligned_malloc`).
+	The allocations are forwarded to the glibc allocator and memory is freed with the (unchanged) `free`.
+	With other C libraries only the global operator new is replaced and the tensors of Eigen are NOT counted
+	(see `AllocationCounters::counts_malloc`).
+
+	NOTE: this header replaces the allocation functions and must only be included in the translation unit of the benchmark `main`
+*/
+namespace SmartPeak
+{
+	struct AllocationCounters
+	{
+		static inline std::atomic<size_t> n_allocations{ 0 };
+		static inline std::atomic<size_t> n_bytes{ 0 };
+#if defined(__GLIBC__)
+		static constexpr bool counts_malloc = true;
+#else
+		static constexpr bool counts_malloc = false;
+#endif
+		static void add(const std::size_t& size)
+		{
+			n_allocations.fetch_add(1, std::memory_order_relaxed);
+			n_bytes.fetch_add(size, std::memory_order_relaxed);
+		};
+	};
+}
+
+#if defined(__GLIBC__)
+extern "C"
+{
+	void* __libc_malloc(std::size_t size) noexcept;
+	void* __libc_calloc(std::size_t n, std::size_t size) noexcept;
+	void* __libc_realloc(void* ptr, std::size_t size) noexcept;
+	void* __libc_memalign(std::size_t alignment, std::size_t size) noexcept;
+
+	void* malloc(std::size_t size) noexcept
+	{
+		SmartPeak::AllocationCounters::add(size);
+		return __libc_malloc(size);
+	}
+	void* calloc(std::size_t n, std::size_t size) noexcept
+	{
+		SmartPeak::AllocationCounters::add(n * size);
+		return __libc_calloc(n, size);
+	}
+	void* realloc(void* ptr, std::size_t size) noexcept
+	{
+		SmartPeak::AllocationCounters::add(size);
+		return __libc_realloc(ptr, size);
+	}
+	void* memalign(std::size_t alignment, std::size_t size) noexcept
+	{
+		SmartPeak::AllocationCounters::add(size);
+		return __libc_memalign(alignment, size);
+	}
+	void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept { return memalign(alignment, size); }
+	int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept
+	{
+		*ptr = memalign(alignment, size);
+		return (*ptr == nullptr) ? ENOMEM : 0;
+	}
+}
+#else
+void* operator new(std::size_t size)
+{
+	SmartPeak::AllocationCounters::add(size);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+	throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
+
+namespace SmartPeak
+{
+	/*
+	@brief The timings and allocations of a benchmark
+
+	All values are per op (i.e., per call of the benchmarked function)
+	*/
+	struct BenchmarkResult
+	{
+		std::string name; ///< name of the benchmark (e.g., "SumTensorOp")
+		std::string size; ///< description of the problem size (e.g., "batch=32;source=128;sink=128")
+		int repetitions = 0; ///< number of timed repetitions
+		long iterations = 0; ///< number of ops per repetition
+		double time_per_op_us = 0; ///< median time per op over the repetitions
+		double time_per_op_us_min = 0; ///< fastest time per op over the repetitions
+		double bytes_allocated_per_op = 0; ///< bytes allocated on the heap per op (see `AllocationCounters`)
+		double allocations_per_op = 0; ///< number of heap allocations per op (see `AllocationCounters`)
+		double throughput = 0; ///< items per second based on the median time per op
+		std::string throughput_unit; ///< the unit of the items (e.g., "flop/s")
+	};
+
+	/*
+	@brief Harness for running micro benchmarks
+
+	Each benchmark is run once to warm up and to calibrate the number of ops per repetition
+		so that each repetition takes at least `min_time_ms`.
+		The median (and min) time per op over all repetitions is reported so that the results are robust to outliers.
+		Results are written as one CSV line per benchmark to stdout with a header line written on construction.
+
+	Usage:
+		SomeBenchmark [min_time_ms] [repetitions] [filter]
+
+		min_time_ms The minimum time of each repetition (Default: 100)
+		repetitions The number of timed repetitions (Default: 5)
+		filter Only run the benchmarks whose name contains the filter (Default: "", i.e., all)
+	*/
+	class BenchmarkRunner
+	{
+	public:
+		BenchmarkRunner() { writeHeader(std::cout); };
+		BenchmarkRunner(int argc, char** argv)
+		{
+			if (argc >= 2) min_time_ms_ = std::stod(argv[1]);
+			if (argc >= 3) repetitions_ = std::max(1, std::stoi(argv[2]));
+			if (argc >= 4) filter_ = argv[3];
+			writeHeader(std::cout);
+		};
+		~BenchmarkRunner() = default;
+
+		void setMinTimeMs(const double& min_time_ms) { min_time_ms_ = min_time_ms; }; ///< min_time_ms setter
+		double getMinTimeMs() const { return min_time_ms_; }; ///< min_time_ms getter
+		void setRepetitions(const int& repetitions) { repetitions_ = repetitions; }; ///< repetitions setter
+		int getRepetitions() const { return repetitions_; }; ///< repetitions getter
+		void setFilter(const std::string& filter) { filter_ = filter; }; ///< filter setter
+		std::string getFilter() const { return filter_; }; ///< filter getter
+		std::vector<BenchmarkResult> getResults() const { return results_; }; ///< results getter
+
+		/*
+		@brief Check if a benchmark passes the filter (e.g., to skip its set-up)
+		*/
+		bool isSelected(const std::string& name) const { return filter_.empty() || name.find(filter_) != std::string::npos; };
+
+		/*
+		@brief Time a benchmark and write the results
+
+		@param[in] name The name of the benchmark
+		@param[in] size The description of the problem size
+		@param[in] items_per_op The number of items processed by each op (for the throughput)
+		@param[in] items_unit The unit of the throughput
+		@param[in] func The op to benchmark (any set-up should be done beforehand)
+		*/
+		template<typename Func>
+		void run(const std::string& name, const std::string& size, const double& items_per_op, const std::string& items_unit, Func func)
+		{
+			if (!isSelected(name)) return;
+
+			// warm up and calibrate the number of ops per repetition
+			const double warmup_ms = timeOps(1, func);
+			long iterations = 1;
+			if (warmup_ms < min_time_ms_)
+				iterations = std::min(max_iterations_, long(min_time_ms_ / std::max(warmup_ms, 1e-6)) + 1);
+
+			// timed repetitions (the times are reserved so that the harness does not allocate while counting)
+			std::vector<double> times_per_op_us;
+			times_per_op_us.reserve(repetitions_);
+			const size_t n_allocations_start = AllocationCounters::n_allocations.load();
+			const size_t n_bytes_start = AllocationCounters::n_bytes.load();
+			for (int rep_iter = 0; rep_iter < repetitions_; ++rep_iter)
+				times_per_op_us.push_back(1e3 * timeOps(iterations, func) / iterations);
+			const size_t n_allocations = AllocationCounters::n_allocations.load() - n_allocations_start;
+			const size_t n_bytes = AllocationCounters::n_bytes.load() - n_bytes_start;
+			addResult(name, size, items_per_op, items_unit, iterations, times_per_op_us, n_allocations, n_bytes);
+		};
+
+		/*
+		@brief Time a benchmark that needs to be set-up before each op and write the results
+
+		Only the op is timed and only the allocations of the op are counted.
+			Each op is timed individually so the op should take considerably longer than reading the clock (i.e., > 1 us).
+
+		@param[in] set_up The set-up before each op (e.g., the forward pass before the back propogation)
+		@param[in] func The op to benchmark
+		*/
+		template<typename SetUpFunc, typename Func>
+		void run(const std::string& name, const std::string& size, const double& items_per_op, const std::string& items_unit, SetUpFunc set_up, Func func)
+		{
+			if (!isSelected(name)) return;
+
+			// warm up and calibrate the number of ops per repetition
+			set_up();
+			const double warmup_ms = timeOps(1, func);
+			long iterations = 1;
+			if (warmup_ms < min_time_ms_)
+				iterations = std::min(max_iterations_, long(min_time_ms_ / std::max(warmup_ms, 1e-6)) + 1);
+
+			// timed repetitions
+			std::vector<double> times_per_op_us;
+			times_per_op_us.reserve(repetitions_);
+			size_t n_allocations = 0, n_bytes = 0;
+			for (int rep_iter = 0; rep_iter < repetitions_; ++rep_iter) {
+				double time_ms = 0;
+				for (long iter = 0; iter < iterations; ++iter) {
+					set_up();
+					const size_t n_allocations_start = AllocationCounters::n_allocations.load();
+					const size_t n_bytes_start = AllocationCounters::n_bytes.load();
+					time_ms += timeOps(1, func);
+					n_allocations += AllocationCounters::n_allocations.load() - n_allocations_start;
+					n_bytes += AllocationCounters::n_bytes.load() - n_bytes_start;
+				}
+				times_per_op_us.push_back(1e3 * time_ms / iterations);
+			}
+			addResult(name, size, items_per_op, items_unit, iterations, times_per_op_us, n_allocations, n_bytes);
+		};
+
+		static void writeHeader(std::ostream& stream)
+		{
+			if (!AllocationCounters::counts_malloc)
+				std::cerr << "The allocations of malloc (e.g., the tensors of Eigen) are not counted with this C library." << std::endl;
+			stream << "benchmark,size,repetitions,iterations,time_per_op_us,time_per_op_us_min,bytes_allocated_per_op,allocations_per_op,throughput,throughput_unit" << std::endl;
+		};
+
+		static void writeResult(std::ostream& stream, const BenchmarkResult& result)
+		{
+			char values_char[512];
+			snprintf(values_char, sizeof(values_char), "%.6g,%.6g,%.6g,%.6g,%.6g", result.time_per_op_us, result.time_per_op_us_min, result.bytes_allocated_per_op, result.allocations_per_op, result.throughput);
+			stream << result.name << "," << result.size << "," << result.repetitions << "," << result.iterations << "," << values_char << "," << result.throughput_unit << std::endl;
+		};
+
+	private:
+		void addResult(const std::string& name, const std::string& size, const double& items_per_op, const std::string& items_unit,
+			const long& iterations, std::vector<double>& times_per_op_us, const size_t& n_allocations, const size_t& n_bytes)
+		{
+			std::sort(times_per_op_us.begin(), times_per_op_us.end());
+			BenchmarkResult result;
+			result.name = name;
+			result.size = size;
+			result.repetitions = repetitions_;
+			result.iterations = iterations;
+			result.time_per_op_us = times_per_op_us.at(times_per_op_us.size() / 2);
+			result.time_per_op_us_min = times_per_op_us.front();
+			const double n_ops = double(repetitions_) * double(iterations);
+			result.allocations_per_op = double(n_allocations) / n_ops;
+			result.bytes_allocated_per_op = double(n_bytes) / n_ops;
+			result.throughput = (result.time_per_op_us > 0) ? items_per_op / (1e-6 * result.time_per_op_us) : 0;
+			result.throughput_unit = items_unit;
+			writeResult(std::cout, result);
+			results_.push_back(result);
+		};
+
+		template<typename Func>
+		static double timeOps(const long& iterations, Func& func)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (long iter = 0; iter < iterations; ++iter)
+				func();
+			const auto stop = std::chrono::steady_clock::now();
+			return std::chrono::duration<double, std::milli>(stop - start).count();
+		};
+
+		double min_time_ms_ = 100; ///< the minimum time of each repetition
+		int repetitions_ = 5; ///< the number of timed repetitions
+		std::string filter_ = ""; ///< only benchmarks whose name contains the filter are run
+		long max_iterations_ = 10000000; ///< cap on the number of ops per repetition
+		std::vector<BenchmarkResult> results_;
+	};
+}
+
+#endif //SMARTPEAK_BENCHMARK_H
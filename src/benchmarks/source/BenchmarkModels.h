@@ -0,0 +1,94 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_BENCHMARKMODELS_H
+#define SMARTPEAK_BENCHMARKMODELS_H
+
+#include <SmartPeak/ml/ModelBuilder.h>
+#include <SmartPeak/ml/Model.h>
+
+#include <random>
+
+/*
+@brief Models that are shared between the interpreter and trainer benchmarks
+*/
+namespace SmartPeak
+{
+	/// Assign reproducible trainable weights (i.e., instead of seeding each weight init op from std::random_device)
+	inline void setWeightsReproducible(Model<float>& model, const int& fan_in)
+	{
+		std::mt19937 engine(1);
+		std::normal_distribution<float> distribution(0.0f, 1.0f / std::sqrt(float(fan_in)));
+		for (auto& weight_map : model.getWeightsMap()) {
+			if (weight_map.second->getSolverOp()->getName() == "DummySolverOp") continue;
+			weight_map.second->setWeight(distribution(engine));
+			weight_map.second->setInitWeight(false);
+		}
+	}
+
+	/// Input -> 2 fully connected ReLU layers -> linear output layer (all with n_nodes nodes)
+	inline Model<float> makeModelFullyConnected(const int& n_nodes)
+	{
+		Model<float> model;
+		model.setName("FullyConnected");
+		ModelBuilder<float> model_builder;
+		std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", n_nodes, true);
+		for (const std::string& layer_name : { "FC0", "FC1" }) {
+			node_names = model_builder.addFullyConnected(model, layer_name, layer_name, node_names, n_nodes,
+				std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()),
+				std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+				std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(n_nodes)), std::make_shared<AdamOp<float>>(AdamOp<float>(1e-3, 0.9, 0.999, 1e-8)), 0.0f, 0.0f, true, true);
+		}
+		node_names = model_builder.addFullyConnected(model, "Output", "Output", node_names, n_nodes,
+			std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()),
+			std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+			std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(n_nodes)), std::make_shared<AdamOp<float>>(AdamOp<float>(1e-3, 0.9, 0.999, 1e-8)), 0.0f, 0.0f, true, true);
+		for (const std::string& node_name : node_names)
+			model.getNodesMap().at(node_name)->setType(NodeType::output);
+		setWeightsReproducible(model, n_nodes);
+		return model;
+	}
+
+	/// Input -> LSTM layer with n_units (one cell per block or fused) -> linear output node
+	inline Model<float> makeModelLSTM(const int& n_inputs, const int& n_units, const bool& fused)
+	{
+		Model<float> model;
+		model.setName(fused ? "LSTMFused" : "LSTM");
+		ModelBuilder<float> model_builder;
+		std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", n_inputs, true);
+		if (fused) {
+			node_names = model_builder.addLSTMFused(model, "LSTM", "LSTM", node_names, n_units,
+				std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(n_inputs + n_units)), std::make_shared<AdamOp<float>>(AdamOp<float>(1e-3, 0.9, 0.999, 1e-8)),
+				0.0f, true, true, true);
+		}
+		else {
+			node_names = model_builder.addLSTM(model, "LSTM", "LSTM", node_names, n_units, 1,
+				std::make_shared<TanHOp<float>>(TanHOp<float>()), std::make_shared<TanHGradOp<float>>(TanHGradOp<float>()),
+				std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+				std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(n_inputs + n_units)), std::make_shared<AdamOp<float>>(AdamOp<float>(1e-3, 0.9, 0.999, 1e-8)),
+				0.0f, 0.0f, true, true, 1, true, true);
+		}
+		node_names = model_builder.addFullyConnected(model, "Output", "Output", node_names, 1,
+			std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()),
+			std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+			std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(n_units)), std::make_shared<AdamOp<float>>(AdamOp<float>(1e-3, 0.9, 0.999, 1e-8)), 0.0f, 0.0f, true, true);
+		for (const std::string& node_name : node_names)
+			model.getNodesMap().at(node_name)->setType(NodeType::output);
+		setWeightsReproducible(model, n_inputs + n_units);
+		return model;
+	}
+
+	/// Names of the nodes of a module in the order of their index (e.g., "Input_000000000000")
+	inline std::vector<std::string> makeNodeNames(const std::string& module_name, const int& n_nodes)
+	{
+		std::vector<std::string> node_names;
+		for (int node_iter = 0; node_iter < n_nodes; ++node_iter) {
+			char* node_name_char = new char[512];
+			sprintf(node_name_char, "%s_%012d", module_name.data(), node_iter);
+			node_names.push_back(std::string(node_name_char));
+			delete[] node_name_char;
+		}
+		return node_names;
+	}
+}
+
+#endif //SMARTPEAK_BENCHMARKMODELS_H
@@ -0,0 +1,158 @@
+/**TODO:  Add copyright*/
+
+#include "Benchmark.h"
+
+#include <SmartPeak/ml/ActivationFunctionTensor.h>
+#include <SmartPeak/ml/IntegrationFunctionTensor.h>
+#include <SmartPeak/ml/SolverTensor.h>
+
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <memory>
+
+using namespace SmartPeak;
+
+/*
+@brief Micro benchmarks of the tensor ops that are executed for every layer by the model interpreter
+
+Times the following ops on the DefaultDevice for several layer sizes:
+1. integration: forward (Sum, Prod), error (Sum), and weight gradient (Sum) ops of a fully connected layer
+2. activation: forward and gradient ops of a layer
+3. solvers: weight updates of a fully connected layer
+
+Usage:
+	Kernels_benchmark [min_time_ms] [repetitions] [filter]
+*/
+
+const int batch_size = 32;
+const int memory_size = 2;
+const std::vector<int> layer_sizes = { 32, 256, 1024 };
+
+/// Description of the size of a fully connected layer
+std::string makeSizeString(const int& source_layer_size, const int& sink_layer_size)
+{
+	return "batch=" + std::to_string(batch_size) + ";memory=" + std::to_string(memory_size) + ";source=" + std::to_string(source_layer_size) + ";sink=" + std::to_string(sink_layer_size);
+}
+
+void benchmarkIntegration(BenchmarkRunner& runner)
+{
+	Eigen::DefaultDevice device;
+	for (const int& layer_size : layer_sizes) {
+		const std::string size = makeSizeString(layer_size, layer_size);
+		const double flops_fc = 2.0 * batch_size * layer_size * layer_size; // one time-step
+
+		// source/sink layers (dim0: batch, dim1: memory, dim2: layer) and the weights (dim0: source, dim1: sink)
+		Eigen::Tensor<float, 3> source_output(batch_size, memory_size, layer_size), source_input(batch_size, memory_size, layer_size),
+			sink_input(batch_size, memory_size, layer_size), sink_output(batch_size, memory_size, layer_size),
+			sink_error(batch_size, memory_size, layer_size), sink_derivative(batch_size, memory_size, layer_size), source_error(batch_size, memory_size, layer_size);
+		Eigen::Tensor<float, 2> weights(layer_size, layer_size), weight_error(layer_size, layer_size);
+		source_output.setRandom(); source_input.setRandom(); sink_output.setRandom(); sink_derivative.setRandom(); source_error.setRandom();
+		weights.setRandom();
+		sink_input.setZero(); sink_error.setZero(); weight_error.setZero();
+
+		SumTensorOp<float, Eigen::DefaultDevice> sum_op;
+		runner.run(sum_op.getName(), size, flops_fc, "flop/s", [&]() {
+			sum_op(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, layer_size, layer_size, 0, 1, device);
+		});
+		// the Prod op allocates a [batch, source, sink] buffer so it is only run for the smaller layers
+		if (layer_size <= 256) {
+			// unit values so that the products do not under/overflow
+			Eigen::Tensor<float, 3> prod_source_output(batch_size, memory_size, layer_size), prod_sink_input(batch_size, memory_size, layer_size);
+			Eigen::Tensor<float, 2> prod_weights(layer_size, layer_size);
+			prod_source_output.setConstant(1); prod_sink_input.setConstant(1); prod_weights.setConstant(1);
+			ProdTensorOp<float, Eigen::DefaultDevice> prod_op;
+			runner.run(prod_op.getName(), size, flops_fc, "flop/s", [&]() {
+				prod_op(prod_source_output.data(), prod_weights.data(), prod_sink_input.data(), batch_size, memory_size, layer_size, layer_size, 0, 1, device);
+			});
+		}
+		SumErrorTensorOp<float, Eigen::DefaultDevice> sum_error_op;
+		runner.run(sum_error_op.getName(), size, flops_fc, "flop/s", [&]() {
+			sum_error_op(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(),
+				layer_size, batch_size, memory_size, layer_size, layer_size, 0, 1, device);
+		});
+		SumWeightGradTensorOp<float, Eigen::DefaultDevice> sum_weight_grad_op;
+		runner.run(sum_weight_grad_op.getName(), size, flops_fc * memory_size, "flop/s", [&]() {
+			sum_weight_grad_op(sink_error.data(), source_output.data(), weights.data(), source_input.data(), weight_error.data(),
+				layer_size, batch_size, memory_size, layer_size, layer_size, device);
+		});
+	}
+}
+
+void benchmarkActivation(BenchmarkRunner& runner)
+{
+	Eigen::DefaultDevice device;
+	for (const int& layer_size : layer_sizes) {
+		const std::string size = "batch=" + std::to_string(batch_size) + ";memory=" + std::to_string(memory_size) + ";layer=" + std::to_string(layer_size);
+		const double n_elements = double(batch_size) * layer_size; // one time-step
+
+		Eigen::Tensor<float, 3> x_I(batch_size, memory_size, layer_size), x_O(batch_size, memory_size, layer_size);
+		x_I.setRandom();
+		x_I = x_I - x_I.constant(0.5f);
+		x_O.setZero();
+
+		const std::vector<std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>>> activation_ops = {
+			std::make_shared<ReLUTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<ReLUGradTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<ELUTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<SigmoidTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<SigmoidGradTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<TanHTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<TanHGradTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<LinearTensorOp<float, Eigen::DefaultDevice>>(),
+			std::make_shared<ExponentialTensorOp<float, Eigen::DefaultDevice>>()
+		};
+		for (const std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>>& activation_op : activation_ops) {
+			runner.run(activation_op->getName(), size, n_elements, "elements/s", [&]() {
+				(*activation_op)(x_I.data(), x_O.data(), batch_size, memory_size, layer_size, 0, device);
+			});
+		}
+	}
+}
+
+void benchmarkSolver(BenchmarkRunner& runner)
+{
+	Eigen::DefaultDevice device;
+	for (const int& layer_size : layer_sizes) {
+		const std::string size = "source=" + std::to_string(layer_size) + ";sink=" + std::to_string(layer_size);
+		const double n_weights = double(layer_size) * layer_size;
+
+		Eigen::Tensor<float, 2> weights(layer_size, layer_size), errors(layer_size, layer_size);
+		weights.setRandom();
+		errors.setRandom();
+		errors = errors * errors.constant(1e-3f);
+
+		// solver params (dim2: learning rate, momentum, momentum_prev)
+		Eigen::Tensor<float, 3> sgd_params(layer_size, layer_size, 3);
+		sgd_params.chip(0, 2).setConstant(1e-3f);
+		sgd_params.chip(1, 2).setConstant(0.9f);
+		sgd_params.chip(2, 2).setZero();
+		SGDTensorOp<float, Eigen::DefaultDevice> sgd_op;
+		int sgd_iter = 0;
+		runner.run(sgd_op.getName(), size, n_weights, "weights/s", [&]() {
+			sgd_op(weights.data(), errors.data(), sgd_params.data(), layer_size, layer_size, sgd_iter++, device);
+		});
+
+		// solver params (dim2: learning rate, momentum, mementum2, delta, momentum_prev, momentum2_prev)
+		Eigen::Tensor<float, 3> adam_params(layer_size, layer_size, 6);
+		adam_params.chip(0, 2).setConstant(1e-3f);
+		adam_params.chip(1, 2).setConstant(0.9f);
+		adam_params.chip(2, 2).setConstant(0.999f);
+		adam_params.chip(3, 2).setConstant(1e-8f);
+		adam_params.chip(4, 2).setZero();
+		adam_params.chip(5, 2).setZero();
+		AdamTensorOp<float, Eigen::DefaultDevice> adam_op;
+		int adam_iter = 0;
+		runner.run(adam_op.getName(), size, n_weights, "weights/s", [&]() {
+			adam_op(weights.data(), errors.data(), adam_params.data(), layer_size, layer_size, adam_iter++, device);
+		});
+	}
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkRunner runner(argc, argv);
+	benchmarkIntegration(runner);
+	benchmarkActivation(runner);
+	benchmarkSolver(runner);
+	return 0;
+}
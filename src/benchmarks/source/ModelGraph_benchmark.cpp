@@ -0,0 +1,89 @@
+/**TODO:  Add copyright*/
+
+#include "Benchmark.h"
+#include "BenchmarkModels.h"
+
+#include <SmartPeak/ml/ModelInterpreterDefaultDevice.h>
+#include <SmartPeak/ml/ModelReplicator.h>
+#include <SmartPeak/ml/ModelGraph.h>
+
+using namespace SmartPeak;
+
+/*
+@brief Benchmark of the model graph operations for large models
+
+Times the following operations on fully connected models of increasing size:
+1. making the integer indexed model graph
+2. interpreting the model (i.e., compiling the forward propogation operations and allocating the tensors)
+3. finding the cycles of the model
+4. mutating the model (node additions and link additions/deletions)
+5. checking that the inputs and outputs are connected
+6. removing the isolated nodes and pruning the model
+
+The throughput is the number of links per second.
+
+Usage:
+	ModelGraph_benchmark [min_time_ms] [repetitions] [filter]
+*/
+
+int main(int argc, char** argv)
+{
+	BenchmarkRunner runner(argc, argv);
+	const int batch_size = 2, memory_size = 1, n_mutations = 10;
+
+	for (const int& n_nodes : { 16, 64, 128 }) {
+		Model<float> model = makeModelFullyConnected(n_nodes);
+		model.setInputAndOutputNodes();
+		const double n_links = model.links_.size();
+		const std::string size = "nodes=" + std::to_string(model.nodes_.size()) + ";links=" + std::to_string(model.links_.size());
+
+		// model graph
+		runner.run("ModelGraph", size, n_links, "links/s", [&]() {
+			ModelGraph<float> graph(model);
+		});
+
+		// interpretation
+		ModelResources model_resources = { ModelDevice(0, 1) };
+		ModelInterpreterDefaultDevice<float> model_interpreter(model_resources);
+		runner.run("getForwardPropogationOperations", size, n_links, "links/s", [&]() {
+			model_interpreter.clear_cache();
+			model.initNodeTensorIndices();
+			model.initWeightTensorIndices();
+		}, [&]() {
+			model_interpreter.getForwardPropogationOperations(model, batch_size, memory_size, true, true, false, true);
+		});
+		model_interpreter.clear_cache();
+		model.initNodeTensorIndices();
+		model.initWeightTensorIndices();
+
+		// cycles
+		runner.run("findCycles", size, n_links, "links/s", [&]() {
+			model.findCycles();
+		});
+
+		// mutation (on a fresh copy of the model for each op)
+		Model<float> model_copy;
+		ModelReplicator<float> model_replicator;
+		model_replicator.setNNodeDownAdditions(n_mutations);
+		model_replicator.setNNodeRightAdditions(n_mutations);
+		model_replicator.setNLinkAdditions(n_mutations);
+		model_replicator.setNLinkDeletions(n_mutations);
+		runner.run("modifyModel", size, n_links, "links/s", [&]() {
+			model_copy = model;
+		}, [&]() {
+			model_replicator.modifyModel(model_copy, "bench");
+		});
+
+		// validity checks and pruning
+		runner.run("checkCompleteInputToOutput", size, n_links, "links/s", [&]() {
+			model.checkCompleteInputToOutput();
+		});
+		runner.run("removeIsolatedNodesAndPruneModel", size, n_links, "links/s", [&]() {
+			model_copy = model;
+		}, [&]() {
+			model_copy.removeIsolatedNodes();
+			model_copy.pruneModel();
+		});
+	}
+	return 0;
+}
@@ -0,0 +1,95 @@
+/**TODO:  Add copyright*/
+
+#include "Benchmark.h"
+#include "BenchmarkModels.h"
+
+#include <SmartPeak/ml/ModelInterpreterDefaultDevice.h>
+
+using namespace SmartPeak;
+
+/*
+@brief Benchmark of the forward and back propogation of the model interpreter on the DefaultDevice
+
+Times the following operations on a fully connected (DAG) model and on LSTM (DCG) models at several sizes:
+1. FPTT (forward propogation through time)
+2. TBPTT (truncated back propogation through time) after the forward propogation and the error calculation
+3. updateWeights after the back propogation
+
+The throughput is the number of sequences (i.e., batch_size) per second.
+
+Usage:
+	ModelInterpreter_benchmark [min_time_ms] [repetitions] [filter]
+*/
+
+void benchmarkModel(BenchmarkRunner& runner, Model<float>& model, const int& n_inputs, const int& n_outputs, const int& batch_size, const int& memory_size)
+{
+	const std::string model_name = model.getName();
+	if (!runner.isSelected(model_name + "-FPTT") && !runner.isSelected(model_name + "-TBPTT") && !runner.isSelected(model_name + "-updateWeights")) return;
+
+	// compile the graph into a set of operations and allocate all tensors (the layers are specified so the fast check can be used)
+	ModelInterpreterDefaultDevice<float> model_interpreter;
+	model_interpreter.getForwardPropogationOperations(model, batch_size, memory_size, true, true, true, true);
+	model_interpreter.allocateModelErrorTensor(batch_size, memory_size, 0);
+	const std::string size = "batch=" + std::to_string(batch_size) + ";memory=" + std::to_string(memory_size) +
+		";nodes=" + std::to_string(model.getNodesMap().size()) + ";links=" + std::to_string(model.getLinksMap().size());
+
+	// reproducible input and expected output
+	const std::vector<std::string> input_nodes = makeNodeNames("Input", n_inputs);
+	const std::vector<std::string> output_nodes = makeNodeNames("Output", n_outputs);
+	std::mt19937 engine(1);
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+	Eigen::Tensor<float, 3> input(batch_size, memory_size, n_inputs), expected(batch_size, memory_size, n_outputs);
+	for (int i = 0; i < input.size(); ++i) input.data()[i] = distribution(engine);
+	for (int i = 0; i < expected.size(); ++i) expected.data()[i] = distribution(engine);
+	std::shared_ptr<LossFunctionOp<float>> loss_function = std::make_shared<MSELossOp<float>>(MSELossOp<float>());
+	std::shared_ptr<LossFunctionGradOp<float>> loss_function_grad = std::make_shared<MSELossGradOp<float>>(MSELossGradOp<float>());
+
+	auto mapInput = [&]() {
+		model_interpreter.reInitNodes();
+		model_interpreter.reInitModelError();
+		model_interpreter.initBiases(model);
+		model_interpreter.mapValuesToLayers(model, input, input_nodes, "output");
+	};
+	auto forwardAndError = [&]() {
+		mapInput();
+		model_interpreter.FPTT(memory_size);
+		model_interpreter.CETT(model, expected, output_nodes, loss_function, loss_function_grad, memory_size);
+	};
+	int iter = 0;
+	runner.run(model_name + "-FPTT", size, batch_size, "sequences/s", mapInput, [&]() {
+		model_interpreter.FPTT(memory_size);
+	});
+	runner.run(model_name + "-TBPTT", size, batch_size, "sequences/s", forwardAndError, [&]() {
+		model_interpreter.TBPTT(memory_size);
+	});
+	runner.run(model_name + "-updateWeights", size, batch_size, "sequences/s", [&]() {
+		forwardAndError();
+		model_interpreter.TBPTT(memory_size);
+	}, [&]() {
+		model_interpreter.updateWeights(iter++);
+	});
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkRunner runner(argc, argv);
+	const int batch_size = 32;
+
+	// DAG
+	for (const int& n_nodes : { 16, 64, 256 }) {
+		Model<float> model = makeModelFullyConnected(n_nodes);
+		benchmarkModel(runner, model, n_nodes, n_nodes, batch_size, 1);
+	}
+
+	// DCG
+	const int n_inputs = 4, memory_size = 8;
+	for (const int& n_units : { 4, 16, 64 }) {
+		Model<float> model = makeModelLSTM(n_inputs, n_units, false);
+		benchmarkModel(runner, model, n_inputs, 1, batch_size, memory_size);
+	}
+	for (const int& n_units : { 4, 16, 64 }) {
+		Model<float> model = makeModelLSTM(n_inputs, n_units, true);
+		benchmarkModel(runner, model, n_inputs, 1, batch_size, memory_size);
+	}
+	return 0;
+}
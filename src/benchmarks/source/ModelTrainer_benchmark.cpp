@@ -0,0 +1,86 @@
+/**TODO:  Add copyright*/
+
+#include "Benchmark.h"
+#include "BenchmarkModels.h"
+
+#include <SmartPeak/ml/ModelTrainerDefaultDevice.h>
+#include <SmartPeak/ml/ModelInterpreterDefaultDevice.h>
+
+using namespace SmartPeak;
+
+/*
+@brief Benchmark of the model trainer on the DefaultDevice
+
+Times `trainModel` (i.e., model interpretation followed by n_epochs of FPTT, CETT, TBPTT, and weight updates)
+	on a fully connected (DAG) model and a fused LSTM (DCG) model at several sizes.
+
+The throughput is the number of trained sequences (i.e., batch_size * n_epochs) per second.
+
+Usage:
+	ModelTrainer_benchmark [min_time_ms] [repetitions] [filter]
+*/
+
+template<typename TensorT>
+class ModelTrainerExt : public ModelTrainerDefaultDevice<TensorT> {};
+
+void benchmarkTrainer(BenchmarkRunner& runner, const Model<float>& model_init, const int& n_inputs, const int& n_outputs, const int& batch_size, const int& memory_size, const int& n_epochs)
+{
+	const std::string name = model_init.getName() + "-trainModel";
+	if (!runner.isSelected(name)) return;
+
+	ModelTrainerExt<float> model_trainer;
+	model_trainer.setBatchSize(batch_size);
+	model_trainer.setMemorySize(memory_size);
+	model_trainer.setNEpochsTraining(n_epochs);
+	model_trainer.setVerbosityLevel(0);
+	model_trainer.setLogging(false, false);
+	model_trainer.setFastInterpreter(true); // the layers are specified
+	model_trainer.setFindCycles(model_init.getCyclicPairs().size() == 0); // manually specifying the cycles
+	const std::vector<std::string> input_nodes = makeNodeNames("Input", n_inputs);
+	const std::vector<std::string> output_nodes = makeNodeNames("Output", n_outputs);
+	LossFunctionHelper<float> loss_function_helper;
+	loss_function_helper.output_nodes_ = output_nodes;
+	loss_function_helper.loss_functions_ = { std::make_shared<MSELossOp<float>>(MSELossOp<float>()) };
+	loss_function_helper.loss_function_grads_ = { std::make_shared<MSELossGradOp<float>>(MSELossGradOp<float>()) };
+	model_trainer.setLossFunctionHelpers({ loss_function_helper });
+
+	// reproducible input and expected output
+	std::mt19937 engine(1);
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+	Eigen::Tensor<float, 4> input(batch_size, memory_size, n_inputs, n_epochs), output(batch_size, memory_size, n_outputs, n_epochs);
+	for (int i = 0; i < input.size(); ++i) input.data()[i] = distribution(engine);
+	for (int i = 0; i < output.size(); ++i) output.data()[i] = distribution(engine);
+	Eigen::Tensor<float, 3> time_steps(batch_size, memory_size, n_epochs);
+	time_steps.setConstant(1.0f);
+
+	const std::string size = "batch=" + std::to_string(batch_size) + ";memory=" + std::to_string(memory_size) + ";epochs=" + std::to_string(n_epochs) +
+		";nodes=" + std::to_string(model_init.getNodes().size());
+	Model<float> model;
+	runner.run(name, size, double(batch_size) * n_epochs, "sequences/s", [&]() {
+		model = Model<float>(model_init); // each op trains a (deep) copy of the same initial model
+	}, [&]() {
+		ModelInterpreterDefaultDevice<float> model_interpreter;
+		ModelLogger<float> model_logger;
+		model_trainer.trainModel(model, input, output, time_steps, input_nodes, model_logger, model_interpreter);
+	});
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkRunner runner(argc, argv);
+	const int batch_size = 32, n_epochs = 10;
+
+	// DAG
+	for (const int& n_nodes : { 16, 64 }) {
+		const Model<float> model = makeModelFullyConnected(n_nodes);
+		benchmarkTrainer(runner, model, n_nodes, n_nodes, batch_size, 1, n_epochs);
+	}
+
+	// DCG
+	const int n_inputs = 4, memory_size = 8;
+	for (const int& n_units : { 4, 32 }) {
+		const Model<float> model = makeModelLSTM(n_inputs, n_units, true);
+		benchmarkTrainer(runner, model, n_inputs, 1, batch_size, memory_size, n_epochs);
+	}
+	return 0;
+}
@@ -0,0 +1,101 @@
+/**TODO:  Add copyright*/
+
+#include "Benchmark.h"
+
+#include <SmartPeak/ml/ModelInterpreterDefaultDevice.h>
+#include <SmartPeak/ml/ModelBuilder.h>
+#include <SmartPeak/ml/OpToTensorOp.h>
+#include <SmartPeak/ml/Model.h>
+#include <SmartPeak/io/WeightFile.h>
+
+#include <cstdio>
+
+using namespace SmartPeak;
+
+/*
+@brief Benchmark of the conversion of ops to tensor ops for large models
+
+Times the following operations on wide models with n_width * (n_layers + 1) nodes (up to 10k nodes):
+1. interpreting the model (i.e., compiling the forward propogation operations and allocating the tensors)
+2. converting the activation op of every node using a single converter (the tensor ops are shared)
+3. converting the activation op of every node using a new converter for each node (the tensor ops are not shared)
+4. storing and loading the weights from a .csv file
+
+The throughput is the number of nodes (or weights) per second.
+
+Usage:
+	OpToTensorOp_benchmark [min_time_ms] [repetitions] [filter]
+*/
+
+Model<float> makeModelWide(const int& n_width, const int& n_layers)
+{
+	Model<float> model;
+	ModelBuilder<float> model_builder;
+	std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", n_width, true);
+	for (int layer_iter = 0; layer_iter < n_layers; ++layer_iter) {
+		const std::string layer_name = "SC" + std::to_string(layer_iter);
+		node_names = model_builder.addSinglyConnected(model, layer_name, layer_name, node_names, n_width,
+			std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()),
+			std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+			std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(1)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, 0.0f, false, true);
+	}
+	for (const std::string& node_name : node_names)
+		model.nodes_.at(node_name)->setType(NodeType::output);
+	model.setInputAndOutputNodes();
+	return model;
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkRunner runner(argc, argv);
+	const int n_layers = 3, batch_size = 2, memory_size = 1;
+	const std::string filename = "OpToTensorOp_benchmark_weights.csv";
+
+	for (const int& n_width : { 250, 2500 }) {
+		Model<float> model = makeModelWide(n_width, n_layers);
+		const double n_nodes = model.nodes_.size(), n_weights = model.weights_.size();
+		const std::string size = "nodes=" + std::to_string(model.nodes_.size()) + ";links=" + std::to_string(model.links_.size());
+
+		// interpretation
+		ModelResources model_resources = { ModelDevice(0, 1) };
+		ModelInterpreterDefaultDevice<float> model_interpreter(model_resources);
+		runner.run("getForwardPropogationOperations", size, n_nodes, "nodes/s", [&]() {
+			model_interpreter.clear_cache();
+			model.initNodeTensorIndices();
+			model.initWeightTensorIndices();
+		}, [&]() {
+			model_interpreter.getForwardPropogationOperations(model, batch_size, memory_size, true, true, false, true);
+		});
+
+		// conversion of the node activations
+		std::vector<std::shared_ptr<ActivationOp<float>>> activations;
+		for (auto& node_map : model.nodes_)
+			activations.push_back(node_map.second->getActivationShared());
+		ActivationOpToActivationTensorOp<float, Eigen::DefaultDevice> activation_conv;
+		runner.run("ActivationOpToActivationTensorOp-shared", size, n_nodes, "nodes/s", [&]() {
+			for (std::shared_ptr<ActivationOp<float>>& activation : activations)
+				activation_conv.convertOpToTensorOp(activation);
+		});
+		runner.run("ActivationOpToActivationTensorOp-unshared", size, n_nodes, "nodes/s", [&]() {
+			for (std::shared_ptr<ActivationOp<float>>& activation : activations) {
+				ActivationOpToActivationTensorOp<float, Eigen::DefaultDevice> activation_conv_tmp;
+				activation_conv_tmp.convertOpToTensorOp(activation);
+			}
+		});
+
+		// weights file
+		WeightFile<float> weight_file;
+		runner.run("storeWeightsCsv", size, n_weights, "weights/s", [&]() {
+			weight_file.storeWeightsCsv(filename, model.weights_);
+		});
+		if (runner.isSelected("loadWeightsCsv")) {
+			weight_file.storeWeightsCsv(filename, model.weights_);
+			runner.run("loadWeightsCsv", size, n_weights, "weights/s", [&]() {
+				std::map<std::string, std::shared_ptr<Weight<float>>> weights;
+				weight_file.loadWeightsCsv(filename, weights);
+			});
+		}
+	}
+	std::remove(filename.c_str());
+	return 0;
+}
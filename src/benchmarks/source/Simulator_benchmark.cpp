@@ -0,0 +1,106 @@
+/**TODO:  Add copyright*/
+
+#include "Benchmark.h"
+
+#include <SmartPeak/simulator/AddProbSimulator.h>
+#include <SmartPeak/simulator/ChromatogramSimulator.h>
+#include <SmartPeak/simulator/HarmonicOscillatorSimulator.h>
+
+#include <random>
+
+using namespace SmartPeak;
+
+/*
+@brief Benchmark of the batched data generation of the simulators
+
+Times the following on a single thread (so that the results do not depend on the number of cores) for several batch sizes:
+1. AddProbSimulator::AddProbBatch
+2. HarmonicOscillatorSimulator::WeightSpring1W1S1DwDampingBatch and WeightSpring3W2S1DBatch
+3. ChromatogramSimulator::simulateChromatograms
+
+The throughput is the number of simulated sequences (i.e., batch_size) per second.
+
+Usage:
+	Simulator_benchmark [min_time_ms] [repetitions] [filter]
+*/
+
+template<typename TensorT>
+class ChromatogramSimulatorExt : public ChromatogramSimulator<TensorT>
+{
+public:
+	void simulateTrainingData(Eigen::Tensor<TensorT, 4>& input_data, Eigen::Tensor<TensorT, 4>& output_data, Eigen::Tensor<TensorT, 3>& time_steps) override {};
+	void simulateValidationData(Eigen::Tensor<TensorT, 4>& input_data, Eigen::Tensor<TensorT, 4>& output_data, Eigen::Tensor<TensorT, 3>& time_steps) override {};
+	void simulateEvaluationData(Eigen::Tensor<TensorT, 4>& input_data, Eigen::Tensor<TensorT, 3>& time_steps) override {};
+};
+
+const std::vector<int> batch_sizes = { 32, 256, 2048 };
+
+void benchmarkAddProb(BenchmarkRunner& runner)
+{
+	const int sequence_length = 100, n_masks = 2;
+	for (const int& batch_size : batch_sizes) {
+		const std::string size = "batch=" + std::to_string(batch_size) + ";sequence_length=" + std::to_string(sequence_length);
+		Eigen::Tensor<float, 2> random_sequences(batch_size, sequence_length), mask_sequences(batch_size, sequence_length);
+		Eigen::Tensor<float, 1> results(batch_size);
+		std::mt19937 engine(1);
+		runner.run("AddProbBatch", size, batch_size, "sequences/s", [&]() {
+			AddProbSimulator<float>::AddProbBatch(random_sequences, mask_sequences, results, n_masks, engine);
+		});
+	}
+}
+
+void benchmarkHarmonicOscillator(BenchmarkRunner& runner)
+{
+	const int n_time_steps = 100;
+	const float time_intervals = 0.1f;
+	for (const int& batch_size : batch_sizes) {
+		const std::string size = "batch=" + std::to_string(batch_size) + ";time_steps=" + std::to_string(n_time_steps);
+		std::mt19937 engine(1);
+		auto makeParameters = [&](const float& lb, const float& ub) {
+			return HarmonicOscillatorSimulator<float>::makeRandomParameters(batch_size, std::make_pair(lb, ub), engine);
+		};
+		Eigen::Tensor<float, 1> time_steps(n_time_steps);
+
+		// 1 weight and 1 spring with under, critical, and over damping
+		const Eigen::Tensor<float, 1> m1 = makeParameters(0.5f, 2.0f), k1 = makeParameters(0.5f, 2.0f), beta1 = makeParameters(0.0f, 4.0f),
+			x1o = makeParameters(-1.0f, 1.0f), v1o = makeParameters(-1.0f, 1.0f);
+		Eigen::Tensor<float, 3> displacements_1W(batch_size, n_time_steps, 1);
+		runner.run("WeightSpring1W1S1DwDampingBatch", size, batch_size, "sequences/s", [&]() {
+			HarmonicOscillatorSimulator<float>::WeightSpring1W1S1DwDampingBatch(time_steps, displacements_1W, time_intervals, m1, k1, beta1, x1o, v1o);
+		});
+
+		// 3 weights and 2 springs
+		const Eigen::Tensor<float, 1> A1 = makeParameters(0.5f, 1.5f), A2 = makeParameters(0.5f, 1.5f), A3 = makeParameters(0.5f, 1.5f),
+			m = makeParameters(0.5f, 2.0f), x1 = makeParameters(-0.5f, 0.5f), x2 = makeParameters(-0.5f, 0.5f), x3 = makeParameters(-0.5f, 0.5f), k = makeParameters(0.5f, 2.0f);
+		Eigen::Tensor<float, 3> displacements_3W(batch_size, n_time_steps, 3);
+		runner.run("WeightSpring3W2S1DBatch", size, batch_size, "sequences/s", [&]() {
+			HarmonicOscillatorSimulator<float>::WeightSpring3W2S1DBatch(time_steps, displacements_3W, time_intervals, A1, A2, A3, m, m, m, x1, x2, x3, k);
+		});
+	}
+}
+
+void benchmarkChromatogram(BenchmarkRunner& runner)
+{
+	const int memory_size = 1, n_points = 128;
+	ChromatogramSimulatorExt<float> chrom_simulator;
+	for (const int& batch_size : batch_sizes) {
+		const std::string size = "batch=" + std::to_string(batch_size) + ";memory=" + std::to_string(memory_size) + ";points=" + std::to_string(n_points);
+		Eigen::Tensor<float, 3> input_data(batch_size, memory_size, n_points), loss_output_data(batch_size, memory_size, n_points), metric_output_data(batch_size, memory_size, n_points);
+		runner.run("simulateChromatograms", size, double(batch_size) * memory_size, "sequences/s", [&]() {
+			chrom_simulator.simulateChromatograms(input_data, loss_output_data, metric_output_data, "IsPeak",
+				std::make_pair(1.0f, 1.0f), std::make_pair(0.0f, 0.0f), std::make_pair(100.0f, 150.0f),
+				std::make_pair(0.0f, 0.0f), std::make_pair(0.0f, 0.05f), std::make_pair(0.0f, 1.0f),
+				std::make_pair(1.0f, 10.0f), std::make_pair(1.0f, 10.0f), std::make_pair(0.0f, 1.0f), std::make_pair(0.0f, 1.0f), std::make_pair(1.0f, 5.0f),
+				100.0f, 1);
+		});
+	}
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkRunner runner(argc, argv);
+	benchmarkAddProb(runner);
+	benchmarkHarmonicOscillator(runner);
+	benchmarkChromatogram(runner);
+	return 0;
+}
@@ -75,23 +75,22 @@ public:
     const int sequence_length = n_input_nodes / 2;
     assert(sequence_length == this->sequence_length_);
 
+    // generate a new sequence for each batch
+    Eigen::Tensor<TensorT, 2> random_sequences(batch_size, this->sequence_length_);
+    Eigen::Tensor<TensorT, 2> mask_sequences(batch_size, this->sequence_length_);
+    Eigen::Tensor<TensorT, 1> results(batch_size);
+    this->AddProbBatch(random_sequences, mask_sequences, results, this->n_mask_, this->engine_);
+
     // Generate the input and output data for training
-    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
-
-      // generate a new sequence 
-      Eigen::Tensor<TensorT, 1> random_sequence(this->sequence_length_);
-      Eigen::Tensor<TensorT, 1> mask_sequence(this->sequence_length_);
-      float result = this->AddProb(random_sequence, mask_sequence, this->n_mask_);
-
-      for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
-        for (int nodes_iter = 0; nodes_iter < n_input_nodes / 2; ++nodes_iter) {
-          input_data(batch_iter, memory_iter, nodes_iter) = random_sequence(nodes_iter); // random sequence
-          input_data(batch_iter, memory_iter, nodes_iter + n_input_nodes / 2) = mask_sequence(nodes_iter); // mask sequence
-        }
-        for (int nodes_iter = 0; nodes_iter < n_output_nodes; ++nodes_iter) {
-          output_data(batch_iter, memory_iter, nodes_iter) = result;
-          metric_data(batch_iter, memory_iter, nodes_iter) = result;
-        }
+    const Eigen::array<Eigen::Index, 2> offsets_random = { 0, 0 };
+    const Eigen::array<Eigen::Index, 2> offsets_mask = { 0, sequence_length };
+    const Eigen::array<Eigen::Index, 2> extents = { batch_size, sequence_length };
+    for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+      input_data.chip(memory_iter, 1).slice(offsets_random, extents) = random_sequences; // random sequence
+      input_data.chip(memory_iter, 1).slice(offsets_mask, extents) = mask_sequences; // mask sequence
+      for (int nodes_iter = 0; nodes_iter < n_output_nodes; ++nodes_iter) {
+        output_data.chip(memory_iter, 1).chip(nodes_iter, 1) = results;
+        metric_data.chip(memory_iter, 1).chip(nodes_iter, 1) = results;
       }
     }
 
@@ -100,35 +100,24 @@ public:
     const int n_input_nodes = input_data.dimension(2);
     const int n_output_nodes = output_data.dimension(2);
 
-    // Generate the input and output data for training [BUG FREE]
-    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
-
-      // generate a new sequence 
-      // TODO: ensure that the this->sequence_length_ >= memory_size!
-      Eigen::Tensor<float, 1> random_sequence(this->sequence_length_);
-      Eigen::Tensor<float, 1> mask_sequence(this->sequence_length_);
-      float result = this->AddProb(random_sequence, mask_sequence, this->n_mask_);
-      Eigen::Tensor<float, 1> cumulative(this->sequence_length_);
-      cumulative.setZero();
-
-      float result_cumulative = 0.0;
-
-      for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
-        // determine the cumulative vector
-        result_cumulative += random_sequence(memory_iter) * mask_sequence(memory_iter);
-        cumulative(memory_iter) = result_cumulative;
-      }
-      //for (int memory_iter = memory_size - 1; memory_iter >= 0; --memory_iter) {
-      for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
-        // assign the input sequences
-        input_data(batch_iter, memory_iter, 0) = random_sequence(memory_size - memory_iter - 1); // random sequence
-        input_data(batch_iter, memory_iter, 1) = mask_sequence(memory_size - memory_iter - 1); // mask sequence
-
-        // assign the output
-        output_data(batch_iter, memory_iter, 0) = cumulative(memory_size - memory_iter - 1);
-        metric_data(batch_iter, memory_iter, 0) = cumulative(memory_size - memory_iter - 1);
-      }
-    }
+    // generate a new sequence for each batch
+    // TODO: ensure that the this->sequence_length_ >= memory_size!
+    Eigen::Tensor<TensorT, 2> random_sequences(batch_size, this->sequence_length_);
+    Eigen::Tensor<TensorT, 2> mask_sequences(batch_size, this->sequence_length_);
+    Eigen::Tensor<TensorT, 1> results(batch_size);
+    this->AddProbBatch(random_sequences, mask_sequences, results, this->n_mask_, this->engine_);
+
+    // Generate the input and output data for training (from the last to the first sequence element)
+    const Eigen::array<Eigen::Index, 2> offsets = { 0, 0 };
+    const Eigen::array<Eigen::Index, 2> extents = { batch_size, memory_size };
+    const Eigen::array<bool, 2> reverse_memory = { false, true };
+    Eigen::Tensor<TensorT, 2> random_memory = random_sequences.slice(offsets, extents);
+    Eigen::Tensor<TensorT, 2> mask_memory = mask_sequences.slice(offsets, extents);
+    Eigen::Tensor<TensorT, 2> cumulative = (random_memory * mask_memory).cumsum(1);
+    input_data.chip(0, 2) = random_memory.reverse(reverse_memory); // random sequence
+    input_data.chip(1, 2) = mask_memory.reverse(reverse_memory); // mask sequence
+    output_data.chip(0, 2) = cumulative.reverse(reverse_memory);
+    metric_data.chip(0, 2) = cumulative.reverse(reverse_memory);
 
     time_steps.setConstant(1.0f);
   }
@@ -63,31 +63,30 @@ public:
     const int n_input_nodes = input_data.dimension(2);
     const int n_output_nodes = output_data.dimension(2);
 
-    HarmonicOscillatorSimulator<float> WeightSpring;
     std::random_device rd{};
     std::mt19937 gen{ rd() };
     std::normal_distribution<> dist{ 0.0f, 1.0f };
 
-    // Generate the input and output data for training
-    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
-
-      // Simulate a 3 weight and 2 spring 1D harmonic system
-      // where the middle weight has been displaced by a random amount
-      Eigen::Tensor<float, 1> time_steps(memory_size);
-      Eigen::Tensor<float, 2> displacements(memory_size, 3);
-      WeightSpring.WeightSpring3W2S1D(time_steps, displacements, memory_size, 0.1,
-        1, 1, 1, //A
-        1, 1, 1, //m
-        0, dist(gen), 0, //xo
-        1);
-
-      for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
-        if (memory_iter >= memory_size - 1)	input_data(batch_iter, memory_iter, 0) = displacements(memory_size - 1 - memory_iter, 1); // m2
-        else input_data(batch_iter, memory_iter, 0) = TensorT(0);
-        output_data(batch_iter, memory_iter, 0) = displacements(memory_size - 1 - memory_iter, 0); // m1
-        output_data(batch_iter, memory_iter, 1) = displacements(memory_size - 1 - memory_iter, 2); // m3
-      }
-    }
+    // Simulate a batch of 3 weight and 2 spring 1D harmonic systems
+    // where the middle weight has been displaced by a random amount
+    Eigen::Tensor<float, 1> parameters(batch_size), x2o(batch_size), zeros(batch_size);
+    parameters.setConstant(1);
+    zeros.setZero();
+    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) x2o(batch_iter) = dist(gen);
+    Eigen::Tensor<float, 1> time_steps_displacements(memory_size);
+    Eigen::Tensor<float, 3> displacements(batch_size, memory_size, 3);
+    HarmonicOscillatorSimulator<float>::WeightSpring3W2S1DBatch(time_steps_displacements, displacements, 0.1,
+      parameters, parameters, parameters, //A
+      parameters, parameters, parameters, //m
+      zeros, x2o, zeros, //xo
+      parameters);
+
+    // Generate the input and output data for training (from the last to the first time-step)
+    Eigen::Tensor<float, 3> displacements_reversed = displacements.reverse(Eigen::array<bool, 3>({ false, true, false }));
+    input_data.setZero();
+    input_data.chip(memory_size - 1, 1).chip(0, 1) = displacements_reversed.chip(memory_size - 1, 1).chip(1, 1); // m2
+    output_data.chip(0, 2) = displacements_reversed.chip(0, 2); // m1
+    output_data.chip(1, 2) = displacements_reversed.chip(2, 2); // m3
     time_steps.setConstant(1.0f);
   }
   void simulateDataWeightSpring1W1S1D(Eigen::Tensor<TensorT, 4>& input_data, Eigen::Tensor<TensorT, 4>& output_data, Eigen::Tensor<TensorT, 3>& time_steps)
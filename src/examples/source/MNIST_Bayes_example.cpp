@@ -357,13 +357,12 @@ void main_MNIST(const ParameterTypes& ...args) {
   // read in the training data
   std::string training_data_filename = std::get<EvoNetParameters::General::DataDir>(parameters).get() + "train-images.idx3-ubyte";
   std::string training_labels_filename = std::get<EvoNetParameters::General::DataDir>(parameters).get() + "train-labels.idx1-ubyte";
-  data_simulator.readData(training_data_filename, training_labels_filename, true, training_data_size, input_size);
+  data_simulator.readDataMapped(training_data_filename, training_labels_filename, true, training_data_size, input_size, std::make_pair(0.0f, 1.0f), training_data_filename + ".cache");
 
   // read in the validation data
   std::string validation_data_filename = std::get<EvoNetParameters::General::DataDir>(parameters).get() + "t10k-images.idx3-ubyte";
   std::string validation_labels_filename = std::get<EvoNetParameters::General::DataDir>(parameters).get() + "t10k-labels.idx1-ubyte";
-  data_simulator.readData(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size);
-  data_simulator.unitScaleData();
+  data_simulator.readDataMapped(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size, std::make_pair(0.0f, 1.0f), validation_data_filename + ".cache");
 
   // Make the input nodes
   std::vector<std::string> input_nodes;
@@ -299,7 +299,7 @@ void main_AE(const bool& make_model, const bool& train_model) {
   training_labels_filename = "C:/Users/domccl/GitHub/mnist/train-labels.idx1-ubyte";
   //training_data_filename = "C:/Users/dmccloskey/Documents/GitHub/mnist/train-images-idx3-ubyte";
   //training_labels_filename = "C:/Users/dmccloskey/Documents/GitHub/mnist/train-labels-idx1-ubyte";
-  data_simulator.readData(training_data_filename, training_labels_filename, true, training_data_size, input_size);
+  data_simulator.readDataMapped(training_data_filename, training_labels_filename, true, training_data_size, input_size, std::make_pair(0.0f, 1.0f), training_data_filename + ".cache");
 
   // read in the validation data
   std::string validation_data_filename, validation_labels_filename;
@@ -309,8 +309,7 @@ void main_AE(const bool& make_model, const bool& train_model) {
   validation_labels_filename = "C:/Users/domccl/GitHub/mnist/t10k-labels.idx1-ubyte";
   //validation_data_filename = "C:/Users/dmccloskey/Documents/GitHub/mnist/t10k-images-idx3-ubyte";
   //validation_labels_filename = "C:/Users/dmccloskey/Documents/GitHub/mnist/t10k-labels-idx1-ubyte";
-  data_simulator.readData(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size);
-  data_simulator.unitScaleData();
+  data_simulator.readDataMapped(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size, std::make_pair(0.0f, 1.0f), validation_data_filename + ".cache");
 
   // Make the input nodes
   std::vector<std::string> input_nodes;
@@ -368,13 +368,12 @@ void main_MNIST(const std::string& data_dir, const bool& make_model, const bool&
   // read in the training data
   std::string training_data_filename = data_dir + "train-images.idx3-ubyte";
   std::string training_labels_filename = data_dir + "train-labels.idx1-ubyte";
-  data_simulator.readData(training_data_filename, training_labels_filename, true, training_data_size, input_size);
+  data_simulator.readDataMapped(training_data_filename, training_labels_filename, true, training_data_size, input_size, std::make_pair(0.0f, 1.0f), training_data_filename + ".cache");
 
   // read in the validation data
   std::string validation_data_filename = data_dir + "t10k-images.idx3-ubyte";
   std::string validation_labels_filename = data_dir + "t10k-labels.idx1-ubyte";
-  data_simulator.readData(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size);
-  data_simulator.unitScaleData();
+  data_simulator.readDataMapped(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size, std::make_pair(0.0f, 1.0f), validation_data_filename + ".cache");
 
   // Make the input nodes
   std::vector<std::string> input_nodes;
@@ -189,15 +189,14 @@ void main_EvoNet() {
 	// const std::string training_labels_filename = "C:/Users/domccl/GitHub/mnist/train-labels.idx1-ubyte";
 	const std::string training_data_filename = "/home/user/data/train-images-idx3-ubyte";
 	const std::string training_labels_filename = "/home/user/data/train-labels-idx1-ubyte";
-	data_simulator.readData(training_data_filename, training_labels_filename, true, training_data_size, input_size);
+	data_simulator.readDataMapped(training_data_filename, training_labels_filename, true, training_data_size, input_size, std::make_pair(0.0f, 1.0f), training_data_filename + ".cache");
 
 	// read in the validation data
 	// const std::string validation_data_filename = "C:/Users/domccl/GitHub/mnist/t10k-images.idx3-ubyte";
 	// const std::string validation_labels_filename = "C:/Users/domccl/GitHub/mnist/t10k-labels.idx1-ubyte";
 	const std::string validation_data_filename = "/home/user/data/t10k-images-idx3-ubyte";
 	const std::string validation_labels_filename = "/home/user/data/t10k-labels-idx1-ubyte";
-	data_simulator.readData(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size);
-	data_simulator.unitScaleData();
+	data_simulator.readDataMapped(validation_data_filename, validation_labels_filename, false, validation_data_size, input_size, std::make_pair(0.0f, 1.0f), validation_data_filename + ".cache");
 
 	// Make the input nodes
 	std::vector<std::string> input_nodes;
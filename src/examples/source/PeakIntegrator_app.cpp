@@ -142,81 +142,11 @@ class DataSimulatorExt : public ChromatogramSimulator<TensorT>
 public:
   void simulateChromData_(Eigen::Tensor<TensorT, 3>& input_data, Eigen::Tensor<TensorT, 3>& loss_output_data, Eigen::Tensor<TensorT, 3>& metric_output_data, Eigen::Tensor<TensorT, 2>& time_steps) 
   {
-    // infer data dimensions based on the input tensors
-    const int batch_size = input_data.dimension(0);
-    const int memory_size = input_data.dimension(1);
-    const int n_input_nodes = input_data.dimension(2);
-    const int n_output_nodes = loss_output_data.dimension(2);
-    const int n_metric_nodes = metric_output_data.dimension(2);
-    input_data.setZero();
-    loss_output_data.setZero();
-    metric_output_data.setZero();
-
-    if (this->output_data_type_ == "EMG") {
-      assert(n_output_nodes == 4);
-      assert(n_metric_nodes == 4);
-    }
-    else {
-      assert(n_output_nodes == n_input_nodes);
-      assert(n_metric_nodes == n_input_nodes);
-    }
-
-    // Reformat the Chromatogram for training
-    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
-      for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
-
-        std::vector<TensorT> chrom_time, chrom_intensity, chrom_time_test, chrom_intensity_test;
-        std::vector<std::pair<TensorT, TensorT>> best_lr;
-        std::vector<TensorT> peak_apices;
-        std::vector<EMGModel<TensorT>> emgs;
-
-        // make the chrom and noisy chrom
-        this->simulateChromatogram(chrom_time_test, chrom_intensity_test, chrom_time, chrom_intensity, best_lr, peak_apices, emgs,
-          step_size_mu_, step_size_sigma_, chrom_window_size_,
-          noise_mu_, noise_sigma_, baseline_height_,
-          n_peaks_, emg_h_, emg_tau_, emg_mu_offset_, emg_sigma_);
-
-        for (int nodes_iter = 0; nodes_iter < n_input_nodes; ++nodes_iter) {
-          input_data(batch_iter, memory_iter, nodes_iter) = chrom_intensity.at(nodes_iter);  //intensity
-          if (this->output_data_type_ == "Points") {
-            loss_output_data(batch_iter, memory_iter, nodes_iter) = chrom_intensity_test.at(nodes_iter);  //intensity
-            metric_output_data(batch_iter, memory_iter, nodes_iter) = chrom_intensity_test.at(nodes_iter);  //intensity
-          }
-          else if (this->output_data_type_ == "IsApex") {
-            TensorT isPeakApex = 0.0;
-            for (const TensorT& peak_apex : peak_apices) {
-              if (abs(chrom_time_test.at(nodes_iter) - peak_apex) < 1e-6) {
-                isPeakApex = 1.0;
-              }
-            }
-            loss_output_data(batch_iter, memory_iter, nodes_iter) = isPeakApex;  //IsPeakApex
-            metric_output_data(batch_iter, memory_iter, nodes_iter) = isPeakApex;  //IsPeakApex
-          }
-          else if (this->output_data_type_ == "IsPeak") {
-            TensorT isPeak = 0.0;
-            for (const std::pair<TensorT, TensorT>& lr : best_lr) {
-              if (chrom_time_test.at(nodes_iter) >= lr.first && chrom_time_test.at(nodes_iter) <= lr.second) {
-                isPeak = 1.0;
-              }
-            }
-            loss_output_data(batch_iter, memory_iter, nodes_iter) = isPeak;  //IsPeak
-            metric_output_data(batch_iter, memory_iter, nodes_iter) = isPeak;  //IsPeak
-          }
-        }
-        if (this->output_data_type_ == "EMG") {
-          for (int i = 0; i < emgs.size(); ++i) {
-            loss_output_data(batch_iter, memory_iter, i * 4) = emgs.at(i).getH();
-            metric_output_data(batch_iter, memory_iter, i * 4) = emgs.at(i).getH();
-            loss_output_data(batch_iter, memory_iter, i * 4 + 1) = emgs.at(i).getTau();
-            metric_output_data(batch_iter, memory_iter, i * 4 + 1) = emgs.at(i).getTau();
-            loss_output_data(batch_iter, memory_iter, i * 4 + 2) = emgs.at(i).getMu() / chrom_window_size_.first;
-            metric_output_data(batch_iter, memory_iter, i * 4 + 2) = emgs.at(i).getMu() / chrom_window_size_.first;
-            loss_output_data(batch_iter, memory_iter, i * 4 + 3) = emgs.at(i).getSigma() / chrom_window_size_.first;
-            metric_output_data(batch_iter, memory_iter, i * 4 + 3) = emgs.at(i).getSigma() / chrom_window_size_.first;
-          }
-        }
-      }
-    }
+    // simulate the chrom and noisy chrom of each batch and memory directly into the tensors
+    this->simulateChromatograms(input_data, loss_output_data, metric_output_data, this->output_data_type_,
+      step_size_mu_, step_size_sigma_, chrom_window_size_,
+      noise_mu_, noise_sigma_, baseline_height_,
+      n_peaks_, emg_h_, emg_tau_, emg_mu_offset_, emg_sigma_);
     time_steps.setConstant(1.0f);
   }
   void simulateTrainingData(Eigen::Tensor<TensorT, 3>& input_data, Eigen::Tensor<TensorT, 3>& loss_output_data, Eigen::Tensor<TensorT, 3>& metric_output_data, Eigen::Tensor<TensorT, 2>& time_steps) override {
@@ -311,6 +241,12 @@ void main_(const ParameterTypes& ...args) {
     data_simulator.emg_mu_offset_ = std::make_pair(0, 0);
     data_simulator.emg_sigma_ = std::make_pair(10, 10);
   }
+  if (std::get<EvoNetParameters::Examples::SimulationType>(parameters).get().find("Dense") != std::string::npos) {
+    // hundreds of co-eluting peaks
+    data_simulator.setDensePeaks(true);
+    data_simulator.n_peaks_ = std::make_pair(input_size / 4, input_size / 2);
+    data_simulator.emg_sigma_ = std::make_pair(1, 3);
+  }
 
   // Make the input nodes
   std::vector<std::string> input_nodes;
@@ -117,7 +117,7 @@ void CircuitFinder::run()
 	Stack.clear();
 	S = 1;
 
-	while (S < N) {
+	while (S <= N) {
 		for (int I = S; I <= N; ++I) {
 			Blocked[I - 1] = false;
 			B[I - 1].clear();
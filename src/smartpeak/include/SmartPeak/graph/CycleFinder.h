@@ -0,0 +1,187 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_CYCLEFINDER_H
+#define SMARTPEAK_CYCLEFINDER_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace SmartPeak
+{
+	/**
+		@brief Compressed sparse row (CSR) adjacency of a directed graph
+
+		Vertices are numbered 1 to n_nodes (as in the CircuitFinder) and the sinks of
+			vertex i are stored in targets[offsets[i - 1]] to targets[offsets[i] - 1]
+	*/
+	struct AdjacencyCSR
+	{
+		int n_nodes = 0;
+		std::vector<int> offsets; ///< size n_nodes + 1
+		std::vector<int> targets; ///< size n_edges
+
+		/**
+			@brief Build the CSR adjacency from a list of 1-based source/sink edges.
+				The order of the sinks of each vertex follows the order of the edges.
+
+			@param[in] n Number of vertices
+			@param[in] edges Source/sink pairs
+		*/
+		void build(const int& n, const std::vector<std::pair<int, int>>& edges)
+		{
+			n_nodes = n;
+			offsets.assign(n + 1, 0);
+			for (const auto& edge : edges) ++offsets[edge.first];
+			for (int i = 0; i < n; ++i) offsets[i + 1] += offsets[i];
+			targets.resize(edges.size());
+			std::vector<int> next(offsets.begin(), offsets.end() - 1);
+			for (const auto& edge : edges) targets[next[edge.first - 1]++] = edge.second;
+		}
+		int begin(const int& v) const { return offsets[v - 1]; }
+		int end(const int& v) const { return offsets[v]; }
+	};
+
+	/**
+		@brief Cycle finder that returns the same set of source/sink pairs as the CircuitFinder
+			without enumerating every elementary circuit
+
+		An edge u -> s is reported by the CircuitFinder if and only if it closes an elementary
+			circuit whose lowest numbered vertex is s, i.e., if s can reach u in the subgraph
+			induced by the vertices numbered s or higher.  The strongly connected components (SCCs)
+			are first found in linear time using an iterative version of Tarjan's algorithm.
+			Then, for each vertex s with an incoming edge from a vertex u >= s of the same SCC,
+			an iterative depth-first search from s restricted to the SCC and to the vertices >= s
+			reports all edges that lead back to the root s.
+
+		Each edge is reported only once (the CircuitFinder reports it once per circuit) and
+			acyclic parts of the graph are skipped after the SCC pass.  The run time is
+			O(V + E) for acyclic graphs and graphs with only simple cycles and O(V * E) in the
+			worst case compared to the exponential number of circuits enumerated by the CircuitFinder.
+			No recursion is used so that large recurrent networks do not exhaust the stack.
+
+		References:
+		R. Tarjan. Depth-first search and linear graph algorithms. SIAM J. Comput. Vol. 1, No. 2, June 1972
+	*/
+	class CycleFinder
+	{
+	public:
+		CycleFinder(const AdjacencyCSR& adj) : adj_(adj) {};
+		~CycleFinder() = default;
+
+		void run();
+		std::vector<std::pair<int, int>> getCycles() const { return cycles_; } ///< source/sink pairs of the edges that close a circuit
+		std::vector<int> getComponents() const { return component_; } ///< SCC index of each vertex (0-based vertex index)
+		int getNComponents() const { return n_components_; } ///< number of SCCs
+
+	private:
+		void findComponents();
+		void findClosingEdges();
+
+		const AdjacencyCSR& adj_;
+		std::vector<std::pair<int, int>> cycles_;
+		std::vector<int> component_;
+		int n_components_ = 0;
+	};
+
+	inline void CycleFinder::run()
+	{
+		cycles_.clear();
+		findComponents();
+		findClosingEdges();
+	}
+
+	inline void CycleFinder::findComponents()
+	{
+		const int n = adj_.n_nodes;
+		component_.assign(n, -1);
+		n_components_ = 0;
+		std::vector<int> index(n, -1), lowlink(n, 0);
+		std::vector<bool> on_stack(n, false);
+		std::vector<int> scc_stack;
+		std::vector<std::pair<int, int>> call_stack; // vertex/next edge position
+		int counter = 0;
+
+		for (int root = 1; root <= n; ++root) {
+			if (index[root - 1] >= 0) continue;
+			call_stack.emplace_back(root, adj_.begin(root));
+			index[root - 1] = lowlink[root - 1] = counter++;
+			scc_stack.push_back(root);
+			on_stack[root - 1] = true;
+
+			while (!call_stack.empty()) {
+				const int v = call_stack.back().first;
+				int& pos = call_stack.back().second;
+				if (pos < adj_.end(v)) {
+					const int w = adj_.targets[pos++];
+					if (index[w - 1] < 0) {
+						index[w - 1] = lowlink[w - 1] = counter++;
+						scc_stack.push_back(w);
+						on_stack[w - 1] = true;
+						call_stack.emplace_back(w, adj_.begin(w));
+					}
+					else if (on_stack[w - 1]) {
+						lowlink[v - 1] = std::min(lowlink[v - 1], index[w - 1]);
+					}
+					continue;
+				}
+
+				// all sinks visited
+				if (lowlink[v - 1] == index[v - 1]) {
+					int w;
+					do {
+						w = scc_stack.back();
+						scc_stack.pop_back();
+						on_stack[w - 1] = false;
+						component_[w - 1] = n_components_;
+					} while (w != v);
+					++n_components_;
+				}
+				call_stack.pop_back();
+				if (!call_stack.empty()) {
+					const int u = call_stack.back().first;
+					lowlink[u - 1] = std::min(lowlink[u - 1], lowlink[v - 1]);
+				}
+			}
+		}
+	}
+
+	inline void CycleFinder::findClosingEdges()
+	{
+		const int n = adj_.n_nodes;
+
+		// vertices that can be the lowest numbered vertex of a circuit
+		std::vector<bool> is_root(n, false);
+		for (int u = 1; u <= n; ++u)
+			for (int pos = adj_.begin(u); pos < adj_.end(u); ++pos) {
+				const int s = adj_.targets[pos];
+				if (s <= u && component_[s - 1] == component_[u - 1]) is_root[s - 1] = true;
+			}
+
+		std::vector<int> visited(n, 0); // stamp of the last search that visited the vertex
+		std::vector<std::pair<int, int>> call_stack; // vertex/next edge position
+		for (int s = 1; s <= n; ++s) {
+			if (!is_root[s - 1]) continue;
+			const int c = component_[s - 1];
+			call_stack.emplace_back(s, adj_.begin(s));
+			visited[s - 1] = s;
+			while (!call_stack.empty()) {
+				const int v = call_stack.back().first;
+				int& pos = call_stack.back().second;
+				if (pos < adj_.end(v)) {
+					const int w = adj_.targets[pos++];
+					if (w == s)
+						cycles_.emplace_back(v, s);
+					else if (w > s && component_[w - 1] == c && visited[w - 1] != s) {
+						visited[w - 1] = s;
+						call_stack.emplace_back(w, adj_.begin(w));
+					}
+					continue;
+				}
+				call_stack.pop_back();
+			}
+		}
+	}
+}
+
+#endif //SMARTPEAK_CYCLEFINDER_H
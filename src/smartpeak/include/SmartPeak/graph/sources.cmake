@@ -4,6 +4,7 @@ set(directory include/SmartPeak/graph)
 ### list all header files of the directory here
 set(sources_list_h
 	CircuitFinder.h
+	CycleFinder.h
 )
 
 ### add path to the filenames
@@ -0,0 +1,319 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_MESSAGETRANSPORT_H
+#define SMARTPEAK_MESSAGETRANSPORT_H
+
+// .h
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// .cpp
+#if !defined(_WIN32)
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace SmartPeak
+{
+  /**
+    @brief Base class for a bidirectional channel that exchanges whole messages between two endpoints
+      (e.g., the coordinator and a worker of a distributed population)
+  */
+  class MessageTransport
+  {
+  public:
+    MessageTransport() = default;
+    virtual ~MessageTransport() = default;
+
+    /**
+      @brief Send a message to the other endpoint
+
+      @returns True on success, False if the channel is closed or broken
+    */
+    virtual bool sendMessage(const std::string& message) = 0;
+
+    /**
+      @brief Receive the next message from the other endpoint
+
+      @param[out] message The message
+      @param[in] timeout_ms The time to wait for the message in milliseconds (or -1 to wait indefinitely)
+
+      @returns True on success, False if the channel is closed or broken or the timeout expired
+    */
+    virtual bool receiveMessage(std::string& message, const int& timeout_ms = -1) = 0;
+
+    /// Close the channel so that the other endpoint can no longer receive from it or send to it
+    virtual void closeTransport() = 0;
+  };
+
+  /**
+    @brief In-process transport backed by a pair of shared message queues
+      (e.g., for testing with workers that run in threads)
+  */
+  class LocalQueueTransport : public MessageTransport
+  {
+  public:
+    LocalQueueTransport() = default;
+    ~LocalQueueTransport() { closeTransport(); }
+
+    /**
+      @brief Make two connected endpoints
+    */
+    static std::pair<std::shared_ptr<LocalQueueTransport>, std::shared_ptr<LocalQueueTransport>> makeTransportPair();
+
+    bool sendMessage(const std::string& message) override;
+    bool receiveMessage(std::string& message, const int& timeout_ms = -1) override;
+    void closeTransport() override;
+
+  private:
+    struct Queue
+    {
+      std::mutex mutex;
+      std::condition_variable condition;
+      std::deque<std::string> messages;
+      bool closed = false;
+    };
+    std::shared_ptr<Queue> send_queue_;
+    std::shared_ptr<Queue> receive_queue_;
+  };
+
+  inline std::pair<std::shared_ptr<LocalQueueTransport>, std::shared_ptr<LocalQueueTransport>> LocalQueueTransport::makeTransportPair()
+  {
+    auto queue_1 = std::make_shared<Queue>();
+    auto queue_2 = std::make_shared<Queue>();
+    auto transport_1 = std::make_shared<LocalQueueTransport>();
+    auto transport_2 = std::make_shared<LocalQueueTransport>();
+    transport_1->send_queue_ = queue_1;
+    transport_1->receive_queue_ = queue_2;
+    transport_2->send_queue_ = queue_2;
+    transport_2->receive_queue_ = queue_1;
+    return std::make_pair(transport_1, transport_2);
+  }
+
+  inline bool LocalQueueTransport::sendMessage(const std::string& message)
+  {
+    if (!send_queue_) return false;
+    {
+      std::lock_guard<std::mutex> lock(send_queue_->mutex);
+      if (send_queue_->closed) return false;
+      send_queue_->messages.push_back(message);
+    }
+    send_queue_->condition.notify_one();
+    return true;
+  }
+
+  inline bool LocalQueueTransport::receiveMessage(std::string& message, const int& timeout_ms)
+  {
+    if (!receive_queue_) return false;
+    std::unique_lock<std::mutex> lock(receive_queue_->mutex);
+    auto ready = [this]() { return !receive_queue_->messages.empty() || receive_queue_->closed; };
+    if (timeout_ms < 0)
+      receive_queue_->condition.wait(lock, ready);
+    else if (!receive_queue_->condition.wait_for(lock, std::chrono::milliseconds(timeout_ms), ready))
+      return false;
+    if (receive_queue_->messages.empty()) return false; // closed
+    message = std::move(receive_queue_->messages.front());
+    receive_queue_->messages.pop_front();
+    return true;
+  }
+
+  inline void LocalQueueTransport::closeTransport()
+  {
+    for (auto& queue : { send_queue_, receive_queue_ }) {
+      if (!queue) continue;
+      {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->closed = true;
+      }
+      queue->condition.notify_all();
+    }
+  }
+
+#if !defined(_WIN32)
+  /**
+    @brief Transport over a Unix domain stream socket between two processes on the same host
+
+    Each message is framed by its length (8 bytes) followed by the message bytes.
+
+    Example use case:
+      // coordinator
+      const int listen_fd = UnixSocketTransport::listenSocket("/tmp/population.sock");
+      std::shared_ptr<UnixSocketTransport> worker_transport = UnixSocketTransport::acceptSocket(listen_fd);
+      // worker
+      std::shared_ptr<UnixSocketTransport> coordinator_transport = UnixSocketTransport::connectSocket("/tmp/population.sock");
+  */
+  class UnixSocketTransport : public MessageTransport
+  {
+  public:
+    UnixSocketTransport() = default;
+    explicit UnixSocketTransport(const int& socket_fd) : socket_fd_(socket_fd) {};
+    UnixSocketTransport(const UnixSocketTransport&) = delete;
+    UnixSocketTransport& operator=(const UnixSocketTransport&) = delete;
+    ~UnixSocketTransport() { closeTransport(); }
+
+    /**
+      @brief Make two connected endpoints (e.g., before forking a worker process)
+    */
+    static std::pair<std::shared_ptr<UnixSocketTransport>, std::shared_ptr<UnixSocketTransport>> makeSocketPair();
+
+    /**
+      @brief Create a listening socket bound to a path (any existing file at the path is removed)
+
+      @returns The file descriptor of the listening socket
+    */
+    static int listenSocket(const std::string& path, const int& backlog = 16);
+
+    /**
+      @brief Accept a connection on a listening socket
+
+      @param[in] listen_fd The file descriptor of the listening socket
+      @param[in] timeout_ms The time to wait for a connection in milliseconds (or -1 to wait indefinitely)
+
+      @returns The transport of the connection (or nullptr if no connection was made)
+    */
+    static std::shared_ptr<UnixSocketTransport> acceptSocket(const int& listen_fd, const int& timeout_ms = -1);
+
+    /**
+      @brief Connect to a listening socket
+
+      @returns The transport of the connection (or nullptr if no connection was made)
+    */
+    static std::shared_ptr<UnixSocketTransport> connectSocket(const std::string& path);
+
+    bool sendMessage(const std::string& message) override;
+    bool receiveMessage(std::string& message, const int& timeout_ms = -1) override;
+    void closeTransport() override;
+    int getSocketFd() const { return socket_fd_; }; ///< socket_fd getter
+
+  private:
+    bool writeAll_(const char* data, size_t size);
+    bool readAll_(char* data, size_t size, const int& timeout_ms);
+    int socket_fd_ = -1;
+  };
+
+  inline std::pair<std::shared_ptr<UnixSocketTransport>, std::shared_ptr<UnixSocketTransport>> UnixSocketTransport::makeSocketPair()
+  {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+      const std::string error = "Failed to create a socket pair: " + std::string(std::strerror(errno));
+      throw std::runtime_error(error);
+    }
+    return std::make_pair(std::make_shared<UnixSocketTransport>(fds[0]), std::make_shared<UnixSocketTransport>(fds[1]));
+  }
+
+  inline int UnixSocketTransport::listenSocket(const std::string& path, const int& backlog)
+  {
+    sockaddr_un address;
+    if (path.size() >= sizeof(address.sun_path)) {
+      const std::string error = "The socket path " + path + " is too long.";
+      throw std::runtime_error(error);
+    }
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    unlink(path.c_str());
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0 || bind(listen_fd, (sockaddr*)&address, sizeof(address)) != 0 || listen(listen_fd, backlog) != 0) {
+      const std::string error = "Failed to listen on the socket " + path + ": " + std::string(std::strerror(errno));
+      if (listen_fd >= 0) close(listen_fd);
+      throw std::runtime_error(error);
+    }
+    return listen_fd;
+  }
+
+  inline std::shared_ptr<UnixSocketTransport> UnixSocketTransport::acceptSocket(const int& listen_fd, const int& timeout_ms)
+  {
+    pollfd poll_fd = { listen_fd, POLLIN, 0 };
+    if (poll(&poll_fd, 1, timeout_ms) <= 0) return nullptr;
+    const int socket_fd = accept(listen_fd, nullptr, nullptr);
+    if (socket_fd < 0) return nullptr;
+    return std::make_shared<UnixSocketTransport>(socket_fd);
+  }
+
+  inline std::shared_ptr<UnixSocketTransport> UnixSocketTransport::connectSocket(const std::string& path)
+  {
+    sockaddr_un address;
+    if (path.size() >= sizeof(address.sun_path)) return nullptr;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    const int socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket_fd < 0) return nullptr;
+    if (connect(socket_fd, (sockaddr*)&address, sizeof(address)) != 0) {
+      close(socket_fd);
+      return nullptr;
+    }
+    return std::make_shared<UnixSocketTransport>(socket_fd);
+  }
+
+  inline bool UnixSocketTransport::sendMessage(const std::string& message)
+  {
+    if (socket_fd_ < 0) return false;
+    const uint64_t size = message.size();
+    return writeAll_((const char*)&size, sizeof(size)) && writeAll_(message.data(), message.size());
+  }
+
+  inline bool UnixSocketTransport::receiveMessage(std::string& message, const int& timeout_ms)
+  {
+    if (socket_fd_ < 0) return false;
+    uint64_t size = 0;
+    if (!readAll_((char*)&size, sizeof(size), timeout_ms)) return false;
+    message.resize(size);
+    return readAll_(&message[0], size, timeout_ms);
+  }
+
+  inline void UnixSocketTransport::closeTransport()
+  {
+    // only the descriptor is closed (i.e., no shutdown) so that a copy that was inherited by a forked process is not affected
+    if (socket_fd_ >= 0) {
+      close(socket_fd_);
+      socket_fd_ = -1;
+    }
+  }
+
+  inline bool UnixSocketTransport::writeAll_(const char* data, size_t size)
+  {
+#if defined(MSG_NOSIGNAL)
+    const int flags = MSG_NOSIGNAL; // a broken channel is reported instead of raising SIGPIPE
+#else
+    const int flags = 0;
+#endif
+    while (size > 0) {
+      const ssize_t n_bytes = send(socket_fd_, data, size, flags);
+      if (n_bytes < 0 && errno == EINTR) continue;
+      if (n_bytes <= 0) return false;
+      data += n_bytes;
+      size -= n_bytes;
+    }
+    return true;
+  }
+
+  inline bool UnixSocketTransport::readAll_(char* data, size_t size, const int& timeout_ms)
+  {
+    while (size > 0) {
+      pollfd poll_fd = { socket_fd_, POLLIN, 0 };
+      const int n_ready = poll(&poll_fd, 1, timeout_ms);
+      if (n_ready < 0 && errno == EINTR) continue;
+      if (n_ready <= 0) return false;
+      const ssize_t n_bytes = recv(socket_fd_, data, size, 0);
+      if (n_bytes < 0 && errno == EINTR) continue;
+      if (n_bytes <= 0) return false; // closed or broken
+      data += n_bytes;
+      size -= n_bytes;
+    }
+    return true;
+  }
+#endif
+}
+#endif //SMARTPEAK_MESSAGETRANSPORT_H
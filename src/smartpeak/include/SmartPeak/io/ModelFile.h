@@ -56,6 +56,18 @@ public:
 		*/
 		bool loadModelBinary(const std::string& filename, Model<TensorT>& model);
 
+		/**
+			@brief store or load a binarized Model to or from a stream
+				(e.g., to send the model to another process)
+
+			@param stream The binary stream
+			@param model The model to store or to load data into
+
+			@returns Status True on success, False if not
+		*/
+		bool storeModelBinary(std::ostream& stream, const Model<TensorT>& model);
+		bool loadModelBinary(std::istream& stream, Model<TensorT>& model);
+
     /**
       @brief load Model weights from a binarized model file file
 
@@ -117,20 +129,34 @@ public:
 	{
 		std::ofstream ofs(filename, std::ios::binary);  
 		//if (ofs.is_open() == false) {// Lines check to make sure the file is not already created
-		cereal::BinaryOutputArchive oarchive(ofs); 
-		oarchive(model); 
+		storeModelBinary(ofs, model);
 		ofs.close();
 		//}// Lines check to make sure the file is not already created
 		return true;
 	}
 
+	template<typename TensorT>
+	inline bool ModelFile<TensorT>::storeModelBinary(std::ostream& stream, const Model<TensorT>& model)
+	{
+		cereal::BinaryOutputArchive oarchive(stream);
+		oarchive(model);
+		return stream.good();
+	}
+
+	template<typename TensorT>
+	inline bool ModelFile<TensorT>::loadModelBinary(std::istream& stream, Model<TensorT>& model)
+	{
+		cereal::BinaryInputArchive iarchive(stream);
+		iarchive(model);
+		return true;
+	}
+
 	template<typename TensorT>
 	bool ModelFile<TensorT>::loadModelBinary(const std::string & filename, Model<TensorT>& model)
 	{		
 		std::ifstream ifs(filename, std::ios::binary); 
 		if (ifs.is_open()) {
-			cereal::BinaryInputArchive iarchive(ifs);
-			iarchive(model);
+			loadModelBinary(ifs, model);
 			ifs.close();
 		}
     else {
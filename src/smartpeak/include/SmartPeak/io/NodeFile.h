@@ -134,6 +134,12 @@ public:
 			else if (node_integration_str == "MeanOp") node_integration.reset(new MeanOp<TensorT>());
 			else if (node_integration_str == "VarModOp") node_integration.reset(new VarModOp<TensorT>());
 			else if (node_integration_str == "CountOp") node_integration.reset(new CountOp<TensorT>());
+			else if (node_integration_str == "LSTMCellOp") node_integration.reset(new LSTMCellOp<TensorT>());
+			else if (node_integration_str == "LSTMOutputOp") node_integration.reset(new LSTMOutputOp<TensorT>());
+			else if (node_integration_str == "GRUCellOp") node_integration.reset(new GRUCellOp<TensorT>());
+			else if (node_integration_str == "DotProdAttentionOp") node_integration.reset(new DotProdAttentionOp<TensorT>());
+			else if (node_integration_str == "SoftMaxOp") node_integration.reset(new SoftMaxOp<TensorT>());
+			else if (node_integration_str == "LogSoftMaxOp") node_integration.reset(new LogSoftMaxOp<TensorT>());
 			else std::cout << "NodeIntegration for node_name " << node_name << " was not recognized." << std::endl;
 
 			// parse the node_integration_error
@@ -144,6 +150,13 @@ public:
 			else if (node_integration_error_str == "MeanErrorOp") node_integration_error.reset(new MeanErrorOp<TensorT>());
 			else if (node_integration_error_str == "VarModErrorOp") node_integration_error.reset(new VarModErrorOp<TensorT>());
 			else if (node_integration_error_str == "CountErrorOp") node_integration_error.reset(new CountErrorOp<TensorT>());
+			else if (node_integration_error_str == "LSTMCellErrorOp") node_integration_error.reset(new LSTMCellErrorOp<TensorT>());
+			else if (node_integration_error_str == "LSTMOutputErrorOp") node_integration_error.reset(new LSTMOutputErrorOp<TensorT>());
+			else if (node_integration_error_str == "GRUCellErrorOp") node_integration_error.reset(new GRUCellErrorOp<TensorT>());
+			else if (node_integration_error_str == "DotProdAttentionErrorOp") node_integration_error.reset(new DotProdAttentionErrorOp<TensorT>());
+			else if (node_integration_error_str == "SoftMaxErrorOp") node_integration_error.reset(new SoftMaxErrorOp<TensorT>());
+			else if (node_integration_error_str == "LogSoftMaxErrorOp") node_integration_error.reset(new LogSoftMaxErrorOp<TensorT>());
+			else if (node_integration_error_str == "SoftMaxCrossEntropyErrorOp") node_integration_error.reset(new SoftMaxCrossEntropyErrorOp<TensorT>());
 			else std::cout << "NodeIntegrationError for node_name " << node_name << " was not recognized." << std::endl;
 
 			// parse the node_integration_weight_grad
@@ -154,6 +167,11 @@ public:
 			else if (node_integration_weight_grad_str == "MeanWeightGradOp") node_integration_weight_grad.reset(new MeanWeightGradOp<TensorT>());
 			else if (node_integration_weight_grad_str == "VarModWeightGradOp") node_integration_weight_grad.reset(new VarModWeightGradOp<TensorT>());
 			else if (node_integration_weight_grad_str == "CountWeightGradOp") node_integration_weight_grad.reset(new CountWeightGradOp<TensorT>());
+			else if (node_integration_weight_grad_str == "LSTMCellWeightGradOp") node_integration_weight_grad.reset(new LSTMCellWeightGradOp<TensorT>());
+			else if (node_integration_weight_grad_str == "LSTMOutputWeightGradOp") node_integration_weight_grad.reset(new LSTMOutputWeightGradOp<TensorT>());
+			else if (node_integration_weight_grad_str == "GRUCellWeightGradOp") node_integration_weight_grad.reset(new GRUCellWeightGradOp<TensorT>());
+			else if (node_integration_weight_grad_str == "DotProdAttentionWeightGradOp") node_integration_weight_grad.reset(new DotProdAttentionWeightGradOp<TensorT>());
+			else if (node_integration_weight_grad_str == "SoftMaxWeightGradOp") node_integration_weight_grad.reset(new SoftMaxWeightGradOp<TensorT>());
 			else std::cout << "NodeIntegrationWeightGrad for node_name " << node_name << " was not recognized." << std::endl;
 
 			std::shared_ptr<Node<TensorT>> node(new Node<TensorT>(node_name, node_type, node_status, node_activation, node_activation_grad, node_integration, node_integration_error, node_integration_weight_grad));
@@ -11,6 +11,8 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <functional>
+#include <unordered_map>
 
 // .cpp
 #include <SmartPeak/io/csv.h>
@@ -74,7 +76,71 @@ public:
 		bool storeWeightValuesCsv(const std::string& filename, const std::map<std::string, std::shared_ptr<Weight<TensorT>>>& weights);
 
     std::map<std::string, TensorT> parseParameters(const std::string& parameters);
+
+    typedef std::function<std::shared_ptr<WeightInitOp<TensorT>>(const std::map<std::string, TensorT>&)> WeightInitOpFactory;
+    typedef std::function<std::shared_ptr<SolverOp<TensorT>>(const std::map<std::string, TensorT>&)> SolverOpFactory;
+
+    /**
+      @brief The factories of the weight init ops and solver ops hashed by op name
+        that are used to parse the `weight_init_op` and `solver_op` columns
+
+      Parameters that are missing from the parsed parameters are given their default values
+    */
+    static const std::unordered_map<std::string, WeightInitOpFactory>& getWeightInitOpRegistry();
+    static const std::unordered_map<std::string, SolverOpFactory>& getSolverOpRegistry();
+
+private:
+    /// Get the named parameter or the default value if the parameter was not specified
+    static TensorT getParameter(const std::map<std::string, TensorT>& parameters, const std::string& name, const TensorT& default_value) {
+      auto parameter = parameters.find(name);
+      return (parameter != parameters.end()) ? parameter->second : default_value;
+    }
   };
+	template<typename TensorT>
+	inline const std::unordered_map<std::string, typename WeightFile<TensorT>::WeightInitOpFactory>& WeightFile<TensorT>::getWeightInitOpRegistry()
+	{
+		static const std::unordered_map<std::string, WeightInitOpFactory> registry = {
+			{ "ConstWeightInitOp", [](const std::map<std::string, TensorT>& params) -> std::shared_ptr<WeightInitOp<TensorT>> {
+				return std::make_shared<ConstWeightInitOp<TensorT>>(getParameter(params, "n", 1.0)); } },
+			{ "RandWeightInitOp", [](const std::map<std::string, TensorT>& params) -> std::shared_ptr<WeightInitOp<TensorT>> {
+				return std::make_shared<RandWeightInitOp<TensorT>>(getParameter(params, "n", 1.0)); } },
+			{ "RangeWeightInitOp", [](const std::map<std::string, TensorT>& params) -> std::shared_ptr<WeightInitOp<TensorT>> {
+				if (params.count("lb") && params.count("ub"))
+					return std::make_shared<RangeWeightInitOp<TensorT>>(params.at("lb"), params.at("ub"));
+				return std::make_shared<RangeWeightInitOp<TensorT>>(0.0, 1.0); } }
+		};
+		return registry;
+	}
+
+	template<typename TensorT>
+	inline const std::unordered_map<std::string, typename WeightFile<TensorT>::SolverOpFactory>& WeightFile<TensorT>::getSolverOpRegistry()
+	{
+		static const std::unordered_map<std::string, SolverOpFactory> registry = {
+			{ "SGDOp", [](const std::map<std::string, TensorT>& params) -> std::shared_ptr<SolverOp<TensorT>> {
+				std::shared_ptr<SGDOp<TensorT>> solver = std::make_shared<SGDOp<TensorT>>();
+				solver->setLearningRate(getParameter(params, "learning_rate", 0.01));
+				solver->setMomentum(getParameter(params, "momentum", 0.9));
+				solver->setGradientThreshold(getParameter(params, "gradient_threshold", 1e6));
+				solver->setGradientNoiseSigma(getParameter(params, "gradient_noise_sigma", 0.0));
+				solver->setGradientNoiseGamma(getParameter(params, "gradient_noise_gamma", 0.0));
+				return solver; } },
+			{ "AdamOp", [](const std::map<std::string, TensorT>& params) -> std::shared_ptr<SolverOp<TensorT>> {
+				std::shared_ptr<AdamOp<TensorT>> solver = std::make_shared<AdamOp<TensorT>>();
+				if (params.count("learning_rate"))
+					solver->setLearningRate(params.at("learning_rate"));
+				solver->setMomentum(getParameter(params, "momentum", 0.9));
+				solver->setMomentum2(getParameter(params, "momentum2", 0.999));
+				solver->setDelta(getParameter(params, "delta", 1e-8));
+				solver->setGradientThreshold(getParameter(params, "gradient_threshold", 1e6));
+				solver->setGradientNoiseSigma(getParameter(params, "gradient_noise_sigma", 0.0));
+				solver->setGradientNoiseGamma(getParameter(params, "gradient_noise_gamma", 0.0));
+				return solver; } },
+			{ "DummySolverOp", [](const std::map<std::string, TensorT>& params) -> std::shared_ptr<SolverOp<TensorT>> {
+				return std::make_shared<DummySolverOp<TensorT>>(); } }
+		};
+		return registry;
+	}
+
 	template<typename TensorT>
 	bool WeightFile<TensorT>::loadWeightsBinary(const std::string& filename, std::map<std::string, std::shared_ptr<Weight<TensorT>>>& weights) {
 		std::ifstream ifs(filename, std::ios::binary);
@@ -95,101 +161,43 @@ public:
 		weights_in.read_header(io::ignore_extra_column,
 			"weight_name", "weight_init_op", "weight_init_params", "solver_op", "solver_params", "weight_value", "module_name", "layer_name", "tensor_index");
 		std::string weight_name, weight_init_op_str, weight_init_params_str, solver_op_str, solver_params_str, weight_value_str, module_name_str, layer_name_str, tensor_index_str;
+		std::unordered_map<std::string, std::shared_ptr<WeightInitOp<TensorT>>> shared_weight_inits;
+		std::unordered_map<std::string, std::shared_ptr<SolverOp<TensorT>>> shared_solvers;
 
 		while (weights_in.read_row(weight_name, weight_init_op_str, weight_init_params_str, solver_op_str, solver_params_str, weight_value_str, module_name_str, layer_name_str, tensor_index_str))
 		{
-			// parse the weight_init_params
-			std::map<std::string, TensorT> weight_init_params = parseParameters(weight_init_params_str);
-
-			// parse the weight_init_op
+			// parse the weight_init_op (weights with identical ops and parameters share the same op)
 			std::shared_ptr<WeightInitOp<TensorT>> weight_init;
-			if (weight_init_op_str == "ConstWeightInitOp")
-			{
-				ConstWeightInitOp<TensorT>* ptr = nullptr;
-				if (weight_init_params.count("n"))
-					ptr = new ConstWeightInitOp<TensorT>(weight_init_params.at("n"));
-				else
-					ptr = new ConstWeightInitOp<TensorT>(1.0);
-				weight_init.reset(ptr);
-			}
-			else if (weight_init_op_str == "RandWeightInitOp")
-			{
-				RandWeightInitOp<TensorT>* ptr = nullptr;
-				if (weight_init_params.count("n"))
-					ptr = new RandWeightInitOp<TensorT>(weight_init_params.at("n"));
-				else
-					ptr = new RandWeightInitOp<TensorT>(1.0);
-				weight_init.reset(ptr);
+			const std::string weight_init_key = weight_init_op_str + "|" + weight_init_params_str;
+			auto shared_weight_init = shared_weight_inits.find(weight_init_key);
+			if (shared_weight_init != shared_weight_inits.end())
+				weight_init = shared_weight_init->second;
+			else {
+				auto weight_init_factory = getWeightInitOpRegistry().find(weight_init_op_str);
+				if (weight_init_factory != getWeightInitOpRegistry().end()) {
+					weight_init = weight_init_factory->second(parseParameters(weight_init_params_str));
+					shared_weight_inits.emplace(weight_init_key, weight_init);
+				}
+				else std::cout << "WeightInitOp " << weight_init_op_str << " for weight_name " << weight_name << " was not recognized." << std::endl;
 			}
-      else if (weight_init_op_str == "RangeWeightInitOp")
-      {
-        RangeWeightInitOp<TensorT>* ptr = nullptr;
-        if (weight_init_params.count("lb") && weight_init_params.count("ub"))
-          ptr = new RangeWeightInitOp<TensorT>(weight_init_params.at("lb"), weight_init_params.at("ub"));
-        else
-          ptr = new RangeWeightInitOp<TensorT>(0.0, 1.0);
-        weight_init.reset(ptr);
-      }
-			else std::cout << "WeightInitOp " << weight_init_op_str << " for weight_name " << weight_name << " was not recognized." << std::endl;
-
-			// parse the solver_params_str
-			std::map<std::string, TensorT> solver_params;
-			if (!solver_params_str.empty())
-				solver_params = parseParameters(solver_params_str);
 
-			// parse the solver_op
+			// parse the solver_op (weights with identical ops and parameters share the same op)
 			std::shared_ptr<SolverOp<TensorT>> solver;
-			if (solver_op_str == "SGDOp")
-			{
-				SGDOp<TensorT>* ptr = new SGDOp<TensorT>();
-				ptr->setLearningRate(0.01);
-				if (solver_params.count("learning_rate"))
-					ptr->setLearningRate(solver_params.at("learning_rate"));
-				ptr->setMomentum(0.9);
-				if (solver_params.count("momentum"))
-					ptr->setMomentum(solver_params.at("momentum"));
-				ptr->setGradientThreshold(1e6);
-				if (solver_params.count("gradient_threshold"))
-					ptr->setGradientThreshold(solver_params.at("gradient_threshold"));
-				ptr->setGradientNoiseSigma(0.0);
-				if (solver_params.count("gradient_noise_sigma"))
-					ptr->setGradientNoiseSigma(solver_params.at("gradient_noise_sigma"));
-				ptr->setGradientNoiseGamma(0.0);
-				if (solver_params.count("gradient_noise_gamma"))
-					ptr->setGradientNoiseGamma(solver_params.at("gradient_noise_gamma"));
-				solver.reset(ptr);
-			}
-			else if (solver_op_str == "AdamOp")
-			{
-				AdamOp<TensorT>* ptr = new AdamOp<TensorT>();
-				if (solver_params.count("learning_rate"))
-					ptr->setLearningRate(solver_params.at("learning_rate"));
-				ptr->setMomentum(0.9);
-				if (solver_params.count("momentum"))
-					ptr->setMomentum(solver_params.at("momentum"));
-				ptr->setMomentum2(0.999);
-				if (solver_params.count("momentum2"))
-					ptr->setMomentum2(solver_params.at("momentum2"));
-				ptr->setDelta(1e-8);
-				if (solver_params.count("delta"))
-					ptr->setDelta(solver_params.at("delta"));
-				ptr->setGradientThreshold(1e6);
-				if (solver_params.count("gradient_threshold"))
-					ptr->setGradientThreshold(solver_params.at("gradient_threshold"));
-				ptr->setGradientNoiseSigma(0.0);
-				if (solver_params.count("gradient_noise_sigma"))
-					ptr->setGradientNoiseSigma(solver_params.at("gradient_noise_sigma"));
-				ptr->setGradientNoiseGamma(0.0);
-				if (solver_params.count("gradient_noise_gamma"))
-					ptr->setGradientNoiseGamma(solver_params.at("gradient_noise_gamma"));
-				solver.reset(ptr);
-			}
-			else if (solver_op_str == "DummySolverOp")
-			{
-				DummySolverOp<TensorT>* ptr = new DummySolverOp<TensorT>();
-				solver.reset(ptr);
+			const std::string solver_key = solver_op_str + "|" + solver_params_str;
+			auto shared_solver = shared_solvers.find(solver_key);
+			if (shared_solver != shared_solvers.end())
+				solver = shared_solver->second;
+			else {
+				auto solver_factory = getSolverOpRegistry().find(solver_op_str);
+				if (solver_factory != getSolverOpRegistry().end()) {
+					std::map<std::string, TensorT> solver_params;
+					if (!solver_params_str.empty())
+						solver_params = parseParameters(solver_params_str);
+					solver = solver_factory->second(solver_params);
+					shared_solvers.emplace(solver_key, solver);
+				}
+				else std::cout << "SolverOp " << solver_op_str << " for weight_name " << weight_name << " was not recognized." << std::endl;
 			}
-			else std::cout << "SolverOp " << solver_op_str << " for weight_name " << weight_name << " was not recognized." << std::endl;
 
 			std::shared_ptr<Weight<TensorT>> weight(new Weight<TensorT>(weight_name, weight_init, solver));
 
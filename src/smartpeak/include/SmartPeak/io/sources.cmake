@@ -7,6 +7,7 @@ set(sources_list_h
 	CSVWriter.h
 	DataFile.h
 	LinkFile.h
+	MessageTransport.h
 	ModelFile.h
 	ModelInterpreterFile.h
 	ModelInterpreterFileDefaultDevice.h
@@ -0,0 +1,138 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_COMPILEDMODELCACHE_H
+#define SMARTPEAK_COMPILEDMODELCACHE_H
+
+#include <vector>
+#include <map>
+#include <list>
+#include <string>
+#include <memory>
+#include <mutex>
+
+namespace SmartPeak
+{
+	/*
+	Structures required to store a compiled model schedule
+	*/
+	struct CompiledOperationArguments
+	{
+		std::string source_node_name;
+		std::string weight_name;
+		std::string link_name;
+		int time_step = 0;
+	};
+
+	struct CompiledOperationList
+	{
+		std::string sink_node_name;
+		int sink_time_step = 0;
+		std::vector<CompiledOperationArguments> arguments;
+		int operation_index = -1;
+	};
+
+	/**
+		@brief Forward propogation schedule of a compiled model where all nodes and weights
+			are referenced by name so that the schedule can be re-instantiated with the
+			nodes and weights of any model with the same structure hash
+	*/
+	struct CompiledOperationsSchedule
+	{
+		std::vector<CompiledOperationList> FP_operations;
+		std::vector<std::map<std::string, std::vector<int>>> tensor_ops_steps;
+	};
+
+	/**
+		@brief Thread-safe cache of compiled model schedules keyed by the model structure hash
+
+		The cache can be shared between model interpreters so that models with an unchanged topology
+		(e.g., replicates that only differ in their weight values) skip the compilation
+		of the forward propogation operations and tensor operations.
+		Schedules are evicted in order of insertion once the maximum size is reached.
+	*/
+	class CompiledModelCache
+	{
+	public:
+		CompiledModelCache() = default; ///< Default constructor
+		CompiledModelCache(const int& max_size) : max_size_(max_size) {}; ///< Explicit constructor
+		~CompiledModelCache() = default; ///< Default destructor
+
+		/**
+			@brief Retrieve a compiled schedule
+
+			@param[in] key The model structure hash
+
+			@returns The compiled schedule or a nullptr if the key is not in the cache
+		*/
+		std::shared_ptr<const CompiledOperationsSchedule> getSchedule(const std::size_t& key);
+
+		/**
+			@brief Add a compiled schedule to the cache
+
+			@param[in] key The model structure hash
+			@param[in] schedule The compiled schedule
+		*/
+		void addSchedule(const std::size_t& key, const std::shared_ptr<const CompiledOperationsSchedule>& schedule);
+
+		void setMaxSize(const int& max_size) { std::lock_guard<std::mutex> lock(mutex_); max_size_ = max_size; }; ///< max_size setter
+		int getMaxSize() const { std::lock_guard<std::mutex> lock(mutex_); return max_size_; }; ///< max_size getter
+		size_t getSize() const; ///< number of cached schedules
+		int getNHits() const { std::lock_guard<std::mutex> lock(mutex_); return n_hits_; }; ///< number of cache hits
+		int getNMisses() const { std::lock_guard<std::mutex> lock(mutex_); return n_misses_; }; ///< number of cache misses
+
+		void clear(); ///< clear all cached schedules and statistics
+
+	private:
+		mutable std::mutex mutex_;
+		std::map<std::size_t, std::shared_ptr<const CompiledOperationsSchedule>> schedules_;
+		std::list<std::size_t> insertion_order_;
+		int max_size_ = 64; ///< The maximum number of cached schedules
+		int n_hits_ = 0;
+		int n_misses_ = 0;
+	};
+
+	inline std::shared_ptr<const CompiledOperationsSchedule> CompiledModelCache::getSchedule(const std::size_t& key)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto found = schedules_.find(key);
+		if (found == schedules_.end()) {
+			++n_misses_;
+			return nullptr;
+		}
+		++n_hits_;
+		return found->second;
+	}
+
+	inline void CompiledModelCache::addSchedule(const std::size_t& key, const std::shared_ptr<const CompiledOperationsSchedule>& schedule)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (max_size_ <= 0) return;
+		auto found = schedules_.emplace(key, schedule);
+		if (!found.second) {
+			found.first->second = schedule;
+			return;
+		}
+		insertion_order_.push_back(key);
+		while (schedules_.size() > max_size_) {
+			schedules_.erase(insertion_order_.front());
+			insertion_order_.pop_front();
+		}
+	}
+
+	inline size_t CompiledModelCache::getSize() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return schedules_.size();
+	}
+
+	inline void CompiledModelCache::clear()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		schedules_.clear();
+		insertion_order_.clear();
+		n_hits_ = 0;
+		n_misses_ = 0;
+	}
+}
+
+#endif //SMARTPEAK_COMPILEDMODELCACHE_H
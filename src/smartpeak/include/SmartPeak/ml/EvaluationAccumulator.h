@@ -0,0 +1,309 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_EVALUATIONACCUMULATOR_H
+#define SMARTPEAK_EVALUATIONACCUMULATOR_H
+
+// .h
+#include <SmartPeak/io/CSVWriter.h>
+#include <unsupported/Eigen/CXX11/Tensor>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SmartPeak
+{
+  /**
+    @brief Base class for reducing the model evaluation outputs on the fly
+
+    Accumulators are passed to `ModelTrainer::setEvaluationAccumulators` and are called once per evaluation epoch
+      with the model output of the epoch (dim0: batch_size, dim1: memory_size, dim2: output nodes)
+      and the total of each metric function of the epoch (dim0: metrics) so that the evaluation statistics
+      can be computed in memory that does not grow with the number of evaluation epochs
+      (see `ModelTrainer::setStreamEvaluation`)
+
+    Example use case:
+      auto output_stats = std::make_shared<OutputStatisticsAccumulator<float>>();
+      model_trainer.setEvaluationAccumulators({ output_stats });
+      model_trainer.setStreamEvaluation(true);
+      model_trainer.evaluateModel(model, data_simulator, input_nodes, model_logger, model_interpreter);
+      Eigen::Tensor<float, 2> mean = output_stats->getMean();
+  */
+  template<typename TensorT>
+  class EvaluationAccumulator
+  {
+  public:
+    EvaluationAccumulator() = default;
+    virtual ~EvaluationAccumulator() = default;
+    virtual std::string getName() const = 0;
+
+    /**
+      @brief Reset the accumulator before the first evaluation epoch
+
+      @param[in] batch_size The batch size
+      @param[in] memory_size The memory size
+      @param[in] output_nodes The output node names (dim2 of the model output)
+      @param[in] metric_names The metric names (dim0 of the model metrics)
+    */
+    virtual void initAccumulator(const int& batch_size, const int& memory_size, const std::vector<std::string>& output_nodes, const std::vector<std::string>& metric_names) = 0;
+
+    /**
+      @brief Reduce the results of an evaluation epoch into the accumulator
+
+      @param[in] epoch The evaluation epoch
+      @param[in] model_output The model output of dims batch_size, memory_size, output nodes
+      @param[in] model_metrics The total of each metric of dims metrics (empty if no metrics were calculated)
+    */
+    virtual void accumulate(const int& epoch, const Eigen::Tensor<TensorT, 3>& model_output, const Eigen::Tensor<TensorT, 1>& model_metrics) = 0;
+
+    /// Called after the last evaluation epoch
+    virtual void finalizeAccumulator() {};
+  };
+
+  /**
+    @brief Running mean, variance, minimum, and maximum of each output node and memory step
+      over all batches and evaluation epochs
+
+    The mean and variance are merged per epoch using the parallel form of Welford's algorithm
+      so that the statistics are numerically stable over many epochs
+  */
+  template<typename TensorT>
+  class OutputStatisticsAccumulator : public EvaluationAccumulator<TensorT>
+  {
+  public:
+    std::string getName() const override { return "OutputStatisticsAccumulator"; };
+    void initAccumulator(const int& batch_size, const int& memory_size, const std::vector<std::string>& output_nodes, const std::vector<std::string>& metric_names) override
+    {
+      n_samples_ = 0;
+      mean_.resize(memory_size, (int)output_nodes.size()); mean_.setZero();
+      m2_.resize(memory_size, (int)output_nodes.size()); m2_.setZero();
+      min_.resize(memory_size, (int)output_nodes.size()); min_.setConstant(std::numeric_limits<TensorT>::max());
+      max_.resize(memory_size, (int)output_nodes.size()); max_.setConstant(std::numeric_limits<TensorT>::lowest());
+    }
+    void accumulate(const int& epoch, const Eigen::Tensor<TensorT, 3>& model_output, const Eigen::Tensor<TensorT, 1>& model_metrics) override
+    {
+      const int batch_size = model_output.dimension(0);
+      if (batch_size == 0) return;
+      const int memory_size = model_output.dimension(1);
+      const int n_nodes = model_output.dimension(2);
+
+      // statistics of the epoch
+      Eigen::Tensor<TensorT, 2> mean_epoch = model_output.mean(Eigen::array<int, 1>({ 0 }));
+      auto mean_epoch_bcast = mean_epoch.reshape(Eigen::array<int, 3>({ 1, memory_size, n_nodes })).broadcast(Eigen::array<int, 3>({ batch_size, 1, 1 }));
+      Eigen::Tensor<TensorT, 2> m2_epoch = (model_output - mean_epoch_bcast).square().sum(Eigen::array<int, 1>({ 0 }));
+
+      // merge with the running statistics
+      const TensorT n_a = TensorT(n_samples_), n_b = TensorT(batch_size), n = n_a + n_b;
+      Eigen::Tensor<TensorT, 2> delta = mean_epoch - mean_;
+      mean_ += delta * delta.constant(n_b / n);
+      m2_ += m2_epoch + delta.square() * delta.constant(n_a * n_b / n);
+      min_ = min_.cwiseMin(model_output.minimum(Eigen::array<int, 1>({ 0 })));
+      max_ = max_.cwiseMax(model_output.maximum(Eigen::array<int, 1>({ 0 })));
+      n_samples_ += batch_size;
+    }
+    Eigen::Tensor<TensorT, 2> getMean() const { return mean_; } ///< mean of dims memory_size, output nodes
+    Eigen::Tensor<TensorT, 2> getVariance() const { return (n_samples_ > 1) ? Eigen::Tensor<TensorT, 2>(m2_ / m2_.constant(TensorT(n_samples_ - 1))) : Eigen::Tensor<TensorT, 2>(m2_.constant(TensorT(0))); } ///< sample variance of dims memory_size, output nodes
+    Eigen::Tensor<TensorT, 2> getMin() const { return min_; } ///< minimum of dims memory_size, output nodes
+    Eigen::Tensor<TensorT, 2> getMax() const { return max_; } ///< maximum of dims memory_size, output nodes
+    long long getNSamples() const { return n_samples_; } ///< number of samples (i.e., batches x epochs)
+  protected:
+    long long n_samples_ = 0;
+    Eigen::Tensor<TensorT, 2> mean_;
+    Eigen::Tensor<TensorT, 2> m2_; ///< sum of squared differences from the mean
+    Eigen::Tensor<TensorT, 2> min_;
+    Eigen::Tensor<TensorT, 2> max_;
+  };
+
+  /**
+    @brief Sum, mean, minimum, and maximum of each metric function over all evaluation epochs
+  */
+  template<typename TensorT>
+  class MetricAccumulator : public EvaluationAccumulator<TensorT>
+  {
+  public:
+    std::string getName() const override { return "MetricAccumulator"; };
+    void initAccumulator(const int& batch_size, const int& memory_size, const std::vector<std::string>& output_nodes, const std::vector<std::string>& metric_names) override
+    {
+      n_epochs_ = 0;
+      metric_names_ = metric_names;
+      sum_.resize((int)metric_names.size()); sum_.setZero();
+      min_.resize((int)metric_names.size()); min_.setConstant(std::numeric_limits<TensorT>::max());
+      max_.resize((int)metric_names.size()); max_.setConstant(std::numeric_limits<TensorT>::lowest());
+    }
+    void accumulate(const int& epoch, const Eigen::Tensor<TensorT, 1>& model_metrics)
+    {
+      if (model_metrics.size() != sum_.size()) return;
+      sum_ += model_metrics;
+      min_ = min_.cwiseMin(model_metrics);
+      max_ = max_.cwiseMax(model_metrics);
+      ++n_epochs_;
+    }
+    void accumulate(const int& epoch, const Eigen::Tensor<TensorT, 3>& model_output, const Eigen::Tensor<TensorT, 1>& model_metrics) override { accumulate(epoch, model_metrics); }
+    Eigen::Tensor<TensorT, 1> getSum() const { return sum_; } ///< sum of dims metrics
+    Eigen::Tensor<TensorT, 1> getMean() const { return (n_epochs_ > 0) ? Eigen::Tensor<TensorT, 1>(sum_ / sum_.constant(TensorT(n_epochs_))) : Eigen::Tensor<TensorT, 1>(sum_.constant(TensorT(0))); } ///< mean of dims metrics
+    Eigen::Tensor<TensorT, 1> getMin() const { return min_; } ///< minimum of dims metrics
+    Eigen::Tensor<TensorT, 1> getMax() const { return max_; } ///< maximum of dims metrics
+    std::vector<std::string> getMetricNames() const { return metric_names_; }
+    int getNEpochs() const { return n_epochs_; } ///< number of accumulated epochs
+  protected:
+    int n_epochs_ = 0;
+    std::vector<std::string> metric_names_;
+    Eigen::Tensor<TensorT, 1> sum_;
+    Eigen::Tensor<TensorT, 1> min_;
+    Eigen::Tensor<TensorT, 1> max_;
+  };
+
+  /**
+    @brief Histogram of the output values of each output node (e.g., the predicted class probabilities)
+      over all batches, memory steps, and evaluation epochs
+
+    The bins are evenly spaced between the lower and upper bounds and values outside of the bounds
+      are counted in the first or last bin
+  */
+  template<typename TensorT>
+  class OutputHistogramAccumulator : public EvaluationAccumulator<TensorT>
+  {
+  public:
+    OutputHistogramAccumulator() = default;
+    OutputHistogramAccumulator(const int& n_bins, const TensorT& lower_bound, const TensorT& upper_bound) :
+      n_bins_(n_bins), lower_bound_(lower_bound), upper_bound_(upper_bound) {};
+    std::string getName() const override { return "OutputHistogramAccumulator"; };
+    void initAccumulator(const int& batch_size, const int& memory_size, const std::vector<std::string>& output_nodes, const std::vector<std::string>& metric_names) override
+    {
+      if (n_bins_ <= 0 || upper_bound_ <= lower_bound_)
+        throw std::runtime_error("The histogram needs at least one bin and an upper bound greater than the lower bound.");
+      counts_.resize((int)output_nodes.size(), n_bins_);
+      counts_.setZero();
+    }
+    void accumulate(const int& epoch, const Eigen::Tensor<TensorT, 3>& model_output, const Eigen::Tensor<TensorT, 1>& model_metrics) override
+    {
+      const TensorT bin_width = (upper_bound_ - lower_bound_) / TensorT(n_bins_);
+      for (int node_iter = 0; node_iter < model_output.dimension(2); ++node_iter) {
+        for (int memory_iter = 0; memory_iter < model_output.dimension(1); ++memory_iter) {
+          for (int batch_iter = 0; batch_iter < model_output.dimension(0); ++batch_iter) {
+            const TensorT value = model_output(batch_iter, memory_iter, node_iter);
+            int bin = (value >= upper_bound_) ? n_bins_ - 1 : (value <= lower_bound_) ? 0 : int((value - lower_bound_) / bin_width);
+            counts_(node_iter, std::min(std::max(bin, 0), n_bins_ - 1)) += 1;
+          }
+        }
+      }
+    }
+    Eigen::Tensor<long long, 2> getCounts() const { return counts_; } ///< counts of dims output nodes, bins
+    int getNBins() const { return n_bins_; }
+    TensorT getLowerBound() const { return lower_bound_; }
+    TensorT getUpperBound() const { return upper_bound_; }
+  protected:
+    int n_bins_ = 10;
+    TensorT lower_bound_ = 0;
+    TensorT upper_bound_ = 1;
+    Eigen::Tensor<long long, 2> counts_;
+  };
+
+  /**
+    @brief The k largest output values of each output node over all batches and evaluation epochs
+      (e.g., the most confidently predicted samples of each class)
+
+    The values are kept in a min-heap of size k per output node
+  */
+  template<typename TensorT>
+  class TopKAccumulator : public EvaluationAccumulator<TensorT>
+  {
+  public:
+    struct TopKEntry
+    {
+      TensorT value;
+      int epoch;
+      int batch_index;
+      bool operator>(const TopKEntry& other) const { return value > other.value; }
+    };
+
+    TopKAccumulator() = default;
+    TopKAccumulator(const int& k, const int& memory_index = 0) : k_(k), memory_index_(memory_index) {};
+    std::string getName() const override { return "TopKAccumulator"; };
+    void initAccumulator(const int& batch_size, const int& memory_size, const std::vector<std::string>& output_nodes, const std::vector<std::string>& metric_names) override
+    {
+      if (memory_index_ < 0 || memory_index_ >= memory_size)
+        throw std::runtime_error("The memory index " + std::to_string(memory_index_) + " is outside of the memory size " + std::to_string(memory_size) + ".");
+      heaps_.assign(output_nodes.size(), std::vector<TopKEntry>());
+      for (auto& heap : heaps_) heap.reserve(k_ + 1);
+    }
+    void accumulate(const int& epoch, const Eigen::Tensor<TensorT, 3>& model_output, const Eigen::Tensor<TensorT, 1>& model_metrics) override
+    {
+      for (int node_iter = 0; node_iter < model_output.dimension(2) && node_iter < (int)heaps_.size(); ++node_iter) {
+        std::vector<TopKEntry>& heap = heaps_.at(node_iter);
+        for (int batch_iter = 0; batch_iter < model_output.dimension(0); ++batch_iter) {
+          const TensorT value = model_output(batch_iter, memory_index_, node_iter);
+          if ((int)heap.size() < k_) {
+            heap.push_back(TopKEntry({ value, epoch, batch_iter }));
+            std::push_heap(heap.begin(), heap.end(), std::greater<TopKEntry>());
+          }
+          else if (k_ > 0 && value > heap.front().value) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<TopKEntry>());
+            heap.back() = TopKEntry({ value, epoch, batch_iter });
+            std::push_heap(heap.begin(), heap.end(), std::greater<TopKEntry>());
+          }
+        }
+      }
+    }
+
+    /**
+      @brief The k largest values of an output node sorted from largest to smallest
+
+      @param[in] node_index The index of the output node
+    */
+    std::vector<TopKEntry> getTopK(const int& node_index) const
+    {
+      std::vector<TopKEntry> top_k = heaps_.at(node_index);
+      std::sort(top_k.begin(), top_k.end(), std::greater<TopKEntry>());
+      return top_k;
+    }
+    int getK() const { return k_; }
+    int getMemoryIndex() const { return memory_index_; }
+  protected:
+    int k_ = 10;
+    int memory_index_ = 0; ///< the memory step to rank (0 is the most recent time step)
+    std::vector<std::vector<TopKEntry>> heaps_;
+  };
+
+  /**
+    @brief Writes the model output of each evaluation epoch to a .csv file
+      so that the outputs can be post-processed without holding all epochs in memory
+
+    Each row holds the epoch, batch index, and memory index followed by the value of each output node
+  */
+  template<typename TensorT>
+  class OutputFileAccumulator : public EvaluationAccumulator<TensorT>
+  {
+  public:
+    OutputFileAccumulator() = default;
+    OutputFileAccumulator(const std::string& filename) : filename_(filename) {};
+    std::string getName() const override { return "OutputFileAccumulator"; };
+    void initAccumulator(const int& batch_size, const int& memory_size, const std::vector<std::string>& output_nodes, const std::vector<std::string>& metric_names) override
+    {
+      csv_writer_ = CSVWriter(filename_);
+      std::vector<std::string> headers = { "Epoch", "BatchIndex", "MemoryIndex" };
+      for (const std::string& output_node : output_nodes) headers.push_back(output_node);
+      csv_writer_.writeDataInRow(headers.begin(), headers.end());
+    }
+    void accumulate(const int& epoch, const Eigen::Tensor<TensorT, 3>& model_output, const Eigen::Tensor<TensorT, 1>& model_metrics) override
+    {
+      std::vector<std::string> row;
+      for (int batch_iter = 0; batch_iter < model_output.dimension(0); ++batch_iter) {
+        for (int memory_iter = 0; memory_iter < model_output.dimension(1); ++memory_iter) {
+          row = { std::to_string(epoch), std::to_string(batch_iter), std::to_string(memory_iter) };
+          for (int node_iter = 0; node_iter < model_output.dimension(2); ++node_iter)
+            row.push_back(std::to_string(model_output(batch_iter, memory_iter, node_iter)));
+          csv_writer_.writeDataInRow(row.begin(), row.end());
+        }
+      }
+    }
+    std::string getFilename() const { return filename_; }
+  protected:
+    std::string filename_ = "EvaluationOutput.csv";
+    CSVWriter csv_writer_;
+  };
+}
+
+#endif //SMARTPEAK_EVALUATIONACCUMULATOR_H
@@ -218,6 +218,134 @@ public:
 		}
 	};
 
+	/**
+		@brief Fused LSTM cell integration function
+
+			The sink layer holds the memory cell and output gate nodes of a whole LSTM layer whose inputs
+			are the (linear) input, forget, block input, and output gate pre-activations of a single source layer
+			(see `ModelBuilder::addLSTMFused`).
+	*/
+	template<typename T>
+	class LSTMCellOp : public IntegrationOp<T>
+	{
+	public:
+		using IntegrationOp<T>::IntegrationOp;
+		std::string getName() const { return "LSTMCellOp"; };
+    IntegrationOp<T>* copy() const { return new LSTMCellOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused LSTM output integration function
+
+			The sink layer holds the output nodes of a whole LSTM layer whose inputs are the memory cell
+			and output gate nodes of a single LSTM cell layer (see `ModelBuilder::addLSTMFused`).
+	*/
+	template<typename T>
+	class LSTMOutputOp : public IntegrationOp<T>
+	{
+	public:
+		using IntegrationOp<T>::IntegrationOp;
+		std::string getName() const { return "LSTMOutputOp"; };
+    IntegrationOp<T>* copy() const { return new LSTMOutputOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused GRU cell integration function
+
+			The sink layer holds the output nodes of a whole GRU layer whose inputs are the (linear) update gate,
+			reset gate, input candidate, and recurrent candidate pre-activations of a single source layer
+			(see `ModelBuilder::addGRUFused`).
+	*/
+	template<typename T>
+	class GRUCellOp : public IntegrationOp<T>
+	{
+	public:
+		using IntegrationOp<T>::IntegrationOp;
+		std::string getName() const { return "GRUCellOp"; };
+    IntegrationOp<T>* copy() const { return new GRUCellOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused scaled dot product attention integration function
+
+			The sink layer holds the attention nodes of all heads whose inputs are the (linear) query, key, and values
+			projections of a single source layer (see `ModelBuilder::addMultiHeadAttentionFused`).
+	*/
+	template<typename T>
+	class DotProdAttentionOp : public IntegrationOp<T>
+	{
+	public:
+		using IntegrationOp<T>::IntegrationOp;
+		std::string getName() const { return "DotProdAttentionOp"; };
+    IntegrationOp<T>* copy() const { return new DotProdAttentionOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused numerically stable softmax integration function
+
+			The sink layer holds the softmax nodes whose inputs are the nodes of a single source layer
+			(see `ModelBuilder::addSoftMaxFused`).
+	*/
+	template<typename T>
+	class SoftMaxOp : public IntegrationOp<T>
+	{
+	public:
+		using IntegrationOp<T>::IntegrationOp;
+		std::string getName() const { return "SoftMaxOp"; };
+    IntegrationOp<T>* copy() const { return new SoftMaxOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused numerically stable log softmax integration function
+
+			The sink layer holds the log softmax nodes whose inputs are the nodes of a single source layer
+			(see `ModelBuilder::addSoftMaxFused`).
+	*/
+	template<typename T>
+	class LogSoftMaxOp : public IntegrationOp<T>
+	{
+	public:
+		using IntegrationOp<T>::IntegrationOp;
+		std::string getName() const { return "LogSoftMaxOp"; };
+    IntegrationOp<T>* copy() const { return new LogSoftMaxOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationOp<T>>(this));
+		}
+	};
+
 	/**
 	@brief Base class for all integration error functions.
 	*/
@@ -366,6 +494,135 @@ public:
 		}
 	};
 
+	/**
+		@brief Fused LSTM cell integration error function
+	*/
+	template<typename T>
+	class LSTMCellErrorOp : public IntegrationErrorOp<T>
+	{
+	public:
+		using IntegrationErrorOp<T>::IntegrationErrorOp;
+		std::string getName() const { return "LSTMCellErrorOp"; };
+    IntegrationErrorOp<T>* copy() const { return new LSTMCellErrorOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationErrorOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused LSTM output integration error function
+	*/
+	template<typename T>
+	class LSTMOutputErrorOp : public IntegrationErrorOp<T>
+	{
+	public:
+		using IntegrationErrorOp<T>::IntegrationErrorOp;
+		std::string getName() const { return "LSTMOutputErrorOp"; };
+    IntegrationErrorOp<T>* copy() const { return new LSTMOutputErrorOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationErrorOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused GRU cell integration error function
+	*/
+	template<typename T>
+	class GRUCellErrorOp : public IntegrationErrorOp<T>
+	{
+	public:
+		using IntegrationErrorOp<T>::IntegrationErrorOp;
+		std::string getName() const { return "GRUCellErrorOp"; };
+    IntegrationErrorOp<T>* copy() const { return new GRUCellErrorOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationErrorOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused scaled dot product attention integration error function
+	*/
+	template<typename T>
+	class DotProdAttentionErrorOp : public IntegrationErrorOp<T>
+	{
+	public:
+		using IntegrationErrorOp<T>::IntegrationErrorOp;
+		std::string getName() const { return "DotProdAttentionErrorOp"; };
+    IntegrationErrorOp<T>* copy() const { return new DotProdAttentionErrorOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationErrorOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused numerically stable softmax integration error function
+	*/
+	template<typename T>
+	class SoftMaxErrorOp : public IntegrationErrorOp<T>
+	{
+	public:
+		using IntegrationErrorOp<T>::IntegrationErrorOp;
+		std::string getName() const { return "SoftMaxErrorOp"; };
+    IntegrationErrorOp<T>* copy() const { return new SoftMaxErrorOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationErrorOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused numerically stable log softmax integration error function
+	*/
+	template<typename T>
+	class LogSoftMaxErrorOp : public IntegrationErrorOp<T>
+	{
+	public:
+		using IntegrationErrorOp<T>::IntegrationErrorOp;
+		std::string getName() const { return "LogSoftMaxErrorOp"; };
+    IntegrationErrorOp<T>* copy() const { return new LogSoftMaxErrorOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationErrorOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused softmax and cross entropy integration error function
+
+			The loss function gradient of the softmax output nodes is passed directly to the inputs of the softmax
+			(e.g., for use with `CrossEntropyWithLogitsLossGradOp`).
+	*/
+	template<typename T>
+	class SoftMaxCrossEntropyErrorOp : public IntegrationErrorOp<T>
+	{
+	public:
+		using IntegrationErrorOp<T>::IntegrationErrorOp;
+		std::string getName() const { return "SoftMaxCrossEntropyErrorOp"; };
+    IntegrationErrorOp<T>* copy() const { return new SoftMaxCrossEntropyErrorOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationErrorOp<T>>(this));
+		}
+	};
+
 	/**
 	@brief Base class for all integration error functions.
 	*/
@@ -513,6 +770,96 @@ public:
 			archive(cereal::base_class<IntegrationWeightGradOp<T>>(this));
 		}
 	};
+
+	/**
+		@brief Fused LSTM cell integration weight gradient function (the gate to cell links are fixed)
+	*/
+	template<typename T>
+	class LSTMCellWeightGradOp : public IntegrationWeightGradOp<T>
+	{
+	public:
+		using IntegrationWeightGradOp<T>::IntegrationWeightGradOp;
+		std::string getName() const { return "LSTMCellWeightGradOp"; };
+    IntegrationWeightGradOp<T>* copy() const { return new LSTMCellWeightGradOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationWeightGradOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused LSTM output integration weight gradient function (the cell to output links are fixed)
+	*/
+	template<typename T>
+	class LSTMOutputWeightGradOp : public IntegrationWeightGradOp<T>
+	{
+	public:
+		using IntegrationWeightGradOp<T>::IntegrationWeightGradOp;
+		std::string getName() const { return "LSTMOutputWeightGradOp"; };
+    IntegrationWeightGradOp<T>* copy() const { return new LSTMOutputWeightGradOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationWeightGradOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused GRU cell integration weight gradient function (the gate to cell links are fixed)
+	*/
+	template<typename T>
+	class GRUCellWeightGradOp : public IntegrationWeightGradOp<T>
+	{
+	public:
+		using IntegrationWeightGradOp<T>::IntegrationWeightGradOp;
+		std::string getName() const { return "GRUCellWeightGradOp"; };
+    IntegrationWeightGradOp<T>* copy() const { return new GRUCellWeightGradOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationWeightGradOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused scaled dot product attention integration weight gradient function (the projection to attention links are fixed)
+	*/
+	template<typename T>
+	class DotProdAttentionWeightGradOp : public IntegrationWeightGradOp<T>
+	{
+	public:
+		using IntegrationWeightGradOp<T>::IntegrationWeightGradOp;
+		std::string getName() const { return "DotProdAttentionWeightGradOp"; };
+    IntegrationWeightGradOp<T>* copy() const { return new DotProdAttentionWeightGradOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationWeightGradOp<T>>(this));
+		}
+	};
+
+	/**
+		@brief Fused softmax integration weight gradient function (the source to softmax links are fixed)
+	*/
+	template<typename T>
+	class SoftMaxWeightGradOp : public IntegrationWeightGradOp<T>
+	{
+	public:
+		using IntegrationWeightGradOp<T>::IntegrationWeightGradOp;
+		std::string getName() const { return "SoftMaxWeightGradOp"; };
+    IntegrationWeightGradOp<T>* copy() const { return new SoftMaxWeightGradOp<T>(*this); }
+	private:
+		friend class cereal::access;
+		template<class Archive>
+		void serialize(Archive& archive) {
+			archive(cereal::base_class<IntegrationWeightGradOp<T>>(this));
+		}
+	};
 }
 
 CEREAL_REGISTER_TYPE(SmartPeak::SumOp<float>);
@@ -524,6 +871,12 @@ CEREAL_REGISTER_TYPE(SmartPeak::MeanOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::VarianceOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::VarModOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::CountOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::GRUCellOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LogSoftMaxOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::SumErrorOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::ProdErrorOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::MaxErrorOp<float>);
@@ -531,6 +884,13 @@ CEREAL_REGISTER_TYPE(SmartPeak::MinErrorOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::MeanErrorOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::VarModErrorOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::CountErrorOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellErrorOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputErrorOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::GRUCellErrorOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionErrorOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxErrorOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LogSoftMaxErrorOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxCrossEntropyErrorOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::SumWeightGradOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::ProdWeightGradOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::MaxWeightGradOp<float>);
@@ -538,6 +898,11 @@ CEREAL_REGISTER_TYPE(SmartPeak::MinWeightGradOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::CountWeightGradOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::MeanWeightGradOp<float>);
 CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellWeightGradOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputWeightGradOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::GRUCellWeightGradOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionWeightGradOp<float>);
+CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxWeightGradOp<float>);
 
 //CEREAL_REGISTER_TYPE(SmartPeak::SumOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::ProdOp<double>);
@@ -548,6 +913,12 @@ CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<float>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarianceOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarModOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::CountOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::GRUCellOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LogSoftMaxOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::SumErrorOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::ProdErrorOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MaxErrorOp<double>);
@@ -555,6 +926,13 @@ CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<float>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MeanErrorOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarModErrorOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::CountErrorOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellErrorOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputErrorOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::GRUCellErrorOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionErrorOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxErrorOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LogSoftMaxErrorOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxCrossEntropyErrorOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::SumWeightGradOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::ProdWeightGradOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MaxWeightGradOp<double>);
@@ -562,6 +940,11 @@ CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<float>);
 //CEREAL_REGISTER_TYPE(SmartPeak::CountWeightGradOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MeanWeightGradOp<double>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellWeightGradOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputWeightGradOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::GRUCellWeightGradOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionWeightGradOp<double>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxWeightGradOp<double>);
 //
 //CEREAL_REGISTER_TYPE(SmartPeak::SumOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::ProdOp<int>);
@@ -572,6 +955,12 @@ CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<float>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarianceOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarModOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::CountOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::GRUCellOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LogSoftMaxOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::SumErrorOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::ProdErrorOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MaxErrorOp<int>);
@@ -579,6 +968,13 @@ CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<float>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MeanErrorOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarModErrorOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::CountErrorOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellErrorOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputErrorOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::GRUCellErrorOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionErrorOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxErrorOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LogSoftMaxErrorOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxCrossEntropyErrorOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::SumWeightGradOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::ProdWeightGradOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MaxWeightGradOp<int>);
@@ -586,4 +982,9 @@ CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<float>);
 //CEREAL_REGISTER_TYPE(SmartPeak::CountWeightGradOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::MeanWeightGradOp<int>);
 //CEREAL_REGISTER_TYPE(SmartPeak::VarModWeightGradOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMCellWeightGradOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::LSTMOutputWeightGradOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::GRUCellWeightGradOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::DotProdAttentionWeightGradOp<int>);
+//CEREAL_REGISTER_TYPE(SmartPeak::SoftMaxWeightGradOp<int>);
 #endif //SMARTPEAK_INTEGRATIONFUNCTION_H
\ No newline at end of file
@@ -14,6 +14,10 @@
 #include <SmartPeak/ml/ActivationFunctionTensor.h>
 #include <unsupported/Eigen/CXX11/Tensor>
 #include <typeinfo>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 //#include <cereal/access.hpp>  // serialiation of private members
 //#undef min // clashes with std::limit on windows in polymorphic.hpp
@@ -34,6 +38,12 @@ public:
     ~IntegrationTensorOp() = default;
     virtual std::string getName() const = 0;
     virtual void operator()(TensorT* source_output, TensorT* weights, TensorT* sink_input, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) = 0;
+    /**
+      @brief Treat the memory as a ring buffer where the time step that precedes the oldest memory index
+        is the most recent memory index (see `ModelInterpreter::stepStreaming`).
+        Only used by the integration functions that read the previous time step of the sink layer.
+    */
+    virtual void setRingMemory(const bool& ring_memory) {};
 	protected:
 		TensorT eps_ = TensorT(1e-24);
     TensorT min_ = TensorT(-1e9);
@@ -399,6 +409,576 @@ public:
 	//	}
 	};
 
+	/**
+		@brief Routing of the gate source nodes to the cell sink nodes of a fused recurrent cell layer
+
+		The links between the gate layer and the cell layer are fixed and the value of each link weight
+			encodes the gate of the link (1 to n_gates).  The routing is recovered from the weights on the host
+			and cached for as long as the weight tensor does not change.
+
+		NOTE: the routing is state of the layer so the tensor ops that hold a routing are made for each layer
+			(see `OpToTensorOp::isStatefulTensorOp`)
+	*/
+	template<typename TensorT>
+	class FusedCellRouting
+	{
+	public:
+		/**
+			@brief Build the routing of each cell of the cell layer
+
+			@param[in] weights The fixed gate to cell link weights (source_layer_size x sink_layer_size)
+			@param[in] source_layer_size The number of gate nodes
+			@param[in] sink_layer_size The number of cell nodes
+			@param[in] n_gates The number of gate codes
+		*/
+		void setRouting(const TensorT* weights, const int& source_layer_size, const int& sink_layer_size, const int& n_gates)
+		{
+			if (weights == weights_ && source_layer_size == source_layer_size_ && sink_layer_size == sink_layer_size_) return;
+			n_gates_ = n_gates;
+			gate_rows_.assign(sink_layer_size * n_gates, -1);
+			for (int col = 0; col < sink_layer_size; ++col) {
+				for (int row = 0; row < source_layer_size; ++row) {
+					const int code = (int)std::round(weights[row + col * source_layer_size]);
+					if (code < 1 || code > n_gates) continue;
+					if (gate_rows_[col * n_gates + code - 1] >= 0) throwGates(col);
+					gate_rows_[col * n_gates + code - 1] = row;
+				}
+			}
+			weights_ = weights;
+			source_layer_size_ = source_layer_size;
+			sink_layer_size_ = sink_layer_size;
+		}
+		/// The row of the gate of a cell (or -1 if the gate is not linked to the cell)
+		int getGateRow(const int& cell, const int& gate) const { return gate_rows_[cell * n_gates_ + gate]; }
+		/// Check that only the gates [first_gate, last_gate] are linked to the cell
+		bool hasGates(const int& cell, const int& first_gate, const int& last_gate) const {
+			for (int gate = 0; gate < n_gates_; ++gate)
+				if ((gate >= first_gate && gate <= last_gate) != (getGateRow(cell, gate) >= 0)) return false;
+			return true;
+		}
+		/// Throw if the gates of a cell are not linked as expected
+		static void throwGates(const int& cell) {
+			const std::string error = "The gates of the fused cell node at position " + std::to_string(cell) + " are not linked as expected.";
+			throw std::runtime_error(error);
+		}
+	private:
+		const TensorT* weights_ = nullptr;
+		int source_layer_size_ = 0;
+		int sink_layer_size_ = 0;
+		int n_gates_ = 0;
+		std::vector<int> gate_rows_; ///< gate rows of each cell in the order of the gate codes
+	};
+
+	/**
+		@brief Fused LSTM cell integration function
+
+		All gates of a whole LSTM layer are computed in a single pass over the pre-activations of the gate layer
+			where the fixed link weights encode the gate of each link (1 input, 2 forget, and 3 block input gate for the
+			memory cell nodes and 4 for the output gate nodes; links with a weight of 0 are ignored).  The memory cell of the previous time step
+			is the memory cell input of the next memory index.
+
+			c = sigmoid(f) * c_prev + sigmoid(i) * tanh(g)
+			o = sigmoid(o)
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LSTMCellTensorOp : public IntegrationTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LSTMCellTensorOp() {};
+		~LSTMCellTensorOp() {};
+		void operator()(TensorT* source_output, TensorT* weights, TensorT* sink_input, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "LSTMCellTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weights, source_layer_size, sink_layer_size, 4);
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			const bool has_prev = ring_memory_ || sink_time_step + 1 < memory_size;
+			const int prev_offset = batch_size * ((sink_time_step + 1) % memory_size - sink_time_step);
+			for (int cell = 0; cell < sink_layer_size; ++cell) {
+				TensorT* sink_ptr = sink_input + sink_offset + batch_memory_size * cell;
+				if (routing_.hasGates(cell, 0, 2)) {
+					const TensorT* i_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 0);
+					const TensorT* f_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 1);
+					const TensorT* g_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 2);
+					for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+						const TensorT c_prev = (has_prev) ? sink_ptr[batch_iter + prev_offset] : TensorT(0);
+						sink_ptr[batch_iter] = std::min(std::max(sigmoid(f_ptr[batch_iter]) * c_prev + sigmoid(i_ptr[batch_iter]) * std::tanh(g_ptr[batch_iter]), this->min_), this->max_);
+					}
+				}
+				else if (routing_.hasGates(cell, 3, 3)) {
+					const TensorT* o_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 3);
+					for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+						sink_ptr[batch_iter] = sigmoid(o_ptr[batch_iter]);
+				}
+				else routing_.throwGates(cell);
+			}
+		}
+		std::string getName() const { return "LSTMCellTensorOp"; };
+		void setRingMemory(const bool& ring_memory) override { ring_memory_ = ring_memory; };
+	private:
+		static TensorT sigmoid(const TensorT& x) { return TensorT(1) / (TensorT(1) + std::exp(-x)); }
+		FusedCellRouting<TensorT> routing_;
+		bool ring_memory_ = false;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused LSTM output integration function
+
+		The outputs of a whole LSTM layer are computed in a single pass over the LSTM cell layer
+			where the fixed link weights encode the source of each link (1 memory cell and 2 output gate).
+
+			h = o * tanh(c)
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LSTMOutputTensorOp : public IntegrationTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LSTMOutputTensorOp() {};
+		~LSTMOutputTensorOp() {};
+		void operator()(TensorT* source_output, TensorT* weights, TensorT* sink_input, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "LSTMOutputTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weights, source_layer_size, sink_layer_size, 2);
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (int cell = 0; cell < sink_layer_size; ++cell) {
+				if (!routing_.hasGates(cell, 0, 1)) routing_.throwGates(cell);
+				const TensorT* c_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 0);
+				const TensorT* o_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 1);
+				TensorT* h_ptr = sink_input + sink_offset + batch_memory_size * cell;
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+					h_ptr[batch_iter] = o_ptr[batch_iter] * std::tanh(c_ptr[batch_iter]);
+			}
+		}
+		std::string getName() const { return "LSTMOutputTensorOp"; };
+	private:
+		FusedCellRouting<TensorT> routing_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused GRU cell integration function
+
+		All gates of a whole GRU layer are computed in a single pass over the pre-activations of the gate layer
+			where the fixed link weights encode the gate of each link (1 update gate, 2 reset gate, 3 input candidate,
+			and 4 recurrent candidate).  The reset gate is applied after the recurrent weights (i.e., as in cuDNN)
+			and the output of the previous time step is the output input of the next memory index.
+
+			n = tanh(nx + sigmoid(r) * nh)
+			h = (1 - sigmoid(z)) * n + sigmoid(z) * h_prev
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class GRUCellTensorOp : public IntegrationTensorOp<TensorT, DeviceT>
+	{
+	public:
+		GRUCellTensorOp() {};
+		~GRUCellTensorOp() {};
+		void operator()(TensorT* source_output, TensorT* weights, TensorT* sink_input, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "GRUCellTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weights, source_layer_size, sink_layer_size, 4);
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			const bool has_prev = ring_memory_ || sink_time_step + 1 < memory_size;
+			const int prev_offset = batch_size * ((sink_time_step + 1) % memory_size - sink_time_step);
+			for (int cell = 0; cell < sink_layer_size; ++cell) {
+				if (!routing_.hasGates(cell, 0, 3)) routing_.throwGates(cell);
+				const TensorT* z_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 0);
+				const TensorT* r_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 1);
+				const TensorT* nx_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 2);
+				const TensorT* nh_ptr = source_output + source_offset + batch_memory_size * routing_.getGateRow(cell, 3);
+				TensorT* h_ptr = sink_input + sink_offset + batch_memory_size * cell;
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					const TensorT h_prev = (has_prev) ? h_ptr[batch_iter + prev_offset] : TensorT(0);
+					const TensorT z = sigmoid(z_ptr[batch_iter]);
+					const TensorT n = std::tanh(nx_ptr[batch_iter] + sigmoid(r_ptr[batch_iter]) * nh_ptr[batch_iter]);
+					h_ptr[batch_iter] = (TensorT(1) - z) * n + z * h_prev;
+				}
+			}
+		}
+		std::string getName() const { return "GRUCellTensorOp"; };
+		void setRingMemory(const bool& ring_memory) override { ring_memory_ = ring_memory; };
+	private:
+		static TensorT sigmoid(const TensorT& x) { return TensorT(1) / (TensorT(1) + std::exp(-x)); }
+		FusedCellRouting<TensorT> routing_;
+		bool ring_memory_ = false;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Routing of the projection source nodes to the attention sink nodes of a fused attention layer
+
+		The links between the projection layer and the attention layer are fixed and the value of each link weight
+			encodes the role of the link: 3*i+1 for the query and 3*i+2 for the key of position i of the head and
+			3*j+3 for the values of the position j of the attention node (links with a weight of 0 are ignored).  Attention nodes that are linked to the same queries and keys
+			make up a head.  The routing is recovered from the weights on the host and cached for as long as the weight tensor does not change.
+
+		NOTE: the routing and the softmax buffers are state of the layer so the attention tensor ops are made for each layer
+			(see `OpToTensorOp::isStatefulTensorOp`)
+	*/
+	template<typename TensorT>
+	class FusedAttentionRouting
+	{
+	public:
+		/// The query and key rows of a head and its attention nodes
+		struct Head {
+			std::vector<int> query_rows;
+			std::vector<int> key_rows;
+			std::vector<int> cells;
+		};
+
+		/**
+			@brief Build the routing of each head of the attention layer
+
+			@param[in] weights The fixed projection to attention link weights (source_layer_size x sink_layer_size)
+			@param[in] source_layer_size The number of projection nodes
+			@param[in] sink_layer_size The number of attention nodes
+		*/
+		void setRouting(const TensorT* weights, const int& source_layer_size, const int& sink_layer_size)
+		{
+			if (weights == weights_ && source_layer_size == source_layer_size_ && sink_layer_size == sink_layer_size_) return;
+			heads_.clear();
+			value_rows_.assign(sink_layer_size, -1);
+			positions_.assign(sink_layer_size, -1);
+			for (int col = 0; col < sink_layer_size; ++col) {
+				Head head;
+				for (int row = 0; row < source_layer_size; ++row) {
+					const int code = (int)std::round(weights[row + col * source_layer_size]);
+					if (code < 1) continue;
+					const int position = (code - 1) / 3;
+					if ((code - 1) % 3 == 2) {
+						if (value_rows_[col] >= 0) throwLinks(col);
+						value_rows_[col] = row;
+						positions_[col] = position;
+						continue;
+					}
+					std::vector<int>& rows = ((code - 1) % 3 == 0) ? head.query_rows : head.key_rows;
+					if (rows.size() <= position) rows.resize(position + 1, -1);
+					if (rows[position] >= 0) throwLinks(col);
+					rows[position] = row;
+				}
+				if (value_rows_[col] < 0 || head.query_rows.size() != head.key_rows.size() || positions_[col] >= head.query_rows.size() ||
+					std::count(head.query_rows.begin(), head.query_rows.end(), -1) > 0 || std::count(head.key_rows.begin(), head.key_rows.end(), -1) > 0)
+					throwLinks(col);
+
+				// add the attention node to its head
+				auto found = std::find_if(heads_.begin(), heads_.end(), [&head](const Head& other) {
+					return other.query_rows == head.query_rows && other.key_rows == head.key_rows; });
+				if (found == heads_.end()) {
+					head.cells.push_back(col);
+					heads_.push_back(head);
+				}
+				else found->cells.push_back(col);
+			}
+			weights_ = weights;
+			source_layer_size_ = source_layer_size;
+			sink_layer_size_ = sink_layer_size;
+		}
+		const std::vector<Head>& getHeads() const { return heads_; }
+		/// The row of the values of an attention node
+		int getValueRow(const int& cell) const { return value_rows_[cell]; }
+		/// The position of an attention node in its head
+		int getPosition(const int& cell) const { return positions_[cell]; }
+		/// Throw if the projections of an attention node are not linked as expected
+		static void throwLinks(const int& cell) {
+			const std::string error = "The projections of the fused attention node at position " + std::to_string(cell) + " are not linked as expected.";
+			throw std::runtime_error(error);
+		}
+	private:
+		const TensorT* weights_ = nullptr;
+		int source_layer_size_ = 0;
+		int sink_layer_size_ = 0;
+		std::vector<Head> heads_;
+		std::vector<int> value_rows_; ///< values row of each attention node
+		std::vector<int> positions_; ///< position of each attention node in its head
+	};
+
+	/**
+		@brief Fused scaled dot product attention integration function
+
+		The scores, the numerically stable softmax, and the weighting of the values of all heads of an attention layer
+			are computed in a single pass over the query, key, and values projections of the source layer
+			(see `FusedAttentionRouting` for how the projections are linked).  As in `ModelBuilder::addDotProdAttention`,
+			the scores of a head are the scaled element-wise products of its queries and keys
+
+			a_j = softmax(q * k / sqrt(n))_j * v_j
+
+			where n is the number of positions of the head.
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class DotProdAttentionTensorOp : public IntegrationTensorOp<TensorT, DeviceT>
+	{
+	public:
+		DotProdAttentionTensorOp() {};
+		~DotProdAttentionTensorOp() {};
+		void operator()(TensorT* source_output, TensorT* weights, TensorT* sink_input, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "DotProdAttentionTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weights, source_layer_size, sink_layer_size);
+			const TensorT* source_ptr = source_output + batch_size * source_time_step;
+			TensorT* sink_ptr = sink_input + batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (const auto& head : routing_.getHeads()) {
+				const int n_positions = head.query_rows.size();
+				const TensorT scale = TensorT(1) / std::sqrt(TensorT(n_positions));
+				probabilities_.resize(n_positions);
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					// stable softmax of the scores
+					TensorT max_score = std::numeric_limits<TensorT>::lowest();
+					for (int position = 0; position < n_positions; ++position) {
+						probabilities_[position] = source_ptr[batch_memory_size * head.query_rows[position] + batch_iter] * source_ptr[batch_memory_size * head.key_rows[position] + batch_iter] * scale;
+						max_score = std::max(max_score, probabilities_[position]);
+					}
+					TensorT sum = TensorT(0);
+					for (TensorT& probability : probabilities_) {
+						probability = std::exp(probability - max_score);
+						sum += probability;
+					}
+
+					// weight the values
+					for (const int& cell : head.cells)
+						sink_ptr[batch_memory_size * cell + batch_iter] = probabilities_[routing_.getPosition(cell)] / sum * source_ptr[batch_memory_size * routing_.getValueRow(cell) + batch_iter];
+				}
+			}
+		}
+		std::string getName() const { return "DotProdAttentionTensorOp"; };
+	private:
+		FusedAttentionRouting<TensorT> routing_;
+		std::vector<TensorT> probabilities_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Routing of the source nodes to the sink nodes of a fused softmax layer
+
+		The links between the source layer and the softmax layer are fixed and the value of each link weight
+			encodes the role of the link: 2 for the input of the softmax node and 1 for the other inputs that the softmax
+			is normalized over (links with a weight of 0 are ignored).  Softmax nodes that are linked to the same inputs make up a group.
+			The routing is recovered from the weights on the host and cached for as long as the weight tensor does not change.
+
+		NOTE: the routing and the softmax buffers are state of the layer so the softmax tensor ops are made for each layer
+			(see `OpToTensorOp::isStatefulTensorOp`).  The forward ops write the (log) probabilities to the layer tensor and
+			the error ops recompute them from the layer outputs so no probabilities are kept between the forward and backward passes.
+	*/
+	template<typename TensorT>
+	class FusedSoftMaxRouting
+	{
+	public:
+		/// The input rows of a group and its softmax nodes
+		struct Group {
+			std::vector<int> rows;
+			std::vector<int> cells;
+		};
+
+		/**
+			@brief Build the routing of each group of the softmax layer
+
+			@param[in] weights The fixed source to softmax link weights (source_layer_size x sink_layer_size)
+			@param[in] source_layer_size The number of source nodes
+			@param[in] sink_layer_size The number of softmax nodes
+		*/
+		void setRouting(const TensorT* weights, const int& source_layer_size, const int& sink_layer_size)
+		{
+			if (weights == weights_ && source_layer_size == source_layer_size_ && sink_layer_size == sink_layer_size_) return;
+			groups_.clear();
+			positions_.assign(sink_layer_size, -1);
+			for (int col = 0; col < sink_layer_size; ++col) {
+				Group group;
+				for (int row = 0; row < source_layer_size; ++row) {
+					const int code = (int)std::round(weights[row + col * source_layer_size]);
+					if (code < 1) continue;
+					if (code == 2) {
+						if (positions_[col] >= 0) throwLinks(col);
+						positions_[col] = group.rows.size();
+					}
+					group.rows.push_back(row);
+				}
+				if (positions_[col] < 0) throwLinks(col);
+
+				// add the softmax node to its group
+				auto found = std::find_if(groups_.begin(), groups_.end(), [&group](const Group& other) { return other.rows == group.rows; });
+				if (found == groups_.end()) {
+					group.cells.push_back(col);
+					groups_.push_back(group);
+				}
+				else found->cells.push_back(col);
+			}
+			weights_ = weights;
+			source_layer_size_ = source_layer_size;
+			sink_layer_size_ = sink_layer_size;
+		}
+		const std::vector<Group>& getGroups() const { return groups_; }
+		/// The position of the input of a softmax node in its group
+		int getPosition(const int& cell) const { return positions_[cell]; }
+		/// Throw if the inputs of a softmax node are not linked as expected
+		static void throwLinks(const int& cell) {
+			const std::string error = "The inputs of the fused softmax node at position " + std::to_string(cell) + " are not linked as expected.";
+			throw std::runtime_error(error);
+		}
+
+		/**
+			@brief Numerically stable softmax of the inputs of a group
+
+			@param[in] values The input values of the first batch
+			@param[in] stride The distance between the values of consecutive rows
+			@param[in] rows The input rows of the group
+			@param[out] probabilities The softmax of the inputs
+			@param[out] max_value The max of the inputs
+
+			@returns The log of the sum of the exponentials of the max offset inputs
+		*/
+		static TensorT softMax(const TensorT* values, const int& stride, const std::vector<int>& rows, std::vector<TensorT>& probabilities, TensorT& max_value) {
+			probabilities.resize(rows.size());
+			max_value = std::numeric_limits<TensorT>::lowest();
+			for (const int& row : rows) max_value = std::max(max_value, values[stride * row]);
+			TensorT sum = TensorT(0);
+			for (size_t position = 0; position < rows.size(); ++position) {
+				probabilities[position] = std::exp(values[stride * rows[position]] - max_value);
+				sum += probabilities[position];
+			}
+			for (TensorT& probability : probabilities) probability /= sum;
+			return std::log(sum);
+		}
+	private:
+		const TensorT* weights_ = nullptr;
+		int source_layer_size_ = 0;
+		int sink_layer_size_ = 0;
+		std::vector<Group> groups_;
+		std::vector<int> positions_; ///< position of the input of each softmax node in its group
+	};
+
+	/**
+		@brief Fused numerically stable softmax integration function
+
+		The max offset, the exponentials, the sum, and the normalization of each group of a softmax layer
+			are computed in a single pass over the source layer (see `FusedSoftMaxRouting` for how the inputs are linked)
+
+			y_j = exp(x_j - max(x)) / sum(exp(x - max(x)))
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class SoftMaxTensorOp : public IntegrationTensorOp<TensorT, DeviceT>
+	{
+	public:
+		SoftMaxTensorOp() {};
+		~SoftMaxTensorOp() {};
+		void operator()(TensorT* source_output, TensorT* weights, TensorT* sink_input, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "SoftMaxTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weights, source_layer_size, sink_layer_size);
+			const TensorT* source_ptr = source_output + batch_size * source_time_step;
+			TensorT* sink_ptr = sink_input + batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (const auto& group : routing_.getGroups()) {
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					TensorT max_value;
+					routing_.softMax(source_ptr + batch_iter, batch_memory_size, group.rows, probabilities_, max_value);
+					for (const int& cell : group.cells)
+						sink_ptr[batch_memory_size * cell + batch_iter] = probabilities_[routing_.getPosition(cell)];
+				}
+			}
+		}
+		std::string getName() const { return "SoftMaxTensorOp"; };
+	private:
+		FusedSoftMaxRouting<TensorT> routing_;
+		std::vector<TensorT> probabilities_; ///< softmax of the group of a single batch (scratch buffer of the layer)
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused numerically stable log softmax integration function
+
+		The log softmax of each group of a softmax layer is computed in a single pass over the source layer
+			(see `FusedSoftMaxRouting` for how the inputs are linked)
+
+			y_j = x_j - max(x) - log(sum(exp(x - max(x))))
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LogSoftMaxTensorOp : public IntegrationTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LogSoftMaxTensorOp() {};
+		~LogSoftMaxTensorOp() {};
+		void operator()(TensorT* source_output, TensorT* weights, TensorT* sink_input, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "LogSoftMaxTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weights, source_layer_size, sink_layer_size);
+			const TensorT* source_ptr = source_output + batch_size * source_time_step;
+			TensorT* sink_ptr = sink_input + batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (const auto& group : routing_.getGroups()) {
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					TensorT max_value;
+					const TensorT log_sum = routing_.softMax(source_ptr + batch_iter, batch_memory_size, group.rows, probabilities_, max_value);
+					for (const int& cell : group.cells)
+						sink_ptr[batch_memory_size * cell + batch_iter] = (source_ptr[batch_memory_size * group.rows[routing_.getPosition(cell)] + batch_iter] - max_value) - log_sum;
+				}
+			}
+		}
+		std::string getName() const { return "LogSoftMaxTensorOp"; };
+	private:
+		FusedSoftMaxRouting<TensorT> routing_;
+		std::vector<TensorT> probabilities_; ///< softmax of the group of a single batch (scratch buffer of the layer)
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
 	/**
 	@brief Base class for all integration error functions.
 	*/
@@ -746,6 +1326,422 @@ public:
 	//	}
 	};
 
+	/**
+		@brief Fused LSTM cell integration error function
+
+		The errors of the memory cell and output gate nodes are propogated to the gate pre-activations in a single pass
+			and the memory cell error is carried to the previous time step (i.e., the next memory index) through the forget gate.
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LSTMCellErrorTensorOp : public IntegrationErrorTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LSTMCellErrorTensorOp() {};
+		~LSTMCellErrorTensorOp() {};
+		void operator()(TensorT* source_error, TensorT *source_input, TensorT* weight, TensorT* sink_output, TensorT* sink_error, TensorT* sink_derivative, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "LSTMCellErrorTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weight, sink_layer_size, source_layer_size, 4); // NOTE: source/sink are reversed
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			const bool has_prev = source_time_step + 1 < memory_size;
+			for (int cell = 0; cell < source_layer_size; ++cell) {
+				const int cell_pos = source_offset + batch_memory_size * cell;
+				if (routing_.hasGates(cell, 0, 2)) {
+					int gate_pos[3];
+					for (int gate = 0; gate < 3; ++gate) gate_pos[gate] = sink_offset + batch_memory_size * routing_.getGateRow(cell, gate);
+					for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+						const TensorT i = sigmoid(sink_output[gate_pos[0] + batch_iter]);
+						const TensorT f = sigmoid(sink_output[gate_pos[1] + batch_iter]);
+						const TensorT g = std::tanh(sink_output[gate_pos[2] + batch_iter]);
+						const TensorT c_prev = (has_prev) ? source_input[cell_pos + batch_iter + batch_size] : TensorT(0);
+						const TensorT dc = source_error[cell_pos + batch_iter];
+						const TensorT gate_error[3] = { dc * g * i * (TensorT(1) - i), dc * c_prev * f * (TensorT(1) - f), dc * i * (TensorT(1) - g * g) };
+						for (int gate = 0; gate < 3; ++gate) {
+							const int pos = gate_pos[gate] + batch_iter;
+							sink_error[pos] = std::min(std::max(sink_error[pos] + gate_error[gate] * sink_derivative[pos], this->min_), this->max_);
+						}
+						if (has_prev) source_error[cell_pos + batch_iter + batch_size] += dc * f;
+					}
+				}
+				else if (routing_.hasGates(cell, 3, 3)) {
+					const int o_pos = sink_offset + batch_memory_size * routing_.getGateRow(cell, 3);
+					for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+						const TensorT o = source_input[cell_pos + batch_iter];
+						const int pos = o_pos + batch_iter;
+						sink_error[pos] = std::min(std::max(sink_error[pos] + source_error[cell_pos + batch_iter] * o * (TensorT(1) - o) * sink_derivative[pos], this->min_), this->max_);
+					}
+				}
+				else routing_.throwGates(cell);
+			}
+		}
+		std::string getName() const { return "LSTMCellErrorTensorOp"; };
+	private:
+		static TensorT sigmoid(const TensorT& x) { return TensorT(1) / (TensorT(1) + std::exp(-x)); }
+		FusedCellRouting<TensorT> routing_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationErrorTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused LSTM output integration error function
+
+		The errors of the output nodes are propogated to the memory cell and output gate nodes in a single pass.
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LSTMOutputErrorTensorOp : public IntegrationErrorTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LSTMOutputErrorTensorOp() {};
+		~LSTMOutputErrorTensorOp() {};
+		void operator()(TensorT* source_error, TensorT *source_input, TensorT* weight, TensorT* sink_output, TensorT* sink_error, TensorT* sink_derivative, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "LSTMOutputErrorTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weight, sink_layer_size, source_layer_size, 2); // NOTE: source/sink are reversed
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (int cell = 0; cell < source_layer_size; ++cell) {
+				if (!routing_.hasGates(cell, 0, 1)) routing_.throwGates(cell);
+				const int c_pos = sink_offset + batch_memory_size * routing_.getGateRow(cell, 0);
+				const int o_pos = sink_offset + batch_memory_size * routing_.getGateRow(cell, 1);
+				const int h_pos = source_offset + batch_memory_size * cell;
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					const TensorT tanh_c = std::tanh(sink_output[c_pos + batch_iter]);
+					const TensorT dh = source_error[h_pos + batch_iter];
+					sink_error[c_pos + batch_iter] = std::min(std::max(sink_error[c_pos + batch_iter] + dh * sink_output[o_pos + batch_iter] * (TensorT(1) - tanh_c * tanh_c) * sink_derivative[c_pos + batch_iter], this->min_), this->max_);
+					sink_error[o_pos + batch_iter] = std::min(std::max(sink_error[o_pos + batch_iter] + dh * tanh_c * sink_derivative[o_pos + batch_iter], this->min_), this->max_);
+				}
+			}
+		}
+		std::string getName() const { return "LSTMOutputErrorTensorOp"; };
+	private:
+		FusedCellRouting<TensorT> routing_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationErrorTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused GRU cell integration error function
+
+		The errors of the output nodes are propogated to the gate pre-activations in a single pass
+			and carried to the previous time step (i.e., the next memory index) through the update gate.
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class GRUCellErrorTensorOp : public IntegrationErrorTensorOp<TensorT, DeviceT>
+	{
+	public:
+		GRUCellErrorTensorOp() {};
+		~GRUCellErrorTensorOp() {};
+		void operator()(TensorT* source_error, TensorT *source_input, TensorT* weight, TensorT* sink_output, TensorT* sink_error, TensorT* sink_derivative, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "GRUCellErrorTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weight, sink_layer_size, source_layer_size, 4); // NOTE: source/sink are reversed
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			const bool has_prev = source_time_step + 1 < memory_size;
+			for (int cell = 0; cell < source_layer_size; ++cell) {
+				if (!routing_.hasGates(cell, 0, 3)) routing_.throwGates(cell);
+				int gate_pos[4];
+				for (int gate = 0; gate < 4; ++gate) gate_pos[gate] = sink_offset + batch_memory_size * routing_.getGateRow(cell, gate);
+				const int h_pos = source_offset + batch_memory_size * cell;
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					const TensorT z = sigmoid(sink_output[gate_pos[0] + batch_iter]);
+					const TensorT r = sigmoid(sink_output[gate_pos[1] + batch_iter]);
+					const TensorT nh = sink_output[gate_pos[3] + batch_iter];
+					const TensorT n = std::tanh(sink_output[gate_pos[2] + batch_iter] + r * nh);
+					const TensorT h_prev = (has_prev) ? source_input[h_pos + batch_iter + batch_size] : TensorT(0);
+					const TensorT dh = source_error[h_pos + batch_iter];
+					const TensorT dn = dh * (TensorT(1) - z) * (TensorT(1) - n * n);
+					const TensorT gate_error[4] = { dh * (h_prev - n) * z * (TensorT(1) - z), dn * nh * r * (TensorT(1) - r), dn, dn * r };
+					for (int gate = 0; gate < 4; ++gate) {
+						const int pos = gate_pos[gate] + batch_iter;
+						sink_error[pos] = std::min(std::max(sink_error[pos] + gate_error[gate] * sink_derivative[pos], this->min_), this->max_);
+					}
+					if (has_prev) source_error[h_pos + batch_iter + batch_size] += dh * z;
+				}
+			}
+		}
+		std::string getName() const { return "GRUCellErrorTensorOp"; };
+	private:
+		static TensorT sigmoid(const TensorT& x) { return TensorT(1) / (TensorT(1) + std::exp(-x)); }
+		FusedCellRouting<TensorT> routing_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationErrorTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused scaled dot product attention integration error function
+
+		The errors of the queries, keys, and values of all heads are computed in a single pass
+			using the analytic gradient of the softmax
+
+			ds_i = p_i * (dp_i - sum_j(p_j * dp_j))
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class DotProdAttentionErrorTensorOp : public IntegrationErrorTensorOp<TensorT, DeviceT>
+	{
+	public:
+		DotProdAttentionErrorTensorOp() {};
+		~DotProdAttentionErrorTensorOp() {};
+		void operator()(TensorT* source_error, TensorT *source_input, TensorT* weight, TensorT* sink_output, TensorT* sink_error, TensorT* sink_derivative, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "DotProdAttentionErrorTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weight, sink_layer_size, source_layer_size); // NOTE: source/sink are reversed
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			auto add_error = [&](const int& pos, const TensorT& error) {
+				sink_error[pos] = std::min(std::max(sink_error[pos] + error * sink_derivative[pos], this->min_), this->max_);
+			};
+			for (const auto& head : routing_.getHeads()) {
+				const int n_positions = head.query_rows.size();
+				const TensorT scale = TensorT(1) / std::sqrt(TensorT(n_positions));
+				probabilities_.resize(n_positions);
+				probability_errors_.resize(n_positions);
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					// recompute the softmax of the scores
+					TensorT max_score = std::numeric_limits<TensorT>::lowest();
+					for (int position = 0; position < n_positions; ++position) {
+						probabilities_[position] = sink_output[sink_offset + batch_memory_size * head.query_rows[position] + batch_iter] * sink_output[sink_offset + batch_memory_size * head.key_rows[position] + batch_iter] * scale;
+						max_score = std::max(max_score, probabilities_[position]);
+					}
+					TensorT sum = TensorT(0);
+					for (TensorT& probability : probabilities_) {
+						probability = std::exp(probability - max_score);
+						sum += probability;
+					}
+					for (TensorT& probability : probabilities_) probability /= sum;
+
+					// values and attention errors
+					std::fill(probability_errors_.begin(), probability_errors_.end(), TensorT(0));
+					for (const int& cell : head.cells) {
+						const TensorT error = source_error[source_offset + batch_memory_size * cell + batch_iter];
+						const int value_pos = sink_offset + batch_memory_size * routing_.getValueRow(cell) + batch_iter;
+						probability_errors_[routing_.getPosition(cell)] += error * sink_output[value_pos];
+						add_error(value_pos, error * probabilities_[routing_.getPosition(cell)]);
+					}
+
+					// query and key errors
+					TensorT weighted_sum = TensorT(0);
+					for (int position = 0; position < n_positions; ++position)
+						weighted_sum += probabilities_[position] * probability_errors_[position];
+					for (int position = 0; position < n_positions; ++position) {
+						const TensorT score_error = probabilities_[position] * (probability_errors_[position] - weighted_sum) * scale;
+						const int query_pos = sink_offset + batch_memory_size * head.query_rows[position] + batch_iter;
+						const int key_pos = sink_offset + batch_memory_size * head.key_rows[position] + batch_iter;
+						add_error(query_pos, score_error * sink_output[key_pos]);
+						add_error(key_pos, score_error * sink_output[query_pos]);
+					}
+				}
+			}
+		}
+		std::string getName() const { return "DotProdAttentionErrorTensorOp"; };
+	private:
+		FusedAttentionRouting<TensorT> routing_;
+		std::vector<TensorT> probabilities_;
+		std::vector<TensorT> probability_errors_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationErrorTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused numerically stable softmax integration error function
+
+		The errors of the inputs of each group are computed in a single pass using the analytic gradient of the softmax
+
+			dx_i = y_i * (dy_i - sum_j(y_j * dy_j))
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class SoftMaxErrorTensorOp : public IntegrationErrorTensorOp<TensorT, DeviceT>
+	{
+	public:
+		SoftMaxErrorTensorOp() {};
+		~SoftMaxErrorTensorOp() {};
+		void operator()(TensorT* source_error, TensorT *source_input, TensorT* weight, TensorT* sink_output, TensorT* sink_error, TensorT* sink_derivative, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "SoftMaxErrorTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weight, sink_layer_size, source_layer_size); // NOTE: source/sink are reversed
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (const auto& group : routing_.getGroups()) {
+				output_errors_.resize(group.rows.size());
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					// recompute the softmax and gather the errors of the softmax nodes by input
+					TensorT max_value;
+					routing_.softMax(sink_output + sink_offset + batch_iter, batch_memory_size, group.rows, probabilities_, max_value);
+					std::fill(output_errors_.begin(), output_errors_.end(), TensorT(0));
+					for (const int& cell : group.cells)
+						output_errors_[routing_.getPosition(cell)] += source_error[source_offset + batch_memory_size * cell + batch_iter];
+					TensorT weighted_sum = TensorT(0);
+					for (size_t position = 0; position < group.rows.size(); ++position)
+						weighted_sum += probabilities_[position] * output_errors_[position];
+					for (size_t position = 0; position < group.rows.size(); ++position) {
+						const int pos = sink_offset + batch_memory_size * group.rows[position] + batch_iter;
+						const TensorT error = probabilities_[position] * (output_errors_[position] - weighted_sum);
+						sink_error[pos] = std::min(std::max(sink_error[pos] + error * sink_derivative[pos], this->min_), this->max_);
+					}
+				}
+			}
+		}
+		std::string getName() const { return "SoftMaxErrorTensorOp"; };
+	private:
+		FusedSoftMaxRouting<TensorT> routing_;
+		std::vector<TensorT> probabilities_; ///< softmax of the group of a single batch (scratch buffer of the layer)
+		std::vector<TensorT> output_errors_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationErrorTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused numerically stable log softmax integration error function
+
+		The errors of the inputs of each group are computed in a single pass using the analytic gradient of the log softmax
+
+			dx_i = dy_i - softmax(x)_i * sum_j(dy_j)
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LogSoftMaxErrorTensorOp : public IntegrationErrorTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LogSoftMaxErrorTensorOp() {};
+		~LogSoftMaxErrorTensorOp() {};
+		void operator()(TensorT* source_error, TensorT *source_input, TensorT* weight, TensorT* sink_output, TensorT* sink_error, TensorT* sink_derivative, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "LogSoftMaxErrorTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weight, sink_layer_size, source_layer_size); // NOTE: source/sink are reversed
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (const auto& group : routing_.getGroups()) {
+				output_errors_.resize(group.rows.size());
+				for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+					// recompute the softmax and gather the errors of the softmax nodes by input
+					TensorT max_value;
+					routing_.softMax(sink_output + sink_offset + batch_iter, batch_memory_size, group.rows, probabilities_, max_value);
+					std::fill(output_errors_.begin(), output_errors_.end(), TensorT(0));
+					TensorT error_sum = TensorT(0);
+					for (const int& cell : group.cells) {
+						const TensorT error = source_error[source_offset + batch_memory_size * cell + batch_iter];
+						output_errors_[routing_.getPosition(cell)] += error;
+						error_sum += error;
+					}
+					for (size_t position = 0; position < group.rows.size(); ++position) {
+						const int pos = sink_offset + batch_memory_size * group.rows[position] + batch_iter;
+						const TensorT error = output_errors_[position] - probabilities_[position] * error_sum;
+						sink_error[pos] = std::min(std::max(sink_error[pos] + error * sink_derivative[pos], this->min_), this->max_);
+					}
+				}
+			}
+		}
+		std::string getName() const { return "LogSoftMaxErrorTensorOp"; };
+	private:
+		FusedSoftMaxRouting<TensorT> routing_;
+		std::vector<TensorT> probabilities_; ///< softmax of the group of a single batch (scratch buffer of the layer)
+		std::vector<TensorT> output_errors_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationErrorTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+		@brief Fused softmax and cross entropy integration error function
+
+		The softmax nodes are output nodes whose loss function gradient is already the gradient with respect to the
+			inputs of the softmax (e.g., `CrossEntropyWithLogitsLossGradTensorOp` evaluated on the softmax outputs
+			gives (y * sum(expected) - expected) / n), so the error of each softmax node is passed directly to its input
+
+			dx_i = dy_i
+
+		NOTE: only implemented for the DefaultDevice
+	*/
+	template<typename TensorT, typename DeviceT>
+	class SoftMaxCrossEntropyErrorTensorOp : public IntegrationErrorTensorOp<TensorT, DeviceT>
+	{
+	public:
+		SoftMaxCrossEntropyErrorTensorOp() {};
+		~SoftMaxCrossEntropyErrorTensorOp() {};
+		void operator()(TensorT* source_error, TensorT *source_input, TensorT* weight, TensorT* sink_output, TensorT* sink_error, TensorT* sink_derivative, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, const int& source_time_step, const int& sink_time_step, DeviceT& device) {
+			if (typeid(device).name() != typeid(Eigen::DefaultDevice).name()) {
+				const std::string error = "SoftMaxCrossEntropyErrorTensorOp is only implemented for the DefaultDevice.";
+				throw std::runtime_error(error);
+			}
+			routing_.setRouting(weight, sink_layer_size, source_layer_size); // NOTE: source/sink are reversed
+			const int source_offset = batch_size * source_time_step;
+			const int sink_offset = batch_size * sink_time_step;
+			const int batch_memory_size = batch_size * memory_size;
+			for (const auto& group : routing_.getGroups()) {
+				for (const int& cell : group.cells) {
+					const TensorT* error_ptr = source_error + source_offset + batch_memory_size * cell;
+					const int sink_pos = sink_offset + batch_memory_size * group.rows[routing_.getPosition(cell)];
+					for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+						const int pos = sink_pos + batch_iter;
+						sink_error[pos] = std::min(std::max(sink_error[pos] + error_ptr[batch_iter] * sink_derivative[pos], this->min_), this->max_);
+					}
+				}
+			}
+		}
+		std::string getName() const { return "SoftMaxCrossEntropyErrorTensorOp"; };
+	private:
+		FusedSoftMaxRouting<TensorT> routing_;
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationErrorTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
 	/**
 	@brief Base class for all integration error functions.
 	*/
@@ -1067,6 +2063,126 @@ public:
 	//		archive(cereal::base_class<IntegrationWeightGradTensorOp<TensorT, DeviceT>>(this));
 	//	}
 	};
+
+	/**
+	@brief Fused LSTM cell integration weight gradient function
+
+	The gate to cell links only route the gate pre-activations and are not trained.
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LSTMCellWeightGradTensorOp : public IntegrationWeightGradTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LSTMCellWeightGradTensorOp() {};
+		~LSTMCellWeightGradTensorOp() {};
+		void operator()(TensorT* sink_error, TensorT* source_output, TensorT* weight, TensorT* source_input, TensorT* weight_error, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, DeviceT& device) {
+			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> weight_error_tensor(weight_error, source_layer_size, sink_layer_size);
+			weight_error_tensor.device(device) = weight_error_tensor.constant(TensorT(0));
+		};
+		std::string getName() const { return "LSTMCellWeightGradTensorOp"; };
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationWeightGradTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+	@brief Fused LSTM output integration weight gradient function
+
+	The memory cell and output gate to output links only route the LSTM cell layer and are not trained.
+	*/
+	template<typename TensorT, typename DeviceT>
+	class LSTMOutputWeightGradTensorOp : public IntegrationWeightGradTensorOp<TensorT, DeviceT>
+	{
+	public:
+		LSTMOutputWeightGradTensorOp() {};
+		~LSTMOutputWeightGradTensorOp() {};
+		void operator()(TensorT* sink_error, TensorT* source_output, TensorT* weight, TensorT* source_input, TensorT* weight_error, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, DeviceT& device) {
+			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> weight_error_tensor(weight_error, source_layer_size, sink_layer_size);
+			weight_error_tensor.device(device) = weight_error_tensor.constant(TensorT(0));
+		};
+		std::string getName() const { return "LSTMOutputWeightGradTensorOp"; };
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationWeightGradTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+	@brief Fused GRU cell integration weight gradient function
+
+	The gate to cell links only route the gate pre-activations and are not trained.
+	*/
+	template<typename TensorT, typename DeviceT>
+	class GRUCellWeightGradTensorOp : public IntegrationWeightGradTensorOp<TensorT, DeviceT>
+	{
+	public:
+		GRUCellWeightGradTensorOp() {};
+		~GRUCellWeightGradTensorOp() {};
+		void operator()(TensorT* sink_error, TensorT* source_output, TensorT* weight, TensorT* source_input, TensorT* weight_error, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, DeviceT& device) {
+			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> weight_error_tensor(weight_error, source_layer_size, sink_layer_size);
+			weight_error_tensor.device(device) = weight_error_tensor.constant(TensorT(0));
+		};
+		std::string getName() const { return "GRUCellWeightGradTensorOp"; };
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationWeightGradTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+	@brief Fused scaled dot product attention integration weight gradient function
+
+	The projection to attention links only route the projections and are not trained.
+	*/
+	template<typename TensorT, typename DeviceT>
+	class DotProdAttentionWeightGradTensorOp : public IntegrationWeightGradTensorOp<TensorT, DeviceT>
+	{
+	public:
+		DotProdAttentionWeightGradTensorOp() {};
+		~DotProdAttentionWeightGradTensorOp() {};
+		void operator()(TensorT* sink_error, TensorT* source_output, TensorT* weight, TensorT* source_input, TensorT* weight_error, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, DeviceT& device) {
+			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> weight_error_tensor(weight_error, source_layer_size, sink_layer_size);
+			weight_error_tensor.device(device) = weight_error_tensor.constant(TensorT(0));
+		};
+		std::string getName() const { return "DotProdAttentionWeightGradTensorOp"; };
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationWeightGradTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
+
+	/**
+	@brief Fused softmax integration weight gradient function
+
+	The source to softmax links only route the inputs and are not trained.
+	*/
+	template<typename TensorT, typename DeviceT>
+	class SoftMaxWeightGradTensorOp : public IntegrationWeightGradTensorOp<TensorT, DeviceT>
+	{
+	public:
+		SoftMaxWeightGradTensorOp() {};
+		~SoftMaxWeightGradTensorOp() {};
+		void operator()(TensorT* sink_error, TensorT* source_output, TensorT* weight, TensorT* source_input, TensorT* weight_error, const int& n_input_nodes, const int& batch_size, const int& memory_size, const int& source_layer_size, const int& sink_layer_size, DeviceT& device) {
+			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> weight_error_tensor(weight_error, source_layer_size, sink_layer_size);
+			weight_error_tensor.device(device) = weight_error_tensor.constant(TensorT(0));
+		};
+		std::string getName() const { return "SoftMaxWeightGradTensorOp"; };
+	//private:
+	//	friend class cereal::access;
+	//	template<class Archive>
+	//	void serialize(Archive& archive) {
+	//		archive(cereal::base_class<IntegrationWeightGradTensorOp<TensorT, DeviceT>>(this));
+	//	}
+	};
 }
 //CEREAL_REGISTER_TYPE(SmartPeak::SumTensorOp<float, Eigen::DefaultDevice>);
 //CEREAL_REGISTER_TYPE(SmartPeak::ProdTensorOp<float, Eigen::DefaultDevice>);
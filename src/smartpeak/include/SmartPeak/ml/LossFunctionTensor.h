@@ -28,6 +28,23 @@ namespace SmartPeak
 		virtual ~LossFunctionTensorOp() = default;
 		virtual std::string getName() = 0;
 		virtual void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step, DeviceT& device) const = 0;
+
+    /**
+      @brief Evaluate the loss function over consecutive time steps in a single call
+
+      The default implementation calls the loss function for each time step.  Loss functions that
+        are used with long sequences override it to evaluate all time steps in a single kernel.
+
+      @param[in] expected Expected values of dims batch_size, layer_size, n_time_steps
+        (i.e., the expected values of each time step are contiguous)
+      @param[in] time_step_start The first time step (memory index) to evaluate
+      @param[in] n_time_steps The number of time steps to evaluate
+    */
+    virtual void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const
+    {
+      for (int iter = 0; iter < n_time_steps; ++iter)
+        (*this)(predicted, expected + iter * batch_size * layer_size, error, batch_size, memory_size, layer_size, time_step_start + iter, device);
+    };
 	protected:
 		TensorT eps_ = TensorT(1e-24);
 		TensorT scale_ = TensorT(1.0);
@@ -45,9 +62,19 @@ namespace SmartPeak
 	public:
 		LossFunctionGradTensorOp() = default;
 		LossFunctionGradTensorOp(const TensorT& eps, const TensorT& scale) : eps_(eps), scale_(scale) {};
-		~LossFunctionGradTensorOp() = default;
+		virtual ~LossFunctionGradTensorOp() = default;
 		virtual std::string getName() = 0;
 		virtual void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step, DeviceT& device) const = 0;
+
+    /**
+      @brief Evaluate the loss function gradient over consecutive time steps in a single call
+        (see `LossFunctionTensorOp::evaluateSequence`)
+    */
+    virtual void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const
+    {
+      for (int iter = 0; iter < n_time_steps; ++iter)
+        (*this)(predicted, expected + iter * batch_size * layer_size, error, batch_size, memory_size, layer_size, time_step_start + iter, device);
+    };
 	protected:
     TensorT eps_ = TensorT(1e-24);
     TensorT scale_ = TensorT(1.0);
@@ -157,6 +184,20 @@ public:
       );
 			error_tensor.chip(time_step, 1).device(device) += (tmp.sum(Eigen::array<int, 1>({ 1 })) * error_tensor.chip(time_step, 1).constant(this->scale_)).clip(this->min_, this->max_);
 		};
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, batch_size, memory_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 2>({ 0, time_step_start }), Eigen::array<Eigen::Index, 2>({ batch_size, n_time_steps }));
+      auto tmp = -(
+        expected_seq * predicted_seq.clip(this->eps_, TensorT(1)).log() +
+        (expected_seq.constant(TensorT(1)) - expected_seq) * (expected_seq.constant(TensorT(1)) - predicted_seq).clip(this->eps_, TensorT(1)).log()
+      );
+      error_seq.device(device) += (tmp.sum(Eigen::array<int, 1>({ 2 })) * error_seq.constant(this->scale_)).clip(this->min_, this->max_);
+    };
   };
 
   /**
@@ -184,6 +225,18 @@ public:
       //auto result = (predicted_chip - expected_tensor) / ((predicted_chip - expected_tensor.constant(TensorT(1))) * predicted_chip);
 			error_tensor.chip(time_step, 1).device(device) += (result*error_tensor.chip(time_step, 1).constant(this->scale_)).clip(this->min_, this->max_);
 		};
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> error_tensor(error, batch_size, memory_size, layer_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto term1 = expected_seq / predicted_seq.clip(this->eps_, TensorT(1));
+      auto term2 = (expected_seq.constant(TensorT(1)) - expected_seq) / (expected_seq.constant(TensorT(1)) - predicted_seq.clip(TensorT(0), TensorT(1) - this->eps_));
+      error_seq.device(device) += ((term1 - term2) * error_seq.constant(this->scale_)).clip(this->min_, this->max_);
+    };
   };
 
   /**
@@ -251,6 +304,17 @@ public:
 			error_tensor.chip(time_step, 1).device(device) += (((expected_tensor - predicted_chip).pow(TensorT(2)) * expected_tensor.constant(TensorT(0.5)) / expected_tensor.constant(TensorT(layer_size))).sum(Eigen::array<int, 1>({ 1 }))
 				*error_tensor.chip(time_step, 1).constant(this->scale_)).clip(this->min_, this->max_);
 		};
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, batch_size, memory_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 2>({ 0, time_step_start }), Eigen::array<Eigen::Index, 2>({ batch_size, n_time_steps }));
+      error_seq.device(device) += (((expected_seq - predicted_seq).pow(TensorT(2)) * expected_seq.constant(TensorT(0.5)) / expected_seq.constant(TensorT(layer_size))).sum(Eigen::array<int, 1>({ 2 }))
+        * error_seq.constant(this->scale_)).clip(this->min_, this->max_);
+    };
   };
 
   /**
@@ -272,6 +336,17 @@ public:
 			error_tensor.chip(time_step, 1).device(device) += (((expected_tensor - predicted_chip) / expected_tensor.constant(TensorT(layer_size)))
 				*error_tensor.chip(time_step, 1).constant(this->scale_)).clip(this->min_, this->max_);
 		};
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> error_tensor(error, batch_size, memory_size, layer_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      error_seq.device(device) += (((expected_seq - predicted_seq) / expected_seq.constant(TensorT(layer_size)))
+        * error_seq.constant(this->scale_)).clip(this->min_, this->max_);
+    };
   };
 
   /**
@@ -292,6 +367,17 @@ public:
       error_tensor.chip(time_step, 1).device(device) += (((expected_tensor - predicted_chip).pow(TensorT(2)).sqrt() / expected_tensor.constant(TensorT(layer_size))).sum(Eigen::array<int, 1>({ 1 }))
         *error_tensor.chip(time_step, 1).constant(this->scale_)).clip(this->min_, this->max_);
     };
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, batch_size, memory_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 2>({ 0, time_step_start }), Eigen::array<Eigen::Index, 2>({ batch_size, n_time_steps }));
+      error_seq.device(device) += (((expected_seq - predicted_seq).pow(TensorT(2)).sqrt() / expected_seq.constant(TensorT(layer_size))).sum(Eigen::array<int, 1>({ 2 }))
+        * error_seq.constant(this->scale_)).clip(this->min_, this->max_);
+    };
   };
 
   /**
@@ -315,6 +401,20 @@ public:
       );
       error_tensor.chip(time_step, 1).device(device) += result.clip(this->min_, this->max_);
     };
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> error_tensor(error, batch_size, memory_size, layer_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto result = (expected_seq - predicted_seq == predicted_seq.constant(TensorT(0))).select(
+        predicted_seq.constant(TensorT(0)),
+        (((expected_seq - predicted_seq) / (expected_seq - predicted_seq).pow(TensorT(2)).sqrt() / expected_seq.constant(TensorT(layer_size))) * error_seq.constant(this->scale_))
+      );
+      error_seq.device(device) += result.clip(this->min_, this->max_);
+    };
   };
 
   /**
@@ -710,6 +810,43 @@ public:
       }
 #endif
 		};
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, batch_size, memory_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 2>({ 0, time_step_start }), Eigen::array<Eigen::Index, 2>({ batch_size, n_time_steps }));
+      auto max_values = predicted_seq.maximum(Eigen::array<int, 1>({ 2 })).reshape(Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, 1 })).broadcast(Eigen::array<Eigen::Index, 3>({ 1, 1, layer_size }));
+      auto exps = (predicted_seq - max_values).exp();
+      auto stable_softmax = exps / exps.sum(Eigen::array<int, 1>({ 2 })).reshape(Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, 1 })).broadcast(Eigen::array<Eigen::Index, 3>({ 1, 1, layer_size }));
+
+      // Temporary memory for computation
+      TensorT* tmp_data;
+      if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
+        tmp_data = new TensorT[batch_size * n_time_steps];
+      }
+#if COMPILE_WITH_CUDA
+      else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
+        size_t bytes = batch_size * n_time_steps * sizeof(TensorT);
+        assert(cudaMalloc((void**)(&tmp_data), bytes) == cudaSuccess);
+      }
+#endif
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> result(tmp_data, batch_size, n_time_steps);
+      result.device(device) = ((-expected_seq * (stable_softmax.clip(this->eps_, TensorT(1)).log())) * expected_seq.constant(TensorT(1) / TensorT(layer_size))).sum(Eigen::array<int, 1>({ 2 })) * error_seq.constant(this->scale_);
+      error_seq.device(device) += (result == result).select(result.clip(this->min_, this->max_), result.constant(TensorT(0)));
+
+      // Deallocate temporary memory
+      if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
+        delete[] tmp_data;
+      }
+#if COMPILE_WITH_CUDA
+      else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
+        assert(cudaFree(tmp_data) == cudaSuccess);
+      }
+#endif
+    };
 	};
 
 	/**
@@ -735,6 +872,18 @@ public:
       auto result = (((predicted_chip * expected_sum - expected_tensor.chip(0, 2)) / error_tensor.chip(time_step, 1).constant(TensorT(layer_size))) * error_tensor.chip(time_step, 1).constant(this->scale_));
 			error_tensor.chip(time_step, 1).device(device) -= (result == result).select(result.clip(this->min_, this->max_), result.constant(TensorT(0)));
 		};
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size, const int& time_step_start, const int& n_time_steps, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> error_tensor(error, batch_size, memory_size, layer_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto expected_sum = expected_seq.sum(Eigen::array<int, 1>({ 2 })).reshape(Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, 1 })).broadcast(Eigen::array<Eigen::Index, 3>({ 1, 1, layer_size }));
+      auto result = (((predicted_seq * expected_sum - expected_seq) / error_seq.constant(TensorT(layer_size))) * error_seq.constant(this->scale_));
+      error_seq.device(device) -= (result == result).select(result.clip(this->min_, this->max_), result.constant(TensorT(0)));
+    };
 	};
 
   /**
@@ -218,6 +218,22 @@ namespace SmartPeak
     TensorT classification_threshold_ = 0.5;
   };
 
+  /**
+    @brief Area under the precision-recall curve (AUPRC) function.
+  */
+  template<typename TensorT>
+  class AUPRCOp : public MetricFunctionOp<TensorT>
+  {
+  public:
+    AUPRCOp() = default;
+    AUPRCOp(const TensorT& classification_threshold) :classification_threshold_(classification_threshold) {}
+    std::string getName() { return "AUPRCOp"; };
+    std::vector<TensorT> getParameters() const { return std::vector<TensorT>({ this->classification_threshold_ }); }
+    TensorT getClassificationThreshold() const { return this->classification_threshold_; }
+  protected:
+    TensorT classification_threshold_ = 0.5;
+  };
+
   /**
     @brief Mathews correlation coefficient (MCC) function for binary classification.
   */
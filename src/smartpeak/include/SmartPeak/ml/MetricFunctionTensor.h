@@ -11,6 +11,11 @@
 #endif
 
 #include <unsupported/Eigen/CXX11/Tensor>
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
 
 namespace SmartPeak
 {
@@ -30,6 +35,33 @@ namespace SmartPeak
 		virtual std::string getName() = 0;
 		virtual void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
       const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const = 0;
+
+    /**
+      @brief Evaluate the metric function over consecutive time steps in a single call
+
+      The default implementation calls the metric function for each time step
+        and then finalizes the metric values that are accumulated over the time steps at time_step_start (see `finalizeMetric`).
+
+      @param[in] expected Expected values of dims batch_size, layer_size, n_time_steps
+        (i.e., the expected values of each time step are contiguous)
+      @param[in] time_step_start The first time step (memory index) to evaluate
+      @param[in] n_time_steps The number of time steps to evaluate
+    */
+    virtual void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
+      const int& n_metrics, const int& time_step_start, const int& n_time_steps, const int& metric_index, DeviceT& device) const
+    {
+      for (int iter = 0; iter < n_time_steps; ++iter)
+        (*this)(predicted, expected + iter * batch_size * layer_size, error, batch_size, memory_size, layer_size, n_metrics, time_step_start + iter, metric_index, device);
+      this->finalizeMetric(error, layer_size, memory_size, n_metrics, time_step_start, metric_index, device);
+    };
+
+    /**
+      @brief Add the metric values that are accumulated over several calls of the metric function
+        (e.g., the AUROC over all time steps of a batch) to the metric tensor at the time step and reset the accumulated statistics
+
+      Metric functions that are fully computed by each call (the default) do nothing.
+    */
+    virtual void finalizeMetric(TensorT* error, const int& layer_size, const int& memory_size, const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const {};
     void setReductionFunc(std::string& reduction_func) { reduction_func_ = reduction_func; }
     std::string getReductionFunc() { return reduction_func_; }
   protected:
@@ -39,40 +71,311 @@ namespace SmartPeak
 	};
 
   /**
-    @brief Accuracy metric function for binary classification.
-       The class returns the average classification accuracy across all batches
-       where an expected true value > 0.9 and an expected false value < 0.9
+    @brief Allocate and free the temporary memory used by the metric functions on the device
+  */
+  template<typename TensorT, typename DeviceT>
+  TensorT* allocateMetricTmpData(const int& size, DeviceT& device)
+  {
+    TensorT* tmp_data = nullptr;
+    if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
+      tmp_data = new TensorT[size];
+    }
+#if COMPILE_WITH_CUDA
+    else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
+      size_t bytes = size * sizeof(TensorT);
+      assert(cudaMalloc((void**)(&tmp_data), bytes) == cudaSuccess);
+    }
+#endif
+    return tmp_data;
+  }
+  template<typename TensorT, typename DeviceT>
+  void freeMetricTmpData(TensorT* tmp_data, DeviceT& device)
+  {
+    if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
+      delete[] tmp_data;
+    }
+#if COMPILE_WITH_CUDA
+    else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
+      assert(cudaFree(tmp_data) == cudaSuccess);
+    }
+#endif
+  }
 
-    Where classification accuracy = (TP + TN)/(TP + TN + FP + FN)
+  /**
+    @brief Temporary memory of the metric functions on the device that is allocated on first use
+      and re-used by the following calls instead of being allocated and freed on each call
+
+    Copies do not share the memory (i.e., a copy allocates its own memory on first use).
   */
   template<typename TensorT, typename DeviceT>
-  class AccuracyBCTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class MetricTmpData
   {
   public:
-    AccuracyBCTensorOp() = default;
-    AccuracyBCTensorOp(const TensorT& classification_threshold) : classification_threshold_(classification_threshold) {};
-		std::string getName() override { return "AccuracyBCTensorOp"; }
-		void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
-		{
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
+    MetricTmpData() = default;
+    MetricTmpData(const MetricTmpData<TensorT, DeviceT>& other) {};
+    ~MetricTmpData() { clear(); };
+    MetricTmpData<TensorT, DeviceT>& operator=(const MetricTmpData<TensorT, DeviceT>& other) { return *this; };
+
+    /// the memory of the given size where newly allocated memory is set to zero
+    TensorT* getData(const int& size, DeviceT& device)
+    {
+      if (size != size_) {
+        clear();
+        data_ = allocateMetricTmpData<TensorT, DeviceT>(size, device);
+        size_ = size;
+        setZero(device);
+      }
+      return data_;
+    }
+    TensorT* getData() const { return data_; }
+    int getSize() const { return size_; }
+    void setZero(DeviceT& device)
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 1>> data_tensor(data_, size_);
+      data_tensor.device(device) = data_tensor.constant(TensorT(0));
+    }
+    void clear()
+    {
+      if (data_ == nullptr) return;
+      if (std::is_same<DeviceT, Eigen::DefaultDevice>::value) {
+        delete[] data_;
+      }
+#if COMPILE_WITH_CUDA
+      else if (std::is_same<DeviceT, Eigen::GpuDevice>::value) {
+        cudaFree(data_);
+      }
+#endif
+      data_ = nullptr;
+      size_ = 0;
+    }
+  private:
+    TensorT* data_ = nullptr;
+    int size_ = 0;
+  };
+
+  /**
+    @brief Confusion matrix of the output layer at a single time step
+
+    The confusion matrix is stored per output node (i.e., per class) as a [layer_size, 4] tensor
+      with the columns TP, FP, FN, and TN where expected values > threshold_positive are true,
+      expected values < threshold_negative are false, and all other expected values are not counted.
+      A prediction is positive if it is greater than or equal to the classification threshold (binary classification)
+      or if it is the maximum prediction of the batch (multiclass classification)
+  */
+  template<typename TensorT, typename DeviceT>
+  class ConfusionMatrixTensorOp
+  {
+  public:
+    ConfusionMatrixTensorOp() = default;
+    ConfusionMatrixTensorOp(const TensorT& classification_threshold, const bool& use_argmax, const TensorT& threshold_positive, const TensorT& threshold_negative) :
+      classification_threshold_(classification_threshold), use_argmax_(use_argmax), threshold_positive_(threshold_positive), threshold_negative_(threshold_negative) {};
+    ~ConfusionMatrixTensorOp() = default;
+    void operator()(TensorT* predicted, TensorT* expected, TensorT* confusion, const int& batch_size, const int& memory_size, const int& layer_size,
+      const int& time_step, DeviceT& device) const
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(confusion, layer_size, 4);
+      auto predicted_chip = predicted_tensor.chip(time_step, 1);
 
-      // calculate the confusion matrix
-      auto predicted_chip = predicted_tensor.chip(time_step, 1); 
-      auto tp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto tn = (predicted_chip < expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fn = (predicted_chip < expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
+      // predicted positives (1) and negatives (0)
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> positive_tensor(positive_data_.getData(batch_size * layer_size, device), batch_size, layer_size);
+      if (use_argmax_) {
+        auto max_tensor = predicted_chip.maximum(Eigen::array<int, 1>({ 1 })).reshape(Eigen::array<int, 2>({ batch_size, 1 })).broadcast(Eigen::array<int, 2>({ 1, layer_size }));
+        positive_tensor.device(device) = (predicted_chip >= (max_tensor - max_tensor.constant(TensorT(1e-6)))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
+      }
+      else {
+        positive_tensor.device(device) = (predicted_chip >= expected_tensor.constant(this->classification_threshold_)).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
+      }
+      auto true_tensor = (expected_tensor > expected_tensor.constant(this->threshold_positive_)).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
+      auto false_tensor = (expected_tensor < expected_tensor.constant(this->threshold_negative_)).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
+      auto negative_tensor = positive_tensor.constant(TensorT(1)) - positive_tensor;
+
+      // count the TP, FP, FN, and TN for each class
+      confusion_tensor.chip(0, 1).device(device) = (positive_tensor * true_tensor).sum(Eigen::array<int, 1>({ 0 }));
+      confusion_tensor.chip(1, 1).device(device) = (positive_tensor * false_tensor).sum(Eigen::array<int, 1>({ 0 }));
+      confusion_tensor.chip(2, 1).device(device) = (negative_tensor * true_tensor).sum(Eigen::array<int, 1>({ 0 }));
+      confusion_tensor.chip(3, 1).device(device) = (negative_tensor * false_tensor).sum(Eigen::array<int, 1>({ 0 }));
+    };
+  protected:
+    TensorT classification_threshold_ = 0.5;
+    bool use_argmax_ = false;
+    TensorT threshold_positive_ = 0.9;
+    TensorT threshold_negative_ = 0.1;
+    mutable MetricTmpData<TensorT, DeviceT> positive_data_; ///< predicted positives
+  };
 
-      // calculate the accuracy
-      auto accuracy = (tp.sum() + tn.sum()) / (tp.sum() + tn.sum() + fp.sum() + fn.sum());
-      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += accuracy;
-		};
+  /**
+    @brief Cumulative score histogram (i.e., the ROC and precision-recall curves) of the output layer
+
+    The predictions of all output nodes (clipped to [0, 1]) are scored against n_thresholds evenly spaced thresholds
+      on a fixed grid over [0, 1] and the number of true (TP) and false (FP) expected values
+      with a prediction greater than or equal to each threshold are added to a [n_thresholds + 1, 2] tensor.
+      The first row holds the total number of true and false expected values.
+      The last row is zero (i.e., the threshold above the maximum prediction) so that the curves are closed.
+
+    The thresholds do not depend on the predictions so that the counts of consecutive time steps and batches
+      are added to the same tensor and the area under the curves is computed once from the accumulated counts.
+      Predictions that fall between the same two thresholds are treated as ties so that the
+      area under the curves is exact if no two distinct predictions share a bin
+      and otherwise approximated with an error that is bounded by the fraction of true/false pairs that share a bin.
+      The cost is O(batch_size * layer_size * n_thresholds) without sorting the predictions.
+  */
+  template<typename TensorT, typename DeviceT>
+  class ScoreCurveTensorOp
+  {
+  public:
+    ScoreCurveTensorOp() = default;
+    ScoreCurveTensorOp(const int& n_thresholds, const TensorT& threshold_positive, const TensorT& threshold_negative) :
+      n_thresholds_(n_thresholds), threshold_positive_(threshold_positive), threshold_negative_(threshold_negative) {};
+    ~ScoreCurveTensorOp() = default;
+    void operator()(TensorT* predicted, TensorT* expected, TensorT* curve, const int& batch_size, const int& memory_size, const int& layer_size,
+      const int& time_step, DeviceT& device) const
+    {
+      const int n_scores = batch_size * layer_size;
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> curve_tensor(curve, n_thresholds_ + 1, 2);
+      auto predicted_chip = predicted_tensor.chip(time_step, 1);
+
+      // the fixed thresholds (copied to the device once)
+      if (threshold_data_.getSize() != n_thresholds_) {
+        std::vector<TensorT> thresholds(n_thresholds_);
+        for (int i = 0; i < n_thresholds_; ++i) thresholds[i] = TensorT(i) / TensorT(std::max(n_thresholds_ - 1, 1));
+        device.memcpyHostToDevice(threshold_data_.getData(n_thresholds_, device), thresholds.data(), n_thresholds_ * sizeof(TensorT));
+      }
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> threshold_tensor(threshold_data_.getData(), 1, n_thresholds_);
+
+      // add the true and false expected values with a prediction above each threshold
+      auto score_bcast = predicted_chip.cwiseMax(TensorT(0)).cwiseMin(TensorT(1)).reshape(Eigen::array<int, 2>({ n_scores, 1 })).broadcast(Eigen::array<int, 2>({ 1, n_thresholds_ }));
+      auto threshold_bcast = threshold_tensor.broadcast(Eigen::array<int, 2>({ n_scores, 1 }));
+      auto above_threshold = score_bcast >= threshold_bcast;
+      auto expected_bcast = expected_tensor.reshape(Eigen::array<int, 2>({ n_scores, 1 })).broadcast(Eigen::array<int, 2>({ 1, n_thresholds_ }));
+      auto ones = threshold_bcast.constant(TensorT(1));
+      auto zeros = threshold_bcast.constant(TensorT(0));
+      Eigen::array<Eigen::Index, 2> offsets = { 0, 0 };
+      Eigen::array<Eigen::Index, 2> spans = { n_thresholds_, 1 };
+      curve_tensor.slice(offsets, spans).device(device) += (above_threshold && expected_bcast > expected_bcast.constant(this->threshold_positive_)).select(ones, zeros)
+        .sum(Eigen::array<int, 1>({ 0 })).reshape(Eigen::array<int, 2>({ n_thresholds_, 1 }));
+      offsets = { 0, 1 };
+      curve_tensor.slice(offsets, spans).device(device) += (above_threshold && expected_bcast < expected_bcast.constant(this->threshold_negative_)).select(ones, zeros)
+        .sum(Eigen::array<int, 1>({ 0 })).reshape(Eigen::array<int, 2>({ n_thresholds_, 1 }));
+    };
+    void setNThresholds(const int& n_thresholds) { n_thresholds_ = n_thresholds; }
+    int getNThresholds() const { return n_thresholds_; }
+  protected:
+    int n_thresholds_ = 101;
+    TensorT threshold_positive_ = 0.9;
+    TensorT threshold_negative_ = 0.1;
+    mutable MetricTmpData<TensorT, DeviceT> threshold_data_; ///< thresholds of dims 1, n_thresholds
+  };
+
+  /**
+    @brief Base class for classification metric functions that are derived from
+      the confusion matrix or the score curve of the output layer (see `ConfusionMatrixTensorOp` and `ScoreCurveTensorOp`)
+
+    Calling the metric function computes the statistics and then the metric.  Metric functions with the same
+      statistics can be combined using the `ClassificationMetricsTensorOp` so that the statistics are only computed once.
+      Metrics with a zero denominator (e.g., precision without any positive predictions) are reported as 0.
+
+    The confusion matrix metrics are computed for each time step.  The score curve metrics (e.g., AUROC) are
+      accumulated over the calls of the metric function (e.g., all time steps of a batch) and computed once
+      from the accumulated score curve by `finalizeMetric`.
+  */
+  template<typename TensorT, typename DeviceT>
+  class ClassificationMetricTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  {
+  public:
+    ClassificationMetricTensorOp() = default;
+    ClassificationMetricTensorOp(const TensorT& classification_threshold, const bool& use_argmax) : classification_threshold_(classification_threshold), use_argmax_(use_argmax),
+      confusion_matrix_(classification_threshold, use_argmax, this->threshold_positive_, this->threshold_negative_) {};
+    virtual ~ClassificationMetricTensorOp() = default;
+    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      TensorT* statistics = statistics_data_.getData(this->getStatisticsSize(layer_size), device);
+      this->computeStatistics(predicted, expected, statistics, batch_size, memory_size, layer_size, time_step, device);
+      if (!this->getUseScoreCurve())
+        this->computeMetric(statistics, error, layer_size, memory_size, n_metrics, time_step, metric_index, device);
+    };
+    void finalizeMetric(TensorT* error, const int& layer_size, const int& memory_size, const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      if (!this->getUseScoreCurve() || statistics_data_.getSize() == 0) return;
+      this->computeMetric(statistics_data_.getData(), error, layer_size, memory_size, n_metrics, time_step, metric_index, device);
+      statistics_data_.setZero(device);
+    };
+
+    /**
+      @brief Compute the metric from the statistics and add it to the metric tensor
+
+      @param[in] statistics The confusion matrix [layer_size, 4] or the score curve [n_thresholds + 1, 2]
+    */
+    virtual void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const = 0;
+
+    /**
+      @brief Compute the statistics of the time step
+
+      @param[in, out] statistics The confusion matrix [layer_size, 4] that is overwritten
+        or the score curve [n_thresholds + 1, 2] that the counts of the time step are added to
+    */
+    void computeStatistics(TensorT* predicted, TensorT* expected, TensorT* statistics, const int& batch_size, const int& memory_size, const int& layer_size,
+      const int& time_step, DeviceT& device) const
+    {
+      if (this->getUseScoreCurve())
+        score_curve_(predicted, expected, statistics, batch_size, memory_size, layer_size, time_step, device);
+      else
+        confusion_matrix_(predicted, expected, statistics, batch_size, memory_size, layer_size, time_step, device);
+    }
+    int getStatisticsSize(const int& layer_size) const { return (this->getUseScoreCurve()) ? (this->n_thresholds_ + 1) * 2 : layer_size * 4; }
+
+    /// whether the other metric function is computed from the same statistics
+    bool hasSameStatistics(const ClassificationMetricTensorOp<TensorT, DeviceT>& other) const
+    {
+      if (this->getUseScoreCurve() != other.getUseScoreCurve()) return false;
+      else if (this->getUseScoreCurve()) return this->n_thresholds_ == other.n_thresholds_;
+      else return this->use_argmax_ == other.use_argmax_ && (this->use_argmax_ || this->classification_threshold_ == other.classification_threshold_);
+    }
+
+    virtual bool getUseScoreCurve() const { return false; } ///< score curve (true) or confusion matrix (false) statistics
     TensorT getClassificationThreshold() const { return this->classification_threshold_; }
+    bool getUseArgmax() const { return this->use_argmax_; }
+    void setNThresholds(const int& n_thresholds) { n_thresholds_ = n_thresholds; score_curve_.setNThresholds(n_thresholds); }
+    int getNThresholds() const { return n_thresholds_; }
   protected:
     TensorT classification_threshold_ = 0.5;
+    bool use_argmax_ = false; ///< multiclass (true) or binary (false) classification
+    int n_thresholds_ = 101;
+    ConfusionMatrixTensorOp<TensorT, DeviceT> confusion_matrix_;
+    ScoreCurveTensorOp<TensorT, DeviceT> score_curve_;
+    mutable MetricTmpData<TensorT, DeviceT> statistics_data_; ///< the statistics of the last time step or the accumulated score curve
+  };
+
+  /**
+    @brief Accuracy metric function for binary classification.
+       The class returns the average classification accuracy across all batches
+       where an expected true value > 0.9 and an expected false value < 0.9
+
+    Where classification accuracy = (TP + TN)/(TP + TN + FP + FN)
+  */
+  template<typename TensorT, typename DeviceT>
+  class AccuracyBCTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
+  {
+  public:
+    AccuracyBCTensorOp() = default;
+    AccuracyBCTensorOp(const TensorT& classification_threshold) : ClassificationMetricTensorOp<TensorT, DeviceT>(classification_threshold, false) {};
+		std::string getName() override { return "AccuracyBCTensorOp"; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      auto tn = confusion_tensor.chip(3, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp + tn) / (tp + tn + fp + fn).cwiseMax(TensorT(1));
+    };
   };
 
   /**
@@ -83,60 +386,21 @@ namespace SmartPeak
     Where classification accuracy = (TP + TN)/(TP + TN + FP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class AccuracyMCMicroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class AccuracyMCMicroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
+    AccuracyMCMicroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
     std::string getName() override { return "AccuracyMCMicroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 4>> predicted_tensor(predicted, batch_size, memory_size, layer_size, 1);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // allocate temporary memory
-      TensorT* tmp_data;
-      if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
-        tmp_data = new TensorT[batch_size*layer_size];
-      }
-#if COMPILE_WITH_CUDA
-      else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
-        size_t bytes = batch_size * layer_size * sizeof(TensorT);
-        assert(cudaMalloc((void**)(&tmp_data), bytes) == cudaSuccess);
-      }
-#endif
-      // find the maximum value for each batch
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> max_tensor(tmp_data, batch_size, layer_size);
-      max_tensor.device(device) = predicted_chip.maximum(Eigen::array<int, 1>({ 1 })).broadcast(Eigen::array<int, 2>({ 1, layer_size }));
-
-      // calculate the confusion matrix
-      auto tp = (predicted_chip.chip(0, 2) >= (max_tensor - max_tensor.constant(TensorT(1e-6))) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto tn = (predicted_chip.chip(0, 2) < max_tensor && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fp = (predicted_chip.chip(0, 2) >= (max_tensor - max_tensor.constant(TensorT(1e-6))) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fn = (predicted_chip.chip(0, 2) < max_tensor && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-
-      // calculate the accuracy     
-      auto accuracy = (tp.sum() + tn.sum()) / (tp.sum() + tn.sum() + fp.sum() + fn.sum());
-      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += accuracy;
-
-      // deallocate temporary memory
-      if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
-        delete[] tmp_data;
-      }
-#if COMPILE_WITH_CUDA
-      else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
-        assert(cudaFree(tmp_data) == cudaSuccess);
-      }
-#endif
-
-      //// DEBUG
-      //std::cout << "TP: " << tp << std::endl;
-      //std::cout << "TN: " << tn << std::endl;
-      //std::cout << "FP: " << fp << std::endl;
-      //std::cout << "FN: " << fn << std::endl;
-      //std::cout << "Accuracy: " << accuracy << std::endl;
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      auto tn = confusion_tensor.chip(3, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp + tn) / (tp + tn + fp + fn).cwiseMax(TensorT(1));
     };
   };
 
@@ -148,22 +412,21 @@ namespace SmartPeak
     Where classification accuracy = (TP + TN)/(TP + TN + FP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class AccuracyMCMacroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class AccuracyMCMacroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
+    AccuracyMCMacroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
     std::string getName() override { return "AccuracyMCMacroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // find the maximum value for each batch
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      // TODO... 
-      // Sum on the per batch level and then average e.g. / accuracy.constant(TensorT(batch_size));
+      auto tp = confusion_tensor.chip(0, 1);
+      auto fp = confusion_tensor.chip(1, 1);
+      auto fn = confusion_tensor.chip(2, 1);
+      auto tn = confusion_tensor.chip(3, 1);
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += ((tp + tn) / (tp + tn + fp + fn).cwiseMax(TensorT(1))).mean();
     };
   };
 
@@ -175,31 +438,21 @@ namespace SmartPeak
     Where classification precision = TP/(TP + FP)
   */
   template<typename TensorT, typename DeviceT>
-  class PrecisionBCTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class PrecisionBCTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
     PrecisionBCTensorOp() = default;
-    PrecisionBCTensorOp(const TensorT& classification_threshold) : classification_threshold_(classification_threshold) {};
+    PrecisionBCTensorOp(const TensorT& classification_threshold) : ClassificationMetricTensorOp<TensorT, DeviceT>(classification_threshold, false) {};
     std::string getName() override { return "PrecisionBCTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // calculate the confusion matrix
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      auto tp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-
-      // calculate the precision     
-      auto precision = tp.sum() / (tp.sum() + fp.sum());
-      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += precision;
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += tp / (tp + fp).cwiseMax(TensorT(1));
     };
-    TensorT getClassificationThreshold() const { return this->classification_threshold_; }
-  protected:
-    TensorT classification_threshold_ = 0.5;
   };
 
   /**
@@ -210,37 +463,19 @@ namespace SmartPeak
     Where classification precision = TP/(TP + FP)
   */
   template<typename TensorT, typename DeviceT>
-  class PrecisionMCMicroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class PrecisionMCMicroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
+    PrecisionMCMicroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
     std::string getName() override { return "PrecisionMCMicroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 4>> predicted_tensor(predicted, batch_size, memory_size, layer_size, 1);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // find the maximum value for each batch
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      auto max_tensor = predicted_chip.maximum(Eigen::array<int, 1>({ 1 })).broadcast(Eigen::array<int, 2>({ 1, layer_size }));
-
-      // calculate the confusion matrix
-      auto tp = (predicted_chip.chip(0, 2) >= (max_tensor - max_tensor.constant(TensorT(1e-6))) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fp = (predicted_chip.chip(0, 2) >= (max_tensor - max_tensor.constant(TensorT(1e-6))) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-
-      // calculate the precision     
-      auto precision = tp.sum() / (tp.sum() + fp.sum());
-      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += precision;
-
-      //// DEBUG
-      //std::cout << "predicted_chip.chip(0, 1): " << predicted_chip << std::endl;
-      //std::cout << "max_tensor: " << max_tensor << std::endl;
-      //std::cout << "expected_tensor: " << expected_tensor << std::endl;
-      //std::cout << "TP: " << tp << std::endl;
-      //std::cout << "FP: " << fp << std::endl;
-      //std::cout << "precision: " << precision << std::endl;
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += tp / (tp + fp).cwiseMax(TensorT(1));
     };
   };
 
@@ -252,22 +487,19 @@ namespace SmartPeak
     Where classification precision = TP/(TP + FP)
   */
   template<typename TensorT, typename DeviceT>
-  class PrecisionMCMacroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class PrecisionMCMacroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
+    PrecisionMCMacroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
     std::string getName() override { return "PrecisionMCMacroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // find the maximum value for each batch
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      // TODO... 
-      // Sum on the per batch level and then average e.g. / precision.constant(TensorT(batch_size));
+      auto tp = confusion_tensor.chip(0, 1);
+      auto fp = confusion_tensor.chip(1, 1);
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp / (tp + fp).cwiseMax(TensorT(1))).mean();
     };
   };
 
@@ -279,31 +511,21 @@ namespace SmartPeak
     Where classification recall = TP /(TP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class RecallBCTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class RecallBCTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
     RecallBCTensorOp() = default;
-    RecallBCTensorOp(const TensorT& classification_threshold) : classification_threshold_(classification_threshold) {};
+    RecallBCTensorOp(const TensorT& classification_threshold) : ClassificationMetricTensorOp<TensorT, DeviceT>(classification_threshold, false) {};
     std::string getName() override { return "RecallBCTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // calculate the confusion matrix
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      auto tp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fn = (predicted_chip < expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-
-      // calculate the recall     
-      auto recall = tp.sum() / (tp.sum() + fn.sum());
-      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += recall;
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += tp / (tp + fn).cwiseMax(TensorT(1));
     };
-    TensorT getClassificationThreshold() const { return this->classification_threshold_; }
-  protected:
-    TensorT classification_threshold_ = 0.5;
   };
 
   /**
@@ -314,29 +536,19 @@ namespace SmartPeak
     Where classification recall = TP /(TP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class RecallMCMicroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class RecallMCMicroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
+    RecallMCMicroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
     std::string getName() override { return "RecallMCMicroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 4>> predicted_tensor(predicted, batch_size, memory_size, layer_size, 1);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // find the maximum value for each batch
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      auto max_tensor = predicted_chip.maximum(Eigen::array<int, 1>({ 1 })).broadcast(Eigen::array<int, 2>({ 1, layer_size }));
-
-      // calculate the confusion matrix
-      auto tp = (predicted_chip.chip(0, 2) >= (max_tensor - max_tensor.constant(TensorT(1e-6))) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      auto fn = (predicted_chip.chip(0, 2) < max_tensor && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-
-      // calculate the recall     
-      auto recall = tp.sum() / (tp.sum() + fn.sum());
-      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += recall;
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += tp / (tp + fn).cwiseMax(TensorT(1));
     };
   };
 
@@ -348,22 +560,19 @@ namespace SmartPeak
     Where classification recall = TP /(TP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class RecallMCMacroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class RecallMCMacroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
+    RecallMCMacroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
     std::string getName() override { return "RecallMCMacroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      // find the maximum value for each batch
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      // TODO... 
-      // Sum on the per batch level and then average e.g. / recall.constant(TensorT(batch_size));
+      auto tp = confusion_tensor.chip(0, 1);
+      auto fn = confusion_tensor.chip(2, 1);
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp / (tp + fn).cwiseMax(TensorT(1))).mean();
     };
   };
 
@@ -393,103 +602,52 @@ namespace SmartPeak
     @brief F1 score metric function for binary classification.
       The class returns the average F1 score across all batches
 
-    Where F1 score = 2*precision*recall/(precision + recall)
+    Where F1 score = 2*precision*recall/(precision + recall) = 2*TP/(2*TP + FP + FN)
 	    and precision = TP/(TP + FP)
 	    and recall = TP/(TP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class F1ScoreBCTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class F1ScoreBCTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
     F1ScoreBCTensorOp() = default;
-    F1ScoreBCTensorOp(const TensorT& classification_threshold) : classification_threshold_(classification_threshold) {};
-		std::string getName() { return "F1ScoreBCTensorOp"; }
-		void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
-		{
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      //// calculate the confusion matrix
-      //auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      //auto tp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      //auto fp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      //auto fn = (predicted_chip < expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-
-      //// calculate the F1 score
-      //auto precision = tp.sum()/(tp.sum() + fp.sum());
-      //auto recall = tp.sum() / (tp.sum() + fn.sum());
-      //auto f1score = precision.constant(TensorT(2))*precision*recall / (precision + recall);
-      //error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += f1score;
-		};
-    TensorT getClassificationThreshold() const { return this->classification_threshold_; }
-  protected:
-    TensorT classification_threshold_ = 0.5;
+    F1ScoreBCTensorOp(const TensorT& classification_threshold) : ClassificationMetricTensorOp<TensorT, DeviceT>(classification_threshold, false) {};
+		std::string getName() override { return "F1ScoreBCTensorOp"; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp + tp) / (tp + tp + fp + fn).cwiseMax(TensorT(1));
+    };
   };
 
   /**
     @brief F1 score metric function for multiclass classification.
       The class returns the micro average F1 score across all batches
 
-    Where F1 score = 2*precision*recall/(precision + recall)
+    Where F1 score = 2*precision*recall/(precision + recall) = 2*TP/(2*TP + FP + FN)
       and precision = TP/(TP + FP)
       and recall = TP/(TP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class F1ScoreMCMicroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class F1ScoreMCMicroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
-    std::string getName() { return "F1ScoreMCMicroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    F1ScoreMCMicroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
+    std::string getName() override { return "F1ScoreMCMicroTensorOp"; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 4>> predicted_tensor(predicted, batch_size, memory_size, layer_size, 1);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-//      // allocate temporary memory
-//      TensorT* tmp_data;
-//      if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
-//        tmp_data = new TensorT[batch_size*layer_size];
-//      }
-//#if COMPILE_WITH_CUDA
-//      else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
-//        size_t bytes = batch_size * layer_size * sizeof(TensorT);
-//        assert(cudaMalloc((void**)(&tmp_data), bytes) == cudaSuccess);
-//      }
-//#endif
-//      // find the maximum value for each batch
-//      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-//      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> max_tensor(tmp_data, batch_size, layer_size);
-//      max_tensor = predicted_chip.maximum(Eigen::array<int, 1>({ 1 })).broadcast(Eigen::array<int, 2>({ 1, layer_size }));
-//
-//      // calculate the confusion matrix
-//      auto tp = (predicted_chip.chip(0, 2) >= (max_tensor - max_tensor.constant(TensorT(1e-6))) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-//      auto fp = (predicted_chip.chip(0, 2) >= (max_tensor - max_tensor.constant(TensorT(1e-6))) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-//      auto fn = (predicted_chip.chip(0, 2) < max_tensor && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-//
-//      // calculate the F1 score
-//      auto precision = tp.sum() / (tp.sum() + fp.sum());
-//      auto recall = tp.sum() / (tp.sum() + fn.sum());
-//      auto f1score = precision.constant(TensorT(2))*precision*recall / (precision + recall);
-//      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += f1score;
-//
-//      // deallocate temporary memory
-//      if (typeid(device).name() == typeid(Eigen::DefaultDevice).name()) {
-//        delete[] tmp_data;
-//      }
-//#if COMPILE_WITH_CUDA
-//      else if (typeid(device).name() == typeid(Eigen::GpuDevice).name()) {
-//        assert(cudaFree(tmp_data) == cudaSuccess);
-//      }
-//#endif
-
-      //// DEBUG
-      //std::cout << "precision: " << precision << std::endl;
-      //std::cout << "recall: " << recall << std::endl;
-      //std::cout << "f1score: " << f1score << std::endl;
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp + tp) / (tp + tp + fp + fn).cwiseMax(TensorT(1));
     };
   };
 
@@ -497,59 +655,97 @@ namespace SmartPeak
     @brief F1 score metric function for multiclass classification.
       The class returns the macro average F1 score across all batches
 
-    Where F1 score = 2*precision*recall/(precision + recall)
+    Where F1 score = 2*precision*recall/(precision + recall) = 2*TP/(2*TP + FP + FN)
       and precision = TP/(TP + FP)
       and recall = TP/(TP + FN)
   */
   template<typename TensorT, typename DeviceT>
-  class F1ScoreMCMacroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class F1ScoreMCMacroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
-    std::string getName() { return "F1ScoreMCMacroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    F1ScoreMCMacroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
+    std::string getName() override { return "F1ScoreMCMacroTensorOp"; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-
-      //// calculate the confusion matrix
-      //auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      //auto tp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      //auto fp = (predicted_chip >= expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor < expected_tensor.constant(TensorT(this->threshold_negative_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-      //auto fn = (predicted_chip < expected_tensor.constant(TensorT(this->classification_threshold_)) && expected_tensor > expected_tensor.constant(TensorT(this->threshold_positive_))).select(expected_tensor.constant(TensorT(1)), expected_tensor.constant(TensorT(0)));
-
-      //// calculate the F1 score [TODO: update as this is not correct...]
-      //auto precision = tp.sum() / (tp.sum() + fp.sum());
-      //auto recall = tp.sum() / (tp.sum() + fn.sum());
-      //auto f1score = precision.constant(TensorT(2))*precision*recall / (precision + recall);
-      //error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += f1score;
+      auto tp = confusion_tensor.chip(0, 1);
+      auto fp = confusion_tensor.chip(1, 1);
+      auto fn = confusion_tensor.chip(2, 1);
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += ((tp + tp) / (tp + tp + fp + fn).cwiseMax(TensorT(1))).mean();
     };
   };
 
   /**
     @brief AUROC metric function.
 
-    Where ROC point per batch = sensitivity/FPR
+    Where ROC point per threshold = sensitivity/FPR
 	    and sensitivity = recall = TP/(TP + FN)
 	    and FPR = FP/(FP + TN)
-    And AUROC = area under the curve of sensitivity vs. FPR
+    And AUROC = area under the curve of sensitivity vs. FPR (trapezoidal rule)
+      computed over all output nodes (i.e., micro averaged for multiclass classification)
   */
   template<typename TensorT, typename DeviceT>
-  class AUROCTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class AUROCTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
 public:
-		using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
-		std::string getName() { return "AUROCTensorOp"; }
-		void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
-		{
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-			auto predicted_chip = predicted_tensor.chip(time_step, 1);
-		};
+    AUROCTensorOp() = default;
+    AUROCTensorOp(const int& n_thresholds) { this->setNThresholds(n_thresholds); };
+		std::string getName() override { return "AUROCTensorOp"; }
+    bool getUseScoreCurve() const override { return true; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> curve_tensor(statistics, this->n_thresholds_ + 1, 2);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
+      auto tp = curve_tensor.chip(0, 1);
+      auto fp = curve_tensor.chip(1, 1);
+      Eigen::array<Eigen::Index, 1> spans = { this->n_thresholds_ };
+      auto tp_lo = tp.slice(Eigen::array<Eigen::Index, 1>({ 0 }), spans);
+      auto tp_hi = tp.slice(Eigen::array<Eigen::Index, 1>({ 1 }), spans);
+      auto fp_lo = fp.slice(Eigen::array<Eigen::Index, 1>({ 0 }), spans);
+      auto fp_hi = fp.slice(Eigen::array<Eigen::Index, 1>({ 1 }), spans);
+      auto n_true = tp.slice(Eigen::array<Eigen::Index, 1>({ 0 }), Eigen::array<Eigen::Index, 1>({ 1 })).sum();
+      auto n_false = fp.slice(Eigen::array<Eigen::Index, 1>({ 0 }), Eigen::array<Eigen::Index, 1>({ 1 })).sum();
+      auto area = ((fp_lo - fp_hi) * (tp_lo + tp_hi)).sum() / (n_true * n_false * n_true.constant(TensorT(2))).cwiseMax(TensorT(1));
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += area;
+    };
+  };
+
+  /**
+    @brief AUPRC (i.e., average precision) metric function.
+
+    Where PR point per threshold = precision/recall
+      and precision = TP/(TP + FP)
+      and recall = TP/(TP + FN)
+    And AUPRC = Sum[ (recall_k - recall_k+1) * precision_k ]
+      computed over all output nodes (i.e., micro averaged for multiclass classification)
+  */
+  template<typename TensorT, typename DeviceT>
+  class AUPRCTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
+  {
+  public:
+    AUPRCTensorOp() = default;
+    AUPRCTensorOp(const int& n_thresholds) { this->setNThresholds(n_thresholds); };
+    std::string getName() override { return "AUPRCTensorOp"; }
+    bool getUseScoreCurve() const override { return true; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> curve_tensor(statistics, this->n_thresholds_ + 1, 2);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
+      auto tp = curve_tensor.chip(0, 1);
+      auto fp = curve_tensor.chip(1, 1);
+      Eigen::array<Eigen::Index, 1> spans = { this->n_thresholds_ };
+      auto tp_lo = tp.slice(Eigen::array<Eigen::Index, 1>({ 0 }), spans);
+      auto tp_hi = tp.slice(Eigen::array<Eigen::Index, 1>({ 1 }), spans);
+      auto fp_lo = fp.slice(Eigen::array<Eigen::Index, 1>({ 0 }), spans);
+      auto n_true = tp.slice(Eigen::array<Eigen::Index, 1>({ 0 }), Eigen::array<Eigen::Index, 1>({ 1 })).sum();
+      auto precision = tp_lo / (tp_lo + fp_lo).cwiseMax(TensorT(1));
+      auto area = ((tp_lo - tp_hi) * precision).sum() / n_true.cwiseMax(TensorT(1));
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += area;
+    };
   };
 
 	/**
@@ -559,20 +755,23 @@ public:
     Where MCC = TP*TN-FP*FN/sqrt((TP+FP)(TP+FN)(TN+FP)(TN+FN))
 	*/
 	template<typename TensorT, typename DeviceT>
-	class MCCBCTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+	class MCCBCTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
 	{
 	public:
-		using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
-		std::string getName() { return "MCCBCTensorOp"; }
-		void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
-		{
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
-			Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-			auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      // TODO...
-		};
+    MCCBCTensorOp() = default;
+    MCCBCTensorOp(const TensorT& classification_threshold) : ClassificationMetricTensorOp<TensorT, DeviceT>(classification_threshold, false) {};
+		std::string getName() override { return "MCCBCTensorOp"; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      auto tn = confusion_tensor.chip(3, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp * tn - fp * fn) / ((tp + fp) * (tp + fn) * (tn + fp) * (tn + fn)).cwiseMax(TensorT(1)).sqrt();
+    };
 	};
 
   /**
@@ -582,22 +781,110 @@ public:
     Where MCC = TP*TN-FP*FN/sqrt((TP+FP)(TP+FN)(TN+FP)(TN+FN))
   */
   template<typename TensorT, typename DeviceT>
-  class MCCMCMicroTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  class MCCMCMicroTensorOp : public ClassificationMetricTensorOp<TensorT, DeviceT>
   {
   public:
-    using MetricFunctionTensorOp<TensorT, DeviceT>::MetricFunctionTensorOp;
-    std::string getName() { return "MCCMCMicroTensorOp"; }
-    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
-      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const
+    MCCMCMicroTensorOp() : ClassificationMetricTensorOp<TensorT, DeviceT>(TensorT(0.5), true) {};
+    std::string getName() override { return "MCCMCMicroTensorOp"; }
+    void computeMetric(TensorT* statistics, TensorT* error, const int& layer_size, const int& memory_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
     {
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> expected_tensor(expected, batch_size, layer_size);
-      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> confusion_tensor(statistics, layer_size, 4);
       Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
-      auto predicted_chip = predicted_tensor.chip(time_step, 1);
-      // TODO...
+      auto tp = confusion_tensor.chip(0, 1).sum();
+      auto fp = confusion_tensor.chip(1, 1).sum();
+      auto fn = confusion_tensor.chip(2, 1).sum();
+      auto tn = confusion_tensor.chip(3, 1).sum();
+      error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += (tp * tn - fp * fn) / ((tp + fp) * (tp + fn) * (tn + fp) * (tn + fn)).cwiseMax(TensorT(1)).sqrt();
     };
   };
 
+  /**
+    @brief Fused classification metric functions of an output layer
+
+    The confusion matrix (or score curve) is computed once per time step for all metric functions
+      that share the same statistics (e.g., the accuracy, precision, recall, F1 score, and MCC of a
+      binary classifier with the same classification threshold) instead of once per metric function.
+      The metric function i is written to metric_index + metric_offset_i.
+      The score curves are accumulated until `finalizeMetric` as for the individual metric functions.
+
+    Example use case:
+      ClassificationMetricsTensorOp<float, Eigen::DefaultDevice> metrics;
+      metrics.addMetric(std::make_shared<AccuracyMCMicroTensorOp<float, Eigen::DefaultDevice>>(), 0);
+      metrics.addMetric(std::make_shared<PrecisionMCMicroTensorOp<float, Eigen::DefaultDevice>>(), 1);
+      metrics(predicted, expected, error, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
+  */
+  template<typename TensorT, typename DeviceT>
+  class ClassificationMetricsTensorOp : public MetricFunctionTensorOp<TensorT, DeviceT>
+  {
+  public:
+    ClassificationMetricsTensorOp() = default;
+    ~ClassificationMetricsTensorOp() = default;
+    std::string getName() override { return "ClassificationMetricsTensorOp"; }
+    void operator()(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
+      const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      if (metrics_.empty()) return;
+
+      // compute the statistics once for all metrics that share them
+      TensorT* statistics = statistics_data_.getData(this->getStatisticsOffset_(metrics_.size(), layer_size), device);
+      for (size_t i = 0; i < metrics_.size(); ++i) {
+        TensorT* metric_statistics = statistics + this->getStatisticsOffset_(i, layer_size);
+        if (statistics_groups_.at(i) == i)
+          metrics_.at(i)->computeStatistics(predicted, expected, metric_statistics, batch_size, memory_size, layer_size, time_step, device);
+        if (!metrics_.at(i)->getUseScoreCurve())
+          metrics_.at(i)->computeMetric(metric_statistics, error, layer_size, memory_size, n_metrics, time_step, metric_index + metric_offsets_.at(i), device);
+      }
+    };
+    void finalizeMetric(TensorT* error, const int& layer_size, const int& memory_size, const int& n_metrics, const int& time_step, const int& metric_index, DeviceT& device) const override
+    {
+      if (statistics_data_.getSize() == 0) return;
+      for (size_t i = 0; i < metrics_.size(); ++i) {
+        if (!metrics_.at(i)->getUseScoreCurve()) continue;
+        TensorT* metric_statistics = statistics_data_.getData() + this->getStatisticsOffset_(i, layer_size);
+        metrics_.at(i)->computeMetric(metric_statistics, error, layer_size, memory_size, n_metrics, time_step, metric_index + metric_offsets_.at(i), device);
+      }
+      statistics_data_.setZero(device);
+    };
+
+    /**
+      @brief Add a metric function
+
+      @param[in] metric The classification metric function
+      @param[in] metric_offset The offset of the metric function index from the metric index
+    */
+    void addMetric(const std::shared_ptr<ClassificationMetricTensorOp<TensorT, DeviceT>>& metric, const int& metric_offset)
+    {
+      size_t statistics_group = metrics_.size();
+      for (size_t i = 0; i < metrics_.size(); ++i) {
+        if (metrics_.at(i)->hasSameStatistics(*metric)) {
+          statistics_group = statistics_groups_.at(i);
+          break;
+        }
+      }
+      metrics_.push_back(metric);
+      metric_offsets_.push_back(metric_offset);
+      statistics_groups_.push_back(statistics_group);
+      statistics_data_.clear();
+    }
+    int getNMetrics() const { return (int)metrics_.size(); }
+    void clear() { metrics_.clear(); metric_offsets_.clear(); statistics_groups_.clear(); statistics_data_.clear(); }
+  protected:
+    /// the offset of the statistics of the metric function (or the size of all statistics for metric_iter == number of metrics)
+    int getStatisticsOffset_(const size_t& metric_iter, const int& layer_size) const
+    {
+      const size_t statistics_group = (metric_iter < metrics_.size()) ? statistics_groups_.at(metric_iter) : metrics_.size();
+      int offset = 0;
+      for (size_t i = 0; i < statistics_group; ++i)
+        if (statistics_groups_.at(i) == i) offset += metrics_.at(i)->getStatisticsSize(layer_size);
+      return offset;
+    }
+    std::vector<std::shared_ptr<ClassificationMetricTensorOp<TensorT, DeviceT>>> metrics_;
+    std::vector<int> metric_offsets_;
+    std::vector<size_t> statistics_groups_; ///< the index of the first metric function with the same statistics
+    mutable MetricTmpData<TensorT, DeviceT> statistics_data_; ///< the statistics of all groups
+  };
+
   /**
     @brief MAE Mean Absolute Error metric function.
 
@@ -618,6 +905,17 @@ public:
 
       error_tensor.chip(metric_index, 0).chip(time_step, 0).device(device) += ((expected_tensor - predicted_chip).pow(TensorT(2)).pow(TensorT(0.5)) / expected_tensor.constant(TensorT(layer_size) * TensorT(batch_size))).sum();
     };
+    void evaluateSequence(TensorT* predicted, TensorT* expected, TensorT* error, const int& batch_size, const int& memory_size, const int& layer_size,
+      const int& n_metrics, const int& time_step_start, const int& n_time_steps, const int& metric_index, DeviceT& device) const override
+    {
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> expected_tensor(expected, batch_size, layer_size, n_time_steps);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 3>> predicted_tensor(predicted, batch_size, memory_size, layer_size);
+      Eigen::TensorMap<Eigen::Tensor<TensorT, 2>> error_tensor(error, n_metrics, memory_size);
+      auto expected_seq = expected_tensor.shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+      auto predicted_seq = predicted_tensor.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), Eigen::array<Eigen::Index, 3>({ batch_size, n_time_steps, layer_size }));
+      auto error_seq = error_tensor.slice(Eigen::array<Eigen::Index, 2>({ metric_index, time_step_start }), Eigen::array<Eigen::Index, 2>({ 1, n_time_steps }));
+      error_seq.device(device) += ((expected_seq - predicted_seq).pow(TensorT(2)).pow(TensorT(0.5)) / expected_seq.constant(TensorT(layer_size) * TensorT(batch_size))).sum(Eigen::array<int, 2>({ 0, 2 })).reshape(Eigen::array<Eigen::Index, 2>({ 1, n_time_steps }));
+    };
   };
 
   /**
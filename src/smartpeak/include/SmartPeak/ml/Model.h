@@ -14,9 +14,13 @@
 #include <tuple>
 #include <list>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
 
 // .cpp
 #include <SmartPeak/graph/CircuitFinder.h>
+#include <SmartPeak/graph/CycleFinder.h>
 #include <iostream>
 
 #include <cereal/access.hpp>  // serialiation of private members
@@ -40,6 +44,7 @@ namespace SmartPeak
 public:
     Model() = default; ///< Default constructor
     Model(const Model& other); ///< Copy constructor that does not create a shared memory address between model nodes/links/weights
+    Model(Model&& other) = default; ///< Move constructor
     Model(const int& id); ///< Explicit constructor  
     ~Model() = default; ///< Default destructor
 
@@ -84,8 +89,12 @@ public:
       nodes_ = other.nodes_;
       weights_ = other.weights_;
 			cyclic_pairs_ = other.cyclic_pairs_;
+      shared_nodes_ = other.shared_nodes_;
+      shared_links_ = other.shared_links_;
+      shared_weights_ = other.shared_weights_;
       return *this;
     }
+    Model& operator=(Model&& other) = default; ///< Move assignment operator
 
     void setId(const int& id); ///< id setter
     int getId() const; ///< id getter
@@ -217,8 +226,17 @@ public:
 		@param[out] output_nodes
 		*/
 		bool checkCompleteInputToOutput();
-		void checkCompleteInputToOutput_(const std::string & node_cur, std::set<std::string>& found_nodes, std::set<std::string>& output_nodes, std::set<std::string>& found_output_nodes);
-		void checkCompleteOutputToInput_(const std::string& node_cur, std::set<std::string>& found_nodes, std::set<std::string>& input_nodes, std::set<std::string>& found_input_nodes);
+
+		/**
+		@brief Breadth-first search from the start vertices that stops at the target vertices
+
+		@param[in] adj The adjacency (1-based vertices)
+		@param[in] starts The start vertices
+		@param[in] is_target Whether each vertex is a target (0-based vertex index)
+
+		@returns The number of distinct targets that were reached
+		*/
+		static int checkCompleteInputToOutput_(const AdjacencyCSR& adj, const std::vector<int>& starts, const std::vector<bool>& is_target);
 
 		/**
 		@brief Check model link node and weight names
@@ -248,11 +266,46 @@ public:
 		@returns An adjacency list representation of a graph
 		*/
 		std::list<int>* convertToAdjacencyList(std::map<int, std::string>& node_id_map, int& node_cnt);
-		void findCycles();
+
+		/**
+		@brief Convert model to a compressed sparse row adjacency (excluding bias nodes)
+
+		@param[out] node_id_map Map of node id to node name
+
+		@returns A CSR representation of the graph
+		*/
+		AdjacencyCSR convertToAdjacencyCSR(std::map<int, std::string>& node_id_map);
+
+		/**
+		@brief Find the cyclic source/sink node pairs of the model
+
+		By default, the pairs are found by a depth-first search over the strongly connected components
+			(O(V * E) in the worst case, see `CycleFinder`).  Optionally, all elementary circuits
+			can be enumerated (exponential time in the worst case, see `CircuitFinder`).
+			Both methods find the same set of circuit closing edges, but the `CircuitFinder`
+			reports an edge once for every circuit that it closes.
+
+		@param[in] exact_circuits Enumerate all elementary circuits
+		*/
+		void findCycles(const bool& exact_circuits = false);
 
     void addCyclicPairs(const std::pair<std::string, std::string>& cyclic_pair);
 		std::set<std::pair<std::string, std::string>> getCyclicPairs() const;
 
+		/**
+		@brief Hash of the model structure that is independent of the model id, name,
+			and node and weight values.  The hash covers the node names, types, integration and activation
+			operators, layer names, and tensor indices, the link source/sink/weight names, the weight layer names
+			and tensor indices, and the cyclic pairs.
+			Models with the same structure hash compile to the same set of interpreter operations.
+
+			NOTE: the cyclic pairs are hashed as stored in the model (i.e., as last found by `findCycles`),
+				which are also the cyclic pairs that the interpreter compiles the model with.
+
+		@returns The structure hash
+		*/
+		std::size_t getStructureHash() const;
+
 		void setError(const Eigen::Tensor<TensorT, 2> model_error); ///< model_error setter
 		Eigen::Tensor<TensorT, 2> getError() const; ///< model_error getter
 
@@ -276,6 +329,39 @@ public:
 		void setBatchAndMemorySizes(const int& batch_size, const int& memory_size);   ///< batch and memory sizes setter
 		std::pair<int, int> getBatchAndMemorySizes() const; ///< batch and memory sizes getter (non-padded sizes)
 
+    /**
+      @brief Copy-on-write copy of another model
+
+      The nodes, links, and weights are shared with the other model instead of being copied
+        (i.e., the cost is proportional to the number of elements and not to their size).
+        Shared elements are copied only when they are detached.  Model methods that add, remove,
+        or replace elements (e.g., those used by the `ModelReplicator`) do not modify shared elements,
+        but any element that is modified in place (e.g., by training, or through `getNodesMap`,
+        `getLinksMap`, or `getWeightsMap`) must be detached first.
+
+      @param[in] other The model to share the nodes, links, and weights with
+    */
+    void copyOnWrite(const Model& other);
+
+    /**
+      @brief Replace a shared node, link, or weight with a private copy.
+        Elements that are not shared or not in the model are ignored.
+
+      @param[in] name The name of the node, link, or weight
+    */
+    void detachNode(const std::string& node_name);
+    void detachLink(const std::string& link_name);
+    void detachWeight(const std::string& weight_name);
+    void detachNodes(); ///< Replace all shared nodes with private copies
+    void detachLinks(); ///< Replace all shared links with private copies
+    void detachWeights(); ///< Replace all shared weights with private copies
+    void detach(); ///< Replace all shared nodes, links, and weights with private copies
+
+    bool isShared() const; ///< whether any node, link, or weight is shared with another model
+    std::set<std::string> getSharedNodes() const { return shared_nodes_; } ///< shared_nodes getter
+    std::set<std::string> getSharedLinks() const { return shared_links_; } ///< shared_links getter
+    std::set<std::string> getSharedWeights() const { return shared_weights_; } ///< shared_weights getter
+
     void clear(); ///< clear all member data
 
 		std::map<std::string, std::shared_ptr<Link>> links_; ///< Model links
@@ -292,6 +378,9 @@ public:
     Eigen::Tensor<TensorT, 2> model_metric_;
     int batch_size_ = 0;
     int memory_size_ = 0;
+    std::set<std::string> shared_nodes_; ///< copy-on-write nodes
+    std::set<std::string> shared_links_; ///< copy-on-write links
+    std::set<std::string> shared_weights_; ///< copy-on-write weights
 		friend class cereal::access;
 		template<class Archive>
 		void serialize(Archive& archive)
@@ -465,6 +554,7 @@ public:
 			if (nodes_.count(node_name) != 0)
 			{
 				nodes_.erase(node_name);
+				shared_nodes_.erase(node_name);
 			}
 		}
 		// pruneLinks(); // Allow for dangling links
@@ -528,6 +618,7 @@ public:
 			if (weights_.count(weight_name) != 0)
 			{
 				weights_.erase(weight_name);
+				shared_weights_.erase(weight_name);
 			}
 		}
 		pruneLinks();
@@ -558,6 +649,7 @@ public:
 			if (links_.count(link_name) != 0)
 			{
 				links_.erase(link_name);
+				shared_links_.erase(link_name);
 			}
 		}
 		// pruneNodes(); // Allow dangling nodes to exist
@@ -601,20 +693,16 @@ public:
 	{
 		std::vector<std::string> node_names;
 		if (nodes_.empty()) { return false; }
+		std::unordered_set<std::string> linked_nodes;
+		linked_nodes.reserve(2 * links_.size());
+		for (const auto& link : links_)
+		{
+			linked_nodes.insert(link.second->getSourceNodeName());
+			linked_nodes.insert(link.second->getSinkNodeName());
+		}
 		for (const auto& node : nodes_)
 		{
-			bool found = false;
-			// if (links_.empty()) { found = true; }
-			for (const auto& link : links_)
-			{
-				if (node.second->getName() == link.second->getSourceNodeName() ||
-					node.second->getName() == link.second->getSinkNodeName())
-				{
-					found = true;
-					break;
-				}
-			}
-			if (!found)
+			if (linked_nodes.count(node.second->getName()) == 0)
 			{
 				node_names.push_back(node.first);
 			}
@@ -633,19 +721,15 @@ public:
 	{
 		std::vector<std::string> weight_names;
 		if (weights_.empty()) { return false; }
+		std::unordered_set<std::string> linked_weights;
+		linked_weights.reserve(links_.size());
+		for (const auto& link : links_)
+		{
+			linked_weights.insert(link.second->getWeightName());
+		}
 		for (const auto& weight : weights_)
 		{
-			bool found = false;
-			// if (links_.empty()) { found = true; }
-			for (const auto& link : links_)
-			{
-				if (weight.second->getName() == link.second->getWeightName())
-				{
-					found = true;
-					break;
-				}
-			}
-			if (!found)
+			if (linked_weights.count(weight.second->getName()) == 0)
 			{
 				weight_names.push_back(weight.first);
 			}
@@ -666,32 +750,8 @@ public:
 		if (links_.empty()) { return false; }
 		for (const auto& link : links_)
 		{
-			bool source_node_found = false;
-			bool sink_node_found = false;
-			// if (nodes_.empty())
-			// {
-			//   source_node_found = true;
-			//   sink_node_found = true;
-			// }
-			for (const auto& node : nodes_)
-			{
-				if (node.second->getName() == link.second->getSourceNodeName())
-					source_node_found = true;
-				if (node.second->getName() == link.second->getSinkNodeName())
-					sink_node_found = true;
-				if (source_node_found && sink_node_found)
-					break;
-			}
-			bool weight_found = false;
-			// if (weights_.empty()) { weight_found = true; }
-			for (const auto& weight : weights_)
-			{
-				if (weight.second->getName() == link.second->getWeightName())
-				{
-					weight_found = true;
-					break;
-				}
-			}
+			const bool source_node_found = nodes_.count(link.second->getSourceNodeName()) != 0;
+			const bool sink_node_found = nodes_.count(link.second->getSinkNodeName()) != 0;
 			if (!source_node_found || !sink_node_found)
 			{
 				link_names.push_back(link.first);
@@ -771,84 +831,64 @@ public:
 	}
 
 	template<typename TensorT>
-	inline void Model<TensorT>::checkCompleteInputToOutput_(const std::string& node_cur, std::set<std::string>& found_nodes, std::set<std::string>& output_nodes, std::set<std::string>& found_output_nodes)
+	inline int Model<TensorT>::checkCompleteInputToOutput_(const AdjacencyCSR& adj, const std::vector<int>& starts, const std::vector<bool>& is_target)
 	{
-		for (auto& link_map : links_) {
-			if (link_map.second->getSourceNodeName() == node_cur) {
-				std::string node_next = link_map.second->getSinkNodeName();
-				if (output_nodes.count(node_next)) {
-					found_output_nodes.insert(node_next);
-					if (found_output_nodes.size() == output_nodes.size()) return;
-				}
-				else if (found_nodes.count(node_next)) {
-					continue; // found a loop
-				}
-				else {
-					found_nodes.insert(node_next);
-					checkCompleteInputToOutput_(node_next, found_nodes, output_nodes, found_output_nodes);
-					if (found_output_nodes.size() == output_nodes.size()) return;
-				}
-			}
+		int n_found = 0;
+		std::vector<bool> visited(adj.n_nodes, false);
+		std::vector<int> queue;
+		queue.reserve(adj.n_nodes);
+		for (const int& start : starts) {
+			visited[start - 1] = true;
+			queue.push_back(start);
 		}
-	};
-
-	template<typename TensorT>
-	inline void Model<TensorT>::checkCompleteOutputToInput_(const std::string& node_cur, std::set<std::string>& found_nodes, std::set<std::string>& output_nodes, std::set<std::string>& found_output_nodes)
-	{
-		for (auto& link_map : links_) {
-			if (link_map.second->getSinkNodeName() == node_cur) {
-				std::string node_next = link_map.second->getSourceNodeName();
-				if (output_nodes.count(node_next)) {
-					found_output_nodes.insert(node_next);
-					if (found_output_nodes.size() == output_nodes.size()) return;
-				}
-				else if (found_nodes.count(node_next)) {
-					continue; // found a loop
-				}
-				else {
-					found_nodes.insert(node_next);
-					checkCompleteOutputToInput_(node_next, found_nodes, output_nodes, found_output_nodes);
-					if (found_output_nodes.size() == output_nodes.size()) return;
-				}
+		for (size_t q = 0; q < queue.size(); ++q) {
+			for (int e = adj.begin(queue[q]); e < adj.end(queue[q]); ++e) {
+				const int next = adj.targets[e];
+				if (visited[next - 1]) continue;
+				visited[next - 1] = true;
+				if (is_target[next - 1]) ++n_found; // do not walk past the targets
+				else queue.push_back(next);
 			}
 		}
-	};
+		return n_found;
+	}
 
 	template<typename TensorT>
 	inline bool Model<TensorT>::checkCompleteInputToOutput()
 	{
-		// Create a set of target output nodes
-		std::set<std::string> output_nodes, found_output_nodes;
-		for (auto& node : nodes_)
-			if (node.second->getType() == NodeType::output)
-				output_nodes.insert(node.second->getName());
-
-		// Create a set of target output nodes
-		std::set<std::string> input_nodes, found_input_nodes;
-		for (auto& node : nodes_)
+		// number the nodes (including link source/sink names that are not in the model)
+		std::unordered_map<std::string, int> node_index;
+		node_index.reserve(nodes_.size());
+		std::vector<int> input_nodes, output_nodes;
+		for (const auto& node : nodes_) {
+			node_index.emplace(node.second->getName(), (int)node_index.size() + 1);
 			if (node.second->getType() == NodeType::input)
-				input_nodes.insert(node.second->getName());
-
-		// Start at each input node and walk through the graph until
-		// a previous node is reached or an output node is reached
-		for (const std::string& node : input_nodes) {
-			std::set<std::string> found_nodes;
-			found_nodes.insert(node);
-			checkCompleteInputToOutput_(node, found_nodes, output_nodes, found_output_nodes);
-			if (found_output_nodes.size() == output_nodes.size()) break;
+				input_nodes.push_back((int)node_index.size());
+			else if (node.second->getType() == NodeType::output)
+				output_nodes.push_back((int)node_index.size());
 		}
-
-		// Start at each output node and walk through the graph until
-		// a previous node is reached or an input node is reached
-		for (const std::string& node : output_nodes) {
-			std::set<std::string> found_nodes;
-			found_nodes.insert(node);
-			checkCompleteOutputToInput_(node, found_nodes, input_nodes, found_input_nodes);
-			if (found_input_nodes.size() == input_nodes.size()) break;
+		std::vector<std::pair<int, int>> edges_forward, edges_backward;
+		edges_forward.reserve(links_.size());
+		edges_backward.reserve(links_.size());
+		for (const auto& link : links_) {
+			const int source = node_index.emplace(link.second->getSourceNodeName(), (int)node_index.size() + 1).first->second;
+			const int sink = node_index.emplace(link.second->getSinkNodeName(), (int)node_index.size() + 1).first->second;
+			edges_forward.push_back(std::make_pair(source, sink));
+			edges_backward.push_back(std::make_pair(sink, source));
 		}
-		
-		if (found_input_nodes.size() == input_nodes.size() && found_output_nodes.size() == output_nodes.size()) return true;
-		else return false;
+		const int n_nodes = (int)node_index.size();
+		std::vector<bool> is_input(n_nodes, false), is_output(n_nodes, false);
+		for (const int& node : input_nodes) is_input[node - 1] = true;
+		for (const int& node : output_nodes) is_output[node - 1] = true;
+
+		// Walk from the input nodes through the graph until an output node is reached
+		AdjacencyCSR adj;
+		adj.build(n_nodes, edges_forward);
+		if (checkCompleteInputToOutput_(adj, input_nodes, is_output) != output_nodes.size()) return false;
+
+		// Walk from the output nodes back through the graph until an input node is reached
+		adj.build(n_nodes, edges_backward);
+		return checkCompleteInputToOutput_(adj, output_nodes, is_input) == input_nodes.size();
 	}
 
 	template<typename TensorT>
@@ -880,43 +920,31 @@ public:
 	inline bool Model<TensorT>::removeIsolatedNodes()
 	{
 		// key/value pair of node name and source/sink count pair
-		std::map<std::string, std::pair<int, int>> node_counts;
+		std::unordered_map<std::string, std::pair<int, int>> node_counts;
 
 		// count all sink/source connections for each node
 		for (const auto& link_map : links_)
 		{
+			const NodeType source_type = nodes_.at(link_map.second->getSourceNodeName())->getType();
+
 			// source
-			if (nodes_.at(link_map.second->getSourceNodeName())->getType() == NodeType::hidden)
-			{
-				auto found = node_counts.emplace(link_map.second->getSourceNodeName(), std::make_pair(1, 0));
-				if (!found.second)
-				{
-					node_counts[link_map.second->getSourceNodeName()].first += 1;
-				}
-			}
+			if (source_type == NodeType::hidden)
+				node_counts[link_map.second->getSourceNodeName()].first += 1;
 
 			// sink
-			if (nodes_.at(link_map.second->getSinkNodeName())->getType() == NodeType::hidden
-				&& nodes_.at(link_map.second->getSourceNodeName())->getType() != NodeType::bias)
-			{
-				auto found = node_counts.emplace(link_map.second->getSinkNodeName(), std::make_pair(0, 1));
-				if (!found.second)
-				{
-					node_counts[link_map.second->getSinkNodeName()].second += 1;
-				}
-			}
+			if (source_type != NodeType::bias
+				&& nodes_.at(link_map.second->getSinkNodeName())->getType() == NodeType::hidden)
+				node_counts[link_map.second->getSinkNodeName()].second += 1;
 		}
 
-		bool dead_end_node_found = false;
+		std::vector<std::string> dead_end_nodes;
 		for (const auto& node_count : node_counts)
 		{
 			if (node_count.second.first == 0 || node_count.second.second == 0)
-			{
-				removeNodes({ node_count.first });
-				dead_end_node_found = true;
-			}
+				dead_end_nodes.push_back(node_count.first);
 		}
-		return dead_end_node_found;
+		removeNodes(dead_end_nodes);
+		return !dead_end_nodes.empty();
 	}
 
 	template<typename TensorT>
@@ -949,17 +977,59 @@ public:
 	}
 
 	template<typename TensorT>
-	inline void Model<TensorT>::findCycles()
+	inline AdjacencyCSR Model<TensorT>::convertToAdjacencyCSR(std::map<int, std::string>& node_id_map)
 	{
-		std::map<int, std::string> node_id_map;
-		int node_cnt;
-		std::list<int> *adj = convertToAdjacencyList(node_id_map, node_cnt);
+		// create a map of node id to node name (excluding bias nodes)
+		node_id_map.clear();
+		int node_cnt = 0;
+		for (auto& node_map : nodes_) {
+			if (node_map.second->getType() != NodeType::bias) {
+				++node_cnt;
+				node_map.second->setId(node_cnt);
+				node_id_map.emplace(node_cnt, node_map.first);
+			}
+			else {
+				node_map.second->setId(-1);
+			}
+		}
 
-		CircuitFinder CF(adj, node_cnt);
-		CF.run();
+		// collect the edges (excluding bias nodes)
+		std::vector<std::pair<int, int>> edges;
+		edges.reserve(links_.size());
+		for (auto& link_map : links_) {
+			const int source_id = nodes_.at(link_map.second->getSourceNodeName())->getId();
+			if (source_id > 0)
+				edges.emplace_back(source_id, nodes_.at(link_map.second->getSinkNodeName())->getId());
+		}
+
+		AdjacencyCSR adj;
+		adj.build(node_cnt, edges);
+		return adj;
+	}
+
+	template<typename TensorT>
+	inline void Model<TensorT>::findCycles(const bool& exact_circuits)
+	{
+		std::map<int, std::string> node_id_map;
+		const AdjacencyCSR adj = convertToAdjacencyCSR(node_id_map);
+
+		std::vector<std::pair<int, int>> cycles;
+		if (exact_circuits) {
+			std::vector<std::list<int>> adj_list(adj.n_nodes);
+			for (int v = 1; v <= adj.n_nodes; ++v)
+				adj_list[v - 1].assign(adj.targets.begin() + adj.begin(v), adj.targets.begin() + adj.end(v));
+			CircuitFinder CF(adj_list.data(), adj.n_nodes);
+			CF.run();
+			cycles = CF.getCycles();
+		}
+		else {
+			CycleFinder CF(adj);
+			CF.run();
+			cycles = CF.getCycles();
+		}
 
 		cyclic_pairs_.clear();
-		for (const auto& source_sink : CF.getCycles()) {
+		for (const auto& source_sink : cycles) {
 			if (nodes_.at(node_id_map.at(source_sink.second))->getType() == NodeType::recursive) // enforce order of recursive nodes
 				cyclic_pairs_.insert(std::make_pair(node_id_map.at(source_sink.second), node_id_map.at(source_sink.first)));
 			else
@@ -979,6 +1049,46 @@ public:
 		return cyclic_pairs_;
 	}
 
+	template<typename TensorT>
+	inline std::size_t Model<TensorT>::getStructureHash() const
+	{
+		std::size_t seed = 0;
+		std::hash<std::string> hasher;
+		auto hash_combine = [&seed, &hasher](const std::string& str) {
+			seed ^= hasher(str) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		};
+
+		// NOTE: maps and sets are ordered so that the iteration order is deterministic
+		for (const auto& node_map : nodes_) {
+			hash_combine(node_map.first);
+			hash_combine(std::to_string(static_cast<int>(node_map.second->getType())));
+			hash_combine((node_map.second->getIntegration() != nullptr) ? node_map.second->getIntegration()->getName() : "");
+			hash_combine((node_map.second->getActivation() != nullptr) ? node_map.second->getActivation()->getName() : "");
+			hash_combine(node_map.second->getLayerName());
+			hash_combine(std::to_string(node_map.second->getTensorIndex().first) + "," + std::to_string(node_map.second->getTensorIndex().second));
+		}
+		hash_combine("/links");
+		for (const auto& link_map : links_) {
+			hash_combine(link_map.first);
+			hash_combine(link_map.second->getSourceNodeName());
+			hash_combine(link_map.second->getSinkNodeName());
+			hash_combine(link_map.second->getWeightName());
+		}
+		hash_combine("/weights");
+		for (const auto& weight_map : weights_) {
+			hash_combine(weight_map.first);
+			hash_combine(weight_map.second->getLayerName());
+			for (const std::tuple<int, int, int>& tensor_index : weight_map.second->getTensorIndex())
+				hash_combine(std::to_string(std::get<0>(tensor_index)) + "," + std::to_string(std::get<1>(tensor_index)) + "," + std::to_string(std::get<2>(tensor_index)));
+		}
+		hash_combine("/cycles");
+		for (const auto& cyclic_pair : cyclic_pairs_) {
+			hash_combine(cyclic_pair.first);
+			hash_combine(cyclic_pair.second);
+		}
+		return seed;
+	}
+
 	template<typename TensorT>
 	inline void Model<TensorT>::setError(const Eigen::Tensor<TensorT, 2> model_error) {
 		model_error_ = model_error;
@@ -1038,6 +1148,112 @@ public:
     weights_.clear();
     nodes_.clear();
     links_.clear();
+    shared_nodes_.clear();
+    shared_links_.clear();
+    shared_weights_.clear();
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::copyOnWrite(const Model<TensorT>& other)
+  {
+    id_ = other.id_;
+    name_ = other.name_;
+    links_ = other.links_;
+    nodes_ = other.nodes_;
+    weights_ = other.weights_;
+    cyclic_pairs_ = other.cyclic_pairs_;
+    shared_nodes_.clear();
+    for (const auto& node_map : nodes_) shared_nodes_.insert(shared_nodes_.end(), node_map.first);
+    shared_links_.clear();
+    for (const auto& link_map : links_) shared_links_.insert(shared_links_.end(), link_map.first);
+    shared_weights_.clear();
+    for (const auto& weight_map : weights_) shared_weights_.insert(shared_weights_.end(), weight_map.first);
+    input_nodes_.clear();
+    output_nodes_.clear();
+    setInputAndOutputNodes();
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::detachNode(const std::string& node_name)
+  {
+    if (shared_nodes_.erase(node_name) == 0) return;
+    auto found = nodes_.find(node_name);
+    if (found == nodes_.end()) return;
+    found->second = std::make_shared<Node<TensorT>>(*found->second);
+    if (found->second->getType() == NodeType::input || found->second->getType() == NodeType::output) {
+      // update the input/output node pointers
+      input_nodes_.clear();
+      output_nodes_.clear();
+      setInputAndOutputNodes();
+    }
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::detachLink(const std::string& link_name)
+  {
+    if (shared_links_.erase(link_name) == 0) return;
+    auto found = links_.find(link_name);
+    if (found == links_.end()) return;
+    found->second = std::make_shared<Link>(*found->second);
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::detachWeight(const std::string& weight_name)
+  {
+    if (shared_weights_.erase(weight_name) == 0) return;
+    auto found = weights_.find(weight_name);
+    if (found == weights_.end()) return;
+    found->second = std::make_shared<Weight<TensorT>>(*found->second);
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::detachNodes()
+  {
+    if (shared_nodes_.empty()) return;
+    for (const std::string& node_name : shared_nodes_) {
+      auto found = nodes_.find(node_name);
+      if (found != nodes_.end()) found->second = std::make_shared<Node<TensorT>>(*found->second);
+    }
+    shared_nodes_.clear();
+
+    // update the input/output node pointers
+    input_nodes_.clear();
+    output_nodes_.clear();
+    setInputAndOutputNodes();
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::detachLinks()
+  {
+    for (const std::string& link_name : shared_links_) {
+      auto found = links_.find(link_name);
+      if (found != links_.end()) found->second = std::make_shared<Link>(*found->second);
+    }
+    shared_links_.clear();
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::detachWeights()
+  {
+    for (const std::string& weight_name : shared_weights_) {
+      auto found = weights_.find(weight_name);
+      if (found != weights_.end()) found->second = std::make_shared<Weight<TensorT>>(*found->second);
+    }
+    shared_weights_.clear();
+  }
+
+  template<typename TensorT>
+  inline void Model<TensorT>::detach()
+  {
+    detachNodes();
+    detachLinks();
+    detachWeights();
+  }
+
+  template<typename TensorT>
+  inline bool Model<TensorT>::isShared() const
+  {
+    return !shared_nodes_.empty() || !shared_links_.empty() || !shared_weights_.empty();
   }
 }
 #endif //SMARTPEAK_MODEL_H
\ No newline at end of file
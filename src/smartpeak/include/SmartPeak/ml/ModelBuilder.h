@@ -173,6 +173,30 @@ public:
 		std::vector<std::string> addStableSoftMax(Model<TensorT>& model, const std::string& name, const std::string& module_name, const std::vector<std::string>& source_node_names,
 			const bool& specify_layer = false);
 
+		/**
+		@brief Add a fused numerically stable Soft Max or Log Soft Max
+
+		The max offset, exponentials, sum, and normalization of `addStableSoftMax` are computed by a single layer
+			whose `SoftMaxOp` (or `LogSoftMaxOp`) integration evaluates the whole softmax in one fused operation
+			and whose error is the analytic gradient of the softmax (see `SoftMaxTensorOp` and `SoftMaxErrorTensorOp`).
+			The fixed links between the source nodes and the softmax nodes encode the input of each softmax node and are not trained.
+			The source nodes should be placed on a single layer.
+
+		When the softmax nodes are output nodes that are trained with `CrossEntropyWithLogitsLossGradOp`,
+			the softmax gradient can be fused with the loss function gradient (i.e., the loss function gradient of the
+			softmax outputs is passed directly to the source nodes using `SoftMaxCrossEntropyErrorOp`)
+
+		@param[in, out] Model
+		@param[in] source_node_names Node_names to add the layer to
+		@param[in] log_softmax Whether to compute the log of the softmax or not
+		@param[in] fuse_with_loss Whether to fuse the softmax gradient with the cross entropy with logits loss function gradient or not
+		@param[in] specify_layer Manually specify the layer that the nodes should be placed on
+
+		@returns vector of output node names
+		*/
+		std::vector<std::string> addSoftMaxFused(Model<TensorT>& model, const std::string& name, const std::string& module_name, const std::vector<std::string>& source_node_names,
+			const bool& log_softmax = false, const bool& fuse_with_loss = false, const bool& specify_layer = false);
+
 		/**
 		@brief Add a Convolution layer or Pooling layer
 
@@ -480,6 +504,67 @@ public:
 			const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
 			const TensorT& drop_out_prob = 0.0f, const TensorT& drop_connection_prob = 0.0f, const bool& biases = true, bool input_gate_connection = true, const bool& specify_layer = false);
 
+		/**
+		@brief Add a fused LSTM layer
+
+		All gates of the layer are computed by a single gate layer of linear nodes (the input, forget, block input, and output gate
+			pre-activations of each unit) that is fully connected to the source nodes, the biases, and the recurrent output nodes.
+			The memory cell and output gate nodes of all units make up a single cell layer whose `LSTMCellOp` integration computes
+			the gate activations and the memory cells of the whole layer in one fused operation (see `LSTMCellTensorOp`)
+			and the output nodes of all units make up a single output layer whose `LSTMOutputOp` integration computes the outputs
+			of the whole layer in one fused operation (see `LSTMOutputTensorOp`).
+			The fixed links between the gate, cell, and output layers encode the gate of each link and are not trained.
+
+		NOTE: the recurrent links should be specified as cyclic pairs (and `Model::findCycles` not used)
+			so that the cells of all units are computed by a single tensor operation.
+
+		@param[in, out] Model
+		@param[in] source_node_names Node_names to add the layer to
+		@param[in] n_units The number of LSTM units
+		@param[in] weight_init The weight initialization function of the source to gate and recurrent weights
+		@param[in] solver The weight solver of the source to gate, bias, and recurrent weights
+		@param[in] drop_connection_prob Weight drop out probability
+		@param[in] biases Whether to include bias nodes or not
+		@param[in] specify_layer Manually specify the layer that the nodes should be placed on
+		@param[in] specify_cyclic_pairs Specify the recurrent output to gate links as cyclic pairs
+
+		@returns vector of output node names
+		*/
+		std::vector<std::string> addLSTMFused(Model<TensorT>& model, const std::string& name, const std::string& module_name,
+			const std::vector<std::string>& source_node_names, const int& n_units,
+			const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
+			const TensorT& drop_connection_prob = 0.0f, const bool& biases = true, const bool& specify_layer = false, const bool& specify_cyclic_pairs = false);
+
+		/**
+		@brief Add a fused GRU layer
+
+		All gates of the layer are computed by a single gate layer of linear nodes (the update gate, reset gate, input candidate,
+			and recurrent candidate pre-activations of each unit) that is fully connected to the source nodes, the biases,
+			and the recurrent output nodes.  The reset gate is applied to the recurrent candidate (i.e., after the recurrent weights
+			as in cuDNN) so that the output nodes of all units make up a single cell layer whose `GRUCellOp` integration computes
+			the gate activations and the output of the whole layer in one fused operation (see `GRUCellTensorOp`).
+			The fixed gate to cell links encode the gate of each link and are not trained.
+
+		NOTE: the recurrent links should be specified as cyclic pairs (and `Model::findCycles` not used)
+			so that the outputs of all units are computed by a single tensor operation.
+
+		@param[in, out] Model
+		@param[in] source_node_names Node_names to add the layer to
+		@param[in] n_units The number of GRU units
+		@param[in] weight_init The weight initialization function of the source to gate and recurrent weights
+		@param[in] solver The weight solver of the source to gate, bias, and recurrent weights
+		@param[in] drop_connection_prob Weight drop out probability
+		@param[in] biases Whether to include bias nodes or not
+		@param[in] specify_layer Manually specify the layer that the nodes should be placed on
+		@param[in] specify_cyclic_pairs Specify the recurrent output to gate links as cyclic pairs
+
+		@returns vector of output node names
+		*/
+		std::vector<std::string> addGRUFused(Model<TensorT>& model, const std::string& name, const std::string& module_name,
+			const std::vector<std::string>& source_node_names, const int& n_units,
+			const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
+			const TensorT& drop_connection_prob = 0.0f, const bool& biases = true, const bool& specify_layer = false, const bool& specify_cyclic_pairs = false);
+
 		/**
 		@brief Add a dot product self attention layer with activation
 
@@ -522,6 +607,38 @@ public:
 			const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
 			const TensorT& drop_out_prob = 0.0f, const TensorT& drop_connection_prob = 0.0f, const bool& biases = true, bool split_attention_layers = true);
 
+		/**
+		@brief Add a fused multi-head scaled dot product self attention layer with activation
+
+		The query, key, and values projections of all heads make up a single projection layer of linear nodes
+			that is fully connected to the source nodes, and the attention nodes of all heads make up a single attention layer
+			whose `DotProdAttentionOp` integration computes the scores, the stable softmax, and the weighted values
+			of all heads in one fused operation (see `DotProdAttentionTensorOp`).  The attention of each head is the same
+			as that of `addDotProdAttention` (with equal key and values lengths) but without the intermediate score and softmax layers.
+			The fixed links between the projection and attention layers encode the role of each link and are not trained.
+
+		@param[in, out] Model
+		@param[in] source_node_names Node_names of the queries, keys, and values
+		@param[in] n_heads The number of heads
+		@param[in] model_length The number of output nodes
+		@param[in] key_length The length of the queries, keys, and values of each head
+		@param[in] node_activation The activation function of the attention and output nodes
+		@param[in] node_activation_grad The activation function gradient of the attention and output nodes
+		@param[in] weight_init The weight initialization function of the projection and output weights
+		@param[in] solver The weight solver of the projection and output weights
+		@param[in] drop_out_prob Node drop out probability
+		@param[in] drop_connection_prob Weight drop out probability
+		@param[in] biases Whether to include bias nodes in the output layer or not
+		@param[in] specify_layer Manually specify the layer that the nodes should be placed on
+
+		@returns vector of output node names
+		*/
+		std::vector<std::string> addMultiHeadAttentionFused(Model<TensorT>& model, const std::string& name, const std::string& module_name,
+			const std::vector<std::string>& source_node_names, const int& n_heads, const int& model_length, const int& key_length,
+			const std::shared_ptr<ActivationOp<TensorT>>& node_activation, const std::shared_ptr<ActivationOp<TensorT>>& node_activation_grad,
+			const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
+			const TensorT& drop_out_prob = 0.0f, const TensorT& drop_connection_prob = 0.0f, const bool& biases = true, const bool& specify_layer = false);
+
 		/**
 		@brief Add an additive attention layer with activation
 
@@ -690,6 +807,11 @@ public:
 		@brief Make a unity weight
 		*/
 		std::string makeUnityWeight(Model<TensorT>& model, const TensorT& scale, const std::string& module_name, const std::string& name_format, const std::string& lhs, const std::string& rhs, const bool& specify_layer = false);
+
+		/**
+		@brief Make a fixed gate to cell link of a fused layer whose weight encodes the gate (see `addLSTMFused`, `addGRUFused`, `addMultiHeadAttentionFused`, and `addSoftMaxFused`)
+		*/
+		void makeFusedCellLink(Model<TensorT>& model, const std::string& module_name, const std::string& gate_name, const std::string& cell_name, const TensorT& gate_code, const bool& specify_layer = false);
   };
 	template<typename TensorT>
 	std::vector<std::string> ModelBuilder<TensorT>::addInputNodes(Model<TensorT> & model, const std::string & name, const std::string & module_name, const int & n_nodes, const bool& specify_layer)
@@ -1258,6 +1380,47 @@ public:
 		return node_names;
 	}
 	template<typename TensorT>
+	inline std::vector<std::string> ModelBuilder<TensorT>::addSoftMaxFused(Model<TensorT>& model, const std::string& name, const std::string& module_name, const std::vector<std::string>& source_node_names,
+		const bool& log_softmax, const bool& fuse_with_loss, const bool& specify_layer)
+	{
+		if (log_softmax && fuse_with_loss) {
+			const std::string error = "The log softmax cannot be fused with the cross entropy with logits loss function gradient.";
+			throw std::runtime_error(error);
+		}
+
+		std::vector<std::string> node_names;
+		for (int i = 0; i < source_node_names.size(); ++i) {
+			// Create the softmax node
+			char* node_name_char = new char[512];
+			sprintf(node_name_char, "%s-Out_%012d", name.data(), i);
+			std::string node_name(node_name_char);
+			std::shared_ptr<IntegrationOp<TensorT>> integration;
+			std::shared_ptr<IntegrationErrorOp<TensorT>> integration_error;
+			if (log_softmax) {
+				integration = std::make_shared<LogSoftMaxOp<TensorT>>(LogSoftMaxOp<TensorT>());
+				integration_error = std::make_shared<LogSoftMaxErrorOp<TensorT>>(LogSoftMaxErrorOp<TensorT>());
+			}
+			else {
+				integration = std::make_shared<SoftMaxOp<TensorT>>(SoftMaxOp<TensorT>());
+				if (fuse_with_loss) integration_error = std::make_shared<SoftMaxCrossEntropyErrorOp<TensorT>>(SoftMaxCrossEntropyErrorOp<TensorT>());
+				else integration_error = std::make_shared<SoftMaxErrorOp<TensorT>>(SoftMaxErrorOp<TensorT>());
+			}
+			Node<TensorT> node(node_name, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<TensorT>>(LinearOp<TensorT>()), std::make_shared<LinearGradOp<TensorT>>(LinearGradOp<TensorT>()),
+				integration, integration_error, std::make_shared<SoftMaxWeightGradOp<TensorT>>(SoftMaxWeightGradOp<TensorT>()));
+			node.setModuleName(module_name);
+			if (specify_layer) node.setLayerName(module_name + "-SoftMax");
+			model.addNodes({ node });
+			node_names.push_back(node_name);
+			delete[] node_name_char;
+
+			// Route all source nodes to the softmax node (the fixed weight encodes the input of the softmax node)
+			for (int j = 0; j < source_node_names.size(); ++j)
+				makeFusedCellLink(model, module_name, source_node_names[j], node_name, (i == j) ? TensorT(2) : TensorT(1), specify_layer);
+		}
+
+		return node_names;
+	}
+	template<typename TensorT>
 	std::vector<std::string> ModelBuilder<TensorT>::addConvolution(Model<TensorT> & model, const std::string & name, const std::string& module_name, const std::vector<std::string>& source_node_names,
 		const int & input_width, const int & input_height, const int& input_width_zero_padding, const int& input_height_zero_padding,
 		const int & extent_width, const int & extent_height, const int & stride,
@@ -3782,6 +3945,68 @@ public:
 		return node_names;
 	}
 	template<typename TensorT>
+	inline std::vector<std::string> ModelBuilder<TensorT>::addMultiHeadAttentionFused(Model<TensorT>& model, const std::string& name, const std::string& module_name,
+		const std::vector<std::string>& source_node_names, const int& n_heads, const int& model_length, const int& key_length,
+		const std::shared_ptr<ActivationOp<TensorT>>& node_activation, const std::shared_ptr<ActivationOp<TensorT>>& node_activation_grad,
+		const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
+		const TensorT& drop_out_prob, const TensorT& drop_connection_prob, const bool& biases, const bool& specify_layer)
+	{
+		// Make the query, key, and values projections of all heads
+		const std::vector<std::string> projection_types = { "Query", "Key", "Values" };
+		std::vector<std::vector<std::vector<std::string>>> projection_names(n_heads, std::vector<std::vector<std::string>>(projection_types.size()));
+		std::vector<std::string> projection_names_all;
+		for (int head_iter = 0; head_iter < n_heads; ++head_iter) {
+			for (size_t type_iter = 0; type_iter < projection_types.size(); ++type_iter) {
+				for (int key_iter = 0; key_iter < key_length; ++key_iter) {
+					char* projection_name_char = new char[512];
+					sprintf(projection_name_char, "%s-Projections-%s-%012d_%012d", name.data(), projection_types[type_iter].data(), head_iter, key_iter);
+					std::string projection_name(projection_name_char);
+					Node<TensorT> projection(projection_name, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<TensorT>>(LinearOp<TensorT>()), std::make_shared<LinearGradOp<TensorT>>(LinearGradOp<TensorT>()), std::make_shared<SumOp<TensorT>>(SumOp<TensorT>()), std::make_shared<SumErrorOp<TensorT>>(SumErrorOp<TensorT>()), std::make_shared<SumWeightGradOp<TensorT>>(SumWeightGradOp<TensorT>()));
+					projection.setModuleName(module_name);
+					if (specify_layer) projection.setLayerName(module_name + "-Projections");
+					model.addNodes({ projection });
+					projection_names[head_iter][type_iter].push_back(projection_name);
+					projection_names_all.push_back(projection_name);
+					delete[] projection_name_char;
+				}
+			}
+		}
+		addFullyConnected(model, module_name, source_node_names, projection_names_all, weight_init, solver, drop_connection_prob, specify_layer);
+
+		// Make the attention nodes of all heads
+		std::vector<std::string> attention_names;
+		for (int head_iter = 0; head_iter < n_heads; ++head_iter) {
+			for (int key_iter = 0; key_iter < key_length; ++key_iter) {
+				char* attention_name_char = new char[512];
+				sprintf(attention_name_char, "%s-Attention-%012d_%012d", name.data(), head_iter, key_iter);
+				std::string attention_name(attention_name_char);
+				Node<TensorT> attention(attention_name, NodeType::hidden, NodeStatus::initialized, node_activation, node_activation_grad, std::make_shared<DotProdAttentionOp<TensorT>>(DotProdAttentionOp<TensorT>()), std::make_shared<DotProdAttentionErrorOp<TensorT>>(DotProdAttentionErrorOp<TensorT>()), std::make_shared<DotProdAttentionWeightGradOp<TensorT>>(DotProdAttentionWeightGradOp<TensorT>()));
+				attention.setModuleName(module_name);
+				attention.setDropProbability(drop_out_prob);
+				if (specify_layer) attention.setLayerName(module_name + "-Attention");
+				model.addNodes({ attention });
+				attention_names.push_back(attention_name);
+				delete[] attention_name_char;
+
+				// Route the queries and keys of the head and the values of the position to the attention node
+				//   (the fixed weight encodes the projection and its position; the values of the other positions
+				//   are linked with a weight of 0 so that all projections have the same outputs)
+				for (int position_iter = 0; position_iter < key_length; ++position_iter) {
+					makeFusedCellLink(model, module_name, projection_names[head_iter][0][position_iter], attention_name, TensorT(3 * position_iter + 1), specify_layer);
+					makeFusedCellLink(model, module_name, projection_names[head_iter][1][position_iter], attention_name, TensorT(3 * position_iter + 2), specify_layer);
+					makeFusedCellLink(model, module_name, projection_names[head_iter][2][position_iter], attention_name, (position_iter == key_iter) ? TensorT(3 * position_iter + 3) : TensorT(0), specify_layer);
+				}
+			}
+		}
+
+		// Matrix multiply the concatenated heads to create the output
+		std::vector<std::string> node_names = addFullyConnected(model, name + "_MultiHead", module_name, attention_names, model_length, node_activation, node_activation_grad,
+			std::make_shared<SumOp<TensorT>>(SumOp<TensorT>()), std::make_shared<SumErrorOp<TensorT>>(SumErrorOp<TensorT>()), std::make_shared<SumWeightGradOp<TensorT>>(SumWeightGradOp<TensorT>()),
+			weight_init, solver, drop_out_prob, drop_connection_prob, biases, specify_layer);
+
+		return node_names;
+	}
+	template<typename TensorT>
 	inline std::vector<std::string> ModelBuilder<TensorT>::addScalar(Model<TensorT>& model, const std::string & name, const std::string & module_name, 
 		const std::vector<std::string>& source_node_names, const TensorT & scalar_value, 
 		const std::shared_ptr<ActivationOp<TensorT>>& node_activation, const std::shared_ptr<ActivationOp<TensorT>>& node_activation_grad, const bool& specify_layer)
@@ -3966,6 +4191,155 @@ public:
 
     return node_names_output;
   }
+  template<typename TensorT>
+  inline std::vector<std::string> ModelBuilder<TensorT>::addLSTMFused(Model<TensorT>& model, const std::string& name, const std::string& module_name,
+    const std::vector<std::string>& source_node_names, const int& n_units,
+    const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
+    const TensorT& drop_connection_prob, const bool& biases, const bool& specify_layer, const bool& specify_cyclic_pairs)
+  {
+    // Make the gate nodes
+    const std::vector<std::string> gate_types = { "Input", "Forget", "BlockInput", "Output" };
+    std::vector<std::vector<std::string>> gate_names(gate_types.size());
+    for (size_t gate_iter = 0; gate_iter < gate_types.size(); ++gate_iter) {
+      for (int unit_iter = 0; unit_iter < n_units; ++unit_iter) {
+        char* gate_name_char = new char[512];
+        sprintf(gate_name_char, "%s-Gates-%s_%012d", name.data(), gate_types[gate_iter].data(), unit_iter);
+        std::string gate_name(gate_name_char);
+        Node<TensorT> gate(gate_name, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<TensorT>>(LinearOp<TensorT>()), std::make_shared<LinearGradOp<TensorT>>(LinearGradOp<TensorT>()), std::make_shared<SumOp<TensorT>>(SumOp<TensorT>()), std::make_shared<SumErrorOp<TensorT>>(SumErrorOp<TensorT>()), std::make_shared<SumWeightGradOp<TensorT>>(SumWeightGradOp<TensorT>()));
+        gate.setModuleName(module_name);
+        if (specify_layer) gate.setLayerName(module_name + "-Gates");
+        model.addNodes({ gate });
+        gate_names[gate_iter].push_back(gate_name);
+        delete[] gate_name_char;
+      }
+    }
+
+    // Make the memory cell, output gate, and output nodes
+    std::vector<std::string> memory_cell_names, output_gate_names, node_names;
+    for (int unit_iter = 0; unit_iter < n_units; ++unit_iter) {
+      for (const std::string& cell_type : { "MemoryCell", "OutputGate" }) {
+        char* cell_name_char = new char[512];
+        sprintf(cell_name_char, "%s-%s_%012d", name.data(), cell_type.data(), unit_iter);
+        std::string cell_name(cell_name_char);
+        Node<TensorT> cell(cell_name, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<TensorT>>(LinearOp<TensorT>()), std::make_shared<LinearGradOp<TensorT>>(LinearGradOp<TensorT>()), std::make_shared<LSTMCellOp<TensorT>>(LSTMCellOp<TensorT>()), std::make_shared<LSTMCellErrorOp<TensorT>>(LSTMCellErrorOp<TensorT>()), std::make_shared<LSTMCellWeightGradOp<TensorT>>(LSTMCellWeightGradOp<TensorT>()));
+        cell.setModuleName(module_name);
+        if (specify_layer) cell.setLayerName(module_name + "-Cells");
+        model.addNodes({ cell });
+        if (cell_type == "MemoryCell") memory_cell_names.push_back(cell_name);
+        else output_gate_names.push_back(cell_name);
+        delete[] cell_name_char;
+      }
+
+      char* node_name_char = new char[512];
+      sprintf(node_name_char, "%s-Output_%012d", name.data(), unit_iter);
+      std::string node_name(node_name_char);
+      Node<TensorT> node(node_name, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<TensorT>>(LinearOp<TensorT>()), std::make_shared<LinearGradOp<TensorT>>(LinearGradOp<TensorT>()), std::make_shared<LSTMOutputOp<TensorT>>(LSTMOutputOp<TensorT>()), std::make_shared<LSTMOutputErrorOp<TensorT>>(LSTMOutputErrorOp<TensorT>()), std::make_shared<LSTMOutputWeightGradOp<TensorT>>(LSTMOutputWeightGradOp<TensorT>()));
+      node.setModuleName(module_name);
+      if (specify_layer) node.setLayerName(module_name + "-Output");
+      model.addNodes({ node });
+      node_names.push_back(node_name);
+      delete[] node_name_char;
+    }
+
+    // Connect the source nodes, biases, and recurrent output nodes to all gates
+    for (const std::vector<std::string>& gate_names_tmp : gate_names) {
+      addFullyConnected(model, module_name, source_node_names, gate_names_tmp, weight_init, solver, drop_connection_prob, specify_layer);
+      if (biases) addBiases(model, module_name, gate_names_tmp, std::make_shared<ConstWeightInitOp<TensorT>>(ConstWeightInitOp<TensorT>(0)), solver, drop_connection_prob, specify_layer);
+      addFullyConnected(model, module_name, node_names, gate_names_tmp, weight_init, solver, drop_connection_prob, specify_layer);
+      if (specify_cyclic_pairs) {
+        for (const std::string& node_name : node_names)
+          for (const std::string& gate_name : gate_names_tmp)
+            model.addCyclicPairs(std::make_pair(node_name, gate_name));
+      }
+    }
+
+    // Route the gates to the memory cell and output gate nodes and the memory cell and output gate nodes to the output nodes
+    //   (the fixed weight encodes the gate; gates that are not used by a cell node are linked with a weight of 0
+    //   so that all nodes of the cell layer have the same inputs)
+    for (int unit_iter = 0; unit_iter < n_units; ++unit_iter) {
+      for (size_t gate_iter = 0; gate_iter < gate_types.size(); ++gate_iter) {
+        const bool is_output_gate = gate_iter == gate_types.size() - 1;
+        makeFusedCellLink(model, module_name, gate_names[gate_iter][unit_iter], memory_cell_names[unit_iter], (is_output_gate) ? TensorT(0) : TensorT(gate_iter + 1), specify_layer);
+        makeFusedCellLink(model, module_name, gate_names[gate_iter][unit_iter], output_gate_names[unit_iter], (is_output_gate) ? TensorT(gate_iter + 1) : TensorT(0), specify_layer);
+      }
+      makeFusedCellLink(model, module_name, memory_cell_names[unit_iter], node_names[unit_iter], TensorT(1), specify_layer);
+      makeFusedCellLink(model, module_name, output_gate_names[unit_iter], node_names[unit_iter], TensorT(2), specify_layer);
+    }
+
+    return node_names;
+  }
+  template<typename TensorT>
+  inline std::vector<std::string> ModelBuilder<TensorT>::addGRUFused(Model<TensorT>& model, const std::string& name, const std::string& module_name,
+    const std::vector<std::string>& source_node_names, const int& n_units,
+    const std::shared_ptr<WeightInitOp<TensorT>>& weight_init, const std::shared_ptr<SolverOp<TensorT>>& solver,
+    const TensorT& drop_connection_prob, const bool& biases, const bool& specify_layer, const bool& specify_cyclic_pairs)
+  {
+    // Make the gate nodes
+    const std::vector<std::string> gate_types = { "Update", "Reset", "InputCandidate", "RecurrentCandidate" };
+    std::vector<std::vector<std::string>> gate_names(gate_types.size());
+    for (size_t gate_iter = 0; gate_iter < gate_types.size(); ++gate_iter) {
+      for (int unit_iter = 0; unit_iter < n_units; ++unit_iter) {
+        char* gate_name_char = new char[512];
+        sprintf(gate_name_char, "%s-Gates-%s_%012d", name.data(), gate_types[gate_iter].data(), unit_iter);
+        std::string gate_name(gate_name_char);
+        Node<TensorT> gate(gate_name, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<TensorT>>(LinearOp<TensorT>()), std::make_shared<LinearGradOp<TensorT>>(LinearGradOp<TensorT>()), std::make_shared<SumOp<TensorT>>(SumOp<TensorT>()), std::make_shared<SumErrorOp<TensorT>>(SumErrorOp<TensorT>()), std::make_shared<SumWeightGradOp<TensorT>>(SumWeightGradOp<TensorT>()));
+        gate.setModuleName(module_name);
+        if (specify_layer) gate.setLayerName(module_name + "-Gates");
+        model.addNodes({ gate });
+        gate_names[gate_iter].push_back(gate_name);
+        delete[] gate_name_char;
+      }
+    }
+
+    // Make the output nodes
+    std::vector<std::string> node_names;
+    for (int unit_iter = 0; unit_iter < n_units; ++unit_iter) {
+      char* node_name_char = new char[512];
+      sprintf(node_name_char, "%s-Output_%012d", name.data(), unit_iter);
+      std::string node_name(node_name_char);
+      Node<TensorT> node(node_name, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<TensorT>>(LinearOp<TensorT>()), std::make_shared<LinearGradOp<TensorT>>(LinearGradOp<TensorT>()), std::make_shared<GRUCellOp<TensorT>>(GRUCellOp<TensorT>()), std::make_shared<GRUCellErrorOp<TensorT>>(GRUCellErrorOp<TensorT>()), std::make_shared<GRUCellWeightGradOp<TensorT>>(GRUCellWeightGradOp<TensorT>()));
+      node.setModuleName(module_name);
+      if (specify_layer) node.setLayerName(module_name + "-Output");
+      model.addNodes({ node });
+      node_names.push_back(node_name);
+      delete[] node_name_char;
+    }
+
+    // Connect the source nodes, biases, and recurrent output nodes to all gates
+    for (const std::vector<std::string>& gate_names_tmp : gate_names) {
+      addFullyConnected(model, module_name, source_node_names, gate_names_tmp, weight_init, solver, drop_connection_prob, specify_layer);
+      if (biases) addBiases(model, module_name, gate_names_tmp, std::make_shared<ConstWeightInitOp<TensorT>>(ConstWeightInitOp<TensorT>(0)), solver, drop_connection_prob, specify_layer);
+      addFullyConnected(model, module_name, node_names, gate_names_tmp, weight_init, solver, drop_connection_prob, specify_layer);
+      if (specify_cyclic_pairs) {
+        for (const std::string& node_name : node_names)
+          for (const std::string& gate_name : gate_names_tmp)
+            model.addCyclicPairs(std::make_pair(node_name, gate_name));
+      }
+    }
+
+    // Route the gates to the output nodes (the fixed weight encodes the gate)
+    for (int unit_iter = 0; unit_iter < n_units; ++unit_iter)
+      for (size_t gate_iter = 0; gate_iter < gate_types.size(); ++gate_iter)
+        makeFusedCellLink(model, module_name, gate_names[gate_iter][unit_iter], node_names[unit_iter], TensorT(gate_iter + 1), specify_layer);
+
+    return node_names;
+  }
+  template<typename TensorT>
+  inline void ModelBuilder<TensorT>::makeFusedCellLink(Model<TensorT>& model, const std::string& module_name, const std::string& gate_name, const std::string& cell_name, const TensorT& gate_code, const bool& specify_layer)
+  {
+    char* link_name_char = new char[512];
+    sprintf(link_name_char, "%s_to_%s", gate_name.data(), cell_name.data());
+    std::string link_name(link_name_char);
+    delete[] link_name_char;
+
+    Weight<TensorT> weight(link_name, std::make_shared<ConstWeightInitOp<TensorT>>(ConstWeightInitOp<TensorT>(gate_code)), std::make_shared<DummySolverOp<TensorT>>(DummySolverOp<TensorT>()));
+    weight.setModuleName(module_name);
+    if (specify_layer) weight.setLayerName(module_name + "-Cells");
+    Link link(link_name, gate_name, cell_name, link_name);
+    link.setModuleName(module_name);
+    model.addWeights({ weight });
+    model.addLinks({ link });
+  }
   template<typename TensorT>
 	inline std::string ModelBuilder<TensorT>::makeUnityWeight(Model<TensorT>& model, const TensorT & scale, const std::string& module_name, const std::string& name_format, const std::string& lhs, const std::string& rhs, const bool& specify_layer)
 	{
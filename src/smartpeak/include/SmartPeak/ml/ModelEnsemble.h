@@ -0,0 +1,292 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_MODELENSEMBLE_H
+#define SMARTPEAK_MODELENSEMBLE_H
+
+// .h
+#include <SmartPeak/ml/Model.h>
+#include <unsupported/Eigen/CXX11/Tensor>
+#include <Eigen/Dense>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace SmartPeak
+{
+  /**
+    @brief Reduction of the outputs of the ensemble members
+
+    - Mean: the average of the member outputs
+    - Vote: the fraction of members whose largest output node is the output node (i.e., majority vote for classification)
+    - Stacking: the weighted sum of the member outputs (see `ModelEnsemble::setStackingWeights` and `ModelEnsemble::fitStackingWeights`)
+  */
+  enum class EnsembleReduction
+  {
+    Mean,
+    Vote,
+    Stacking
+  };
+
+  /**
+    @brief Batched inference of an ensemble of structurally compatible models
+      (i.e., the same nodes, links, and node operators but different weights such as the top N models of a population)
+
+    The members are packed into a single ensemble model that shares the input, bias, and zero nodes and holds a copy
+      of the remaining nodes, links, and weights of each member.  The copies of the nodes and weights of each member are given
+      their own layer names so that the model interpreter allocates separate layer and weight tensors for each member
+      (i.e., N parallel H x H weight tensors instead of a single block-diagonal N*H x N*H weight tensor) that are executed
+      in the same tensor operation steps, so that all members are evaluated in a single forward propogation on one interpreter
+      from the same input tensors.
+
+    Example use case:
+      ModelEnsemble<float, ModelInterpreterDefaultDevice<float>> model_ensemble;
+      Model<float> ensemble_model = model_ensemble.makeEnsembleModel(top_models);
+      model_ensemble.setReduction(EnsembleReduction::Mean);
+      Eigen::Tensor<float, 3> output = model_ensemble.evaluateEnsemble(ensemble_model, model_interpreter, input, input_nodes, output_nodes);
+  */
+  template<typename TensorT, typename InterpreterT>
+  class ModelEnsemble
+  {
+  public:
+    ModelEnsemble() = default;
+    ~ModelEnsemble() = default;
+
+    void setReduction(const EnsembleReduction& reduction) { reduction_ = reduction; }; ///< reduction setter
+    EnsembleReduction getReduction() const { return reduction_; }; ///< reduction getter
+    void setStackingWeights(const std::vector<TensorT>& stacking_weights) { stacking_weights_ = stacking_weights; }; ///< stacking_weights setter
+    std::vector<TensorT> getStackingWeights() const { return stacking_weights_; }; ///< stacking_weights getter
+    int getNMembers() const { return n_members_; }; ///< n_members getter
+
+    /**
+      @brief Name of the copy of a node, link, or weight of an ensemble member
+    */
+    static std::string makeMemberName(const std::string& name, const int& member);
+
+    /**
+      @brief Pack structurally compatible models into a single ensemble model
+
+      @param[in] models The ensemble members
+
+      @returns The ensemble model
+    */
+    Model<TensorT> makeEnsembleModel(const std::vector<Model<TensorT>>& models);
+
+    /**
+      @brief Forward propogate the ensemble model and collect the output of each member
+
+      @param[in, out] ensemble_model The ensemble model (see `makeEnsembleModel`)
+      @param[in, out] model_interpreter The model interpreter
+      @param[in] input Input node values (dim0: batch_size, dim1: memory_size, dim2: input nodes)
+      @param[in] input_nodes Input nodes
+      @param[in] output_nodes Output nodes of the members (i.e., the names of the output nodes in the original models)
+
+      @returns The member outputs (dim0: batch_size, dim1: memory_size, dim2: output nodes, dim3: members)
+    */
+    Eigen::Tensor<TensorT, 4> evaluateMembers(Model<TensorT>& ensemble_model, InterpreterT& model_interpreter, const Eigen::Tensor<TensorT, 3>& input,
+      const std::vector<std::string>& input_nodes, const std::vector<std::string>& output_nodes);
+
+    /**
+      @brief Reduce the member outputs to the ensemble output
+
+      @param[in] member_outputs The member outputs (dim0: batch_size, dim1: memory_size, dim2: output nodes, dim3: members)
+
+      @returns The ensemble output (dim0: batch_size, dim1: memory_size, dim2: output nodes)
+    */
+    Eigen::Tensor<TensorT, 3> reduceMemberOutputs(const Eigen::Tensor<TensorT, 4>& member_outputs) const;
+
+    /**
+      @brief Forward propogate the ensemble model and reduce the member outputs (see `evaluateMembers` and `reduceMemberOutputs`)
+    */
+    Eigen::Tensor<TensorT, 3> evaluateEnsemble(Model<TensorT>& ensemble_model, InterpreterT& model_interpreter, const Eigen::Tensor<TensorT, 3>& input,
+      const std::vector<std::string>& input_nodes, const std::vector<std::string>& output_nodes);
+
+    /**
+      @brief Fit the stacking weights by ridge regression of the expected values on the member outputs
+
+      @param[in] member_outputs The member outputs (dim0: batch_size, dim1: memory_size, dim2: output nodes, dim3: members)
+      @param[in] expected The expected values (dim0: batch_size, dim1: memory_size, dim2: output nodes)
+      @param[in] ridge The ridge penalty
+    */
+    void fitStackingWeights(const Eigen::Tensor<TensorT, 4>& member_outputs, const Eigen::Tensor<TensorT, 3>& expected, const TensorT& ridge = TensorT(1e-6));
+
+  private:
+    static bool isSharedNode_(const Node<TensorT>& node);
+    EnsembleReduction reduction_ = EnsembleReduction::Mean;
+    std::vector<TensorT> stacking_weights_;
+    int n_members_ = 0;
+  };
+
+  template<typename TensorT, typename InterpreterT>
+  inline std::string ModelEnsemble<TensorT, InterpreterT>::makeMemberName(const std::string& name, const int& member)
+  {
+    return name + "@Ensemble" + std::to_string(member);
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline bool ModelEnsemble<TensorT, InterpreterT>::isSharedNode_(const Node<TensorT>& node)
+  {
+    return node.getType() == NodeType::input || node.getType() == NodeType::bias || node.getType() == NodeType::zero;
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline Model<TensorT> ModelEnsemble<TensorT, InterpreterT>::makeEnsembleModel(const std::vector<Model<TensorT>>& models)
+  {
+    if (models.size() <= 0) {
+      const std::string error = "No models were provided to the ensemble.";
+      throw std::runtime_error(error);
+    }
+
+    // check that the members are structurally compatible with the first member
+    auto makeStructure = [](const Model<TensorT>& model) {
+      std::set<std::tuple<std::string, std::string, std::string, std::string>> structure;
+      for (const Node<TensorT>& node : model.getNodes())
+        structure.emplace(node.getName(), node.getLayerName(), node.getActivation()->getName(), node.getIntegration()->getName());
+      for (const Link& link : model.getLinks())
+        structure.emplace(link.getName(), link.getSourceNodeName(), link.getSinkNodeName(), link.getWeightName());
+      return structure;
+    };
+    const auto structure = makeStructure(models.front());
+    for (int member = 1; member < models.size(); ++member) {
+      if (makeStructure(models.at(member)) != structure) {
+        const std::string error = "Model " + models.at(member).getName() + " is not structurally compatible with model " + models.front().getName() + ".";
+        throw std::runtime_error(error);
+      }
+    }
+
+    // copy the members into the ensemble model
+    Model<TensorT> ensemble_model;
+    ensemble_model.setId(models.front().getId());
+    ensemble_model.setName(models.front().getName() + "@Ensemble");
+    std::vector<Node<TensorT>> nodes;
+    std::vector<Link> links;
+    std::vector<Weight<TensorT>> weights;
+    std::set<std::string> shared_nodes;
+    for (const Node<TensorT>& node : models.front().getNodes()) {
+      if (isSharedNode_(node)) {
+        nodes.push_back(node);
+        shared_nodes.insert(node.getName());
+      }
+    }
+    for (int member = 0; member < models.size(); ++member) {
+      const Model<TensorT>& model = models.at(member);
+      for (const Node<TensorT>& node : model.getNodes()) {
+        if (isSharedNode_(node)) continue;
+        Node<TensorT> node_copy(node);
+        node_copy.setName(makeMemberName(node.getName(), member));
+        node_copy.setLayerName(makeMemberName(node.getLayerName(), member));
+        nodes.push_back(node_copy);
+      }
+      for (const Link& link : model.getLinks()) {
+        Link link_copy(link);
+        link_copy.setName(makeMemberName(link.getName(), member));
+        if (shared_nodes.count(link.getSourceNodeName()) == 0)
+          link_copy.setSourceNodeName(makeMemberName(link.getSourceNodeName(), member));
+        if (shared_nodes.count(link.getSinkNodeName()) == 0)
+          link_copy.setSinkNodeName(makeMemberName(link.getSinkNodeName(), member));
+        link_copy.setWeightName(makeMemberName(link.getWeightName(), member));
+        links.push_back(link_copy);
+      }
+      for (const Weight<TensorT>& weight : model.getWeights()) {
+        Weight<TensorT> weight_copy(weight);
+        weight_copy.setName(makeMemberName(weight.getName(), member));
+        weight_copy.setLayerName(makeMemberName(weight.getLayerName(), member));
+        weights.push_back(weight_copy);
+      }
+    }
+    ensemble_model.addNodes(nodes);
+    ensemble_model.addLinks(links);
+    ensemble_model.addWeights(weights);
+    ensemble_model.initNodeTensorIndices();
+    ensemble_model.initWeightTensorIndices();
+    ensemble_model.setInputAndOutputNodes();
+    ensemble_model.findCycles();
+    n_members_ = models.size();
+    return ensemble_model;
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline Eigen::Tensor<TensorT, 4> ModelEnsemble<TensorT, InterpreterT>::evaluateMembers(Model<TensorT>& ensemble_model, InterpreterT& model_interpreter, const Eigen::Tensor<TensorT, 3>& input,
+    const std::vector<std::string>& input_nodes, const std::vector<std::string>& output_nodes)
+  {
+    const int batch_size = input.dimension(0);
+    const int memory_size = input.dimension(1);
+
+    // interpret the ensemble model once
+    if (output_nodes.size() <= 0 || n_members_ <= 0) {
+      const std::string error = "The ensemble model has not been made or no output nodes were provided.";
+      throw std::runtime_error(error);
+    }
+    if (ensemble_model.getNodesMap().at(makeMemberName(output_nodes.front(), 0))->getTensorIndex().first == -1)
+      model_interpreter.getForwardPropogationOperations(ensemble_model, batch_size, memory_size, false, false, true, true);
+
+    // forward propogate all members at once
+    model_interpreter.reInitNodes();
+    model_interpreter.initBiases(ensemble_model);
+    model_interpreter.mapValuesToLayers(ensemble_model, input, input_nodes, "output");
+    model_interpreter.mapValuesToLayers(ensemble_model, input, input_nodes, "input");
+    model_interpreter.FPTT(memory_size);
+    model_interpreter.getModelResults(ensemble_model, true, false, false, false);
+
+    // collect the member outputs
+    Eigen::Tensor<TensorT, 4> member_outputs(batch_size, memory_size, (int)output_nodes.size(), n_members_);
+    for (int member = 0; member < n_members_; ++member) {
+      for (int node_iter = 0; node_iter < output_nodes.size(); ++node_iter) {
+        const Eigen::Tensor<TensorT, 2> output = ensemble_model.getNodesMap().at(makeMemberName(output_nodes.at(node_iter), member))->getOutput();
+        member_outputs.chip(member, 3).chip(node_iter, 2) = output.slice(Eigen::array<Eigen::Index, 2>({ 0, 0 }), Eigen::array<Eigen::Index, 2>({ batch_size, memory_size }));
+      }
+    }
+    return member_outputs;
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline Eigen::Tensor<TensorT, 3> ModelEnsemble<TensorT, InterpreterT>::reduceMemberOutputs(const Eigen::Tensor<TensorT, 4>& member_outputs) const
+  {
+    const int n_members = member_outputs.dimension(3);
+    Eigen::Tensor<TensorT, 3> ensemble_output(member_outputs.dimension(0), member_outputs.dimension(1), member_outputs.dimension(2));
+    if (reduction_ == EnsembleReduction::Mean) {
+      ensemble_output = member_outputs.mean(Eigen::array<Eigen::Index, 1>({ 3 }));
+    }
+    else if (reduction_ == EnsembleReduction::Vote) {
+      ensemble_output.setZero();
+      for (int member = 0; member < n_members; ++member) {
+        const Eigen::Tensor<Eigen::Index, 2> votes = member_outputs.chip(member, 3).argmax(2);
+        for (int batch_iter = 0; batch_iter < votes.dimension(0); ++batch_iter)
+          for (int memory_iter = 0; memory_iter < votes.dimension(1); ++memory_iter)
+            ensemble_output(batch_iter, memory_iter, votes(batch_iter, memory_iter)) += TensorT(1) / TensorT(n_members);
+      }
+    }
+    else if (reduction_ == EnsembleReduction::Stacking) {
+      if (stacking_weights_.size() != n_members) {
+        const std::string error = "The number of stacking weights " + std::to_string(stacking_weights_.size()) + " does not match the number of members " + std::to_string(n_members) + ".";
+        throw std::runtime_error(error);
+      }
+      ensemble_output.setZero();
+      for (int member = 0; member < n_members; ++member)
+        ensemble_output += member_outputs.chip(member, 3) * member_outputs.chip(member, 3).constant(stacking_weights_.at(member));
+    }
+    return ensemble_output;
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline Eigen::Tensor<TensorT, 3> ModelEnsemble<TensorT, InterpreterT>::evaluateEnsemble(Model<TensorT>& ensemble_model, InterpreterT& model_interpreter, const Eigen::Tensor<TensorT, 3>& input,
+    const std::vector<std::string>& input_nodes, const std::vector<std::string>& output_nodes)
+  {
+    return reduceMemberOutputs(evaluateMembers(ensemble_model, model_interpreter, input, input_nodes, output_nodes));
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline void ModelEnsemble<TensorT, InterpreterT>::fitStackingWeights(const Eigen::Tensor<TensorT, 4>& member_outputs, const Eigen::Tensor<TensorT, 3>& expected, const TensorT& ridge)
+  {
+    // solve (X'X + ridge*I) w = X'y where the rows of X are the member outputs of each sample
+    const int n_members = member_outputs.dimension(3);
+    const int n_samples = expected.size();
+    Eigen::Map<const Eigen::Matrix<TensorT, Eigen::Dynamic, Eigen::Dynamic>> X(member_outputs.data(), n_samples, n_members);
+    Eigen::Map<const Eigen::Matrix<TensorT, Eigen::Dynamic, 1>> y(expected.data(), n_samples);
+    Eigen::Matrix<TensorT, Eigen::Dynamic, Eigen::Dynamic> XtX = X.transpose() * X;
+    XtX.diagonal().array() += ridge;
+    const Eigen::Matrix<TensorT, Eigen::Dynamic, 1> w = XtX.ldlt().solve(X.transpose() * y);
+    stacking_weights_.assign(w.data(), w.data() + n_members);
+  }
+}
+#endif //SMARTPEAK_MODELENSEMBLE_H
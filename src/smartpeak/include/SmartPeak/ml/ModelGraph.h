@@ -0,0 +1,194 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_MODELGRAPH_H
+#define SMARTPEAK_MODELGRAPH_H
+
+// .h
+#include <SmartPeak/ml/Model.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SmartPeak
+{
+  /**
+    @brief Integer indexed snapshot of the model graph
+
+    Nodes, links, and weights are numbered in the (name) order of the model maps
+      so that iterating over the indices visits the elements in the same order as iterating over the maps.
+      The link source, sink, and weight indices are stored contiguously and the incoming and outgoing
+      links of each node are stored in compressed sparse row (CSR) format.
+      The name indices are kept to translate between the public (name-based) API and the integer indices.
+
+    The graph shares the node, link, and weight pointers of the model so that changes to node
+      statuses, tensor indices, etc. are visible through both.  Changes to the structure of the model
+      (i.e., adding or removing nodes, links, or weights, or changing the source, sink, or weight of a link)
+      are not tracked and require a new graph to be made.
+
+    Example use case:
+      ModelGraph<float> graph(model);
+      for (int l = 0; l < graph.getNLinks(); ++l)
+        if (graph.getNode(graph.getLinkSource(l))->getStatus() == NodeStatus::activated) ...
+  */
+  template<typename TensorT>
+  class ModelGraph
+  {
+public:
+    ModelGraph() = default; ///< Default constructor
+    ModelGraph(const Model<TensorT>& model) { setGraph(model); }; ///< Explicit constructor
+    ~ModelGraph() = default; ///< Default destructor
+
+    /**
+      @brief Make the integer indices and adjacency of the model graph
+
+      @param[in] model The model
+    */
+    void setGraph(const Model<TensorT>& model);
+
+    int getNNodes() const { return (int)nodes_.size(); } ///< number of nodes
+    int getNLinks() const { return (int)links_.size(); } ///< number of links
+    int getNWeights() const { return (int)weights_.size(); } ///< number of weights
+
+    const std::shared_ptr<Node<TensorT>>& getNode(const int& node_index) const { return nodes_[node_index]; } ///< node getter
+    const std::shared_ptr<Link>& getLink(const int& link_index) const { return links_[link_index]; } ///< link getter
+    const std::shared_ptr<Weight<TensorT>>& getWeight(const int& weight_index) const { return weights_[weight_index]; } ///< weight getter
+
+    int getLinkSource(const int& link_index) const { return link_sources_[link_index]; } ///< index of the link source node
+    int getLinkSink(const int& link_index) const { return link_sinks_[link_index]; } ///< index of the link sink node
+    int getLinkWeight(const int& link_index) const { return link_weights_[link_index]; } ///< index of the link weight
+
+    /// index of the node, link, or weight or -1 if the name is not in the graph
+    int getNodeIndex(const std::string& node_name) const;
+    int getLinkIndex(const std::string& link_name) const;
+    int getWeightIndex(const std::string& weight_name) const;
+
+    /**
+      @brief Incoming and outgoing links of a node as a range of link indices
+        (in the order of the link names)
+
+      @param[in] node_index The node index
+
+      @returns A pair of pointers to the first and one past the last link index
+    */
+    std::pair<const int*, const int*> getInLinks(const int& node_index) const;
+    std::pair<const int*, const int*> getOutLinks(const int& node_index) const;
+
+    void clear(); ///< clear all member data
+
+private:
+    std::vector<std::shared_ptr<Node<TensorT>>> nodes_;
+    std::vector<std::shared_ptr<Link>> links_;
+    std::vector<std::shared_ptr<Weight<TensorT>>> weights_;
+    std::unordered_map<std::string, int> node_index_;
+    std::unordered_map<std::string, int> link_index_;
+    std::unordered_map<std::string, int> weight_index_;
+
+    std::vector<int> link_sources_;
+    std::vector<int> link_sinks_;
+    std::vector<int> link_weights_;
+
+    std::vector<int> in_offsets_; ///< size n_nodes + 1
+    std::vector<int> in_links_; ///< link indices sorted by sink node
+    std::vector<int> out_offsets_; ///< size n_nodes + 1
+    std::vector<int> out_links_; ///< link indices sorted by source node
+  };
+
+  template<typename TensorT>
+  inline void ModelGraph<TensorT>::setGraph(const Model<TensorT>& model)
+  {
+    clear();
+
+    // name indices
+    nodes_.reserve(model.nodes_.size());
+    node_index_.reserve(model.nodes_.size());
+    for (const auto& node_map : model.nodes_) {
+      node_index_.emplace(node_map.first, (int)nodes_.size());
+      nodes_.push_back(node_map.second);
+    }
+    weights_.reserve(model.weights_.size());
+    weight_index_.reserve(model.weights_.size());
+    for (const auto& weight_map : model.weights_) {
+      weight_index_.emplace(weight_map.first, (int)weights_.size());
+      weights_.push_back(weight_map.second);
+    }
+    links_.reserve(model.links_.size());
+    link_index_.reserve(model.links_.size());
+    link_sources_.reserve(model.links_.size());
+    link_sinks_.reserve(model.links_.size());
+    link_weights_.reserve(model.links_.size());
+    for (const auto& link_map : model.links_) {
+      link_index_.emplace(link_map.first, (int)links_.size());
+      links_.push_back(link_map.second);
+      link_sources_.push_back(node_index_.at(link_map.second->getSourceNodeName()));
+      link_sinks_.push_back(node_index_.at(link_map.second->getSinkNodeName()));
+      link_weights_.push_back(weight_index_.at(link_map.second->getWeightName()));
+    }
+
+    // CSR adjacency (counting sort by node keeps the link order within each node)
+    const int n_nodes = getNNodes();
+    const int n_links = getNLinks();
+    in_offsets_.assign(n_nodes + 1, 0);
+    out_offsets_.assign(n_nodes + 1, 0);
+    for (int l = 0; l < n_links; ++l) {
+      ++in_offsets_[link_sinks_[l] + 1];
+      ++out_offsets_[link_sources_[l] + 1];
+    }
+    for (int n = 0; n < n_nodes; ++n) {
+      in_offsets_[n + 1] += in_offsets_[n];
+      out_offsets_[n + 1] += out_offsets_[n];
+    }
+    in_links_.resize(n_links);
+    out_links_.resize(n_links);
+    std::vector<int> in_next(in_offsets_.begin(), in_offsets_.end() - 1);
+    std::vector<int> out_next(out_offsets_.begin(), out_offsets_.end() - 1);
+    for (int l = 0; l < n_links; ++l) {
+      in_links_[in_next[link_sinks_[l]]++] = l;
+      out_links_[out_next[link_sources_[l]]++] = l;
+    }
+  }
+
+  template<typename TensorT>
+  inline int ModelGraph<TensorT>::getNodeIndex(const std::string& node_name) const
+  {
+    auto found = node_index_.find(node_name);
+    return (found != node_index_.end()) ? found->second : -1;
+  }
+
+  template<typename TensorT>
+  inline int ModelGraph<TensorT>::getLinkIndex(const std::string& link_name) const
+  {
+    auto found = link_index_.find(link_name);
+    return (found != link_index_.end()) ? found->second : -1;
+  }
+
+  template<typename TensorT>
+  inline int ModelGraph<TensorT>::getWeightIndex(const std::string& weight_name) const
+  {
+    auto found = weight_index_.find(weight_name);
+    return (found != weight_index_.end()) ? found->second : -1;
+  }
+
+  template<typename TensorT>
+  inline std::pair<const int*, const int*> ModelGraph<TensorT>::getInLinks(const int& node_index) const
+  {
+    return std::make_pair(in_links_.data() + in_offsets_[node_index], in_links_.data() + in_offsets_[node_index + 1]);
+  }
+
+  template<typename TensorT>
+  inline std::pair<const int*, const int*> ModelGraph<TensorT>::getOutLinks(const int& node_index) const
+  {
+    return std::make_pair(out_links_.data() + out_offsets_[node_index], out_links_.data() + out_offsets_[node_index + 1]);
+  }
+
+  template<typename TensorT>
+  inline void ModelGraph<TensorT>::clear()
+  {
+    nodes_.clear(); links_.clear(); weights_.clear();
+    node_index_.clear(); link_index_.clear(); weight_index_.clear();
+    link_sources_.clear(); link_sinks_.clear(); link_weights_.clear();
+    in_offsets_.clear(); in_links_.clear(); out_offsets_.clear(); out_links_.clear();
+  }
+}
+
+#endif //SMARTPEAK_MODELGRAPH_H
@@ -13,11 +13,16 @@
 #include <SmartPeak/ml/LossFunctionTensor.h>
 #include <SmartPeak/ml/OpToTensorOp.h>
 #include <SmartPeak/ml/ModelResources.h>
+#include <SmartPeak/ml/CompiledModelCache.h>
+#include <SmartPeak/ml/ModelGraph.h>
 
 #include <unsupported/Eigen/CXX11/Tensor>
 #include <vector>
 #include <map>
+#include <functional>
 #include <set>
+#include <tuple>
+#include <type_traits>
 
 #include <cereal/access.hpp>  // serialiation of private members
 #include <cereal/types/memory.hpp>
@@ -175,6 +180,7 @@ namespace SmartPeak
 		inline ModelInterpreter& operator=(const ModelInterpreter& other)
 		{
 			model_resources_ = other.model_resources_;
+			compiled_model_cache_ = other.compiled_model_cache_;
 			return *this;
 		}
 
@@ -234,9 +240,15 @@ namespace SmartPeak
 		void getNextInactiveLayer(Model<TensorT>& model,
 			std::map<std::string, int>& FP_operations_map,
 			std::vector<OperationList<TensorT>>& FP_operations);
+		void getNextInactiveLayer(const ModelGraph<TensorT>& graph,
+			std::map<std::string, int>& FP_operations_map,
+			std::vector<OperationList<TensorT>>& FP_operations);
 		void getNextInactiveLayerWOBiases(Model<TensorT>& model,
 			std::map<std::string, int>& FP_operations_map,
 			std::vector<OperationList<TensorT>>& FP_operations);
+		void getNextInactiveLayerWOBiases(const ModelGraph<TensorT>& graph,
+			std::map<std::string, int>& FP_operations_map,
+			std::vector<OperationList<TensorT>>& FP_operations);
 
 		/**
 			@brief Continuation of the forward propogation step that identifies all biases
@@ -254,6 +266,11 @@ namespace SmartPeak
 			std::vector<OperationList<TensorT>>& FP_operations,
 			std::vector<std::string>& sink_nodes_with_biases
 		);
+		void getNextInactiveLayerBiases(const ModelGraph<TensorT>& graph,
+			std::map<std::string, int>& FP_operations_map,
+			std::vector<OperationList<TensorT>>& FP_operations,
+			std::vector<std::string>& sink_nodes_with_biases
+		);
 
 		/**
 			@brief Continuation of the forward propogation step that identifies
@@ -270,6 +287,10 @@ namespace SmartPeak
 			std::map<std::string, int>& FP_operations_map,
 			std::vector<OperationList<TensorT>>& FP_operations,
 			std::set<std::string>& sink_nodes_with_cycles);
+		void getNextInactiveLayerCycles(const ModelGraph<TensorT>& graph,
+			std::map<std::string, int>& FP_operations_map,
+			std::vector<OperationList<TensorT>>& FP_operations,
+			std::set<std::string>& sink_nodes_with_cycles);
 
 		/**
 			@brief Prunes identified cyclic nodes that are not in fact part of a cycle
@@ -407,6 +428,43 @@ namespace SmartPeak
 		*/
 		void getFPOpsGraph_(Model<TensorT>& model, std::vector<OperationList<TensorT>>& FP_operations_expanded, int& iter);
 
+		/**
+		@brief Create the key used to store and retrieve the compiled model schedule
+
+		@param[in] model Network model
+		@param[in] fast_check Boolean to use a faster but incomplete tensor compatibility check when manually specifying layers
+		@param[in] preserve_OoO Boolean to indicate whether the order of operation (OoO) of the model should be preserved
+
+		@returns The model structure hash combined with the compilation options
+		*/
+		static std::size_t makeCompiledModelCacheKey(const Model<TensorT>& model, const bool& fast_check, const bool& preserve_OoO);
+
+		/**
+		@brief Convert the forward propogation operations and tensor operation steps
+			into a schedule that references the model nodes and weights by name
+
+		@param[in] FP_operations
+		@param[in] tensor_ops_steps
+
+		@returns The compiled schedule
+		*/
+		static std::shared_ptr<const CompiledOperationsSchedule> makeCompiledOperationsSchedule(const std::vector<OperationList<TensorT>>& FP_operations,
+			const std::vector<std::map<std::string, std::vector<int>>>& tensor_ops_steps);
+
+		/**
+		@brief Bind a compiled schedule to the nodes and weights of the model.
+			The node and weight tensor indices are cleared when the layer tensors are allocated
+
+		@param[in] model Network model
+		@param[in] schedule The compiled schedule
+		@param[out] FP_operations
+		@param[out] tensor_ops_steps
+
+		@returns True if all nodes and weights in the schedule were found in the model
+		*/
+		static bool instantiateCompiledOperationsSchedule(Model<TensorT>& model, const CompiledOperationsSchedule& schedule,
+			std::vector<OperationList<TensorT>>& FP_operations, std::vector<std::map<std::string, std::vector<int>>>& tensor_ops_steps);
+
 		/**
 		@brief Allocate Node and Weight tensor memory for all model operations.
 			Source and sink layer activations are created using the first node in the layers, respecively.
@@ -456,6 +514,26 @@ namespace SmartPeak
     */
     virtual void executeModelMetricOperations(Eigen::Tensor<TensorT, 2>& expected, const int& layer_id, std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>> metric_function, const int& time_step, const int& metric_index) = 0;
 
+    /**
+    @brief Execute model kernal methods required for calculating the model and output node error
+      over consecutive time-steps in a single call
+
+    @param[in] expected Expected values of dims batch_size, layer_size, n_time_steps
+    @param[in] time_step_start The first time-step to operate on
+    @param[in] n_time_steps The number of time-steps to operate on
+    */
+    virtual void executeModelErrorOperations(Eigen::Tensor<TensorT, 3>& expected, const int& layer_id, std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>>& loss_function, std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>>& loss_function_grad, const int& time_step_start, const int& n_time_steps) = 0;
+
+    /**
+    @brief Execute model kernal methods required for calculating the model metrics
+      over consecutive time-steps in a single call
+
+    @param[in] expected Expected values of dims batch_size, layer_size, n_time_steps
+    @param[in] time_step_start The first time-step to operate on
+    @param[in] n_time_steps The number of time-steps to operate on
+    */
+    virtual void executeModelMetricOperations(Eigen::Tensor<TensorT, 3>& expected, const int& layer_id, std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>> metric_function, const int& time_step_start, const int& n_time_steps, const int& metric_index) = 0;
+
 		/**
 		@brief Execute model kernal methods required for backward propogation
 
@@ -466,8 +544,13 @@ namespace SmartPeak
 		/**
 		@brief Execute model kernal methods required for weight error calculations
 
+		The weight errors are accumulated.  The errors of shared weights are pooled after the accumulation so that
+			a sequence that is back propogated in several windows (see `checkpointedBPTT` and `windowedTBPTT`)
+			should only pool the errors of shared weights after the last window.
+
+		@param[in] combine_shared_weight_errors Pool the errors of shared weights
 		*/
-		virtual void executeWeightErrorOperations() = 0;
+		virtual void executeWeightErrorOperations(const bool& combine_shared_weight_errors = true) = 0;
 
 		/**
 		@brief Execute model kernal methods required for weight update calculations
@@ -529,6 +612,28 @@ namespace SmartPeak
     @param[in] metric_index The index of the metric function to evaluate
     */
     void CMTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& node_names, std::shared_ptr<MetricFunctionOp<TensorT>>& metric_function, 
+      const int& time_steps, const int& metric_index);
+
+    /**
+    @brief Calculates multiple metrics of the model through time (CMTT)
+      with respect to the expected values
+
+    The classification metric functions (e.g., accuracy, precision, recall, F1 score, MCC, AUROC, and AUPRC)
+      are fused so that the confusion matrix (or score curve) of the output layer is only computed once per time step
+      for all metric functions that share it (see `ClassificationMetricsTensorOp`).
+      The score curve metric functions (e.g., AUROC and AUPRC) are computed from the counts of all time steps
+      and written to the first time step.
+
+    @param[in] values Expected node output values
+      (dim0: batch_size, dim1: memory_size, dim2: output nodes)
+      where t=n to t=0
+    @param[in] node_names Output nodes
+    @param[in] metric_functions The metric functions to evaluate on the expected and predicted node values
+    @param[in] time_steps The number of time_steps to evaluate in time
+    @param[in] metric_index The index of the first metric function to evaluate
+      where the metric functions are evaluated at metric_index, metric_index + 1, ...
+    */
+    void CMTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& node_names, std::vector<std::shared_ptr<MetricFunctionOp<TensorT>>>& metric_functions,
       const int& time_steps, const int& metric_index);
 
 		/**
@@ -540,12 +645,77 @@ namespace SmartPeak
 		void TBPTT(const int& time_steps);
 
 		/**
-		@brief Recurrent Real Time Learning (RTRL) of the network model.
+		@brief Checkpointed Back Propogation Through Time (BPTT) of a sequence that is longer than the memory size
 
-		@param[in] time_steps The number of time_steps backwards to
-			unfold the network model.
+		The sequence is split into windows of memory_size - 1 time steps.  The forward pass only keeps the node inputs and outputs
+			of the last time step of each window (i.e., the checkpoints).  The backward pass then re-computes the forward propogation
+			of each window starting from the checkpoint of the previous window and carries the back propogated errors over to the previous window
+			so that the weight errors are the same as those of TBPTT over the complete sequence.
+			The layer tensors only need to hold a single window at the cost of one additional forward propogation.
+
+		The weight errors of all windows are accumulated, but the weights are not updated (see `executeWeightUpdateOperations`).
+
+		@param[in] model The network model
+		@param[in] values Input node values of the sequence (dim0: batch_size, dim1: sequence length, dim2: input nodes) where t=n to t=0
+		@param[in] input_nodes Input nodes
+		@param[in] calc_model_errors Calculates the model errors of a window (e.g., using CETT) given the position in the sequence of the most recent
+			time step of the window and the number of time steps in the window
+
+		@returns The total model error of the sequence
 		*/
-		void RTRL(const int& time_steps);
+		TensorT checkpointedBPTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& input_nodes,
+			const std::function<void(const int&, const int&)>& calc_model_errors);
+
+		/**
+		@brief Windowed Truncated Back Propogation Through Time (TBPTT) of a sequence that is longer than the memory size
+
+		The sequence is propogated forward in time in windows of memory_size - 1 time steps.  The errors of each window are back propogated
+			and accumulated into the weight errors as soon as the window has been forward propogated, and only the node inputs and outputs
+			of the last time step are carried over to the next window.  The errors are not carried back to previous windows (i.e., the gradient
+			is truncated to the window) so that neither the history nor checkpoints of the sequence are stored.
+			Unlike Real Time Recurrent Learning (RTRL), no sensitivities are propogated forward across the windows.
+
+		The weight errors of all windows are accumulated, but the weights are not updated (see `executeWeightUpdateOperations`).
+
+		@param[in] model The network model
+		@param[in] values Input node values of the sequence (dim0: batch_size, dim1: sequence length, dim2: input nodes) where t=n to t=0
+		@param[in] input_nodes Input nodes
+		@param[in] calc_model_errors Calculates the model errors of a window (e.g., using CETT) given the position in the sequence of the most recent
+			time step of the window and the number of time steps in the window
+
+		@returns The total model error of the sequence
+		*/
+		TensorT windowedTBPTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& input_nodes,
+			const std::function<void(const int&, const int&)>& calc_model_errors);
+
+		/**
+		@brief Prepare the interpreter for streaming inference (see `stepStreaming`)
+
+		The node states are reset, the biases are initialized, and the tensor positions of the input and output nodes are cached.
+			Streaming reads and writes the host layer tensors directly and is therefore only available for the DefaultDevice.
+
+		@param[in] model The network model
+		@param[in] input_nodes Input nodes
+		@param[in] output_nodes Output nodes
+		*/
+		void initStreaming(Model<TensorT>& model, const std::vector<std::string>& input_nodes, const std::vector<std::string>& output_nodes);
+
+		/**
+		@brief Forward propogate a single new time step of a stream
+
+		The memory dimension of the layer tensors is used as a ring buffer: each step is executed at the next (i.e., more recent) memory index,
+			wrapping around from memory index 0 to the last memory index, and the recurrent links read the state of the previous step
+			at the following memory index modulo the memory size (see `IntegrationTensorOp::setRingMemory`).  No time steps are copied, and
+			only the inputs of the layers that are the sinks of the forward propogation operations at the current memory index are reset,
+			so each step costs a single forward propogation step instead of the re-propogation of the complete memory window.
+
+		@param[in] values Input node values of the time step (dim0: batch_size, dim1: input nodes)
+
+		@returns The output node values of the time step (dim0: batch_size, dim1: output nodes)
+		*/
+		Eigen::Tensor<TensorT, 2> stepStreaming(const Eigen::Tensor<TensorT, 2>& values);
+
+		int getStreamingTimeStep() const { return streaming_time_step_; }; ///< memory index of the most recent streaming step (-1 before the first step)
 
 		/**
 		@brief Update the weights
@@ -578,6 +748,17 @@ namespace SmartPeak
 		void setModelResources(const ModelResources& model_resources); ///< model_resources setter
 		ModelResources getModelResources(); ///< model_resources getter
 
+		/**
+		@brief Share a cache of compiled model schedules with the interpreter.
+			When set, `getForwardPropogationOperations` retrieves the forward propogation operations
+			and tensor operation steps of models with a matching structure hash from the cache
+			instead of re-compiling them, and adds newly compiled schedules to the cache.
+
+		@param[in] compiled_model_cache The cache (or nullptr to disable caching)
+		*/
+		void setCompiledModelCache(const std::shared_ptr<CompiledModelCache>& compiled_model_cache) { compiled_model_cache_ = compiled_model_cache; };
+		std::shared_ptr<CompiledModelCache> getCompiledModelCache() const { return compiled_model_cache_; }; ///< compiled_model_cache getter
+
     /**
     @brief Estimate the memory footprint of all Tensor Layers
 
@@ -595,9 +776,22 @@ namespace SmartPeak
       - model_error_
       - tensor_ops_steps_
       - FP_operations_
+
+      The stateful tensor ops of the layers (see `OpToTensorOp::isStatefulTensorOp`) are released with the operation steps.
+      The shared compiled model cache is not cleared.
     */
 		void clear_cache();
 
+    /**
+    @brief Clear the loss and metric functions that were converted to their tensor equivalents by CETT and CMTT
+      and the (stateless) node and weight tensor ops that are shared between layers
+
+      The converted functions are cached by the interpreter so that repeated calls to CETT and CMTT
+      (e.g., every epoch of training) and repeated layer allocations do not re-create the tensor operators.
+      The cache is not cleared by `clear_cache`.
+    */
+    void clearTensorOpsCache();
+
 		std::vector<std::map<std::string, std::vector<int>>> getTensorOpsSteps() const; ///< retrieve the tensor_ops_steps_
     std::vector<OperationList<TensorT>> getFPOperations() const; ///< retrieve the FP_operations
 
@@ -613,10 +807,62 @@ namespace SmartPeak
 		std::vector<std::shared_ptr<WeightTensorData<TensorT, DeviceT>>> weight_tensors_;
 		std::shared_ptr<ModelErrorData<TensorT, DeviceT>> model_error_;
 		ModelResources model_resources_;
+		std::shared_ptr<CompiledModelCache> compiled_model_cache_ = nullptr; ///< cache of compiled model schedules that can be shared between interpreters
+
+		// Converters of the node and weight ops to their tensor equivalents
+		//   that share identical stateless tensor ops between all layers of the model
+		//   (stateful tensor ops are owned by the operation steps that they are made for)
+		ActivationOpToActivationTensorOp<TensorT, DeviceT> activation_conv_;
+		SolverOpToSolverTensorOp<TensorT, DeviceT> solver_conv_;
+		IntegrationOpToIntegrationTensorOp<TensorT, DeviceT> integration_conv_;
+		IntegrationErrorOpToIntegrationErrorTensorOp<TensorT, DeviceT> integration_error_conv_;
+		IntegrationWeightGradOpToIntegrationWeightGradTensorOp<TensorT, DeviceT> integration_weight_grad_conv_;
 
 	private:
+    /**
+    @brief Convert the loss, loss gradient, and metric functions to their tensor equivalents or
+      retrieve the previously converted functions from the cache
+    */
+    std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>> getLossFunctionTensor_(std::shared_ptr<LossFunctionOp<TensorT>>& loss_function);
+    std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>> getLossFunctionGradTensor_(std::shared_ptr<LossFunctionGradOp<TensorT>>& loss_function_grad);
+    std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>> getMetricFunctionTensor_(std::shared_ptr<MetricFunctionOp<TensorT>>& metric_function);
+
+    /**
+    @brief Map a window of a sequence to the layers and forward propogate the window (see `checkpointedBPTT` and `windowedTBPTT`)
+
+    @param[in] time_step_start The position in the sequence of the most recent time step of the window
+    @param[in] n_time_steps The number of time steps in the window
+    @param[in] checkpoint The node inputs and outputs preceding the window (or nullptr for the start of the sequence)
+    */
+    void forwardPropogateWindow_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& input_nodes,
+      const int& time_step_start, const int& n_time_steps, const std::vector<Eigen::Tensor<TensorT, 3>>* checkpoint);
+
+    /**
+    @brief Get or set the node inputs and outputs of all layer tensors at a memory index
+      (dim0: batch_size, dim1: 0 for the inputs and 1 for the outputs, dim2: layer_size)
+    */
+    void getLayerCheckpoint_(const int& time_step, std::vector<Eigen::Tensor<TensorT, 3>>& checkpoint);
+    void setLayerCheckpoint_(const int& time_step, const std::vector<Eigen::Tensor<TensorT, 3>>& checkpoint);
+
+    /**
+    @brief Move the node errors of all layer tensors at a memory index out of the layer tensors
+      or add node errors to all layer tensors at a memory index (dim0: batch_size, dim1: layer_size)
+    */
+    void takeLayerErrors_(const int& time_step, std::vector<Eigen::Tensor<TensorT, 2>>& errors);
+    void addLayerErrors_(const int& time_step, const std::vector<Eigen::Tensor<TensorT, 2>>& errors);
+
+    // Streaming inference state (see `initStreaming` and `stepStreaming`)
+    int streaming_time_step_ = -1; ///< memory index of the most recent streaming step
+    std::vector<std::pair<int, int>> streaming_input_indices_; ///< tensor and layer index of each input node
+    std::vector<std::pair<int, int>> streaming_output_indices_; ///< tensor and layer index of each output node
+    std::vector<int> streaming_sink_layers_; ///< layer tensors that are the sinks of forward propogation operations
+
 		std::vector<std::map<std::string, std::vector<int>>> tensor_ops_steps_;
 		std::vector<OperationList<TensorT>> FP_operations_;
+    std::map<std::shared_ptr<LossFunctionOp<TensorT>>, std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>>> loss_function_tensors_; ///< converted loss functions
+    std::map<std::shared_ptr<LossFunctionGradOp<TensorT>>, std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>>> loss_function_grad_tensors_; ///< converted loss function gradients
+    std::map<std::shared_ptr<MetricFunctionOp<TensorT>>, std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>>> metric_function_tensors_; ///< converted metric functions
+    std::map<std::vector<std::shared_ptr<MetricFunctionOp<TensorT>>>, std::shared_ptr<ClassificationMetricsTensorOp<TensorT, DeviceT>>> classification_metrics_tensors_; ///< fused classification metric functions
 		friend class cereal::access;
 		//template<class Archive>
 		//void serialize(Archive& archive) {
@@ -632,6 +878,7 @@ namespace SmartPeak
 	ModelInterpreter<TensorT, DeviceT>::ModelInterpreter(const ModelInterpreter<TensorT, DeviceT>& other)
 	{
 		model_resources_ = other.model_resources_;
+		compiled_model_cache_ = other.compiled_model_cache_;
 	}
 
 	template<typename TensorT, typename DeviceT>
@@ -770,33 +1017,42 @@ namespace SmartPeak
 	void ModelInterpreter<TensorT, DeviceT>::getNextInactiveLayer(Model<TensorT>& model,
 		std::map<std::string, int>& FP_operations_map,
 		std::vector<OperationList<TensorT>>& FP_operations)
+	{
+		getNextInactiveLayer(ModelGraph<TensorT>(model), FP_operations_map, FP_operations);
+	}
+
+	template<typename TensorT, typename DeviceT>
+	void ModelInterpreter<TensorT, DeviceT>::getNextInactiveLayer(const ModelGraph<TensorT>& graph,
+		std::map<std::string, int>& FP_operations_map,
+		std::vector<OperationList<TensorT>>& FP_operations)
 	{
 		// get all links where the source node is active and the sink node is inactive
 		// except for biases
-		for (auto& link_map : model.links_)
+		for (int l = 0; l < graph.getNLinks(); ++l)
 		{
+			const std::shared_ptr<Node<TensorT>>& source_node = graph.getNode(graph.getLinkSource(l));
+			const std::shared_ptr<Node<TensorT>>& sink_node = graph.getNode(graph.getLinkSink(l));
 			if (
-				//model.nodes_.at(link_map.second->getSourceNodeName())->getType() != NodeType::bias &&
-				model.nodes_.at(link_map.second->getSourceNodeName())->getStatus() == NodeStatus::activated &&
-				model.nodes_.at(link_map.second->getSinkNodeName())->getStatus() == NodeStatus::initialized)
+				source_node->getStatus() == NodeStatus::activated &&
+				sink_node->getStatus() == NodeStatus::initialized)
 			{
 				OperationArguments<TensorT> arguments;
-				arguments.source_node = model.nodes_.at(link_map.second->getSourceNodeName());
-				arguments.weight = model.weights_.at(link_map.second->getWeightName());
+				arguments.source_node = source_node;
+				arguments.weight = graph.getWeight(graph.getLinkWeight(l));
 				arguments.time_step = 0;
-				arguments.link_name = link_map.first;
+				arguments.link_name = graph.getLink(l)->getName();
 
-				std::string ops_key = link_map.second->getSinkNodeName();
+				const std::string& ops_key = sink_node->getName();
 				auto found = FP_operations_map.emplace(ops_key, (int)FP_operations.size());
 				if (!found.second)
 				{
-					FP_operations[FP_operations_map.at(ops_key)].arguments.push_back(arguments);
+					FP_operations[found.first->second].arguments.push_back(arguments);
 				}
 				else
 				{
 					OperationList<TensorT> operation_list;
 					OperationResult<TensorT> result;
-					result.sink_node = model.nodes_.at(link_map.second->getSinkNodeName());
+					result.sink_node = sink_node;
 					operation_list.result = result;
 					operation_list.arguments.push_back(arguments);
 					FP_operations.push_back(operation_list);
@@ -809,35 +1065,43 @@ namespace SmartPeak
 	void ModelInterpreter<TensorT, DeviceT>::getNextInactiveLayerWOBiases(Model<TensorT>& model,
 		std::map<std::string, int>& FP_operations_map,
 		std::vector<OperationList<TensorT>>& FP_operations)
+	{
+		getNextInactiveLayerWOBiases(ModelGraph<TensorT>(model), FP_operations_map, FP_operations);
+	}
+
+	template<typename TensorT, typename DeviceT>
+	void ModelInterpreter<TensorT, DeviceT>::getNextInactiveLayerWOBiases(const ModelGraph<TensorT>& graph,
+		std::map<std::string, int>& FP_operations_map,
+		std::vector<OperationList<TensorT>>& FP_operations)
 	{
 		// get all links where the source node is active and the sink node is inactive
 		// except for biases
-		for (auto& link_map : model.links_)
+		for (int l = 0; l < graph.getNLinks(); ++l)
 		{
+			const std::shared_ptr<Node<TensorT>>& source_node = graph.getNode(graph.getLinkSource(l));
+			const std::shared_ptr<Node<TensorT>>& sink_node = graph.getNode(graph.getLinkSink(l));
 			if (
-				model.nodes_.at(link_map.second->getSourceNodeName())->getType() != NodeType::bias &&
-				model.nodes_.at(link_map.second->getSourceNodeName())->getStatus() == NodeStatus::activated &&
-				model.nodes_.at(link_map.second->getSinkNodeName())->getStatus() == NodeStatus::initialized)
+				source_node->getType() != NodeType::bias &&
+				source_node->getStatus() == NodeStatus::activated &&
+				sink_node->getStatus() == NodeStatus::initialized)
 			{
-				//if (FP_operations.size() == 680)
-				//	std::cout << "check" << std::endl;
 				OperationArguments<TensorT> arguments;
-				arguments.source_node = model.nodes_.at(link_map.second->getSourceNodeName());
-				arguments.weight = model.weights_.at(link_map.second->getWeightName());
+				arguments.source_node = source_node;
+				arguments.weight = graph.getWeight(graph.getLinkWeight(l));
 				arguments.time_step = 0;
-				arguments.link_name = link_map.first;
+				arguments.link_name = graph.getLink(l)->getName();
 
-				std::string ops_key = link_map.second->getSinkNodeName();
+				const std::string& ops_key = sink_node->getName();
 				auto found = FP_operations_map.emplace(ops_key, (int)FP_operations.size());
 				if (!found.second)
 				{
-					FP_operations[FP_operations_map.at(ops_key)].arguments.push_back(arguments);
+					FP_operations[found.first->second].arguments.push_back(arguments);
 				}
 				else
 				{
 					OperationList<TensorT> operation_list;
 					OperationResult<TensorT> result;
-					result.sink_node = model.nodes_.at(link_map.second->getSinkNodeName());
+					result.sink_node = sink_node;
 					operation_list.result = result;
 					operation_list.arguments.push_back(arguments);
 					FP_operations.push_back(operation_list);
@@ -852,26 +1116,39 @@ namespace SmartPeak
 		std::vector<OperationList<TensorT>>& FP_operations,
 		std::vector<std::string>& sink_nodes_with_biases)
 	{
+		getNextInactiveLayerBiases(ModelGraph<TensorT>(model), FP_operations_map, FP_operations, sink_nodes_with_biases);
+	}
+
+	template<typename TensorT, typename DeviceT>
+	void ModelInterpreter<TensorT, DeviceT>::getNextInactiveLayerBiases(const ModelGraph<TensorT>& graph,
+		std::map<std::string, int>& FP_operations_map,
+		std::vector<OperationList<TensorT>>& FP_operations,
+		std::vector<std::string>& sink_nodes_with_biases)
+	{
 
 		// get all the biases for the sink nodes
-		for (auto& link_map : model.links_)
+		for (int l = 0; l < graph.getNLinks(); ++l)
 		{
-			std::string ops_key = link_map.second->getSinkNodeName();
+			const std::shared_ptr<Node<TensorT>>& source_node = graph.getNode(graph.getLinkSource(l));
+			const std::shared_ptr<Node<TensorT>>& sink_node = graph.getNode(graph.getLinkSink(l));
 			if (
 				// does not allow for cycles
-				model.nodes_.at(link_map.second->getSourceNodeName())->getType() == NodeType::bias &&
-				model.nodes_.at(link_map.second->getSourceNodeName())->getStatus() == NodeStatus::activated &&
+				source_node->getType() == NodeType::bias &&
+				source_node->getStatus() == NodeStatus::activated &&
 				// required regardless if cycles are or are not allowed
-				model.nodes_.at(link_map.second->getSinkNodeName())->getStatus() == NodeStatus::initialized &&
-				FP_operations_map.count(ops_key) != 0 // sink node has already been identified
+				sink_node->getStatus() == NodeStatus::initialized
 				)
 			{
+				const std::string& ops_key = sink_node->getName();
+				auto found = FP_operations_map.find(ops_key);
+				if (found == FP_operations_map.end()) continue; // sink node has not been identified
+
 				OperationArguments<TensorT> arguments;
-				arguments.source_node = model.nodes_.at(link_map.second->getSourceNodeName());
-				arguments.weight = model.weights_.at(link_map.second->getWeightName());
+				arguments.source_node = source_node;
+				arguments.weight = graph.getWeight(graph.getLinkWeight(l));
 				arguments.time_step = 0;
-				arguments.link_name = link_map.first;
-				FP_operations[FP_operations_map.at(ops_key)].arguments.push_back(arguments);
+				arguments.link_name = graph.getLink(l)->getName();
+				FP_operations[found->second].arguments.push_back(arguments);
 				if (std::count(sink_nodes_with_biases.begin(), sink_nodes_with_biases.end(), ops_key) == 0)
 				{
 					sink_nodes_with_biases.push_back(ops_key);
@@ -886,25 +1163,38 @@ namespace SmartPeak
 		std::vector<OperationList<TensorT>>& FP_operations,
 		std::set<std::string>& sink_nodes_with_cycles)
 	{
+		getNextInactiveLayerCycles(ModelGraph<TensorT>(model), FP_operations_map, FP_operations, sink_nodes_with_cycles);
+	}
+
+	template<typename TensorT, typename DeviceT>
+	void ModelInterpreter<TensorT, DeviceT>::getNextInactiveLayerCycles(const ModelGraph<TensorT>& graph,
+		std::map<std::string, int>& FP_operations_map,
+		std::vector<OperationList<TensorT>>& FP_operations,
+		std::set<std::string>& sink_nodes_with_cycles)
+	{
 
 		// get cyclic source nodes
-		for (auto& link_map : model.links_)
+		for (int l = 0; l < graph.getNLinks(); ++l)
 		{
-			std::string ops_key = link_map.second->getSinkNodeName();
+			const std::shared_ptr<Node<TensorT>>& source_node = graph.getNode(graph.getLinkSource(l));
+			const std::shared_ptr<Node<TensorT>>& sink_node = graph.getNode(graph.getLinkSink(l));
 			if (
-				model.nodes_.at(link_map.second->getSourceNodeName())->getStatus() == NodeStatus::initialized &&
+				source_node->getStatus() == NodeStatus::initialized &&
 				// required regardless if cycles are or are not allowed
-				model.nodes_.at(link_map.second->getSinkNodeName())->getStatus() == NodeStatus::initialized &&
-				FP_operations_map.count(ops_key) != 0 // sink node has already been identified
+				sink_node->getStatus() == NodeStatus::initialized
 				)
 			{
+				const std::string& ops_key = sink_node->getName();
+				auto found = FP_operations_map.find(ops_key);
+				if (found == FP_operations_map.end()) continue; // sink node has not been identified
+
 				OperationArguments<TensorT> arguments;
-				arguments.source_node = model.nodes_.at(link_map.second->getSourceNodeName());
-				arguments.weight = model.weights_.at(link_map.second->getWeightName());
+				arguments.source_node = source_node;
+				arguments.weight = graph.getWeight(graph.getLinkWeight(l));
 
 				arguments.time_step = 1;
-				arguments.link_name = link_map.first;
-				FP_operations[FP_operations_map.at(ops_key)].arguments.push_back(arguments);
+				arguments.link_name = graph.getLink(l)->getName();
+				FP_operations[found->second].arguments.push_back(arguments);
 				sink_nodes_with_cycles.insert(ops_key);
 			}
 		}
@@ -920,18 +1210,14 @@ namespace SmartPeak
 		{
 			std::vector<std::string> sink_nodes_remove;
 			std::vector<OperationList<TensorT>> FP_operations_copy = FP_operations;
+			const std::set<std::pair<std::string, std::string>> cyclic_pairs = model.getCyclicPairs();
 			for (const std::string& sink_node : sink_nodes_with_cycles) {
 				for (size_t i = FP_operations[FP_operations_map.at(sink_node)].arguments.size();
 					i < FP_operations_cycles[FP_operations_map_cycles.at(sink_node)].arguments.size(); ++i) {
 					// check if the "cyclic" argument is actually involved in a cycle
-					bool isCyclicOperation = false;
-					for (const auto& cyclic_pair : model.getCyclicPairs()) {
-						if (FP_operations_cycles[FP_operations_map_cycles.at(sink_node)].arguments[i].source_node->getName() == cyclic_pair.first &&
-							FP_operations_cycles[FP_operations_map_cycles.at(sink_node)].result.sink_node->getName() == cyclic_pair.second) {
-							isCyclicOperation = true;
-							break;
-						}
-					}
+					const bool isCyclicOperation = cyclic_pairs.count(std::make_pair(
+						FP_operations_cycles[FP_operations_map_cycles.at(sink_node)].arguments[i].source_node->getName(),
+						FP_operations_cycles[FP_operations_map_cycles.at(sink_node)].result.sink_node->getName())) != 0;
 					// copy over the cyclic operation
 					if (isCyclicOperation)
 						FP_operations_copy[FP_operations_map_cycles.at(sink_node)].arguments.push_back(FP_operations_cycles[FP_operations_map_cycles.at(sink_node)].arguments[i]);
@@ -1825,6 +2111,17 @@ namespace SmartPeak
 		// buffer the memory size
 		const int memory_size_buffered = memory_size + 1;
 
+		// Retrieve the forward operation steps of a model with the same structure from the compiled model cache
+		std::size_t compiled_model_cache_key = 0;
+		if (tensor_ops_steps_.size() == 0 && compiled_model_cache_ != nullptr) {
+			compiled_model_cache_key = makeCompiledModelCacheKey(model, fast_check, preserve_OoO);
+			std::shared_ptr<const CompiledOperationsSchedule> schedule = compiled_model_cache_->getSchedule(compiled_model_cache_key);
+			if (schedule != nullptr && !instantiateCompiledOperationsSchedule(model, *schedule, FP_operations_, tensor_ops_steps_)) {
+				FP_operations_.clear();
+				tensor_ops_steps_.clear();
+			}
+		}
+
 		// Get the forward operation steps
 		if (tensor_ops_steps_.size() == 0) {
 
@@ -1849,6 +2146,8 @@ namespace SmartPeak
 			// Save the list of operations for fast model check-pointing
 			tensor_ops_steps_ = tensor_ops_steps;
 			FP_operations_ = FP_operations_expanded;
+			if (compiled_model_cache_ != nullptr)
+				compiled_model_cache_->addSchedule(compiled_model_cache_key, makeCompiledOperationsSchedule(FP_operations_expanded, tensor_ops_steps));
 
       // Allocate tensor memory
       setForwardPropogationLayerTensors_(FP_operations_expanded, tensor_ops_steps, batch_size, memory_size_buffered, train);
@@ -1869,6 +2168,69 @@ namespace SmartPeak
 		}
 	}
 
+	template<typename TensorT, typename DeviceT>
+	inline std::size_t ModelInterpreter<TensorT, DeviceT>::makeCompiledModelCacheKey(const Model<TensorT>& model, const bool& fast_check, const bool& preserve_OoO)
+	{
+		std::size_t seed = model.getStructureHash();
+		seed ^= std::hash<int>()(static_cast<int>(fast_check) + 2 * static_cast<int>(preserve_OoO)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		return seed;
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline std::shared_ptr<const CompiledOperationsSchedule> ModelInterpreter<TensorT, DeviceT>::makeCompiledOperationsSchedule(const std::vector<OperationList<TensorT>>& FP_operations,
+		const std::vector<std::map<std::string, std::vector<int>>>& tensor_ops_steps)
+	{
+		std::shared_ptr<CompiledOperationsSchedule> schedule = std::make_shared<CompiledOperationsSchedule>();
+		schedule->tensor_ops_steps = tensor_ops_steps;
+		schedule->FP_operations.reserve(FP_operations.size());
+		for (const auto& FP_operation : FP_operations) {
+			CompiledOperationList operation_list;
+			operation_list.sink_node_name = FP_operation.result.sink_node->getName();
+			operation_list.sink_time_step = FP_operation.result.time_step;
+			operation_list.operation_index = FP_operation.operation_index;
+			for (const auto& argument : FP_operation.arguments) {
+				CompiledOperationArguments arguments;
+				arguments.source_node_name = argument.source_node->getName();
+				arguments.weight_name = argument.weight->getName();
+				arguments.link_name = argument.link_name;
+				arguments.time_step = argument.time_step;
+				operation_list.arguments.push_back(arguments);
+			}
+			schedule->FP_operations.push_back(operation_list);
+		}
+		return schedule;
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline bool ModelInterpreter<TensorT, DeviceT>::instantiateCompiledOperationsSchedule(Model<TensorT>& model, const CompiledOperationsSchedule& schedule,
+		std::vector<OperationList<TensorT>>& FP_operations, std::vector<std::map<std::string, std::vector<int>>>& tensor_ops_steps)
+	{
+		FP_operations.clear();
+		FP_operations.reserve(schedule.FP_operations.size());
+		for (const CompiledOperationList& compiled_operation : schedule.FP_operations) {
+			auto sink_node = model.nodes_.find(compiled_operation.sink_node_name);
+			if (sink_node == model.nodes_.end()) return false;
+			OperationList<TensorT> operation_list;
+			operation_list.result.sink_node = sink_node->second;
+			operation_list.result.time_step = compiled_operation.sink_time_step;
+			operation_list.operation_index = compiled_operation.operation_index;
+			for (const CompiledOperationArguments& compiled_argument : compiled_operation.arguments) {
+				auto source_node = model.nodes_.find(compiled_argument.source_node_name);
+				auto weight = model.weights_.find(compiled_argument.weight_name);
+				if (source_node == model.nodes_.end() || weight == model.weights_.end()) return false;
+				OperationArguments<TensorT> arguments;
+				arguments.source_node = source_node->second;
+				arguments.weight = weight->second;
+				arguments.link_name = compiled_argument.link_name;
+				arguments.time_step = compiled_argument.time_step;
+				operation_list.arguments.push_back(arguments);
+			}
+			FP_operations.push_back(operation_list);
+		}
+		tensor_ops_steps = schedule.tensor_ops_steps;
+		return true;
+	}
+
 	template<typename TensorT, typename DeviceT>
 	inline void ModelInterpreter<TensorT, DeviceT>::getFPOpsOoO_(Model<TensorT>& model, std::vector<OperationList<TensorT>>& FP_operations_expanded, int& iter)
 	{
@@ -1885,6 +2247,7 @@ namespace SmartPeak
 		}
 
 		// STEP 2: Get a list of unoptimized operations for FP in As-soon-as-possible (ASAP) hierarchy
+		const ModelGraph<TensorT> graph(model);
 		const int max_iters = 1e6;
 		std::vector<OperationList<TensorT>> FP_operations;
 		for (; iter < max_iters; ++iter)
@@ -1892,13 +2255,13 @@ namespace SmartPeak
       std::map<std::string, int> FP_operations_map;
       std::vector<OperationList<TensorT>> FP_operations_list;
       // get the next hidden layer
-      getNextInactiveLayer(model, FP_operations_map, FP_operations_list);
+      getNextInactiveLayer(graph, FP_operations_map, FP_operations_list);
 
 			// get cycles
 			std::map<std::string, int> FP_operations_map_cycles = FP_operations_map;
 			std::vector<OperationList<TensorT>> FP_operations_list_cycles = FP_operations_list;
 			std::set<std::string> sink_nodes_cycles;
-			getNextInactiveLayerCycles(model, FP_operations_map_cycles, FP_operations_list_cycles, sink_nodes_cycles);
+			getNextInactiveLayerCycles(graph, FP_operations_map_cycles, FP_operations_list_cycles, sink_nodes_cycles);
 
 			// Remove all nodes involved in "cycles" that have arguments
 			// involving source to sink node pairs not identified as cycles
@@ -2062,25 +2425,28 @@ namespace SmartPeak
 		}
 
 		// convert the loss function
-    std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>> loss_function_tensor;
-		LossFunctionOpToLossFunctionTensorOp<TensorT, DeviceT> loss_conv;
-		loss_conv(loss_function, loss_function_tensor, std::vector<TensorT>() = {});
-		std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>> loss_function_grad_tensor;
-		LossFunctionGradOpToLossFunctionGradTensorOp<TensorT, DeviceT> loss_grad_conv;
-		loss_grad_conv(loss_function_grad, loss_function_grad_tensor, std::vector<TensorT>() = {});
+    std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>> loss_function_tensor = getLossFunctionTensor_(loss_function);
+		std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>> loss_function_grad_tensor = getLossFunctionGradTensor_(loss_function_grad);
 
 		// NOTE: the output are stored [Tmax, Tmax - 1, ..., T=0, T=-1] where T=-1 is added automatically
 		//	     so the expected values should also be stored [Tmax, Tmax - 1, ..., T=0, T=-1]
-		for (int time_step = 0; time_step < max_steps; ++time_step)
-		{
-			// calculate the error for each batch of memory
-			Eigen::Tensor<TensorT, 2> expected = values.chip(time_step, 1);
-		  executeModelErrorOperations(expected, layer_id, loss_function_tensor, loss_function_grad_tensor, time_step);
-		}
+    if (max_steps <= 0) return;
+
+    // calculate the error for each batch of memory of all time steps at once
+    Eigen::Tensor<TensorT, 3> expected = values.slice(Eigen::array<Eigen::Index, 3>({ 0, 0, 0 }), Eigen::array<Eigen::Index, 3>({ values.dimension(0), max_steps, values.dimension(2) })
+      ).shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+    executeModelErrorOperations(expected, layer_id, loss_function_tensor, loss_function_grad_tensor, 0, max_steps);
 	}
 
   template<typename TensorT, typename DeviceT>
   inline void ModelInterpreter<TensorT, DeviceT>::CMTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& node_names, std::shared_ptr<MetricFunctionOp<TensorT>>& metric_function, const int & time_steps, const int & metric_index)
+  {
+    std::vector<std::shared_ptr<MetricFunctionOp<TensorT>>> metric_functions = { metric_function };
+    CMTT(model, values, node_names, metric_functions, time_steps, metric_index);
+  }
+
+  template<typename TensorT, typename DeviceT>
+  inline void ModelInterpreter<TensorT, DeviceT>::CMTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& node_names, std::vector<std::shared_ptr<MetricFunctionOp<TensorT>>>& metric_functions, const int & time_steps, const int & metric_index)
   {
     // check time_steps vs memory_size
     int max_steps = time_steps;
@@ -2106,19 +2472,72 @@ namespace SmartPeak
       throw std::runtime_error(error_char);
     }
 
-    // convert the metric function
-    std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>> metric_function_tensor;
-    MetricFunctionOpToMetricFunctionTensorOp<TensorT, DeviceT> metric_conv;
-    metric_conv(metric_function, metric_function_tensor, std::vector<TensorT>() = {});
+    // convert the metric functions and fuse the classification metric functions
+    std::vector<std::pair<std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>>, int>> metric_function_tensors;
+    auto found = classification_metrics_tensors_.find(metric_functions);
+    const bool fuse_metrics = found == classification_metrics_tensors_.end();
+    std::shared_ptr<ClassificationMetricsTensorOp<TensorT, DeviceT>> classification_metrics = (fuse_metrics) ? std::make_shared<ClassificationMetricsTensorOp<TensorT, DeviceT>>() : found->second;
+    if (fuse_metrics) classification_metrics_tensors_.emplace(metric_functions, classification_metrics);
+    for (int metric_iter = 0; metric_iter < metric_functions.size(); ++metric_iter) {
+      std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>> metric_function_tensor = getMetricFunctionTensor_(metric_functions.at(metric_iter));
+      auto classification_metric = std::dynamic_pointer_cast<ClassificationMetricTensorOp<TensorT, DeviceT>>(metric_function_tensor);
+      if (classification_metric) {
+        if (fuse_metrics) classification_metrics->addMetric(classification_metric, metric_iter);
+      }
+      else
+        metric_function_tensors.push_back(std::make_pair(metric_function_tensor, metric_index + metric_iter));
+    }
+    if (classification_metrics->getNMetrics() > 0)
+      metric_function_tensors.push_back(std::make_pair(std::static_pointer_cast<MetricFunctionTensorOp<TensorT, DeviceT>>(classification_metrics), metric_index));
 
     // NOTE: the output are stored [Tmax, Tmax - 1, ..., T=0, T=-1] where T=-1 is added automatically
     //	     so the expected values should also be stored [Tmax, Tmax - 1, ..., T=0, T=-1]
-    for (int time_step = 0; time_step < max_steps; ++time_step)
-    {
-      // calculate the error for each batch of memory
-      Eigen::Tensor<TensorT, 2> expected = values.chip(time_step, 1);
-      executeModelMetricOperations(expected, layer_id, metric_function_tensor, time_step, metric_index);
-    }
+    if (max_steps <= 0) return;
+
+    // calculate the metrics for each batch of memory of all time steps at once
+    Eigen::Tensor<TensorT, 3> expected = values.slice(Eigen::array<Eigen::Index, 3>({ 0, 0, 0 }), Eigen::array<Eigen::Index, 3>({ values.dimension(0), max_steps, values.dimension(2) })
+      ).shuffle(Eigen::array<int, 3>({ 0, 2, 1 }));
+    for (auto& metric_function_tensor : metric_function_tensors)
+      executeModelMetricOperations(expected, layer_id, metric_function_tensor.first, 0, max_steps, metric_function_tensor.second);
+  }
+
+  template<typename TensorT, typename DeviceT>
+  inline std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>> ModelInterpreter<TensorT, DeviceT>::getLossFunctionTensor_(std::shared_ptr<LossFunctionOp<TensorT>>& loss_function)
+  {
+    auto found = loss_function_tensors_.find(loss_function);
+    if (found != loss_function_tensors_.end())
+      return found->second;
+    std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>> loss_function_tensor;
+    LossFunctionOpToLossFunctionTensorOp<TensorT, DeviceT> loss_conv;
+    loss_conv(loss_function, loss_function_tensor, std::vector<TensorT>() = {});
+    loss_function_tensors_.emplace(loss_function, loss_function_tensor);
+    return loss_function_tensor;
+  }
+
+  template<typename TensorT, typename DeviceT>
+  inline std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>> ModelInterpreter<TensorT, DeviceT>::getLossFunctionGradTensor_(std::shared_ptr<LossFunctionGradOp<TensorT>>& loss_function_grad)
+  {
+    auto found = loss_function_grad_tensors_.find(loss_function_grad);
+    if (found != loss_function_grad_tensors_.end())
+      return found->second;
+    std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>> loss_function_grad_tensor;
+    LossFunctionGradOpToLossFunctionGradTensorOp<TensorT, DeviceT> loss_grad_conv;
+    loss_grad_conv(loss_function_grad, loss_function_grad_tensor, std::vector<TensorT>() = {});
+    loss_function_grad_tensors_.emplace(loss_function_grad, loss_function_grad_tensor);
+    return loss_function_grad_tensor;
+  }
+
+  template<typename TensorT, typename DeviceT>
+  inline std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>> ModelInterpreter<TensorT, DeviceT>::getMetricFunctionTensor_(std::shared_ptr<MetricFunctionOp<TensorT>>& metric_function)
+  {
+    auto found = metric_function_tensors_.find(metric_function);
+    if (found != metric_function_tensors_.end())
+      return found->second;
+    std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>> metric_function_tensor;
+    MetricFunctionOpToMetricFunctionTensorOp<TensorT, DeviceT> metric_conv;
+    metric_conv(metric_function, metric_function_tensor, std::vector<TensorT>() = {});
+    metric_function_tensors_.emplace(metric_function, metric_function_tensor);
+    return metric_function_tensor;
   }
 
   template<typename TensorT, typename DeviceT>
@@ -2138,6 +2557,237 @@ namespace SmartPeak
 		}
 	}
 
+	template<typename TensorT, typename DeviceT>
+	inline TensorT ModelInterpreter<TensorT, DeviceT>::checkpointedBPTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& input_nodes,
+		const std::function<void(const int&, const int&)>& calc_model_errors)
+	{
+		const int window_size = layer_tensors_[0]->getMemorySize() - 1;
+		const int sequence_length = values.dimension(1);
+		const int n_windows = (sequence_length + window_size - 1) / window_size;
+
+		// forward propogate from the oldest to the most recent window and checkpoint the last time step of each window
+		std::vector<std::vector<Eigen::Tensor<TensorT, 3>>> checkpoints(n_windows);
+		for (int window = n_windows - 1; window >= 0; --window) {
+			const int time_step_start = window * window_size;
+			const int n_time_steps = std::min(window_size, sequence_length - time_step_start);
+			forwardPropogateWindow_(model, values, input_nodes, time_step_start, n_time_steps, (window < n_windows - 1) ? &checkpoints.at(window + 1) : nullptr);
+			if (window > 0)
+				getLayerCheckpoint_(0, checkpoints.at(window));
+		}
+
+		// back propogate from the most recent to the oldest window
+		// (the most recent window does not need to be re-computed)
+		TensorT total_error = TensorT(0);
+		std::vector<Eigen::Tensor<TensorT, 2>> carried_errors;
+		for (int window = 0; window < n_windows; ++window) {
+			const int time_step_start = window * window_size;
+			const int n_time_steps = std::min(window_size, sequence_length - time_step_start);
+			if (window > 0)
+				forwardPropogateWindow_(model, values, input_nodes, time_step_start, n_time_steps, (window < n_windows - 1) ? &checkpoints.at(window + 1) : nullptr);
+			if (window < n_windows - 1)
+				checkpoints.at(window + 1).clear();
+
+			reInitModelError();
+			calc_model_errors(time_step_start, n_time_steps);
+			if (window > 0)
+				addLayerErrors_(0, carried_errors);
+			TBPTT(n_time_steps);
+
+			// the errors at the checkpoint belong to the previous window
+			// (the errors of shared weights are pooled once all windows have been accumulated)
+			takeLayerErrors_(n_time_steps, carried_errors);
+			executeWeightErrorOperations(window == n_windows - 1);
+
+			getModelResults(model, false, false, true, false);
+			const Eigen::Tensor<TensorT, 0> window_error = model.getError().sum();
+			total_error += window_error(0);
+		}
+		return total_error;
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline TensorT ModelInterpreter<TensorT, DeviceT>::windowedTBPTT(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& input_nodes,
+		const std::function<void(const int&, const int&)>& calc_model_errors)
+	{
+		const int window_size = layer_tensors_[0]->getMemorySize() - 1;
+		const int sequence_length = values.dimension(1);
+		const int n_windows = (sequence_length + window_size - 1) / window_size;
+
+		// propogate forward in time from the oldest to the most recent window
+		TensorT total_error = TensorT(0);
+		std::vector<Eigen::Tensor<TensorT, 3>> checkpoint;
+		std::vector<Eigen::Tensor<TensorT, 2>> truncated_errors;
+		for (int window = n_windows - 1; window >= 0; --window) {
+			const int time_step_start = window * window_size;
+			const int n_time_steps = std::min(window_size, sequence_length - time_step_start);
+			forwardPropogateWindow_(model, values, input_nodes, time_step_start, n_time_steps, (window < n_windows - 1) ? &checkpoint : nullptr);
+			if (window > 0)
+				getLayerCheckpoint_(0, checkpoint);
+
+			reInitModelError();
+			calc_model_errors(time_step_start, n_time_steps);
+			TBPTT(n_time_steps);
+
+			// the errors at the checkpoint are truncated
+			// (the errors of shared weights are pooled once all windows have been accumulated)
+			takeLayerErrors_(n_time_steps, truncated_errors);
+			executeWeightErrorOperations(window == 0);
+
+			getModelResults(model, false, false, true, false);
+			const Eigen::Tensor<TensorT, 0> window_error = model.getError().sum();
+			total_error += window_error(0);
+		}
+		return total_error;
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline void ModelInterpreter<TensorT, DeviceT>::initStreaming(Model<TensorT>& model, const std::vector<std::string>& input_nodes, const std::vector<std::string>& output_nodes)
+	{
+		if (!std::is_same<DeviceT, Eigen::DefaultDevice>::value) {
+			const std::string error = "Streaming is only implemented for the DefaultDevice.";
+			throw std::runtime_error(error);
+		}
+		if (layer_tensors_.size() <= 0) {
+			std::string error_char = "Tensor layers have not been created.  Cannot initiate streaming.";
+			throw std::runtime_error(error_char);
+		}
+		reInitNodes();
+		initBiases(model);
+
+		// cache the tensor positions of the input and output nodes
+		auto getIndices = [this, &model](const std::vector<std::string>& node_names, std::vector<std::pair<int, int>>& indices) {
+			indices.clear();
+			for (const std::string& node_name : node_names) {
+				const std::pair<int, int> tensor_index = model.nodes_.at(node_name)->getTensorIndex();
+				if (tensor_index.first == -1) {
+					clear_cache(); // clean up before exiting
+					const std::string error = "Node " + node_name + " has not been assigned a tensor index!";
+					throw std::runtime_error(error);
+				}
+				indices.push_back(tensor_index);
+			}
+		};
+		getIndices(input_nodes, streaming_input_indices_);
+		getIndices(output_nodes, streaming_output_indices_);
+
+		// collect the layers whose inputs are integrated by the forward propogation
+		std::set<int> sink_layers;
+		for (const auto& operations_list : operation_steps_)
+			for (const auto& operation : operations_list)
+				sink_layers.insert(operation.sink_layer.tensor_index);
+		streaming_sink_layers_.assign(sink_layers.begin(), sink_layers.end());
+		streaming_time_step_ = -1;
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline Eigen::Tensor<TensorT, 2> ModelInterpreter<TensorT, DeviceT>::stepStreaming(const Eigen::Tensor<TensorT, 2>& values)
+	{
+		if (layer_tensors_.size() <= 0 || streaming_output_indices_.size() <= 0) {
+			std::string error_char = "Streaming has not been initialized.  Call initStreaming before stepStreaming.";
+			throw std::runtime_error(error_char);
+		}
+		if (values.dimension(0) != layer_tensors_[0]->getBatchSize() || values.dimension(1) != streaming_input_indices_.size()) {
+			const std::string error = "The streaming input dimensions " + std::to_string(values.dimension(0)) + " x " + std::to_string(values.dimension(1)) +
+				" do not match the batch size " + std::to_string(layer_tensors_[0]->getBatchSize()) + " and the number of input nodes " + std::to_string(streaming_input_indices_.size()) + ".";
+			throw std::runtime_error(error);
+		}
+
+		// advance the ring buffer
+		const int memory_size = layer_tensors_[0]->getMemorySize();
+		const int time_step = (streaming_time_step_ <= 0) ? memory_size - 1 : streaming_time_step_ - 1;
+		for (const int& layer_index : streaming_sink_layers_) {
+			auto& layer_tensor = layer_tensors_.at(layer_index);
+			if (layer_tensor->getLayerIntegration() == "ProdOp" || layer_tensor->getLayerIntegration() == "ProdSCOp")
+				layer_tensor->getInput().chip(time_step, 1).setConstant(TensorT(1));
+			else
+				layer_tensor->getInput().chip(time_step, 1).setZero();
+		}
+
+		// map the inputs and forward propogate the time step
+		for (int node_iter = 0; node_iter < streaming_input_indices_.size(); ++node_iter) {
+			auto& layer_tensor = layer_tensors_.at(streaming_input_indices_.at(node_iter).first);
+			for (int batch_iter = 0; batch_iter < values.dimension(0); ++batch_iter) {
+				layer_tensor->getInput()(batch_iter, time_step, streaming_input_indices_.at(node_iter).second) = values(batch_iter, node_iter);
+				layer_tensor->getOutput()(batch_iter, time_step, streaming_input_indices_.at(node_iter).second) = values(batch_iter, node_iter);
+			}
+		}
+		auto setRingMemory = [this](const bool& ring_memory) {
+			for (auto& operations_list : operation_steps_)
+				for (auto& operation : operations_list)
+					if (operation.sink_layer.integration) operation.sink_layer.integration->setRingMemory(ring_memory);
+		};
+		setRingMemory(true);
+		executeForwardPropogationOperations(time_step);
+		setRingMemory(false);
+		streaming_time_step_ = time_step;
+
+		// copy out the outputs
+		Eigen::Tensor<TensorT, 2> outputs((int)values.dimension(0), (int)streaming_output_indices_.size());
+		for (int node_iter = 0; node_iter < streaming_output_indices_.size(); ++node_iter) {
+			auto& layer_tensor = layer_tensors_.at(streaming_output_indices_.at(node_iter).first);
+			for (int batch_iter = 0; batch_iter < values.dimension(0); ++batch_iter)
+				outputs(batch_iter, node_iter) = layer_tensor->getOutput()(batch_iter, time_step, streaming_output_indices_.at(node_iter).second);
+		}
+		return outputs;
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline void ModelInterpreter<TensorT, DeviceT>::forwardPropogateWindow_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& values, const std::vector<std::string>& input_nodes,
+		const int& time_step_start, const int& n_time_steps, const std::vector<Eigen::Tensor<TensorT, 3>>* checkpoint)
+	{
+		// slice out the window (padded to the memory size)
+		Eigen::Tensor<TensorT, 3> values_window((int)values.dimension(0), (int)layer_tensors_[0]->getMemorySize() - 1, (int)values.dimension(2));
+		values_window.setZero();
+		Eigen::array<Eigen::Index, 3> spans = { values.dimension(0), n_time_steps, values.dimension(2) };
+		values_window.slice(Eigen::array<Eigen::Index, 3>({ 0, 0, 0 }), spans) = values.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), spans);
+
+		reInitNodes();
+		initBiases(model);
+		mapValuesToLayers(model, values_window, input_nodes, "output");
+		mapValuesToLayers(model, values_window, input_nodes, "input");
+		if (checkpoint != nullptr)
+			setLayerCheckpoint_(n_time_steps, *checkpoint);
+		FPTT(n_time_steps);
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline void ModelInterpreter<TensorT, DeviceT>::getLayerCheckpoint_(const int& time_step, std::vector<Eigen::Tensor<TensorT, 3>>& checkpoint)
+	{
+		checkpoint.clear();
+		for (auto& layer_tensor : layer_tensors_) {
+			Eigen::Tensor<TensorT, 3> layer_checkpoint((int)layer_tensor->getBatchSize(), 2, (int)layer_tensor->getLayerSize());
+			layer_checkpoint.chip(0, 1) = layer_tensor->getInput().chip(time_step, 1);
+			layer_checkpoint.chip(1, 1) = layer_tensor->getOutput().chip(time_step, 1);
+			checkpoint.push_back(layer_checkpoint);
+		}
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline void ModelInterpreter<TensorT, DeviceT>::setLayerCheckpoint_(const int& time_step, const std::vector<Eigen::Tensor<TensorT, 3>>& checkpoint)
+	{
+		for (int i = 0; i < layer_tensors_.size(); ++i) {
+			layer_tensors_.at(i)->getInput().chip(time_step, 1) = checkpoint.at(i).chip(0, 1);
+			layer_tensors_.at(i)->getOutput().chip(time_step, 1) = checkpoint.at(i).chip(1, 1);
+		}
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline void ModelInterpreter<TensorT, DeviceT>::takeLayerErrors_(const int& time_step, std::vector<Eigen::Tensor<TensorT, 2>>& errors)
+	{
+		errors.clear();
+		for (auto& layer_tensor : layer_tensors_) {
+			errors.push_back(layer_tensor->getError().chip(time_step, 1));
+			layer_tensor->getError().chip(time_step, 1).setZero();
+		}
+	}
+
+	template<typename TensorT, typename DeviceT>
+	inline void ModelInterpreter<TensorT, DeviceT>::addLayerErrors_(const int& time_step, const std::vector<Eigen::Tensor<TensorT, 2>>& errors)
+	{
+		for (int i = 0; i < layer_tensors_.size(); ++i)
+			layer_tensors_.at(i)->getError().chip(time_step, 1) += errors.at(i);
+	}
+
 	template<typename TensorT, typename DeviceT>
 	inline void ModelInterpreter<TensorT, DeviceT>::updateWeights(const int& iter)
 	{
@@ -2165,7 +2815,24 @@ namespace SmartPeak
 		operation_steps_.clear();
 		FP_operations_.clear();
 		tensor_ops_steps_.clear();
+		streaming_time_step_ = -1;
+		streaming_input_indices_.clear();
+		streaming_output_indices_.clear();
+		streaming_sink_layers_.clear();
 	}
+  template<typename TensorT, typename DeviceT>
+  inline void ModelInterpreter<TensorT, DeviceT>::clearTensorOpsCache()
+  {
+    loss_function_tensors_.clear();
+    loss_function_grad_tensors_.clear();
+    metric_function_tensors_.clear();
+    classification_metrics_tensors_.clear();
+    activation_conv_.clearSharedTensorOps();
+    solver_conv_.clearSharedTensorOps();
+    integration_conv_.clearSharedTensorOps();
+    integration_error_conv_.clearSharedTensorOps();
+    integration_weight_grad_conv_.clearSharedTensorOps();
+  }
 	template<typename TensorT, typename DeviceT>
 	inline std::vector<std::map<std::string, std::vector<int>>> ModelInterpreter<TensorT, DeviceT>::getTensorOpsSteps() const {
 		return tensor_ops_steps_;
@@ -35,7 +35,9 @@ namespace SmartPeak
 		void executeBackwardPropogationOperations(const int& time_step) override;
 		void executeModelErrorOperations(Eigen::Tensor<TensorT, 2>& expected, const int& layer_id, std::shared_ptr<LossFunctionTensorOp<TensorT,Eigen::DefaultDevice>>& loss_function, std::shared_ptr<LossFunctionGradTensorOp<TensorT,Eigen::DefaultDevice>>& loss_function_grad, const int& time_step) override;
     void executeModelMetricOperations(Eigen::Tensor<TensorT, 2>& expected, const int& layer_id, std::shared_ptr<MetricFunctionTensorOp<TensorT,Eigen::DefaultDevice>> metric_function, const int& time_step, const int& metric_index) override;
-		void executeWeightErrorOperations() override;
+    void executeModelErrorOperations(Eigen::Tensor<TensorT, 3>& expected, const int& layer_id, std::shared_ptr<LossFunctionTensorOp<TensorT,Eigen::DefaultDevice>>& loss_function, std::shared_ptr<LossFunctionGradTensorOp<TensorT,Eigen::DefaultDevice>>& loss_function_grad, const int& time_step_start, const int& n_time_steps) override;
+    void executeModelMetricOperations(Eigen::Tensor<TensorT, 3>& expected, const int& layer_id, std::shared_ptr<MetricFunctionTensorOp<TensorT,Eigen::DefaultDevice>> metric_function, const int& time_step_start, const int& n_time_steps, const int& metric_index) override;
+		void executeWeightErrorOperations(const bool& combine_shared_weight_errors = true) override;
 		void executeWeightUpdateOperations(const int& iter) override;
 		void allocateModelErrorTensor(const int& batch_size, const int& memory_size, const int& n_metrics) override;
 	  void getModelResults(Model<TensorT>& model, const bool& output_nodes, const bool& weights, const bool& model_error, const bool& input_nodes) override;
@@ -59,11 +61,6 @@ namespace SmartPeak
 	{
 		std::vector<OperationTensorStep<TensorT, Eigen::DefaultDevice>> operation_step_list;
 		
-		ActivationOpToActivationTensorOp<TensorT, Eigen::DefaultDevice> activation_conv;
-		SolverOpToSolverTensorOp<TensorT, Eigen::DefaultDevice> solver_conv;
-		IntegrationOpToIntegrationTensorOp<TensorT, Eigen::DefaultDevice> integration_conv;
-		IntegrationErrorOpToIntegrationErrorTensorOp<TensorT, Eigen::DefaultDevice> integration_error_conv;
-		IntegrationWeightGradOpToIntegrationWeightGradTensorOp<TensorT, Eigen::DefaultDevice> integration_weight_grad_conv;
 		int iter = 0;
 		for (const auto& operations : operations_map) {
 
@@ -86,30 +83,30 @@ namespace SmartPeak
             train);
 					this->layer_tensors_.push_back(sink_node_data);
 					operation_step.sink_layer.time_step = FP_operations[operations.second[0]].result.time_step;
-					activation_conv(FP_operations[operations.second[0]].result.sink_node->getActivationShared(), activation, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].result.sink_node->getActivationShared(), activation, std::vector<TensorT>() = {});
 					operation_step.sink_layer.activation = activation;
-					activation_conv(FP_operations[operations.second[0]].result.sink_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].result.sink_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
 					operation_step.sink_layer.activation_grad = activation_grad;
-					integration_conv(FP_operations[operations.second[0]].result.sink_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
+					this->integration_conv_(FP_operations[operations.second[0]].result.sink_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
 					operation_step.sink_layer.integration = integration;
-					integration_error_conv(FP_operations[operations.second[0]].result.sink_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
+					this->integration_error_conv_(FP_operations[operations.second[0]].result.sink_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
 					operation_step.sink_layer.integration_error= integration_error;
-					integration_weight_grad_conv(FP_operations[operations.second[0]].result.sink_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
+					this->integration_weight_grad_conv_(FP_operations[operations.second[0]].result.sink_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
 					operation_step.sink_layer.integration_weight_grad = integration_weight_grad;
 					operation_step.sink_layer.tensor_index = FP_operations[operations.second[0]].result.sink_node->getTensorIndex().first;
 				}
 				else {
 					operation_step.sink_layer.tensor_index = FP_operations[operations.second[0]].result.sink_node->getTensorIndex().first;
 					operation_step.sink_layer.time_step = FP_operations[operations.second[0]].result.time_step;
-					activation_conv(FP_operations[operations.second[0]].result.sink_node->getActivationShared(), activation, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].result.sink_node->getActivationShared(), activation, std::vector<TensorT>() = {});
 					operation_step.sink_layer.activation = activation;
-					activation_conv(FP_operations[operations.second[0]].result.sink_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].result.sink_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
 					operation_step.sink_layer.activation_grad = activation_grad;
-					integration_conv(FP_operations[operations.second[0]].result.sink_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
+					this->integration_conv_(FP_operations[operations.second[0]].result.sink_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
 					operation_step.sink_layer.integration = integration;
-					integration_error_conv(FP_operations[operations.second[0]].result.sink_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
+					this->integration_error_conv_(FP_operations[operations.second[0]].result.sink_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
 					operation_step.sink_layer.integration_error= integration_error;
-					integration_weight_grad_conv(FP_operations[operations.second[0]].result.sink_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
+					this->integration_weight_grad_conv_(FP_operations[operations.second[0]].result.sink_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
 					operation_step.sink_layer.integration_weight_grad = integration_weight_grad;
 					operation_step.sink_layer.time_step = FP_operations[operations.second[0]].result.time_step;
 				}
@@ -128,30 +125,30 @@ namespace SmartPeak
             FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationShared()->getName(), train);
 					operation_step.source_layer.time_step = FP_operations[operations.second[0]].arguments[0].time_step;
 					this->layer_tensors_.push_back(source_node_data);
-					activation_conv(FP_operations[operations.second[0]].arguments[0].source_node->getActivationShared(), activation, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getActivationShared(), activation, std::vector<TensorT>() = {});
 					operation_step.source_layer.activation = activation;
-					activation_conv(FP_operations[operations.second[0]].arguments[0].source_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
 					operation_step.source_layer.activation_grad = activation_grad;
-					integration_conv(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
+					this->integration_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
 					operation_step.source_layer.integration = integration;
-					integration_error_conv(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
+					this->integration_error_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
 					operation_step.source_layer.integration_error = integration_error;
-					integration_weight_grad_conv(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
+					this->integration_weight_grad_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
 					operation_step.source_layer.integration_weight_grad = integration_weight_grad;
 					operation_step.source_layer.tensor_index = FP_operations[operations.second[0]].arguments[0].source_node->getTensorIndex().first;
 				}
 				else {
 					operation_step.source_layer.tensor_index = FP_operations[operations.second[0]].arguments[0].source_node->getTensorIndex().first;
 					operation_step.source_layer.time_step = FP_operations[operations.second[0]].arguments[0].time_step;
-					activation_conv(FP_operations[operations.second[0]].arguments[0].source_node->getActivationShared(), activation, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getActivationShared(), activation, std::vector<TensorT>() = {});
 					operation_step.source_layer.activation = activation;
-					activation_conv(FP_operations[operations.second[0]].arguments[0].source_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
+					this->activation_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getActivationGradShared(), activation_grad, std::vector<TensorT>() = {});
 					operation_step.source_layer.activation_grad = activation_grad;
-					integration_conv(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
+					this->integration_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationShared(), integration, std::vector<TensorT>() = {});
 					operation_step.source_layer.integration = integration;
-					integration_error_conv(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
+					this->integration_error_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationErrorShared(), integration_error, std::vector<TensorT>() = {});
 					operation_step.source_layer.integration_error = integration_error;
-					integration_weight_grad_conv(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
+					this->integration_weight_grad_conv_(FP_operations[operations.second[0]].arguments[0].source_node->getIntegrationWeightGradShared(), integration_weight_grad, std::vector<TensorT>() = {});
 					operation_step.source_layer.integration_weight_grad = integration_weight_grad;
 				}
 			}
@@ -161,7 +158,7 @@ namespace SmartPeak
 			if (make_weight_tensors[iter]) {
 				std::shared_ptr<SolverTensorOp<TensorT, Eigen::DefaultDevice>> solver = nullptr;
 				std::vector<TensorT> solver_params;
-				solver_conv(FP_operations[operations.second[0]].arguments[0].weight->getSolverOpShared(), solver, solver_params);
+				this->solver_conv_(FP_operations[operations.second[0]].arguments[0].weight->getSolverOpShared(), solver, solver_params);
 				weight_data->initWeightTensorData(source_layer_sizes[iter], sink_layer_sizes[iter], weight_indices[iter], shared_weight_indices[iter], weight_values[iter], train,
 					solver_params, FP_operations[operations.second[0]].result.sink_node->getIntegrationShared()->getName());
 				this->weight_tensors_.push_back(weight_data);
@@ -201,7 +198,7 @@ namespace SmartPeak
 					this->layer_tensors_.at(operation.source_layer.tensor_index)->getMemorySize(),
 					this->layer_tensors_.at(operation.source_layer.tensor_index)->getLayerSize(),
 					this->layer_tensors_.at(operation.sink_layer.tensor_index)->getLayerSize(),
-					operation.source_layer.time_step + time_step,
+					(operation.source_layer.time_step + time_step) % this->layer_tensors_.at(operation.source_layer.tensor_index)->getMemorySize(), // wraps around for streaming (see `stepStreaming`)
 					operation.sink_layer.time_step + time_step,
 					device);  // Not over-written
 
@@ -316,7 +313,54 @@ namespace SmartPeak
   }
 
 	template<typename TensorT>
-	inline void ModelInterpreterDefaultDevice<TensorT>::executeWeightErrorOperations()
+	inline void ModelInterpreterDefaultDevice<TensorT>::executeModelErrorOperations(Eigen::Tensor<TensorT, 3>& expected, const int& layer_id, std::shared_ptr<LossFunctionTensorOp<TensorT,Eigen::DefaultDevice>>& loss_function, std::shared_ptr<LossFunctionGradTensorOp<TensorT,Eigen::DefaultDevice>>& loss_function_grad, const int& time_step_start, const int& n_time_steps)
+	{
+		ModelKernalDefaultDevice<TensorT> model_kernal;
+		Eigen::DefaultDevice device;
+		auto layer_tensor_data = this->getLayerTensor(layer_id);
+		model_kernal.executeModelErrors(
+			expected,
+			layer_tensor_data->getHOutputPointer().get(),
+			layer_tensor_data->getDOutputPointer().get(),
+			this->model_error_->getHErrorPointer().get(),
+			this->model_error_->getDErrorPointer().get(),
+			layer_tensor_data->getHErrorPointer().get(),
+			layer_tensor_data->getDErrorPointer().get(),
+			loss_function,
+			loss_function_grad,
+			layer_tensor_data->getBatchSize(),
+			layer_tensor_data->getMemorySize(),
+			layer_tensor_data->getLayerSize(),
+			time_step_start,
+			n_time_steps,
+			device);
+	}
+
+  template<typename TensorT>
+  inline void ModelInterpreterDefaultDevice<TensorT>::executeModelMetricOperations(Eigen::Tensor<TensorT, 3>& expected, const int & layer_id, std::shared_ptr<MetricFunctionTensorOp<TensorT,Eigen::DefaultDevice>> metric_function, const int & time_step_start, const int & n_time_steps, const int & metric_index)
+  {
+    ModelKernalDefaultDevice<TensorT> model_kernal;
+    Eigen::DefaultDevice device;
+    auto layer_tensor_data = this->getLayerTensor(layer_id);
+    model_kernal.executeModelMetric(
+      expected,
+      layer_tensor_data->getHOutputPointer().get(),
+      layer_tensor_data->getDOutputPointer().get(),
+      this->model_error_->getHMetricPointer().get(),
+      this->model_error_->getDMetricPointer().get(),
+      metric_function,
+      layer_tensor_data->getBatchSize(),
+      layer_tensor_data->getMemorySize(),
+      layer_tensor_data->getLayerSize(),
+      this->model_error_->getNMetrics(),
+      time_step_start,
+      n_time_steps,
+      metric_index,
+      device);
+  }
+
+	template<typename TensorT>
+	inline void ModelInterpreterDefaultDevice<TensorT>::executeWeightErrorOperations(const bool& combine_shared_weight_errors)
 	{
 		for (std::vector<OperationTensorStep<TensorT, Eigen::DefaultDevice>>& operations_list : this->operation_steps_) {
 			ModelKernalDefaultDevice<TensorT> model_kernal;
@@ -344,15 +388,16 @@ namespace SmartPeak
 					this->layer_tensors_.at(operation.sink_layer.tensor_index)->getLayerSize(),
 					device);
 
-				model_kernal.executeSharedWeightErrors(
-					this->weight_tensors_.at(operation.weight.tensor_index)->getHErrorPointer().get(),
-					this->weight_tensors_.at(operation.weight.tensor_index)->getDErrorPointer().get(),
-					this->weight_tensors_.at(operation.weight.tensor_index)->getHSharedWeightsPointer().get(),
-					this->weight_tensors_.at(operation.weight.tensor_index)->getDSharedWeightsPointer().get(),
-					this->layer_tensors_.at(operation.source_layer.tensor_index)->getLayerSize(),
-					this->layer_tensors_.at(operation.sink_layer.tensor_index)->getLayerSize(),
-					this->weight_tensors_.at(operation.weight.tensor_index)->getNSharedWeights(),
-					device);
+				if (combine_shared_weight_errors)
+					model_kernal.executeSharedWeightErrors(
+						this->weight_tensors_.at(operation.weight.tensor_index)->getHErrorPointer().get(),
+						this->weight_tensors_.at(operation.weight.tensor_index)->getDErrorPointer().get(),
+						this->weight_tensors_.at(operation.weight.tensor_index)->getHSharedWeightsPointer().get(),
+						this->weight_tensors_.at(operation.weight.tensor_index)->getDSharedWeightsPointer().get(),
+						this->layer_tensors_.at(operation.source_layer.tensor_index)->getLayerSize(),
+						this->layer_tensors_.at(operation.sink_layer.tensor_index)->getLayerSize(),
+						this->weight_tensors_.at(operation.weight.tensor_index)->getNSharedWeights(),
+						device);
 			}
 		}
 	}
@@ -130,6 +130,55 @@ namespace SmartPeak
       const int& metric_index,
       DeviceT& device,
       bool copyHostToDevice = false,
+      bool copyDeviceToHost = false) = 0;
+    /**
+      @brief Calculate the model error and the node errors over consecutive time steps
+
+      @param[in] expected Expected values of dims batch_size, layer_size, n_time_steps
+      @param[in] time_step_start The first time step (memory index) to evaluate
+      @param[in] n_time_steps The number of time steps to evaluate
+    */
+    virtual bool executeModelErrors(
+      Eigen::Tensor<TensorT, 3>& expected,
+      TensorT* h_node_output,
+      TensorT* d_node_output,
+      TensorT* h_model_error,
+      TensorT* d_model_error,
+      TensorT* h_node_errors,
+      TensorT* d_node_errors,
+      std::shared_ptr<LossFunctionTensorOp<TensorT, DeviceT>>& loss_function,
+      std::shared_ptr<LossFunctionGradTensorOp<TensorT, DeviceT>>& loss_grad_function,
+      const int& batch_size,
+      const int& memory_size,
+      const int& layer_size,
+      const int& time_step_start,
+      const int& n_time_steps,
+      DeviceT& device,
+      bool copyHostToDevice = false,
+      bool copyDeviceToHost = false) = 0;
+    /**
+      @brief Calculate the model metric over consecutive time steps
+
+      @param[in] expected Expected values of dims batch_size, layer_size, n_time_steps
+      @param[in] time_step_start The first time step (memory index) to evaluate
+      @param[in] n_time_steps The number of time steps to evaluate
+    */
+    virtual bool executeModelMetric(
+      Eigen::Tensor<TensorT, 3>& expected,
+      TensorT* h_node_output,
+      TensorT* d_node_output,
+      TensorT* h_model_metric,
+      TensorT* d_model_metric,
+      std::shared_ptr<MetricFunctionTensorOp<TensorT, DeviceT>>& metric_function,
+      const int& batch_size,
+      const int& memory_size,
+      const int& layer_size,
+      const int& n_metrics,
+      const int& time_step_start,
+      const int& n_time_steps,
+      const int& metric_index,
+      DeviceT& device,
+      bool copyHostToDevice = false,
       bool copyDeviceToHost = false) = 0;
 		virtual bool executeWeightErrors(
 			TensorT* h_sink_errors,
@@ -362,6 +411,58 @@ namespace SmartPeak
       // Calculate the model metric
       metric_function->operator()(h_node_output, expected.data(), h_model_metric, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
 
+      return true;
+    };
+    bool executeModelErrors(
+      Eigen::Tensor<TensorT, 3>& expected,
+      TensorT* h_node_outputs,
+      TensorT* d_node_outputs,
+      TensorT* h_model_error,
+      TensorT* d_model_error,
+      TensorT* h_node_errors,
+      TensorT* d_node_errors,
+      std::shared_ptr<LossFunctionTensorOp<TensorT, Eigen::DefaultDevice>>& loss_function,
+      std::shared_ptr<LossFunctionGradTensorOp<TensorT, Eigen::DefaultDevice>>& loss_grad_function,
+      const int& batch_size,
+      const int& memory_size,
+      const int& layer_size,
+      const int& time_step_start,
+      const int& n_time_steps,
+      Eigen::DefaultDevice& device,
+      bool copyHostToDevice = false,
+      bool copyDeviceToHost = false) override {
+      assert(expected.size() == batch_size * layer_size * n_time_steps);
+
+      // Calculate the model error
+      loss_function->evaluateSequence(h_node_outputs, expected.data(), h_model_error, batch_size, memory_size, layer_size, time_step_start, n_time_steps, device);
+
+      // Calculate the node errors
+      loss_grad_function->evaluateSequence(h_node_outputs, expected.data(), h_node_errors, batch_size, memory_size, layer_size, time_step_start, n_time_steps, device);
+
+      return true;
+    };
+    bool executeModelMetric(
+      Eigen::Tensor<TensorT, 3>& expected,
+      TensorT* h_node_output,
+      TensorT* d_node_output,
+      TensorT* h_model_metric,
+      TensorT* d_model_metric,
+      std::shared_ptr<MetricFunctionTensorOp<TensorT, Eigen::DefaultDevice>>& metric_function,
+      const int& batch_size,
+      const int& memory_size,
+      const int& layer_size,
+      const int& n_metrics,
+      const int& time_step_start,
+      const int& n_time_steps,
+      const int& metric_index,
+      Eigen::DefaultDevice& device,
+      bool copyHostToDevice = false,
+      bool copyDeviceToHost = false) override {
+      assert(expected.size() == batch_size * layer_size * n_time_steps);
+
+      // Calculate the model metric
+      metric_function->evaluateSequence(h_node_output, expected.data(), h_model_metric, batch_size, memory_size, layer_size, n_metrics, time_step_start, n_time_steps, metric_index, device);
+
       return true;
     };
 		bool executeWeightErrors(
@@ -272,6 +272,102 @@ namespace SmartPeak
       //assert(cudaFreeHost(h_expected) == cudaSuccess); // still owned by expected
       assert(cudaFree(d_expected) == cudaSuccess);
 
+      return true;
+    };
+    bool executeModelErrors(
+      Eigen::Tensor<TensorT, 3>& expected,
+      TensorT* h_node_outputs,
+      TensorT* d_node_outputs,
+      TensorT* h_model_error,
+      TensorT* d_model_error,
+      TensorT* h_node_errors,
+      TensorT* d_node_errors,
+      std::shared_ptr<LossFunctionTensorOp<TensorT, Eigen::GpuDevice>>& loss_function,
+      std::shared_ptr<LossFunctionGradTensorOp<TensorT, Eigen::GpuDevice>>& loss_grad_function,
+      const int& batch_size,
+      const int& memory_size,
+      const int& layer_size,
+      const int& time_step_start,
+      const int& n_time_steps,
+      Eigen::GpuDevice& device,
+      bool copyHostToDevice = false,
+      bool copyDeviceToHost = false) override {
+      // Allocate memory for the expected values of all time steps
+      assert(expected.size() == batch_size * layer_size * n_time_steps);
+      const size_t expected_bytes = batch_size * layer_size * n_time_steps * sizeof(TensorT);
+      TensorT* d_expected;
+      assert(cudaMalloc((void**)(&d_expected), expected_bytes) == cudaSuccess);
+
+      // Copy host to device
+      std::size_t bytes = batch_size * memory_size * layer_size * sizeof(TensorT);
+      std::size_t model_bytes = batch_size * memory_size * sizeof(TensorT);
+      device.memcpyHostToDevice(d_expected, expected.data(), expected_bytes);
+      if (copyHostToDevice) {
+        device.memcpyHostToDevice(d_node_outputs, h_node_outputs, bytes); // only when testing
+        device.memcpyHostToDevice(d_node_errors, h_node_errors, bytes); // only once
+        device.memcpyHostToDevice(d_model_error, h_model_error, model_bytes); // only once
+      }
+
+      // Calculate the model error
+      loss_function->evaluateSequence(d_node_outputs, d_expected, d_model_error, batch_size, memory_size, layer_size, time_step_start, n_time_steps, device);
+
+      // Calculate the node errors
+      loss_grad_function->evaluateSequence(d_node_outputs, d_expected, d_node_errors, batch_size, memory_size, layer_size, time_step_start, n_time_steps, device);
+
+      // Copy device to host
+      if (copyDeviceToHost) {
+        device.memcpyDeviceToHost(h_node_errors, d_node_errors, bytes); // only once
+        device.memcpyDeviceToHost(h_model_error, d_model_error, model_bytes); // only once
+      }
+
+      // Deallocate the memory
+      assert(cudaFree(d_expected) == cudaSuccess);
+
+      return true;
+    };
+    bool executeModelMetric(
+      Eigen::Tensor<TensorT, 3>& expected,
+      TensorT* h_node_output,
+      TensorT* d_node_output,
+      TensorT* h_model_metric,
+      TensorT* d_model_metric,
+      std::shared_ptr<MetricFunctionTensorOp<TensorT, Eigen::GpuDevice>>& metric_function,
+      const int& batch_size,
+      const int& memory_size,
+      const int& layer_size,
+      const int& n_metrics,
+      const int& time_step_start,
+      const int& n_time_steps,
+      const int& metric_index,
+      Eigen::GpuDevice& device,
+      bool copyHostToDevice = false,
+      bool copyDeviceToHost = false) override {
+      // Allocate memory for the expected values of all time steps
+      assert(expected.size() == batch_size * layer_size * n_time_steps);
+      const size_t expected_bytes = batch_size * layer_size * n_time_steps * sizeof(TensorT);
+      TensorT* d_expected;
+      assert(cudaMalloc((void**)(&d_expected), expected_bytes) == cudaSuccess);
+
+      // Copy host to device
+      std::size_t bytes = batch_size * memory_size * layer_size * sizeof(TensorT);
+      std::size_t model_bytes = n_metrics * memory_size * sizeof(TensorT);
+      device.memcpyHostToDevice(d_expected, expected.data(), expected_bytes);
+      if (copyHostToDevice) {
+        device.memcpyHostToDevice(d_node_output, h_node_output, bytes); // only when testing
+        device.memcpyHostToDevice(d_model_metric, h_model_metric, model_bytes); // only once
+      }
+
+      // Calculate the model metric
+      metric_function->evaluateSequence(d_node_output, d_expected, d_model_metric, batch_size, memory_size, layer_size, n_metrics, time_step_start, n_time_steps, metric_index, device);
+
+      // Copy device to host
+      if (copyDeviceToHost) {
+        device.memcpyDeviceToHost(h_model_metric, d_model_metric, model_bytes); // only once
+      }
+
+      // Deallocate the memory
+      assert(cudaFree(d_expected) == cudaSuccess);
+
       return true;
     };
 		bool executeWeightErrors(
@@ -7,6 +7,7 @@
 #include <SmartPeak/ml/Model.h>
 #include <vector>
 #include <string>
+#include <set>
 
 // .cpp
 #include <SmartPeak/core/Preprocessing.h>
@@ -153,6 +154,31 @@ public:
       const std::vector<NodeType>& sink_node_type_exclude,
       const std::vector<NodeType>& sink_node_type_include);
 
+		/**
+			@brief Whether the integration of a node recovers the routing of a fused layer from the weights of its input links
+				(see `ModelBuilder::addLSTMFused`, `addGRUFused`, `addMultiHeadAttentionFused`, and `addSoftMaxFused`)
+
+			The input links of such a node are fixed routing links whose weights encode the role of each link.
+
+			@param[in] node The node
+
+			@returns True if the node is the sink of fused routing links
+		*/
+		static bool isFusedRoutingNode(const Node<TensorT>& node);
+
+		/**
+			@brief Select the nodes that are linked by the fixed routing links of the fused layers
+				(i.e., the fused routing nodes and the source nodes of their input links)
+
+			The random modifications do not select these nodes nor the routing links
+				so that the routing of the fused layers is not corrupted.
+
+			@param[in] model The model
+
+			@returns The node names
+		*/
+		std::set<std::string> selectFusedRoutingNodes(const Model<TensorT>& model);
+
 		/**
 		@brief Select random module given a set of conditions
 
@@ -638,8 +664,9 @@ private:
 	{
 		// populate our list of nodes to select from
 		std::vector<std::string> node_ids;
-		for (const Node<TensorT>& node : model.getNodes())
+		for (const auto& node_map : model.nodes_)
 		{
+			const Node<TensorT>& node = *node_map.second;
 			// check the exclusion list
 			bool exclude_node = false;
 			for (const NodeType& node_type : node_type_exclude)
@@ -678,8 +705,9 @@ private:
 	{
 		// populate our list of modules to select from
 		std::set<std::string> module_name_set;
-		for (const Node<TensorT>& node : model.getNodes())
+		for (const auto& node_map : model.nodes_)
 		{
+			const Node<TensorT>& node = *node_map.second;
 			// check the exclusion list
 			bool exclude_node = false;
 			for (const NodeType& node_type : node_type_exclude)
@@ -734,6 +762,12 @@ private:
 	{
 		std::vector<std::string> node_ids = selectNodes(model, node_type_exclude, node_type_include);
 
+		// exclude the nodes of the fused layers
+		const std::set<std::string> fused_routing_nodes = selectFusedRoutingNodes(model);
+		if (fused_routing_nodes.size() > 0)
+			node_ids.erase(std::remove_if(node_ids.begin(), node_ids.end(), [&fused_routing_nodes](const std::string& node_id) {
+				return fused_routing_nodes.count(node_id) != 0; }), node_ids.end());
+
 		if (node_ids.size() > 0)
 			return selectRandomElement<std::string>(node_ids);
 		else
@@ -766,12 +800,16 @@ private:
 		}
 
 		// find all links that have an existing connection with the source and sink node candidates
+		// (excluding the routing links of the fused layers)
+		const std::set<std::string> source_node_set(source_node_ids.begin(), source_node_ids.end());
+		const std::set<std::string> sink_node_set(sink_node_ids.begin(), sink_node_ids.end());
 		std::vector<std::string> link_ids;
-		for (const Link& link : model.getLinks())
+		for (const auto& link_map : model.links_)
 		{
-			if (std::count(source_node_ids.begin(), source_node_ids.end(), link.getSourceNodeName()) != 0)
-				if (std::count(sink_node_ids.begin(), sink_node_ids.end(), link.getSinkNodeName()) != 0)
-					link_ids.push_back(link.getName());
+			if (source_node_set.count(link_map.second->getSourceNodeName()) != 0)
+				if (sink_node_set.count(link_map.second->getSinkNodeName()) != 0)
+					if (!isFusedRoutingNode(*model.nodes_.at(link_map.second->getSinkNodeName())))
+						link_ids.push_back(link_map.first);
 		}
 
 		if (link_ids.size() > 0)
@@ -783,6 +821,28 @@ private:
 		}
 	}
 
+	template<typename TensorT>
+	inline bool ModelReplicator<TensorT>::isFusedRoutingNode(const Node<TensorT>& node)
+	{
+		const std::string integration_name = node.getIntegration()->getName();
+		return integration_name == "LSTMCellOp" || integration_name == "LSTMOutputOp" || integration_name == "GRUCellOp" ||
+			integration_name == "DotProdAttentionOp" || integration_name == "SoftMaxOp" || integration_name == "LogSoftMaxOp";
+	}
+
+	template<typename TensorT>
+	inline std::set<std::string> ModelReplicator<TensorT>::selectFusedRoutingNodes(const Model<TensorT>& model)
+	{
+		std::set<std::string> node_names;
+		for (const auto& link_map : model.links_) {
+			auto sink_node = model.nodes_.find(link_map.second->getSinkNodeName());
+			if (sink_node != model.nodes_.end() && isFusedRoutingNode(*sink_node->second)) {
+				node_names.insert(link_map.second->getSourceNodeName());
+				node_names.insert(link_map.second->getSinkNodeName());
+			}
+		}
+		return node_names;
+	}
+
 	template<typename TensorT>
 	inline void ModelReplicator<TensorT>::addNodeRight(Model<TensorT>& model, std::string unique_str, bool as_copy)
 	{
@@ -812,20 +872,17 @@ private:
 
 		std::vector<std::string> input_link_names, output_link_names;
 		std::vector<std::string> bias_link_names;
-		for (const Link& link : model.getLinks())
+		for (const auto& link_map : model.links_)
 		{
-			// find the random_nodes bias
-			if (link.getSinkNodeName() == random_node_name &&
-				model.getNode(link.getSourceNodeName()).getType() == NodeType::bias){
-				bias_link_names.push_back(link.getName());
-			}
-			if (link.getSinkNodeName() == random_node_name &&
-				model.getNode(link.getSourceNodeName()).getType() != NodeType::bias) {
-				input_link_names.push_back(link.getName());
-			}
-			if (link.getSourceNodeName() == random_node_name) {
-				output_link_names.push_back(link.getName());
+			if (link_map.second->getSinkNodeName() == random_node_name) {
+				// find the random_nodes bias
+				if (model.nodes_.at(link_map.second->getSourceNodeName())->getType() == NodeType::bias)
+					bias_link_names.push_back(link_map.first);
+				else
+					input_link_names.push_back(link_map.first);
 			}
+			if (link_map.second->getSourceNodeName() == random_node_name)
+				output_link_names.push_back(link_map.first);
 		}
 		if (input_link_names.size() == 0)
 		{
@@ -954,17 +1011,15 @@ private:
 
     // remove candidate sink nodes for which a link already exists
     // [TODO: add test coverage]
+    std::set<std::string> linked_sink_nodes;
+    for (const auto& link_map : model.links_) {
+      if (link_map.second->getSourceNodeName() == source_node_name)
+        linked_sink_nodes.insert(link_map.second->getSinkNodeName());
+    }
+    // and the fused routing nodes whose input links are fixed
     std::vector<std::string> sink_node_ids_noDuplicates;
-    for (std::string sink_node : sink_node_ids) {
-      bool new_link = true;
-      for (const auto& link_map : model.links_) {
-        if (link_map.second->getSourceNodeName() == source_node_name &&
-          link_map.second->getSinkNodeName() == sink_node) {
-          new_link = false;
-          break;
-        }
-      }
-      if (new_link) {
+    for (const std::string& sink_node : sink_node_ids) {
+      if (linked_sink_nodes.count(sink_node) == 0 && !isFusedRoutingNode(*model.nodes_.at(sink_node))) {
         sink_node_ids_noDuplicates.push_back(sink_node);
       }
     }
@@ -1201,16 +1256,13 @@ private:
 		// select a random input link
 		// [OPTIMIZATION: refactor to pass back the Link and not just the name]
 		std::vector<std::string> input_link_names, bias_link_names;
-		for (const Link& link : model.getLinks())
+		for (const auto& link_map : model.links_)
 		{
-			if (link.getSinkNodeName() == random_node_name &&
-				model.getNode(link.getSourceNodeName()).getType() != NodeType::bias){
-				input_link_names.push_back(link.getName());
-			}
-			if (link.getSinkNodeName() == random_node_name &&
-				model.getNode(link.getSourceNodeName()).getType() == NodeType::bias) {
-				bias_link_names.push_back(link.getName());
-			}
+			if (link_map.second->getSinkNodeName() != random_node_name) continue;
+			if (model.nodes_.at(link_map.second->getSourceNodeName())->getType() != NodeType::bias)
+				input_link_names.push_back(link_map.first);
+			else
+				bias_link_names.push_back(link_map.first);
 		}
 		if (input_link_names.size() == 0)
 		{
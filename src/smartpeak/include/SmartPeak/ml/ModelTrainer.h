@@ -8,6 +8,7 @@
 #include <SmartPeak/ml/LossFunction.h>
 #include <SmartPeak/ml/MetricFunction.h>
 #include <SmartPeak/ml/ModelLogger.h>
+#include <SmartPeak/ml/EvaluationAccumulator.h>
 #include <SmartPeak/simulator/DataSimulator.h>
 #include <vector>
 #include <string>
@@ -32,6 +33,17 @@ namespace SmartPeak
     std::vector<std::string> metric_names_; ///< corresponding metric function names given for each metric function
   };
 
+  /**
+    @brief The back propogation through time algorithm used for training
+
+    - TBPTT: (truncated) back propogation through time where the layer tensors hold the complete sequence
+    - CheckpointedBPTT: back propogation through time where the layer tensors only hold a window of the sequence
+      and the windows are re-computed from checkpoints (see `ModelInterpreter::checkpointedBPTT`)
+    - WindowedTBPTT: online learning where the layer tensors only hold a window of the sequence
+      and the gradient is truncated to the window (see `ModelInterpreter::windowedTBPTT`)
+  */
+  enum class BPTTMode { TBPTT, CheckpointedBPTT, WindowedTBPTT };
+
   /**
     @brief Class to train a network model
   */
@@ -59,6 +71,10 @@ public:
     void setInterpretModel(const bool& interpret_model) { interpret_model_ = interpret_model; }; ///< interpret_model setter [TODO: test]
     void setResetModel(const bool& reset_model) { reset_model_ = reset_model; }; ///< reset_model setter [TODO: test]
     void setResetInterpreter(const bool& reset_interpreter) { reset_interpreter_ = reset_interpreter; }; ///< reset_interpreter setter [TODO: test]
+    void setEvaluationAccumulators(const std::vector<std::shared_ptr<EvaluationAccumulator<TensorT>>>& evaluation_accumulators) { evaluation_accumulators_ = evaluation_accumulators; }; ///< evaluation_accumulators setter
+    void setStreamEvaluation(const bool& stream_evaluation) { stream_evaluation_ = stream_evaluation; }; ///< stream_evaluation setter
+    void setBPTTMode(const BPTTMode& bptt_mode) { bptt_mode_ = bptt_mode; }; ///< bptt_mode setter
+    void setNWindowSteps(const int& n_window_steps) { n_window_steps_ = n_window_steps; }; ///< n_window_steps setter
 
     int getBatchSize() const { return batch_size_; }; ///< batch_size setter
     int getMemorySize() const { return memory_size_; }; ///< memory_size setter
@@ -79,6 +95,10 @@ public:
     bool getInterpretModel() { return interpret_model_; }; ///< find_cycles getter [TODO: tests]
     bool getResetModel() { return reset_model_; }; ///< fast_interpreter getter [TODO: tests]
     bool getResetInterpreter() { return reset_interpreter_; }; ///< preserve_OoO getter [TODO: tests]
+    std::vector<std::shared_ptr<EvaluationAccumulator<TensorT>>> getEvaluationAccumulators() const { return evaluation_accumulators_; }; ///< evaluation_accumulators getter
+    bool getStreamEvaluation() const { return stream_evaluation_; }; ///< stream_evaluation getter
+    BPTTMode getBPTTMode() const { return bptt_mode_; }; ///< bptt_mode getter
+    int getNWindowSteps() const { return n_window_steps_; }; ///< n_window_steps getter
 
     std::vector<std::string> getLossOutputNodesLinearized() const; ///< Return a linearized vector of all loss output nodes
     std::vector<std::string> getMetricOutputNodesLinearized() const; ///< Return a linearized vector of all metric output nodes
@@ -153,6 +173,9 @@ public:
       @brief Entry point for users to code their script
         for model training
 
+      When the BPTT mode is checkpointed BPTT or windowed TBPTT (see `BPTTMode`), the model interpreter
+        only holds `n_window_steps` time steps of the memory_size time steps of the sequence
+
       @param[in, out] model The model to train
       @param[in] input Input data tensor of dimensions: batch_size, memory_size, input_nodes, n_epochs
       @param[in] output Expected output data tensor of dimensions: batch_size, memory_size, output_nodes, n_epochs
@@ -251,6 +274,7 @@ public:
 			@param[in] input_nodes Input node names
 
 			@returns Tensor of dims batch_size, memory_size, output_nodes, n_epochs (similar to input)
+        or n_epochs = 0 when streaming the evaluation to the evaluation accumulators (see `setStreamEvaluation`)
 		*/
 		virtual Eigen::Tensor<TensorT, 4> evaluateModel(Model<TensorT>& model,
 			const Eigen::Tensor<TensorT, 4>& input,
@@ -275,6 +299,7 @@ public:
       @param[in] input_nodes Input node names
 
       @returns Tensor of dims batch_size, memory_size, output_nodes, n_epochs (similar to input)
+        or n_epochs = 0 when streaming the evaluation to the evaluation accumulators (see `setStreamEvaluation`)
     */
     virtual Eigen::Tensor<TensorT, 4> evaluateModel(Model<TensorT>& model,
       DataSimulator<TensorT> &data_simulator,
@@ -429,11 +454,39 @@ public:
       const TensorT& min_perc_error_diff);
 
 protected:
-    void ApplyModelLosses_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& output, InterpreterT& model_interpreter); ///< Apply the loss functions to each of the model output nodes
+    void ApplyModelLosses_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& output, InterpreterT& model_interpreter, const int& n_time_steps = -1); ///< Apply the loss functions to each of the model output nodes (over at most n_time_steps if n_time_steps >= 0)
     void ApplyModelMetrics_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& output, InterpreterT& model_interpreter); ///< Apply the metric functions to each of the model output nodes
 
+    /**
+      @brief The memory size of the model interpreter, which is the memory size for TBPTT
+        and the number of window steps (if specified) for checkpointed BPTT and windowed TBPTT
+    */
+    int getInterpreterMemorySize_() const;
+
+    /// Slice out a window of n_window_steps time steps from a sequence starting at time_step_start that is padded with zeros
+    Eigen::Tensor<TensorT, 3> getSequenceWindow_(const Eigen::Tensor<TensorT, 3>& values, const int& time_step_start, const int& n_window_steps) const;
+
+    /**
+      @brief Forward propogate, calculate the model errors of, and back propogate a sequence in windows
+        using checkpointed BPTT or windowed TBPTT (see `BPTTMode`)
+
+      @param[in] model The network model
+      @param[in] input Input values of the sequence (dim0: batch_size, dim1: memory_size, dim2: input nodes)
+      @param[in] output Expected values of the sequence (dim0: batch_size, dim1: memory_size, dim2: loss output nodes)
+      @param[in] input_nodes Input nodes
+      @param[in] model_interpreter The model interpreter
+      @param[out] expected_window The expected values of the window that is held by the model interpreter (e.g., for logging)
+
+      @returns The total model error of the sequence
+    */
+    TensorT backPropogateWindows_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& input, const Eigen::Tensor<TensorT, 3>& output, const std::vector<std::string>& input_nodes,
+      InterpreterT& model_interpreter, Eigen::Tensor<TensorT, 3>& expected_window);
+
+    void accumulateEvaluationOutput_(const int& epoch, Model<TensorT>& model, const std::vector<std::string>& output_nodes, const Eigen::Tensor<TensorT, 1>& total_metrics, Eigen::Tensor<TensorT, 4>& model_output); ///< Pass the model output of an evaluation epoch to the evaluation accumulators and store it unless streaming
+
     std::vector<LossFunctionHelper<TensorT>> loss_function_helpers_;
     std::vector<MetricFunctionHelper<TensorT>> metric_function_helpers_;
+    std::vector<std::shared_ptr<EvaluationAccumulator<TensorT>>> evaluation_accumulators_; ///< reductions of the evaluation epochs (see `EvaluationAccumulator`)
 
 private:
     int batch_size_ = 1;
@@ -452,6 +505,9 @@ private:
     bool interpret_model_ = true; ///< whether to interpret the model and allocate associated Tensor memory for the model interpreter
     bool reset_model_ = true; ///< whether to reset the model at the end of training
     bool reset_interpreter_ = true; ///< whether to reset the model interpreter at the end of training
+    bool stream_evaluation_ = false; ///< whether to only pass the evaluation outputs to the evaluation accumulators instead of returning the outputs of all epochs
+    BPTTMode bptt_mode_ = BPTTMode::TBPTT; ///< the back propogation through time algorithm used for training
+    int n_window_steps_ = -1; ///< the number of time steps held by the model interpreter for checkpointed BPTT and windowed TBPTT (or the memory size if < 0)
 
 		bool find_cycles_ = true; ///< whether to find cycles prior to interpreting the model (see `ModelInterpreter`)
 		bool fast_interpreter_ = false; ///< whether to skip certain checks when interpreting the model (see `ModelInterpreter`)
@@ -674,9 +730,9 @@ private:
     if (this->getInterpretModel()) {
       if (this->getVerbosityLevel() >= 2)
         std::cout << "Interpreting the model..." << std::endl;
-      model_interpreter.checkMemory(model, this->getBatchSize(), this->getMemorySize());
-      model_interpreter.getForwardPropogationOperations(model, this->getBatchSize(), this->getMemorySize(), true, this->getFastInterpreter(), this->getFindCycles(), this->getPreserveOoO());
-      model_interpreter.allocateModelErrorTensor(this->getBatchSize(), this->getMemorySize(), this->getNMetricFunctions());
+      model_interpreter.checkMemory(model, this->getBatchSize(), this->getInterpreterMemorySize_());
+      model_interpreter.getForwardPropogationOperations(model, this->getBatchSize(), this->getInterpreterMemorySize_(), true, this->getFastInterpreter(), this->getFindCycles(), this->getPreserveOoO());
+      model_interpreter.allocateModelErrorTensor(this->getBatchSize(), this->getInterpreterMemorySize_(), this->getNMetricFunctions());
     }
 
 		for (int iter = 0; iter < this->getNEpochsTraining(); ++iter) // use n_epochs here
@@ -684,6 +740,36 @@ private:
 			// update the model hyperparameters
 			this->adaptiveTrainerScheduler(0, iter, model, model_interpreter, model_error);
 
+			// forward propogate, calculate the model error, and back propogate the sequence in windows
+			if (this->getBPTTMode() != BPTTMode::TBPTT) {
+				if (this->getVerbosityLevel() >= 2)
+					std::cout << "Windowed Foward and Back Propogation..." << std::endl;
+				Eigen::Tensor<TensorT, 3> expected_window;
+				const TensorT total_error = this->backPropogateWindows_(model, input.chip(iter, 3), output.chip(iter, 3), input_nodes, model_interpreter, expected_window);
+
+				// update the weights
+				if (this->getVerbosityLevel() >= 2)
+					std::cout << "Weight Update..." << std::endl;
+				model_interpreter.executeWeightUpdateOperations(iter);
+				model_error.push_back(total_error);
+				if (this->getVerbosityLevel() >= 1)
+					std::cout << "Model " << model.getName() << " error: " << total_error << std::endl;
+
+				// log epoch
+				if (this->getLogTraining()) {
+					if (this->getVerbosityLevel() >= 2)
+						std::cout << "Logging..." << std::endl;
+					this->trainingModelLogger(iter, model, model_interpreter, model_logger, expected_window, output_nodes, input_nodes, total_error);
+				}
+
+				// reinitialize the model
+				if (iter != this->getNEpochsTraining() - 1) {
+					model_interpreter.reInitNodes();
+					model_interpreter.reInitModelError();
+				}
+				continue;
+			}
+
 			// assign the input data
 			model_interpreter.initBiases(model); // create the bias	
       model_interpreter.mapValuesToLayers(model, input.chip(iter, 3), input_nodes, "output"); // Needed for OoO/IG with DAG and DCG
@@ -784,6 +870,9 @@ private:
       return std::make_pair(model_error_training, model_error_validation);
     }
 
+    if (this->getBPTTMode() != BPTTMode::TBPTT)
+      std::cout << "Checkpointed BPTT and windowed TBPTT are only available when training from input and output tensors.  TBPTT will be used instead." << std::endl;
+
     // Initialize the model
     if (this->getVerbosityLevel() >= 2)
       std::cout << "Intializing the model..." << std::endl;
@@ -1192,7 +1281,7 @@ private:
 		InterpreterT& model_interpreter)
 	{
     std::vector<std::string> output_nodes = this->getLossOutputNodesLinearized();
-    Eigen::Tensor<TensorT, 4> model_output(this->getBatchSize(), this->getMemorySize(), (int)output_nodes.size(), this->getNEpochsEvaluation()); // for each epoch, for each output node, batch_size x memory_size
+    Eigen::Tensor<TensorT, 4> model_output(this->getBatchSize(), this->getMemorySize(), (int)output_nodes.size(), (this->getStreamEvaluation()) ? 0 : this->getNEpochsEvaluation()); // for each epoch, for each output node, batch_size x memory_size
 
 		// Check input data
 		if (!this->checkInputData(this->getNEpochsEvaluation(), input, this->getBatchSize(), this->getMemorySize(), input_nodes))
@@ -1224,6 +1313,10 @@ private:
       model_interpreter.getForwardPropogationOperations(model, this->getBatchSize(), this->getMemorySize(), true, this->getFastInterpreter(), this->getFindCycles(), this->getPreserveOoO());
     }
 
+		// reset the evaluation accumulators
+		for (auto& evaluation_accumulator : this->evaluation_accumulators_)
+			evaluation_accumulator->initAccumulator(this->getBatchSize(), this->getMemorySize(), output_nodes, std::vector<std::string>());
+
 		for (int iter = 0; iter < this->getNEpochsEvaluation(); ++iter) // use n_epochs here
 		{
 			// assign the input data
@@ -1238,16 +1331,7 @@ private:
 
 			// extract out the model output
       model_interpreter.getModelResults(model, true, false, false, false);
-			std::vector<Eigen::Tensor<TensorT, 2>> output;
-      int node_iter = 0;
-			for (const std::string& output_node : output_nodes) {
-        for (int batch_iter = 0; batch_iter < this->getBatchSize(); ++batch_iter) {
-          for (int memory_iter = 0; memory_iter < this->getMemorySize(); ++memory_iter) {
-            model_output(batch_iter, memory_iter, node_iter, iter) = model.getNodesMap().at(output_node)->getOutput()(batch_iter, memory_iter);
-          }
-        }
-        ++node_iter;
-			}
+      this->accumulateEvaluationOutput_(iter, model, output_nodes, Eigen::Tensor<TensorT, 1>(0), model_output);
 
 			// log epoch
 			if (this->getLogEvaluation()) {
@@ -1261,6 +1345,8 @@ private:
 				model_interpreter.reInitNodes();
 			}
 		}
+		for (auto& evaluation_accumulator : this->evaluation_accumulators_)
+		  evaluation_accumulator->finalizeAccumulator();
 		// copy out results
 		model_interpreter.getModelResults(model, true, true, false, false);
     if (this->getResetInterpreter()) {
@@ -1279,7 +1365,7 @@ private:
   inline Eigen::Tensor<TensorT, 4> ModelTrainer<TensorT, InterpreterT>::evaluateModel(Model<TensorT>& model, DataSimulator<TensorT>& data_simulator, const std::vector<std::string>& input_nodes, ModelLogger<TensorT>& model_logger, InterpreterT & model_interpreter)
   {
     std::vector<std::string> output_nodes = this->getLossOutputNodesLinearized();
-    Eigen::Tensor<TensorT, 4> model_output(this->getBatchSize(), this->getMemorySize(), (int)output_nodes.size(), this->getNEpochsEvaluation()); // for each epoch, for each output node, batch_size x memory_size
+    Eigen::Tensor<TensorT, 4> model_output(this->getBatchSize(), this->getMemorySize(), (int)output_nodes.size(), (this->getStreamEvaluation()) ? 0 : this->getNEpochsEvaluation()); // for each epoch, for each output node, batch_size x memory_size
 
     // Check the loss and metric functions
     if (!this->checkMetricFunctions()) {
@@ -1315,6 +1401,10 @@ private:
       model_interpreter.allocateModelErrorTensor(this->getBatchSize(), this->getMemorySize(), this->getNMetricFunctions());
     }
 
+    // reset the evaluation accumulators
+    for (auto& evaluation_accumulator : this->evaluation_accumulators_)
+      evaluation_accumulator->initAccumulator(this->getBatchSize(), this->getMemorySize(), output_nodes, this->getMetricNamesLinearized());
+
     for (int iter = 0; iter < this->getNEpochsEvaluation(); ++iter) // use n_epochs here
     {
       // Generate the input and output data for evaluation
@@ -1346,15 +1436,7 @@ private:
 
       // extract out the model output
       model_interpreter.getModelResults(model, true, false, false, false);
-      int node_iter = 0;
-      for (const std::string& output_node : output_nodes) {
-        for (int batch_iter = 0; batch_iter < this->getBatchSize(); ++batch_iter) {
-          for (int memory_iter = 0; memory_iter < this->getMemorySize(); ++memory_iter) {
-            model_output(batch_iter, memory_iter, node_iter, iter) = model.getNodesMap().at(output_node)->getOutput()(batch_iter, memory_iter);
-          }
-        }
-        ++node_iter;
-      }
+      this->accumulateEvaluationOutput_(iter, model, output_nodes, total_metrics, model_output);
 
       // log epoch
       if (this->getLogEvaluation()) {
@@ -1368,6 +1450,8 @@ private:
         model_interpreter.reInitNodes();
       }
     }
+    for (auto& evaluation_accumulator : this->evaluation_accumulators_)
+      evaluation_accumulator->finalizeAccumulator();
     // copy out results
     model_interpreter.getModelResults(model, true, true, false, false);
     if (this->getResetInterpreter()) {
@@ -1560,22 +1644,21 @@ private:
       return (TensorT)1;
   }
   template<typename TensorT, typename InterpreterT>
-  inline void ModelTrainer<TensorT, InterpreterT>::ApplyModelLosses_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& output, InterpreterT& model_interpreter)
+  inline void ModelTrainer<TensorT, InterpreterT>::ApplyModelLosses_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& output, InterpreterT& model_interpreter, const int& n_time_steps)
   {
+    int time_steps = (this->getNTETTSteps() < 0) ? this->getMemorySize() : this->getNTETTSteps();
+    if (n_time_steps >= 0)
+      time_steps = std::min(time_steps, n_time_steps);
     int output_node_cnt = 0;
     for (auto& helper : this->loss_function_helpers_) {
       // Slice out the output
       Eigen::array<Eigen::Index, 3> offsets = {0, 0, output_node_cnt};
-      Eigen::array<Eigen::Index, 3> spans = { this->getBatchSize(), this->getMemorySize(), (int)helper.output_nodes_.size() };
+      Eigen::array<Eigen::Index, 3> spans = { this->getBatchSize(), output.dimension(1), (int)helper.output_nodes_.size() };
       Eigen::Tensor<TensorT, 3> expected = output.slice(offsets, spans);
 
       // Calculate the errors
-      for (int loss_iter = 0; loss_iter < helper.loss_functions_.size(); ++loss_iter) {
-        if (this->getNTETTSteps() < 0)
-          model_interpreter.CETT(model, expected, helper.output_nodes_, helper.loss_functions_.at(loss_iter), helper.loss_function_grads_.at(loss_iter), this->getMemorySize());
-        else
-          model_interpreter.CETT(model, expected, helper.output_nodes_, helper.loss_functions_.at(loss_iter), helper.loss_function_grads_.at(loss_iter), this->getNTETTSteps());
-      }
+      for (int loss_iter = 0; loss_iter < helper.loss_functions_.size(); ++loss_iter)
+        model_interpreter.CETT(model, expected, helper.output_nodes_, helper.loss_functions_.at(loss_iter), helper.loss_function_grads_.at(loss_iter), time_steps);
       output_node_cnt += helper.output_nodes_.size();
     }
   }
@@ -1590,16 +1673,64 @@ private:
       Eigen::array<Eigen::Index, 3> spans = { this->getBatchSize(), this->getMemorySize(), (int)helper.output_nodes_.size() };
       Eigen::Tensor<TensorT, 3> expected = output.slice(offsets, spans);
 
-      // Calculate the metrics
-      for (size_t metric_iter = 0; metric_iter < helper.metric_functions_.size(); ++metric_iter) {
-        if (this->getNTETTSteps() < 0)
-          model_interpreter.CMTT(model, expected, helper.output_nodes_, helper.metric_functions_.at(metric_iter), this->getMemorySize(), metric_cnt);
-        else
-          model_interpreter.CMTT(model, expected, helper.output_nodes_, helper.metric_functions_.at(metric_iter), this->getNTETTSteps(), metric_cnt);
-        ++metric_cnt;
-      }
+      // Calculate the metrics (all metrics of the output nodes at once so that the classification metrics share the confusion matrix)
+      if (this->getNTETTSteps() < 0)
+        model_interpreter.CMTT(model, expected, helper.output_nodes_, helper.metric_functions_, this->getMemorySize(), metric_cnt);
+      else
+        model_interpreter.CMTT(model, expected, helper.output_nodes_, helper.metric_functions_, this->getNTETTSteps(), metric_cnt);
+      metric_cnt += helper.metric_functions_.size();
       output_node_cnt += helper.output_nodes_.size();
     }
   }
+  template<typename TensorT, typename InterpreterT>
+  inline int ModelTrainer<TensorT, InterpreterT>::getInterpreterMemorySize_() const
+  {
+    if (this->getBPTTMode() == BPTTMode::TBPTT || this->getNWindowSteps() <= 0)
+      return this->getMemorySize();
+    return std::min(this->getNWindowSteps(), this->getMemorySize());
+  }
+  template<typename TensorT, typename InterpreterT>
+  inline Eigen::Tensor<TensorT, 3> ModelTrainer<TensorT, InterpreterT>::getSequenceWindow_(const Eigen::Tensor<TensorT, 3>& values, const int& time_step_start, const int& n_window_steps) const
+  {
+    Eigen::Tensor<TensorT, 3> values_window((int)values.dimension(0), n_window_steps, (int)values.dimension(2));
+    values_window.setZero();
+    Eigen::array<Eigen::Index, 3> spans = { values.dimension(0), std::min(n_window_steps, (int)values.dimension(1) - time_step_start), values.dimension(2) };
+    values_window.slice(Eigen::array<Eigen::Index, 3>({ 0, 0, 0 }), spans) = values.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), spans);
+    return values_window;
+  }
+  template<typename TensorT, typename InterpreterT>
+  inline TensorT ModelTrainer<TensorT, InterpreterT>::backPropogateWindows_(Model<TensorT>& model, const Eigen::Tensor<TensorT, 3>& input, const Eigen::Tensor<TensorT, 3>& output, const std::vector<std::string>& input_nodes,
+    InterpreterT& model_interpreter, Eigen::Tensor<TensorT, 3>& expected_window)
+  {
+    const int window_size = this->getInterpreterMemorySize_();
+    auto calc_model_errors = [&](const int& time_step_start, const int& n_time_steps) {
+      expected_window = this->getSequenceWindow_(output, time_step_start, window_size);
+      this->ApplyModelLosses_(model, expected_window, model_interpreter, n_time_steps);
+    };
+    if (this->getBPTTMode() == BPTTMode::CheckpointedBPTT)
+      return model_interpreter.checkpointedBPTT(model, input, input_nodes, calc_model_errors);
+    else
+      return model_interpreter.windowedTBPTT(model, input, input_nodes, calc_model_errors);
+  }
+  template<typename TensorT, typename InterpreterT>
+  inline void ModelTrainer<TensorT, InterpreterT>::accumulateEvaluationOutput_(const int& epoch, Model<TensorT>& model, const std::vector<std::string>& output_nodes, const Eigen::Tensor<TensorT, 1>& total_metrics, Eigen::Tensor<TensorT, 4>& model_output)
+  {
+    if (this->getStreamEvaluation() && this->evaluation_accumulators_.empty()) return;
+
+    // extract out the model output of the epoch
+    Eigen::Tensor<TensorT, 3> epoch_output(this->getBatchSize(), this->getMemorySize(), (int)output_nodes.size());
+    Eigen::array<Eigen::Index, 2> offsets = { 0, 0 };
+    Eigen::array<Eigen::Index, 2> spans = { this->getBatchSize(), this->getMemorySize() };
+    int node_iter = 0;
+    for (const std::string& output_node : output_nodes) {
+      epoch_output.chip(node_iter, 2) = model.getNodesMap().at(output_node)->getOutput().slice(offsets, spans);
+      ++node_iter;
+    }
+
+    for (auto& evaluation_accumulator : this->evaluation_accumulators_)
+      evaluation_accumulator->accumulate(epoch, epoch_output, total_metrics);
+    if (!this->getStreamEvaluation())
+      model_output.chip(epoch, 3) = epoch_output;
+  }
 }
-#endif //SMARTPEAK_MODELTRAINER_H
\ No newline at end of file
+#endif //SMARTPEAK_MODELTRAINER_H
@@ -22,14 +22,16 @@ namespace SmartPeak
   {
 public:
     PopulationLogger() = default; ///< Default constructor
-		PopulationLogger(bool log_time_generation, bool log_models_validation_errors_per_generation) : log_time_generation_(log_time_generation), log_models_validation_errors_per_generation_(log_models_validation_errors_per_generation) {};
+		PopulationLogger(bool log_time_generation, bool log_models_validation_errors_per_generation, bool log_throughput = false) : log_time_generation_(log_time_generation), log_models_validation_errors_per_generation_(log_models_validation_errors_per_generation), log_throughput_(log_throughput) {};
     ~PopulationLogger() = default; ///< Default destructor
 
 		bool getLogTimeGeneration() { return log_time_generation_; }
 		bool getLogTrainValErrorsGeneration() { return log_models_validation_errors_per_generation_; }
+		bool getLogThroughput() { return log_throughput_; }
 
 		CSVWriter getLogTimeGenerationCSVWriter() { return log_time_generation_csvwriter_; }
 		CSVWriter getLogTrainValErrorsGenerationCSVWriter() { return log_models_validation_errors_per_generation_csvwriter_; }
+		CSVWriter getLogThroughputCSVWriter() { return log_throughput_csvwriter_; }
 
 		/**
 		@brief Initialize the log files
@@ -68,12 +70,29 @@ public:
 		@returns True for a successfull write operation
 		*/
 		bool logTrainValErrorsPerGeneration(const int& n_generation, const std::vector<std::tuple<int, std::string, TensorT>>& models_validation_errors_per_generation);
+
+		/**
+		@brief Log the number of models evaluated (i.e., trained and validated) vs. time
+
+		@param[in] n_models_evaluated The number of models evaluated so far
+		@param[in] elapsed_seconds The time elapsed since the start of the evolution in seconds
+
+		@returns True for a successfull write operation
+		*/
+		bool logThroughput(const int& n_models_evaluated, const double& elapsed_seconds);
+
+		/**
+		@brief The number of models evaluated per hour
+		*/
+		static double calculateModelsPerHour(const int& n_models_evaluated, const double& elapsed_seconds);
 		
 	private:
 		bool log_time_generation_ = false; ///< log ...
 		CSVWriter log_time_generation_csvwriter_;
 		bool log_models_validation_errors_per_generation_ = false; ///< log 
 		CSVWriter log_models_validation_errors_per_generation_csvwriter_;
+		bool log_throughput_ = false; ///< log the models evaluated per hour
+		CSVWriter log_throughput_csvwriter_;
 
 		// internal variables
 		std::map<std::string, std::vector<std::string>> module_to_node_names_;
@@ -92,6 +111,11 @@ public:
 			CSVWriter csvwriter(filename);
 			log_models_validation_errors_per_generation_csvwriter_ = csvwriter;
 		}
+		if (log_throughput_) {
+			std::string filename = population_name + "_Throughput.csv";
+			CSVWriter csvwriter(filename);
+			log_throughput_csvwriter_ = csvwriter;
+		}
 		return true;
 	}
 
@@ -156,6 +180,31 @@ public:
 		}
 		return true;
 	}
+
+	template<typename TensorT>
+	bool PopulationLogger<TensorT>::logThroughput(const int& n_models_evaluated, const double& elapsed_seconds)
+	{
+		// writer header
+		if (log_throughput_csvwriter_.getLineCount() == 0) {
+			std::vector<std::string> headers = { "models_evaluated", "elapsed_seconds", "models_per_hour" };
+			log_throughput_csvwriter_.writeDataInRow(headers.begin(), headers.end());
+		}
+
+		// write next entry
+		char elapsed[128], models_per_hour[128];
+		sprintf(elapsed, "%0.3f", elapsed_seconds);
+		sprintf(models_per_hour, "%0.3f", calculateModelsPerHour(n_models_evaluated, elapsed_seconds));
+		std::vector<std::string> line = { std::to_string(n_models_evaluated), std::string(elapsed), std::string(models_per_hour) };
+		log_throughput_csvwriter_.writeDataInRow(line.begin(), line.end());
+		return true;
+	}
+
+	template<typename TensorT>
+	double PopulationLogger<TensorT>::calculateModelsPerHour(const int& n_models_evaluated, const double& elapsed_seconds)
+	{
+		if (elapsed_seconds <= 0) return 0;
+		return n_models_evaluated * 3600.0 / elapsed_seconds;
+	}
 }
 
 #endif //SMARTPEAK_POPULATIONLOGGER_H
\ No newline at end of file
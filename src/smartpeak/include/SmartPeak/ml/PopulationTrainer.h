@@ -7,6 +7,7 @@
 #include <SmartPeak/ml/ModelReplicator.h>
 #include <SmartPeak/ml/ModelTrainer.h>
 #include <SmartPeak/ml/PopulationLogger.h>
+#include <SmartPeak/ml/CompiledModelCache.h>
 #include <SmartPeak/simulator/DataSimulator.h>
 
 // .cpp
@@ -22,6 +23,11 @@
 #include <thread>
 #include <future>
 #include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+#include <random>
+#include <limits>
 
 namespace SmartPeak
 {
@@ -58,6 +64,9 @@ public:
     void setResetModelCopyWeights(const bool& reset_model_copy_weights);
     void setResetModelTemplateWeights(const bool& reset_model_template_weights);
     void setPopulationSize(const int& population_size) { population_size_ = population_size; }
+    void setShareCompiledModels(const bool& share_compiled_models) { share_compiled_models_ = share_compiled_models; } ///< share_compiled_models setter
+    void setCopyOnWriteReplicates(const bool& copy_on_write_replicates) { copy_on_write_replicates_ = copy_on_write_replicates; } ///< copy_on_write_replicates setter
+    void setTournamentSize(const int& tournament_size) { tournament_size_ = tournament_size; } ///< tournament_size setter
 
 		int getNTop() const; ///< batch_size setter
 		int getNRandom() const; ///< memory_size setter
@@ -71,6 +80,9 @@ public:
     bool getResetModelCopyWeights() const;
     bool getResetModelTemplateWeights() const;
     int getPopulationSize() { return population_size_; }
+    bool getShareCompiledModels() const { return share_compiled_models_; } ///< share_compiled_models getter
+    bool getCopyOnWriteReplicates() const { return copy_on_write_replicates_; } ///< copy_on_write_replicates getter
+    int getTournamentSize() const { return tournament_size_; } ///< tournament_size getter
 
     /**
       @brief Remove models with non-unique names from the population of models
@@ -102,6 +114,24 @@ public:
       const Eigen::Tensor<TensorT, 4>& output,
       const Eigen::Tensor<TensorT, 3>& time_steps,
       const std::vector<std::string>& input_nodes);
+
+    /**
+      @brief Score all of the models using one thread per model interpreter
+
+      Override to distribute the validation elsewhere (e.g., to worker processes; see `PopulationTrainerDistributed`)
+
+      @param[in, out] models The vector (i.e., population) of models to score
+      @param[out] models_validation_errors The model id, name, and average validation error of each model
+    */
+    virtual void validateModels(
+      std::vector<Model<TensorT>>& models,
+      ModelTrainer<TensorT, InterpreterT>& model_trainer, std::vector<InterpreterT>& model_interpreters,
+      ModelLogger<TensorT>& model_logger,
+      const Eigen::Tensor<TensorT, 4>& input,
+      const Eigen::Tensor<TensorT, 4>& output,
+      const Eigen::Tensor<TensorT, 3>& time_steps,
+      const std::vector<std::string>& input_nodes,
+      std::vector<std::tuple<int, std::string, TensorT>>& models_validation_errors);
  
     /**
       @brief validate all of the models
@@ -143,6 +173,17 @@ public:
     static std::vector<std::tuple<int, std::string, TensorT>> getRandomNModels_(
       std::vector<std::tuple<int, std::string, TensorT>> model_validation_scores,
       const int& n_random);
+
+    /**
+      @brief return the index of the model with the lowest error out of
+        `tournament_size` models that are drawn at random (with replacement)
+
+      @returns the index of the winning model in `model_validation_scores`
+    */
+    static int getTournamentModel_(
+      const std::vector<std::tuple<int, std::string, TensorT>>& model_validation_scores,
+      const int& tournament_size,
+      std::mt19937& generator);
  
     /**
       @brief Replicates the models in the population.  Replicates
@@ -172,13 +213,16 @@ public:
       ModelReplicator<TensorT>& model_replicator,
       const std::string& unique_str,
       const int& models_to_replicate, const int& n_replicates_per_model,
-      const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights);
+      const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights,
+      const bool& copy_on_write);
 
     static std::pair<bool, Model<TensorT>> replicateModel_(
       const Model<TensorT>& model,
       ModelReplicator<TensorT>& model_replicator,
       const std::string& unique_str, const int& cnt,
-      const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights);
+      const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights,
+      const bool& copy_on_write);
+
  
     /**
       @brief Trains each of the models in the population
@@ -271,6 +315,45 @@ public:
 			PopulationLogger<TensorT>& population_logger,
 			const std::vector<std::string>& input_nodes);
 
+		/**
+		@brief Evolve the population asynchronously (i.e., steady-state evolution)
+
+		Instead of synchronizing all models at each generation, each model interpreter is given
+		  its own worker thread that continuously
+		  1. takes a parent from the population by tournament selection (see `setTournamentSize`),
+		  2. replicates and modifies the parent,
+		  3. trains and validates the replicate, and
+		  4. inserts the replicate into the population, removing the model with the highest
+		     validation error once the population exceeds the population size.
+		The seed models are trained and validated first.
+
+		A generation is counted every `population_size` models evaluated (`n_generations * population_size`
+		  models are evaluated in total).  At the end of each generation, the validation errors of the population
+		  are recorded, the replicator scheduler and population logger are called, the models evaluated per hour
+		  are logged (see `PopulationLogger::logThroughput`), and new training data is simulated.
+		The population scheduler is only called once before the evolution starts.
+
+		@param[in, out] models The vector of models to evolve (the seed models on input and the final population on output)
+    @param[in] population_name The name of the population (used for logging)
+		@param[in] model_trainer The trainer to use
+		@param[in] model_interpreters The interpreters to use for model building and training (each interpreter is given its own thread)
+		@param[in] model_replicator The replicator to use
+		@param[in] data_simulator The data simulate/generator to use
+		@param[in] population_logger The population logger to use
+		@param[in] input_nodes Vector of model input nodes
+
+		@returns The validation errors of the population at the end of each generation
+		*/
+		std::vector<std::vector<std::tuple<int, std::string, TensorT>>> evolveModelsAsync(
+			std::vector<Model<TensorT>>& models,
+      const std::string& population_name,
+			ModelTrainer<TensorT, InterpreterT>& model_trainer,  std::vector<InterpreterT>& model_interpreters,
+			ModelReplicator<TensorT>& model_replicator,
+			DataSimulator<TensorT>& data_simulator,
+			ModelLogger<TensorT>& model_logger,
+			PopulationLogger<TensorT>& population_logger,
+			const std::vector<std::string>& input_nodes);
+
 		/**
 		@brief Evaluate the population
 
@@ -319,6 +402,15 @@ public:
       PopulationLogger<TensorT>& population_logger,
       const std::vector<std::tuple<int, std::string, TensorT>>& models_validation_errors_per_generation);
 
+    /**
+      @brief Share a single cache of compiled model schedules between all model interpreters
+        so that models with an unchanged structure are not re-compiled by each interpreter
+        for every training, validation, and evaluation step
+
+      @param[in, out] model_interpreters The interpreters to share the cache between
+    */
+    void shareCompiledModelCache(std::vector<InterpreterT>& model_interpreters);
+
     void updateNEpochsTraining(ModelTrainer<TensorT, InterpreterT>& model_trainer); ///< Update the number of training epochs
     void setNEpochsTraining(const int& n_epochs); ///< n_epochs setter
     int getNEpochsTraining() const; ///< n_epochs setter
@@ -339,6 +431,12 @@ protected:
     bool reset_model_copy_weights_ = false;
     bool reset_model_template_weights_ = false;
 
+    bool copy_on_write_replicates_ = false; ///< Share the links between the replicates and the original models (the nodes and weights are copied once the replicate is complete)
+    int tournament_size_ = 2; ///< The number of models that compete for parenthood in the asynchronous evolution
+
+    // model interpreter settings
+    bool share_compiled_models_ = false;
+
 private:
     bool select_models_ = true; ///< Whether to skip the selection step or not (set internally based on the replication scheme)
     int n_epochs_training_ = -1; ///< The number of epochs to train the models (set internally based on the `ModelInterpreter::n_epochs_training_`)
@@ -493,7 +591,41 @@ private:
 		// score the models
 		std::vector<std::tuple<int, std::string, TensorT>> models_validation_errors;
     models_validation_errors.resize(models.size());
+    validateModels(models, model_trainer, model_interpreters, model_logger, input, output, time_steps, input_nodes, models_validation_errors);
+
+		// sort each model based on their scores in ascending order
+		models_validation_errors = getTopNModels_(
+			models_validation_errors, getNTop()
+		);
+
+		// select a random subset of the top N
+		models_validation_errors = getRandomNModels_(
+			models_validation_errors, getNRandom()
+		);
+
+		std::vector<int> selected_models;
+		for (const std::tuple<int, std::string, TensorT>& model_error : models_validation_errors)
+			selected_models.push_back(std::get<0>(model_error));
 
+		// purge non-selected models
+		if (selected_models.size() != models.size())
+		{
+			models.erase(std::remove_if(models.begin(), models.end(),
+					[=](const Model<TensorT>& model){return std::count(selected_models.begin(), selected_models.end(), model.getId()) == 0;}
+				),models.end());
+		}
+
+		if (models.size() > getNRandom())
+			removeDuplicateModels(models);
+
+		return models_validation_errors;
+	}
+
+  template<typename TensorT, typename InterpreterT>
+  inline void PopulationTrainer<TensorT, InterpreterT>::validateModels(std::vector<Model<TensorT>>& models, ModelTrainer<TensorT, InterpreterT>& model_trainer, std::vector<InterpreterT>& model_interpreters,
+    ModelLogger<TensorT>& model_logger, const Eigen::Tensor<TensorT, 4>& input, const Eigen::Tensor<TensorT, 4>& output, const Eigen::Tensor<TensorT, 3>& time_steps,
+    const std::vector<std::string>& input_nodes, std::vector<std::tuple<int, std::string, TensorT>>& models_validation_errors)
+  {
     // launch the workers asynchronously
     validate_models_iter_ = 0;
     std::vector<std::future<bool>> task_results;
@@ -527,34 +659,7 @@ private:
         printf("Exception: %s", e.what());
       }
     }
-
-		// sort each model based on their scores in ascending order
-		models_validation_errors = getTopNModels_(
-			models_validation_errors, getNTop()
-		);
-
-		// select a random subset of the top N
-		models_validation_errors = getRandomNModels_(
-			models_validation_errors, getNRandom()
-		);
-
-		std::vector<int> selected_models;
-		for (const std::tuple<int, std::string, TensorT>& model_error : models_validation_errors)
-			selected_models.push_back(std::get<0>(model_error));
-
-		// purge non-selected models
-		if (selected_models.size() != models.size())
-		{
-			models.erase(std::remove_if(models.begin(), models.end(),
-					[=](const Model<TensorT>& model){return std::count(selected_models.begin(), selected_models.end(), model.getId()) == 0;}
-				),models.end());
-		}
-
-		if (models.size() > getNRandom())
-			removeDuplicateModels(models);
-
-		return models_validation_errors;
-	}
+  }
 
   template<typename TensorT, typename InterpreterT>
   inline bool PopulationTrainer<TensorT, InterpreterT>::validateModels_(std::vector<Model<TensorT>>& models, ModelTrainer<TensorT, InterpreterT>& model_trainer, InterpreterT& model_interpreter, ModelLogger<TensorT>& model_logger, const Eigen::Tensor<TensorT, 4>& input, const Eigen::Tensor<TensorT, 4>& output, const Eigen::Tensor<TensorT, 3>& time_steps, const std::vector<std::string>& input_nodes, std::vector<std::tuple<int, std::string, TensorT>>& model_validation_errors)
@@ -684,6 +789,26 @@ private:
 		return random_n_models;
 	}
 
+  template<typename TensorT, typename InterpreterT>
+  inline int PopulationTrainer<TensorT, InterpreterT>::getTournamentModel_(
+    const std::vector<std::tuple<int, std::string, TensorT>>& model_validation_scores,
+    const int& tournament_size,
+    std::mt19937& generator)
+  {
+    if (model_validation_scores.size() == 0) {
+      const std::string error = "There are no models to select from.";
+      throw std::runtime_error(error);
+    }
+    std::uniform_int_distribution<int> distribution(0, model_validation_scores.size() - 1);
+    int winner = distribution(generator);
+    for (int i = 1; i < tournament_size; ++i) {
+      const int contender = distribution(generator);
+      if (std::get<2>(model_validation_scores.at(contender)) < std::get<2>(model_validation_scores.at(winner)))
+        winner = contender;
+    }
+    return winner;
+  }
+
 	template<typename TensorT, typename InterpreterT>
 	void PopulationTrainer<TensorT, InterpreterT>::replicateModels(
 		std::vector<Model<TensorT>>& models,
@@ -701,7 +826,7 @@ private:
 		for (int i=0;i<n_threads;++i) {
       // encapsulate in a packaged_task
       std::packaged_task<bool(std::vector<Model<TensorT>>&, ModelReplicator<TensorT>&, const std::string&,
-        const int&, const int&, const bool&, const int&, const bool&, const bool&
+        const int&, const int&, const bool&, const int&, const bool&, const bool&, const bool&
         )> task(PopulationTrainer<TensorT, InterpreterT>::replicateModels_);
 
       // launch the thread
@@ -709,7 +834,8 @@ private:
       std::thread task_thread(std::move(task),
         std::ref(models), std::ref(model_replicator),
         std::ref(unique_str), std::ref(models_to_replicate), std::ref(n_replicates_per_model_),
-        std::ref(remove_isolated_nodes_), std::ref(prune_model_num_), std::ref(check_complete_input_to_output_), std::ref(reset_model_copy_weights_));
+        std::ref(remove_isolated_nodes_), std::ref(prune_model_num_), std::ref(check_complete_input_to_output_), std::ref(reset_model_copy_weights_),
+        std::ref(copy_on_write_replicates_));
       task_thread.detach();
     }
 
@@ -726,14 +852,15 @@ private:
     // reset the template model weights
     if (reset_model_template_weights_)
       for (int i=0;i<models_to_replicate;++i)
-        for (auto& weight_map : models.at(i).getWeightsMap())
+        for (auto& weight_map : models.at(i).getWeightsMap()) {
           weight_map.second->setInitWeight(true);
+        }
 
 		// removeDuplicateModels(models);  // safer to use, but does hurt performance
 	}
 
   template<typename TensorT, typename InterpreterT>
-  inline bool PopulationTrainer<TensorT, InterpreterT>::replicateModels_(std::vector<Model<TensorT>>& models, ModelReplicator<TensorT>& model_replicator, const std::string& unique_str, const int& models_to_replicate, const int& n_replicates_per_model, const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights)
+  inline bool PopulationTrainer<TensorT, InterpreterT>::replicateModels_(std::vector<Model<TensorT>>& models, ModelReplicator<TensorT>& model_replicator, const std::string& unique_str, const int& models_to_replicate, const int& n_replicates_per_model, const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights, const bool& copy_on_write)
   {
     bool status = false;
     while(true) {
@@ -749,7 +876,7 @@ private:
       // make the task
       std::packaged_task<std::pair<bool, Model<TensorT>>// encapsulate in a packaged_task
         (const Model<TensorT>&, ModelReplicator<TensorT>&,
-          const std::string&, const int&, const bool&, const int&, const bool&, const bool&
+          const std::string&, const int&, const bool&, const int&, const bool&, const bool&, const bool&
           )> task(PopulationTrainer<TensorT, InterpreterT>::replicateModel_);
 
       // launch the thread
@@ -757,7 +884,8 @@ private:
       std::thread task_thread(std::move(task),
         std::ref(models.at(model_index)), std::ref(model_replicator),
         std::ref(unique_str), std::ref(replicate_models_iter),
-        std::ref(remove_isolated_nodes), std::ref(prune_model_num), std::ref(check_complete_input_to_output), std::ref(reset_model_copy_weights));
+        std::ref(remove_isolated_nodes), std::ref(prune_model_num), std::ref(check_complete_input_to_output), std::ref(reset_model_copy_weights),
+        std::ref(copy_on_write));
       task_thread.detach();
 
       // retrieve the results
@@ -765,7 +893,7 @@ private:
         std::pair<bool, Model<TensorT>> model_task_result = task_result.get();
         if (model_task_result.first) {
           model_task_result.second.setId(models_id_iter);
-          models.at(models_to_replicate + replicate_models_iter) = model_task_result.second;
+          models.at(models_to_replicate + replicate_models_iter) = std::move(model_task_result.second);
         }
         else {
           std::cout << "All models were broken." << std::endl;
@@ -784,7 +912,8 @@ private:
 		const Model<TensorT>& model,
 		ModelReplicator<TensorT>& model_replicator,
 		const std::string& unique_str, const int& cnt,
-    const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights)
+    const bool& remove_isolated_nodes, const int& prune_model_num, const bool& check_complete_input_to_output, const bool& reset_model_copy_weights,
+    const bool& copy_on_write)
 	{
 		//std::lock_guard<std::mutex> lock(replicateModel_mutex);
 
@@ -806,7 +935,9 @@ private:
     int max_iters = 8; // changed from 32
 		for (int iter = 0; iter < max_iters; ++iter)
 		{
-			Model<TensorT> model_copy(model);
+			Model<TensorT> model_copy;
+			if (copy_on_write) model_copy.copyOnWrite(model);
+			else model_copy = Model<TensorT>(model);
 			model_copy.setName(model_name);
 
 			model_replicator.makeRandomModifications();
@@ -820,13 +951,19 @@ private:
       if (check_complete_input_to_output) complete_model = model_copy.checkCompleteInputToOutput();
 
       if (complete_model) {
+        // the nodes and weights are modified in place by the model interpreter
+        //   (i.e., node tensor indices and statuses, and weight values)
+        //   while the links are read-only after replication and remain shared
+        if (copy_on_write) {
+          model_copy.detachNodes();
+          model_copy.detachWeights();
+        }
+
         // reset the weights
-        if (reset_model_copy_weights) {
-          for (auto& weight_map : model_copy.getWeightsMap()) {
+        if (reset_model_copy_weights)
+          for (auto& weight_map : model_copy.getWeightsMap())
             weight_map.second->setInitWeight(true);
-          }
-        }
-        return std::make_pair(true, model_copy);
+        return std::make_pair(true, std::move(model_copy));
       }
 		}
 		return std::make_pair(false, Model<TensorT>());
@@ -1089,6 +1226,8 @@ private:
 
 		// Population initial conditions
     models_id_iter_ = models.size();
+    if (share_compiled_models_)
+      shareCompiledModelCache(model_interpreters);
 
 		// Initialize the logger
 		if (this->getLogTraining())
@@ -1154,6 +1293,231 @@ private:
 		return models_validation_errors_per_generation;
 	}
 
+	template<typename TensorT, typename InterpreterT>
+	std::vector<std::vector<std::tuple<int, std::string, TensorT>>> PopulationTrainer<TensorT, InterpreterT>::evolveModelsAsync(
+		std::vector<Model<TensorT>>& models,
+    const std::string& population_name,
+		ModelTrainer<TensorT, InterpreterT>& model_trainer,  std::vector<InterpreterT>& model_interpreters,
+		ModelReplicator<TensorT>& model_replicator,
+		DataSimulator<TensorT> &data_simulator,
+		ModelLogger<TensorT>& model_logger,
+		PopulationLogger<TensorT>& population_logger,
+		const std::vector<std::string>& input_nodes)
+	{
+    if (models.size() == 0) {
+      const std::string error = "The population must be seeded with at least one model.";
+      throw std::runtime_error(error);
+    }
+    if (population_size_ <= 0) {
+      const std::string error = "The population size must be greater than 0.";
+      throw std::runtime_error(error);
+    }
+		std::vector<std::vector<std::tuple<int, std::string, TensorT>>> models_validation_errors_per_generation;
+
+    std::vector<std::string> output_nodes = model_trainer.getLossOutputNodesLinearized();
+
+		// generate the input/output data for validation
+		std::cout << "Generating the input/output data for validation..." << std::endl;
+		Eigen::Tensor<TensorT, 4> input_data_validation(model_trainer.getBatchSize(), model_trainer.getMemorySize(), (int)input_nodes.size(), model_trainer.getNEpochsValidation());
+		Eigen::Tensor<TensorT, 4> output_data_validation(model_trainer.getBatchSize(), model_trainer.getMemorySize(), (int)output_nodes.size(), model_trainer.getNEpochsValidation());
+		Eigen::Tensor<TensorT, 3> time_steps_validation(model_trainer.getBatchSize(), model_trainer.getMemorySize(), model_trainer.getNEpochsValidation());
+		data_simulator.simulateValidationData(input_data_validation, output_data_validation, time_steps_validation);
+
+		// Population initial conditions
+    models_id_iter_ = models.size();
+    if (share_compiled_models_)
+      shareCompiledModelCache(model_interpreters);
+		adaptivePopulationScheduler(0, models, models_validation_errors_per_generation);
+    updateNEpochsTraining(model_trainer);
+
+		// Initialize the logger
+		if (this->getLogTraining())
+			population_logger.initLogs(population_name);
+
+    // the training data is replaced at the end of each generation
+    // while the workers that are still training keep the data they started with
+    struct TrainingData {
+      Eigen::Tensor<TensorT, 4> input;
+      Eigen::Tensor<TensorT, 4> output;
+      Eigen::Tensor<TensorT, 3> time_steps;
+    };
+    auto simulateTrainingData = [&]() {
+      std::shared_ptr<TrainingData> training_data = std::make_shared<TrainingData>();
+      training_data->input.resize(model_trainer.getBatchSize(), model_trainer.getMemorySize(), (int)input_nodes.size(), model_trainer.getNEpochsTraining());
+      training_data->output.resize(model_trainer.getBatchSize(), model_trainer.getMemorySize(), (int)output_nodes.size(), model_trainer.getNEpochsTraining());
+      training_data->time_steps.resize(model_trainer.getBatchSize(), model_trainer.getMemorySize(), model_trainer.getNEpochsTraining());
+      data_simulator.simulateTrainingData(training_data->input, training_data->output, training_data->time_steps);
+      return training_data;
+    };
+		std::cout << "Generating the input/output data for training..." << std::endl;
+    std::shared_ptr<TrainingData> training_data_current = simulateTrainingData();
+    std::mutex training_data_mutex; ///< guards `training_data_current` (no other mutex is taken while it is held)
+
+    // the shared population (guarded by the population mutex)
+    std::deque<Model<TensorT>> seed_models(std::make_move_iterator(models.begin()), std::make_move_iterator(models.end()));
+    models.clear();
+    std::vector<std::tuple<int, std::string, TensorT>> models_validation_errors; ///< aligned with `models`
+    std::mutex population_mutex;
+    std::condition_variable population_condition;
+    const int n_evaluations = std::max(getNGenerations() * population_size_, (int)seed_models.size());
+    std::atomic_int n_evaluations_started{ 0 };
+    int n_evaluations_completed = 0;
+    int n_generations_completed = 0; ///< the number of generations whose population has been snapshot (guarded by the population mutex)
+    std::mutex generation_mutex; ///< guards `models_validation_errors_per_generation` (never taken while holding the population mutex)
+    std::condition_variable generation_condition;
+    const auto time_start = std::chrono::steady_clock::now();
+
+    // record the end of a generation
+    // the population is snapshot while the population mutex is held (`population_lock`), which is then released
+    // so that the other workers can continue while the generation is logged and new training data is simulated;
+    // the generations are recorded in the order of their snapshots
+    auto completeGeneration = [&](std::unique_lock<std::mutex>& population_lock) {
+      const int generation = n_generations_completed++;
+      const int n_evaluations_snapshot = n_evaluations_completed;
+      const double elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - time_start).count();
+      std::vector<Model<TensorT>> models_snapshot(models.size());
+      for (int i = 0; i < models.size(); ++i)
+        models_snapshot[i] = models[i]; // the models are not modified once they are in the population
+      const std::vector<std::tuple<int, std::string, TensorT>> models_validation_errors_snapshot = models_validation_errors;
+      population_lock.unlock();
+
+      std::unique_lock<std::mutex> generation_lock(generation_mutex);
+      generation_condition.wait(generation_lock, [&]() { return (int)models_validation_errors_per_generation.size() == generation; });
+      std::cout << "Generation #: " << generation << " (" << n_evaluations_snapshot << " models evaluated, "
+        << PopulationLogger<TensorT>::calculateModelsPerHour(n_evaluations_snapshot, elapsed_seconds) << " models per hour)" << std::endl;
+      models_validation_errors_per_generation.push_back(models_validation_errors_snapshot);
+      {
+        std::lock_guard<std::mutex> lock(replicateModel_mutex);
+        model_replicator.adaptiveReplicatorScheduler(generation, models_snapshot, models_validation_errors_per_generation);
+      }
+      if (this->getLogTraining()) {
+        this->trainingPopulationLogger(generation, models_snapshot, population_logger, models_validation_errors_snapshot);
+        if (population_logger.getLogThroughput())
+          population_logger.logThroughput(n_evaluations_snapshot, elapsed_seconds);
+      }
+      if (n_evaluations_snapshot < n_evaluations) {
+        std::shared_ptr<TrainingData> training_data_next = simulateTrainingData();
+        std::lock_guard<std::mutex> lock(training_data_mutex);
+        training_data_current = training_data_next;
+      }
+      generation_lock.unlock();
+      generation_condition.notify_all();
+    };
+
+    // continuously select, replicate, train, validate, and insert models
+    auto evolveModelsWorker = [&](InterpreterT& model_interpreter) {
+      std::random_device seed;
+      std::mt19937 generator(seed());
+      ModelLogger<TensorT> model_logger_copy = model_logger;
+      while (true) {
+        const int evaluation = n_evaluations_started.fetch_add(1);
+        if (evaluation >= n_evaluations) break;
+
+        // take the next seed model or copy a parent
+        Model<TensorT> model;
+        bool is_seed = false;
+        std::shared_ptr<TrainingData> training_data;
+        {
+          std::unique_lock<std::mutex> lock(population_mutex);
+          if (seed_models.size() > 0) {
+            model = std::move(seed_models.front());
+            seed_models.pop_front();
+            is_seed = true;
+          }
+          else {
+            population_condition.wait(lock, [&]() { return models.size() > 0; });
+            model = models.at(getTournamentModel_(models_validation_errors, tournament_size_, generator));
+          }
+        }
+        {
+          std::lock_guard<std::mutex> lock(training_data_mutex);
+          training_data = training_data_current;
+        }
+
+        // replicate, modify, train, and validate the model
+        // (a model that throws is inserted with the maximum error so that the evaluation is still completed
+        // and the workers that wait for the first model of the population are notified)
+        bool is_valid = true;
+        std::tuple<int, std::string, TensorT> model_validation_error;
+        try {
+          if (!is_seed) {
+            std::pair<bool, Model<TensorT>> replicate_result;
+            {
+              std::lock_guard<std::mutex> lock(replicateModel_mutex);
+              replicate_result = replicateModel_(model, model_replicator, std::to_string(evaluation), evaluation,
+                remove_isolated_nodes_, prune_model_num_, check_complete_input_to_output_, reset_model_copy_weights_, copy_on_write_replicates_);
+            }
+            is_valid = replicate_result.first;
+            if (is_valid) {
+              model = std::move(replicate_result.second);
+              model.setId(models_id_iter_.fetch_add(1));
+            }
+            else {
+              std::cout << "All models were broken." << std::endl;
+            }
+          }
+
+          if (is_valid) {
+            if (model_trainer.getNEpochsTraining() > 0) {
+              trainModel_(model, model_trainer, model_interpreter, model_logger_copy,
+                training_data->input, training_data->output, training_data->time_steps, input_nodes);
+              model_interpreter.clear_cache();
+            }
+            model_validation_error = validateModel_(model, model_trainer, model_interpreter, model_logger_copy,
+              input_data_validation, output_data_validation, time_steps_validation, input_nodes);
+            model_interpreter.clear_cache();
+          }
+        }
+        catch (std::exception& e) {
+          printf("The model %s is broken.\n", model.getName().data());
+          printf("Error: %s.\n", e.what());
+          model_interpreter.clear_cache();
+          is_valid = true;
+          model_validation_error = std::make_tuple(model.getId(), model.getName(), std::numeric_limits<TensorT>::max());
+        }
+
+        // insert the model and remove the worst model
+        std::unique_lock<std::mutex> lock(population_mutex);
+        if (is_valid) {
+          models.push_back(std::move(model));
+          models_validation_errors.push_back(model_validation_error);
+          if (models.size() > population_size_) {
+            const int worst = std::max_element(models_validation_errors.begin(), models_validation_errors.end(),
+              [](const std::tuple<int, std::string, TensorT>& a, const std::tuple<int, std::string, TensorT>& b) { return std::get<2>(a) < std::get<2>(b); }
+            ) - models_validation_errors.begin();
+            models.erase(models.begin() + worst);
+            models_validation_errors.erase(models_validation_errors.begin() + worst);
+          }
+          population_condition.notify_all();
+        }
+        ++n_evaluations_completed;
+        if (n_evaluations_completed % population_size_ == 0 || n_evaluations_completed == n_evaluations)
+          completeGeneration(lock);
+      }
+      return true;
+    };
+
+		// launch the workers asynchronously
+    std::vector<std::future<bool>> task_results;
+    for (size_t i = 0; i < model_interpreters.size(); ++i) {
+      std::packaged_task<bool(InterpreterT&)> task(evolveModelsWorker);
+      task_results.push_back(task.get_future());
+      std::thread task_thread(std::move(task), std::ref(model_interpreters[i]));
+      task_thread.detach();
+    }
+
+    // wait for the workers to finish
+    for (auto& task_result : task_results) {
+      try {
+        const bool result = task_result.get();
+      }
+      catch (std::exception & e) {
+        printf("Exception: %s", e.what());
+      }
+    }
+		return models_validation_errors_per_generation;
+	}
+
 	template<typename TensorT, typename InterpreterT>
 	void PopulationTrainer<TensorT, InterpreterT>::evaluateModels(
 		std::vector<Model<TensorT>>& models,
@@ -1172,6 +1536,8 @@ private:
 
 		// Evaluate the population
 		std::cout << "Evaluating the model..." << std::endl;
+    if (share_compiled_models_)
+      shareCompiledModelCache(model_interpreters);
 		evalModels(models, model_trainer, model_interpreters, model_logger,
 			input_data_evaluation, time_steps_evaluation, input_nodes);
 	}
@@ -1204,6 +1570,23 @@ private:
     return n_epochs_training_;
   }
 
+  template<typename TensorT, typename InterpreterT>
+  inline void PopulationTrainer<TensorT, InterpreterT>::shareCompiledModelCache(std::vector<InterpreterT>& model_interpreters)
+  {
+    // re-use the first cache found in the interpreters
+    std::shared_ptr<CompiledModelCache> compiled_model_cache = nullptr;
+    for (InterpreterT& model_interpreter : model_interpreters) {
+      if (model_interpreter.getCompiledModelCache() != nullptr) {
+        compiled_model_cache = model_interpreter.getCompiledModelCache();
+        break;
+      }
+    }
+    if (compiled_model_cache == nullptr)
+      compiled_model_cache = std::make_shared<CompiledModelCache>(population_size_);
+    for (InterpreterT& model_interpreter : model_interpreters)
+      model_interpreter.setCompiledModelCache(compiled_model_cache);
+  }
+
   template<typename TensorT, typename InterpreterT>
   inline void PopulationTrainer<TensorT, InterpreterT>::updateNEpochsTraining(ModelTrainer<TensorT, InterpreterT>& model_trainer)
   {
@@ -0,0 +1,286 @@
+/**TODO:  Add copyright*/
+
+#ifndef SMARTPEAK_POPULATIONTRAINERDISTRIBUTED_H
+#define SMARTPEAK_POPULATIONTRAINERDISTRIBUTED_H
+
+// .h
+#include <SmartPeak/ml/PopulationTrainer.h>
+#include <SmartPeak/io/MessageTransport.h>
+
+// .cpp
+#include <SmartPeak/io/ModelFile.h>
+#include <deque>
+#include <sstream>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+
+namespace SmartPeak
+{
+  /**
+    @brief Population trainer that distributes only the validation of the models to worker processes
+
+    The coordinator runs the population trainer as usual (i.e., `evolveModels`, `selectModels`, and `replicateModels`),
+      but `validateModels` serializes each model (see `ModelFile::storeModelBinary`) and dispatches it to the next idle worker
+      over a pluggable `MessageTransport` (e.g., Unix sockets between processes or local queues between threads).
+      Each worker validates the model on its own copy of the validation data (see `runWorker`) and replies with the
+      average validation error.  A worker that fails to reply (i.e., the transport breaks or the worker timeout expires)
+      is dropped and its model is dispatched to another worker.  A worker that cannot load or validate a model replies
+      with an explicit failure and stays in use; the model is then validated by the coordinator itself, as are
+      the models that are left when all workers have failed.
+
+    NOTE: the training (`trainModels`) and evaluation (`evalModels`) of the models are not distributed
+      and run on the model interpreters of the coordinator as in the `PopulationTrainer`
+      (distributing the training would require the workers to reply with the trained weights of each model).
+
+    Message protocol:
+      coordinator -> worker: "VALIDATE <model index>\n<binarized model>" or "STOP"
+      worker -> coordinator: "ERROR <model index> <average validation error>" or "FAILED <model index>"
+
+    Example use case:
+      // coordinator
+      PopulationTrainerDistributed<float, ModelInterpreterDefaultDevice<float>> population_trainer;
+      population_trainer.setWorkerTransports(worker_transports);
+      population_trainer.evolveModels(population, model_trainer, model_interpreters, model_replicator, data_simulator, model_logger, population_logger, input_nodes);
+      population_trainer.stopWorkers();
+      // worker
+      PopulationTrainerDistributed<float, ModelInterpreterDefaultDevice<float>>::runWorker(*coordinator_transport, model_trainer, model_interpreter, model_logger,
+        input, output, time_steps, input_nodes);
+  */
+  template<typename TensorT, typename InterpreterT>
+  class PopulationTrainerDistributed : public PopulationTrainer<TensorT, InterpreterT>
+  {
+  public:
+    PopulationTrainerDistributed() = default; ///< Default constructor
+    ~PopulationTrainerDistributed() = default; ///< Default destructor
+
+    void setWorkerTransports(const std::vector<std::shared_ptr<MessageTransport>>& worker_transports); ///< worker_transports setter
+    std::vector<std::shared_ptr<MessageTransport>> getWorkerTransports() const { return worker_transports_; }; ///< worker_transports getter
+    int getNWorkers() const; ///< number of workers that have not failed
+    void setWorkerTimeout(const int& worker_timeout_ms) { worker_timeout_ms_ = worker_timeout_ms; }; ///< worker_timeout setter (in milliseconds or -1 to wait indefinitely)
+    int getWorkerTimeout() const { return worker_timeout_ms_; }; ///< worker_timeout getter
+    std::vector<int> getNModelsValidatedByWorkers() const { return n_models_validated_; }; ///< number of models validated by each worker
+
+    /**
+      @brief Dispatch the models to the workers and gather their validation errors
+    */
+    void validateModels(
+      std::vector<Model<TensorT>>& models,
+      ModelTrainer<TensorT, InterpreterT>& model_trainer, std::vector<InterpreterT>& model_interpreters,
+      ModelLogger<TensorT>& model_logger,
+      const Eigen::Tensor<TensorT, 4>& input,
+      const Eigen::Tensor<TensorT, 4>& output,
+      const Eigen::Tensor<TensorT, 3>& time_steps,
+      const std::vector<std::string>& input_nodes,
+      std::vector<std::tuple<int, std::string, TensorT>>& models_validation_errors) override;
+
+    /**
+      @brief Ask all workers to stop and close their transports
+    */
+    void stopWorkers();
+
+    /**
+      @brief Serve the validation requests of a coordinator until the coordinator sends "STOP" or the transport is closed
+
+      @param[in] transport The transport to the coordinator
+
+      @returns The number of models that were validated
+    */
+    static int runWorker(MessageTransport& transport,
+      ModelTrainer<TensorT, InterpreterT>& model_trainer, InterpreterT& model_interpreter,
+      ModelLogger<TensorT>& model_logger,
+      const Eigen::Tensor<TensorT, 4>& input,
+      const Eigen::Tensor<TensorT, 4>& output,
+      const Eigen::Tensor<TensorT, 3>& time_steps,
+      const std::vector<std::string>& input_nodes);
+
+    static std::string makeValidateMessage(const int& model_index, const Model<TensorT>& model);
+    static std::string makeErrorMessage(const int& model_index, const TensorT& model_error);
+    static bool parseErrorMessage(const std::string& message, int& model_index, TensorT& model_error);
+    static std::string makeFailedMessage(const int& model_index);
+    static bool parseFailedMessage(const std::string& message, int& model_index);
+
+  private:
+    std::vector<std::shared_ptr<MessageTransport>> worker_transports_;
+    std::vector<int> worker_failed_; ///< the workers are flagged from separate dispatch threads
+    std::vector<int> n_models_validated_;
+    int worker_timeout_ms_ = -1;
+  };
+
+  template<typename TensorT, typename InterpreterT>
+  inline void PopulationTrainerDistributed<TensorT, InterpreterT>::setWorkerTransports(const std::vector<std::shared_ptr<MessageTransport>>& worker_transports)
+  {
+    worker_transports_ = worker_transports;
+    worker_failed_.assign(worker_transports.size(), 0);
+    n_models_validated_.assign(worker_transports.size(), 0);
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline int PopulationTrainerDistributed<TensorT, InterpreterT>::getNWorkers() const
+  {
+    return std::count(worker_failed_.begin(), worker_failed_.end(), 0);
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline void PopulationTrainerDistributed<TensorT, InterpreterT>::validateModels(std::vector<Model<TensorT>>& models, ModelTrainer<TensorT, InterpreterT>& model_trainer, std::vector<InterpreterT>& model_interpreters,
+    ModelLogger<TensorT>& model_logger, const Eigen::Tensor<TensorT, 4>& input, const Eigen::Tensor<TensorT, 4>& output, const Eigen::Tensor<TensorT, 3>& time_steps,
+    const std::vector<std::string>& input_nodes, std::vector<std::tuple<int, std::string, TensorT>>& models_validation_errors)
+  {
+    std::deque<int> pending_models;
+    for (int i = 0; i < models.size(); ++i) pending_models.push_back(i);
+    std::deque<int> failed_models; ///< models that the workers could not validate
+    std::mutex pending_models_mutex;
+
+    // dispatch the models to each worker from its own thread
+    auto dispatchModels = [&](const int& worker) {
+      MessageTransport& transport = *worker_transports_.at(worker);
+      while (true) {
+        int model_index;
+        {
+          std::lock_guard<std::mutex> lock(pending_models_mutex);
+          if (pending_models.empty()) return;
+          model_index = pending_models.front();
+          pending_models.pop_front();
+        }
+        std::string reply;
+        int reply_index = -1;
+        TensorT model_error = TensorT(0);
+        const bool replied = transport.sendMessage(makeValidateMessage(model_index, models.at(model_index))) &&
+          transport.receiveMessage(reply, worker_timeout_ms_);
+        if (replied && parseErrorMessage(reply, reply_index, model_error) && reply_index == model_index) {
+          models_validation_errors.at(model_index) = std::make_tuple(models.at(model_index).getId(), models.at(model_index).getName(), model_error);
+          ++n_models_validated_.at(worker);
+        }
+        else if (replied && parseFailedMessage(reply, reply_index) && reply_index == model_index) {
+          // keep the worker and validate the model on the coordinator
+          printf("Worker %d failed to validate model %s.  The model will be validated by the coordinator.\n", worker, models.at(model_index).getName().data());
+          std::lock_guard<std::mutex> lock(pending_models_mutex);
+          failed_models.push_back(model_index);
+        }
+        else {
+          // drop the worker and hand its model to another worker
+          printf("Worker %d failed to validate model %s.  The worker will no longer be used.\n", worker, models.at(model_index).getName().data());
+          transport.closeTransport();
+          worker_failed_.at(worker) = 1;
+          std::lock_guard<std::mutex> lock(pending_models_mutex);
+          pending_models.push_front(model_index);
+          return;
+        }
+      }
+    };
+    std::vector<std::thread> dispatch_threads;
+    for (int worker = 0; worker < worker_transports_.size(); ++worker)
+      if (!worker_failed_.at(worker))
+        dispatch_threads.push_back(std::thread(dispatchModels, worker));
+    for (std::thread& dispatch_thread : dispatch_threads)
+      dispatch_thread.join();
+
+    // validate the remaining models locally
+    if (pending_models.size() > 0)
+      printf("No workers are available.  %d models will be validated by the coordinator.\n", (int)pending_models.size());
+    pending_models.insert(pending_models.end(), failed_models.begin(), failed_models.end());
+    if (pending_models.size() > 0) {
+      for (const int& model_index : pending_models) {
+        models_validation_errors.at(model_index) = this->validateModel_(models.at(model_index), model_trainer, model_interpreters.at(0), model_logger,
+          input, output, time_steps, input_nodes);
+        model_interpreters.at(0).clear_cache();
+      }
+    }
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline void PopulationTrainerDistributed<TensorT, InterpreterT>::stopWorkers()
+  {
+    for (int worker = 0; worker < worker_transports_.size(); ++worker) {
+      if (!worker_failed_.at(worker))
+        worker_transports_.at(worker)->sendMessage("STOP");
+      worker_transports_.at(worker)->closeTransport();
+      worker_failed_.at(worker) = 1;
+    }
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline int PopulationTrainerDistributed<TensorT, InterpreterT>::runWorker(MessageTransport& transport, ModelTrainer<TensorT, InterpreterT>& model_trainer, InterpreterT& model_interpreter,
+    ModelLogger<TensorT>& model_logger, const Eigen::Tensor<TensorT, 4>& input, const Eigen::Tensor<TensorT, 4>& output, const Eigen::Tensor<TensorT, 3>& time_steps,
+    const std::vector<std::string>& input_nodes)
+  {
+    int n_models_validated = 0;
+    std::string message;
+    while (transport.receiveMessage(message)) {
+      if (message == "STOP") break;
+
+      // parse the request
+      const size_t header_end = message.find('\n');
+      int model_index = -1;
+      if (header_end == std::string::npos || sscanf(message.substr(0, header_end).data(), "VALIDATE %d", &model_index) != 1) {
+        printf("Worker received an unknown message.\n");
+        break;
+      }
+      Model<TensorT> model;
+      TensorT model_error = TensorT(0);
+      bool validated = false;
+      try {
+        std::istringstream model_stream(message.substr(header_end + 1));
+        ModelFile<TensorT> model_file;
+        model_file.loadModelBinary(model_stream, model);
+        model_error = std::get<2>(PopulationTrainer<TensorT, InterpreterT>::validateModel_(model, model_trainer, model_interpreter, model_logger,
+          input, output, time_steps, input_nodes));
+        validated = true;
+      }
+      catch (std::exception& e) {
+        printf("Exception: %s\n", e.what());
+      }
+      model_interpreter.clear_cache();
+
+      // reply with the validation error or the failure
+      if (!validated) {
+        if (!transport.sendMessage(makeFailedMessage(model_index))) break;
+        continue;
+      }
+      if (!transport.sendMessage(makeErrorMessage(model_index, model_error))) break;
+      ++n_models_validated;
+    }
+    transport.closeTransport();
+    return n_models_validated;
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline std::string PopulationTrainerDistributed<TensorT, InterpreterT>::makeValidateMessage(const int& model_index, const Model<TensorT>& model)
+  {
+    std::ostringstream message(std::ios::binary);
+    message << "VALIDATE " << model_index << '\n';
+    ModelFile<TensorT> model_file;
+    model_file.storeModelBinary(message, model);
+    return message.str();
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline std::string PopulationTrainerDistributed<TensorT, InterpreterT>::makeErrorMessage(const int& model_index, const TensorT& model_error)
+  {
+    char message_char[128];
+    sprintf(message_char, "ERROR %d %.9e", model_index, (double)model_error);
+    return std::string(message_char);
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline bool PopulationTrainerDistributed<TensorT, InterpreterT>::parseErrorMessage(const std::string& message, int& model_index, TensorT& model_error)
+  {
+    double model_error_tmp;
+    if (sscanf(message.data(), "ERROR %d %le", &model_index, &model_error_tmp) != 2) return false;
+    model_error = (TensorT)model_error_tmp;
+    return true;
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline std::string PopulationTrainerDistributed<TensorT, InterpreterT>::makeFailedMessage(const int& model_index)
+  {
+    return "FAILED " + std::to_string(model_index);
+  }
+
+  template<typename TensorT, typename InterpreterT>
+  inline bool PopulationTrainerDistributed<TensorT, InterpreterT>::parseFailedMessage(const std::string& message, int& model_index)
+  {
+    return sscanf(message.data(), "FAILED %d", &model_index) == 1;
+  }
+}
+#endif //SMARTPEAK_POPULATIONTRAINERDISTRIBUTED_H
@@ -5,6 +5,8 @@ set(directory include/SmartPeak/ml)
 set(sources_list_h
 	ActivationFunction.h
 	ActivationFunctionTensor.h
+	CompiledModelCache.h
+	EvaluationAccumulator.h
 	IntegrationFunction.h
 	IntegrationFunctionTensor.h
 	Interpreter.h
@@ -16,6 +18,8 @@ set(sources_list_h
 	Model.h
 	ModelBuilder.h
 	ModelBuilderExperimental.h
+	ModelEnsemble.h
+	ModelGraph.h
 	ModelInterpreter.h
 	ModelInterpreterDefaultDevice.h
 	ModelInterpreterGpu.h
@@ -36,6 +40,7 @@ set(sources_list_h
 	PopulationLogger.h
 	PopulationTrainer.h
 	PopulationTrainerDefaultDevice.h
+	PopulationTrainerDistributed.h
 	PopulationTrainerExperimental.h
 	PopulationTrainerExperimentalDefaultDevice.h
 	PopulationTrainerExperimentalGpu.h
@@ -6,6 +6,11 @@
 #include <SmartPeak/simulator/DataSimulator.h>
 #include <SmartPeak/core/Preprocessing.h>
 
+// .cpp
+#include <random>
+#include <stdexcept>
+#include <thread>
+
 namespace SmartPeak
 {
   /**
@@ -79,8 +84,74 @@ public:
 			return result;
 		}
 
+		/*
+		@brief batched implementation of the add problem
+
+		All sequences are generated in one pass with the random numbers drawn from the caller's engine.
+			The mask indices of each sequence are drawn without replacement using Floyd's algorithm.
+			The batch can be split between threads where each thread draws from its own engine that is seeded
+			from the caller's engine (i.e., the sequences are reproducible for the same engine state and number of threads).
+
+		@param[in, out] random_sequences (dim0: batch, dim1: sequence_length)
+		@param[in, out] mask_sequences (dim0: batch, dim1: sequence_length)
+		@param[in, out] results The sum of the masked random numbers of each sequence (dim0: batch)
+		@param[in] n_masks The number of random additions
+		@param[in] engine The random number generator
+		@param[in] n_threads The number of threads to split the batch between
+		**/
+		static void AddProbBatch(
+			Eigen::Tensor<TensorT, 2>& random_sequences,
+			Eigen::Tensor<TensorT, 2>& mask_sequences,
+			Eigen::Tensor<TensorT, 1>& results,
+			const int& n_masks,
+			std::mt19937& engine,
+			const int& n_threads = 1)
+		{
+			const int batch_size = random_sequences.dimension(0);
+			const int sequence_length = random_sequences.dimension(1);
+			if (n_masks > sequence_length || mask_sequences.dimensions() != random_sequences.dimensions() || results.dimension(0) != batch_size) {
+				const std::string error = "The number of masks " + std::to_string(n_masks) + " is larger than the sequence length " + std::to_string(sequence_length) +
+					" or the dimensions of the sequences and results do not match.";
+				throw std::runtime_error(error);
+			}
+			mask_sequences.setZero();
+
+			// generate the random sequences and masks of a block of the batch
+			auto makeSequences = [&](const int& batch_start, const int& batch_end, std::mt19937& gen) {
+				std::uniform_real_distribution<TensorT> zero_to_one(0.0, 1.0);
+				for (int i = 0; i < sequence_length; ++i)
+					for (int batch_iter = batch_start; batch_iter < batch_end; ++batch_iter)
+						random_sequences(batch_iter, i) = zero_to_one(gen);
+				for (int batch_iter = batch_start; batch_iter < batch_end; ++batch_iter) {
+					for (int j = sequence_length - n_masks; j < sequence_length; ++j) {
+						const int mask_index = std::uniform_int_distribution<>(0, j)(gen);
+						if (mask_sequences(batch_iter, mask_index) == TensorT(0)) mask_sequences(batch_iter, mask_index) = TensorT(1);
+						else mask_sequences(batch_iter, j) = TensorT(1);
+					}
+				}
+			};
+			const int n_blocks = std::max(1, std::min(n_threads, batch_size));
+			if (n_blocks == 1) {
+				makeSequences(0, batch_size, engine);
+			}
+			else {
+				std::vector<std::mt19937> engines;
+				for (int block_iter = 0; block_iter < n_blocks; ++block_iter)
+					engines.push_back(std::mt19937(engine()));
+				std::vector<std::thread> threads;
+				for (int block_iter = 0; block_iter < n_blocks; ++block_iter)
+					threads.push_back(std::thread(makeSequences, batch_size * block_iter / n_blocks, batch_size * (block_iter + 1) / n_blocks, std::ref(engines.at(block_iter))));
+				for (std::thread& thread : threads)
+					thread.join();
+			}
+
+			// the results
+			results = (random_sequences * mask_sequences).sum(Eigen::array<int, 1>({ 1 }));
+		}
+
 		int n_mask_ = 5;
 		int sequence_length_ = 25;
+		std::mt19937 engine_{ std::random_device{}() }; ///< random number generator for `AddProbBatch`
   };
 }
 
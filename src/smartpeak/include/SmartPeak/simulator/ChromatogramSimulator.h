@@ -8,6 +8,13 @@
 #include <SmartPeak/simulator/PeakSimulator.h>
 #include <SmartPeak/simulator/DataSimulator.h>
 
+// .cpp
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
 namespace SmartPeak
 {
 	/**
@@ -21,6 +28,18 @@ namespace SmartPeak
 		ChromatogramSimulator() = default; ///< Default constructor
 		~ChromatogramSimulator() = default; ///< Default destructor
 
+		/**
+			@brief Toggle the simulation of dense chromatograms
+
+			By default, the chromatogram window is divided into one window per peak and the peak apex is placed at the
+				center of its window (+/- emg_mu_offset).  In dense mode, the peak apices are placed at random positions
+				across the whole chromatogram window (emg_mu_offset is not used) and each peak window spans
+				5 * (emg_sigma + emg_tau) upper bounds on either side of its apex so that hundreds of peaks may co-elute.
+				The overlapping windows are resolved by `joinPeakWindows` while sweeping the peaks in order of their apex.
+		*/
+		void setDensePeaks(const bool& dense_peaks) { dense_peaks_ = dense_peaks; }; ///< dense_peaks setter
+		bool getDensePeaks() const { return dense_peaks_; }; ///< dense_peaks getter
+
 		/**
 			@brief Simulates a chromatogram.
 
@@ -65,6 +84,45 @@ namespace SmartPeak
 			const std::pair<TensorT, TensorT>& emg_sigma,
 			TensorT saturation_limit = (TensorT)100) const;
 
+		/**
+			@brief Simulates a batch of chromatograms directly into the input and output tensors of a model
+
+			Each [batch, memory] element is an independent chromatogram that is simulated as in `simulateChromatogram`.
+				The chromatograms are simulated in parallel and written in place without intermediate vectors
+				(i.e., the peak windows and points are kept in buffers that are reused by each thread).
+				Only the first n_points of each chromatogram are simulated where n_points is the size of the
+				feature dimension of the input tensor.
+
+			@param[out] input_data The intensities of the noisy chromatograms [batch, memory, n_points]
+			@param[out] loss_output_data The expected outputs of the model (see `output_data_type`)
+			@param[out] metric_output_data The expected outputs of the model (see `output_data_type`)
+			@param[in] output_data_type The expected outputs of the model:
+				"Points" the intensities of the chromatograms without noise [batch, memory, n_points],
+				"IsApex" 1 where the time is equal to a peak apex [batch, memory, n_points],
+				"IsPeak" 1 where the time lies between the best left and right of a peak [batch, memory, n_points], or
+				"EMG" the h, tau, mu, and sigma of each peak with mu and sigma divided by the lower bound of the
+					chromatogram window size [batch, memory, 4*n_peaks]
+			@param[in] n_threads The number of threads (or -1 to use all hardware threads)
+
+			See `simulateChromatogram` for the remaining parameters
+		*/
+		void simulateChromatograms(Eigen::Tensor<TensorT, 3>& input_data,
+			Eigen::Tensor<TensorT, 3>& loss_output_data, Eigen::Tensor<TensorT, 3>& metric_output_data,
+			const std::string& output_data_type,
+			const std::pair<TensorT, TensorT>& step_size_mu,
+			const std::pair<TensorT, TensorT>& step_size_sigma,
+			const std::pair<TensorT, TensorT>& chrom_window_size,
+			const std::pair<TensorT, TensorT>& noise_mu,
+			const std::pair<TensorT, TensorT>& noise_sigma,
+			const std::pair<TensorT, TensorT>& baseline_height,
+			const std::pair<TensorT, TensorT>& n_peaks,
+			const std::pair<TensorT, TensorT>& emg_h,
+			const std::pair<TensorT, TensorT>& emg_tau,
+			const std::pair<TensorT, TensorT>& emg_mu_offset,
+			const std::pair<TensorT, TensorT>& emg_sigma,
+			TensorT saturation_limit = (TensorT)100,
+			const int& n_threads = -1) const;
+
 		/**
 			@brief Makes a chromatogram.
 
@@ -100,7 +158,8 @@ namespace SmartPeak
 			@brief Joins peak windows.
 
 			Overlapping or disconnected peak windows will be joined by extending the highest
-				connecting baseline.
+				connecting baseline.  The right peak window will not start before the left peak window
+				so that peaks can be joined in a single sweep (see `joinPeaks_`).
 
 			@param[in,out] peak_left Left peak
 			@param[in,out] emg_left Left peak EMGModel
@@ -114,7 +173,9 @@ namespace SmartPeak
 		/**
 			@brief Find the overlap between two peak windows.
 
-			The point of overlap between two peaks will be returned.
+			The point of overlap between two peaks will be returned.  The points of the left peak are
+				sorted by time so that each point of the right peak is compared against the highest
+				left peak point at or after its time (i.e., O(n log n) in the number of overlapping points).
 
 			@param[in,out] peak_left Left peak
 			@param[in,out] emg_left Left peak EMGModel
@@ -126,6 +187,48 @@ namespace SmartPeak
 		TensorT findPeakOverlap(
 			const PeakSimulator<TensorT>& peak_left, const EMGModel<TensorT>& emg_left,
 			const PeakSimulator<TensorT>& peak_right, const EMGModel<TensorT>& emg_right) const;
+
+	protected:
+		/**
+			@brief Draws the random peak windows (without and with noise) and EMGs of a chromatogram
+
+			See `simulateChromatogram` for the parameters
+		*/
+		void makePeaks_(std::vector<PeakSimulator<TensorT>>& peaks, std::vector<PeakSimulator<TensorT>>& peaks_noise,
+			std::vector<EMGModel<TensorT>>& emgs_O,
+			const std::pair<TensorT, TensorT>& step_size_mu,
+			const std::pair<TensorT, TensorT>& step_size_sigma,
+			const std::pair<TensorT, TensorT>& chrom_window_size,
+			const std::pair<TensorT, TensorT>& noise_mu,
+			const std::pair<TensorT, TensorT>& noise_sigma,
+			const std::pair<TensorT, TensorT>& baseline_height,
+			const std::pair<TensorT, TensorT>& n_peaks,
+			const std::pair<TensorT, TensorT>& emg_h,
+			const std::pair<TensorT, TensorT>& emg_tau,
+			const std::pair<TensorT, TensorT>& emg_mu_offset,
+			const std::pair<TensorT, TensorT>& emg_sigma,
+			const TensorT& saturation_limit,
+			std::mt19937& engine) const;
+
+		/**
+			@brief Orders the peaks from lowest to highest emg_mu and joins their windows
+
+			Only neighboring peaks are joined while sweeping the sorted peaks so that the
+				overlaps of n peaks are resolved in O(n log n).
+
+			@param[in,out] peak_emg_pairs The peaks and their EMGModels
+		*/
+		void joinPeaks_(std::vector<std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>>>& peak_emg_pairs) const;
+
+		/**
+			@brief Random number within the lower and upper bounds
+
+			The bounds are truncated to integers as in the original implementation of `simulateChromatogram`
+		*/
+		static TensorT randomBounds_(const TensorT& lb, const TensorT& ub, std::mt19937& engine);
+
+	private:
+		bool dense_peaks_ = false;
 	};
 
 	template <typename TensorT>
@@ -145,21 +248,28 @@ namespace SmartPeak
 		peak_l.simulatePeak(x_left, y_left, emg_left);
 		peak_r.simulatePeak(x_right, y_right, emg_right);
 
+		// sort the left peak points by time and record the highest left peak point at or after each time
+		std::vector<std::pair<TensorT, TensorT>> xy_left;
+		xy_left.reserve(x_left.size());
+		for (int j = 0; j < x_left.size(); ++j)
+			xy_left.push_back(std::make_pair(x_left[j], y_left[j]));
+		std::sort(xy_left.begin(), xy_left.end());
+		std::vector<TensorT> y_left_max(xy_left.size() + 1, std::numeric_limits<TensorT>::lowest());
+		for (int j = (int)xy_left.size() - 1; j >= 0; --j)
+			y_left_max[j] = std::max(y_left_max[j + 1], xy_left[j].second);
+
 		// find the highest point where the peaks cross
+		// (i.e., the highest right peak point that lies below a left peak point at or after its time)
 		TensorT x_overlap = peak_left.getWindowEnd();
 		TensorT y_overlap = (TensorT)0.0;
 		for (int i = x_right.size() - 1; i >= 0; --i)
 		{  // iterate in reverse order to extend the left peak
-			for (int j = x_left.size() - 1; j >= 0; --j)
+			const int j = std::lower_bound(xy_left.begin(), xy_left.end(), x_right[i],
+				[](const std::pair<TensorT, TensorT>& xy, const TensorT& x) { return xy.first < x; }) - xy_left.begin();
+			if (y_right[i] <= y_left_max[j] && y_overlap < y_right[i])
 			{
-				if (x_right[i] <= x_left[j] && y_right[i] <= y_left[j])
-				{
-					if (y_overlap < y_right[i])
-					{
-						y_overlap = y_right[i];
-						x_overlap = x_right[i];
-					}
-				}
+				y_overlap = y_right[i];
+				x_overlap = x_right[i];
 			}
 		}
 		return x_overlap;
@@ -207,8 +317,8 @@ namespace SmartPeak
 				peak_left, emg_left,
 				peak_right, emg_right
 			);
-			peak_right.setWindowStart(overlap);
-			peak_left.setWindowEnd(overlap);
+			peak_right.setWindowStart(std::max(overlap, peak_left.getWindowStart()));
+			peak_left.setWindowEnd(std::max(overlap, peak_left.getWindowStart()));
 		}
 		else if (x_delta < 0.0 && y_delta > 0.0)
 		{
@@ -220,8 +330,8 @@ namespace SmartPeak
 				peak_left, emg_left,
 				peak_right, emg_right
 			);
-			peak_right.setWindowStart(overlap);
-			peak_left.setWindowEnd(overlap);
+			peak_right.setWindowStart(std::max(overlap, peak_left.getWindowStart()));
+			peak_left.setWindowEnd(std::max(overlap, peak_left.getWindowStart()));
 		}
 	}
 
@@ -235,46 +345,13 @@ namespace SmartPeak
 		const std::pair<TensorT, TensorT>& emg_h, const std::pair<TensorT, TensorT>& emg_tau, const std::pair<TensorT, TensorT>& emg_mu_offset, const std::pair<TensorT, TensorT>& emg_sigma,
 		TensorT saturation_limit) const
 	{
-		// lampda for choosing a random number within l/u bounds
-		auto random_bounds = [](const TensorT& lb, const TensorT& ub)->TensorT {
-			std::random_device rd; // obtain a random number from hardware
-			std::mt19937 eng(rd()); // seed the generator
-			std::uniform_int_distribution<> distr(lb, ub); // define the range
-			return (TensorT)distr(eng);
-		};
-
-		// determine the chrom window size, saturation limits, and number of peaks
-		TensorT chrom_window_size_rand = random_bounds(chrom_window_size.first, chrom_window_size.second);
-		TensorT n_peaks_rand = random_bounds(n_peaks.first, n_peaks.second);
-		TensorT peak_window_length = chrom_window_size_rand / n_peaks_rand;
-
-		// determine the sampling rate
-		TensorT step_size_mu_rand = random_bounds(step_size_mu.first, step_size_mu.second);
-		TensorT step_size_sigma_rand = random_bounds(step_size_sigma.first, step_size_sigma.second);
+		std::random_device rd;
+		std::mt19937 engine(rd());
 
 		// generate a random set of peaks
 		std::vector<PeakSimulator<TensorT>> peaks, peaks_noise;
-    emgs_O.clear();
-		for (int peak_iter = 0; peak_iter < n_peaks_rand; ++peak_iter) {
-			// Define the peak
-			TensorT baseline_left = random_bounds(baseline_height.first, baseline_height.second);
-			TensorT baseline_right = random_bounds(baseline_height.first, baseline_height.second);
-			TensorT noise_mu_rand = random_bounds(noise_mu.first, noise_mu.second);
-			TensorT noise_sigma_rand = random_bounds(noise_sigma.first, noise_sigma.second);
-			TensorT peak_start = (TensorT)peak_iter * peak_window_length;
-			TensorT peak_end = (TensorT)(peak_iter + 1) * peak_window_length;
-			peaks.push_back(PeakSimulator<TensorT>(step_size_mu_rand, (TensorT)0, peak_start, peak_end,
-        (TensorT)0, (TensorT)0, baseline_left, baseline_right, saturation_limit));
-			peaks_noise.push_back(PeakSimulator<TensorT>(step_size_mu_rand, step_size_sigma_rand, peak_start, peak_end,
-				noise_mu_rand, noise_sigma_rand, baseline_left, baseline_right, saturation_limit));
-
-			// Define the EMG generator
-			TensorT h = random_bounds(emg_h.first, emg_h.second);
-			TensorT tau = random_bounds(emg_tau.first, emg_tau.second);
-			TensorT mu = random_bounds(emg_mu_offset.first, emg_mu_offset.second) + ((peak_end - peak_start) / (TensorT)2 + peak_start);
-			TensorT sigma = random_bounds(emg_sigma.first, emg_sigma.second);
-      emgs_O.push_back(EMGModel<TensorT>(h, tau, mu, sigma));
-		}
+		makePeaks_(peaks, peaks_noise, emgs_O, step_size_mu, step_size_sigma, chrom_window_size, noise_mu, noise_sigma, baseline_height,
+			n_peaks, emg_h, emg_tau, emg_mu_offset, emg_sigma, saturation_limit, engine);
 
 		// make the chromatogram
 		makeChromatogram(x_O, y_O, peaks_LR, peak_apices, peaks, emgs_O);
@@ -299,29 +376,14 @@ namespace SmartPeak
 		peaks_LR.clear();
     peak_apices.clear();
 
-		// Order the list of peaks from lowest to highest emg_mu
+		// Order and join the list of peaks
 		std::vector<std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>>> peak_emg_pairs;
 		for (int i = 0; i < emgs.size(); ++i)
 		{
 			const std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>> peak_emg(peaks[i], emgs[i]);
 			peak_emg_pairs.push_back(peak_emg);
 		}
-		std::sort(peak_emg_pairs.begin(), peak_emg_pairs.end(),
-			[](std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>> lhs, std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>> rhs)
-		{
-			return lhs.second.getMu() < rhs.second.getMu(); //ascending order
-		}
-		);
-
-		// Join the peaks in order
-		if (peak_emg_pairs.size() > 1)
-		{
-			for (int i = 1; i < peak_emg_pairs.size(); ++i)
-			{
-				joinPeakWindows(peak_emg_pairs[i - 1].first, peak_emg_pairs[i - 1].second,
-					peak_emg_pairs[i].first, peak_emg_pairs[i].second);
-			}
-		}
+		joinPeaks_(peak_emg_pairs);
 
 		// Add the peaks in order
 		for (int i = 0; i < peak_emg_pairs.size(); ++i)
@@ -345,6 +407,197 @@ namespace SmartPeak
 			y_O.insert(y_O.end(), y.begin(), y.end());
 		}
 	}
+
+	template <typename TensorT>
+	void ChromatogramSimulator<TensorT>::joinPeaks_(std::vector<std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>>>& peak_emg_pairs) const
+	{
+		// Order the list of peaks from lowest to highest emg_mu
+		std::sort(peak_emg_pairs.begin(), peak_emg_pairs.end(),
+			[](const std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>>& lhs, const std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>>& rhs)
+		{
+			return lhs.second.getMu() < rhs.second.getMu(); //ascending order
+		}
+		);
+
+		// Join the peaks in order
+		for (int i = 1; i < peak_emg_pairs.size(); ++i)
+		{
+			joinPeakWindows(peak_emg_pairs[i - 1].first, peak_emg_pairs[i - 1].second,
+				peak_emg_pairs[i].first, peak_emg_pairs[i].second);
+		}
+	}
+
+	template <typename TensorT>
+	TensorT ChromatogramSimulator<TensorT>::randomBounds_(const TensorT& lb, const TensorT& ub, std::mt19937& engine)
+	{
+		std::uniform_int_distribution<> distr(lb, ub); // define the range
+		return (TensorT)distr(engine);
+	}
+
+	template <typename TensorT>
+	void ChromatogramSimulator<TensorT>::makePeaks_(std::vector<PeakSimulator<TensorT>>& peaks, std::vector<PeakSimulator<TensorT>>& peaks_noise,
+		std::vector<EMGModel<TensorT>>& emgs_O,
+		const std::pair<TensorT, TensorT>& step_size_mu, const std::pair<TensorT, TensorT>& step_size_sigma,
+		const std::pair<TensorT, TensorT>& chrom_window_size, const std::pair<TensorT, TensorT>& noise_mu, const std::pair<TensorT, TensorT>& noise_sigma,
+		const std::pair<TensorT, TensorT>& baseline_height, const std::pair<TensorT, TensorT>& n_peaks,
+		const std::pair<TensorT, TensorT>& emg_h, const std::pair<TensorT, TensorT>& emg_tau, const std::pair<TensorT, TensorT>& emg_mu_offset, const std::pair<TensorT, TensorT>& emg_sigma,
+		const TensorT& saturation_limit, std::mt19937& engine) const
+	{
+		// determine the chrom window size, saturation limits, and number of peaks
+		TensorT chrom_window_size_rand = randomBounds_(chrom_window_size.first, chrom_window_size.second, engine);
+		TensorT n_peaks_rand = randomBounds_(n_peaks.first, n_peaks.second, engine);
+		TensorT peak_window_length = chrom_window_size_rand / n_peaks_rand;
+
+		// determine the sampling rate
+		TensorT step_size_mu_rand = randomBounds_(step_size_mu.first, step_size_mu.second, engine);
+		TensorT step_size_sigma_rand = randomBounds_(step_size_sigma.first, step_size_sigma.second, engine);
+
+		// the half width of the peak windows in dense mode
+		const TensorT dense_window_length = std::ceil((TensorT)5 * (emg_sigma.second + emg_tau.second));
+
+		// generate a random set of peaks
+		peaks.clear();
+		peaks_noise.clear();
+		emgs_O.clear();
+		peaks.reserve(n_peaks_rand);
+		peaks_noise.reserve(n_peaks_rand);
+		emgs_O.reserve(n_peaks_rand);
+		for (int peak_iter = 0; peak_iter < n_peaks_rand; ++peak_iter) {
+			// Define the peak
+			TensorT baseline_left = randomBounds_(baseline_height.first, baseline_height.second, engine);
+			TensorT baseline_right = randomBounds_(baseline_height.first, baseline_height.second, engine);
+			TensorT noise_mu_rand = randomBounds_(noise_mu.first, noise_mu.second, engine);
+			TensorT noise_sigma_rand = randomBounds_(noise_sigma.first, noise_sigma.second, engine);
+			TensorT peak_start = (TensorT)peak_iter * peak_window_length;
+			TensorT peak_end = (TensorT)(peak_iter + 1) * peak_window_length;
+			TensorT peak_apex = (peak_end - peak_start) / (TensorT)2 + peak_start;
+			if (dense_peaks_) {
+				peak_apex = randomBounds_(0, chrom_window_size_rand, engine);
+				peak_start = std::max((TensorT)0, peak_apex - dense_window_length);
+				peak_end = std::min(chrom_window_size_rand, peak_apex + dense_window_length);
+			}
+			peaks.push_back(PeakSimulator<TensorT>(step_size_mu_rand, (TensorT)0, peak_start, peak_end,
+				(TensorT)0, (TensorT)0, baseline_left, baseline_right, saturation_limit));
+			peaks_noise.push_back(PeakSimulator<TensorT>(step_size_mu_rand, step_size_sigma_rand, peak_start, peak_end,
+				noise_mu_rand, noise_sigma_rand, baseline_left, baseline_right, saturation_limit));
+
+			// Define the EMG generator
+			TensorT h = randomBounds_(emg_h.first, emg_h.second, engine);
+			TensorT tau = randomBounds_(emg_tau.first, emg_tau.second, engine);
+			TensorT mu = (dense_peaks_) ? peak_apex : randomBounds_(emg_mu_offset.first, emg_mu_offset.second, engine) + peak_apex;
+			TensorT sigma = randomBounds_(emg_sigma.first, emg_sigma.second, engine);
+			emgs_O.push_back(EMGModel<TensorT>(h, tau, mu, sigma));
+		}
+	}
+
+	template <typename TensorT>
+	void ChromatogramSimulator<TensorT>::simulateChromatograms(Eigen::Tensor<TensorT, 3>& input_data,
+		Eigen::Tensor<TensorT, 3>& loss_output_data, Eigen::Tensor<TensorT, 3>& metric_output_data,
+		const std::string& output_data_type,
+		const std::pair<TensorT, TensorT>& step_size_mu, const std::pair<TensorT, TensorT>& step_size_sigma,
+		const std::pair<TensorT, TensorT>& chrom_window_size, const std::pair<TensorT, TensorT>& noise_mu, const std::pair<TensorT, TensorT>& noise_sigma,
+		const std::pair<TensorT, TensorT>& baseline_height, const std::pair<TensorT, TensorT>& n_peaks,
+		const std::pair<TensorT, TensorT>& emg_h, const std::pair<TensorT, TensorT>& emg_tau, const std::pair<TensorT, TensorT>& emg_mu_offset, const std::pair<TensorT, TensorT>& emg_sigma,
+		TensorT saturation_limit, const int& n_threads) const
+	{
+		const int batch_size = input_data.dimension(0);
+		const int memory_size = input_data.dimension(1);
+		const int n_points = input_data.dimension(2);
+		const int n_outputs = loss_output_data.dimension(2);
+		if (output_data_type != "Points" && output_data_type != "IsApex" && output_data_type != "IsPeak" && output_data_type != "EMG") {
+			const std::string error = "The output data type " + output_data_type + " is not supported.";
+			throw std::runtime_error(error);
+		}
+		if (loss_output_data.dimension(0) != batch_size || loss_output_data.dimension(1) != memory_size ||
+			metric_output_data.dimensions() != loss_output_data.dimensions() ||
+			(output_data_type != "EMG" && n_outputs != n_points)) {
+			const std::string error = "The dimensions of the input and output tensors do not match.";
+			throw std::runtime_error(error);
+		}
+		input_data.setZero();
+		loss_output_data.setZero();
+		metric_output_data.setZero();
+
+		// simulate the chromatograms of the [batch, memory] elements in parallel
+		std::atomic_int sample_iter{ 0 };
+		auto simulateSamples = [&]() {
+			std::random_device rd;
+			std::mt19937 engine(rd());
+
+			// buffers that are reused for each chromatogram
+			std::vector<PeakSimulator<TensorT>> peaks, peaks_noise;
+			std::vector<EMGModel<TensorT>> emgs;
+			std::vector<std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>>> peak_emg_pairs, peak_emg_pairs_noise;
+			Eigen::Array<TensorT, Eigen::Dynamic, 1> x_peak(n_points + 1), y_peak(n_points + 1);
+
+			while (true) {
+				const int sample = sample_iter.fetch_add(1);
+				if (sample >= batch_size * memory_size) break;
+				const int batch_iter = sample / memory_size;
+				const int memory_iter = sample % memory_size;
+
+				makePeaks_(peaks, peaks_noise, emgs, step_size_mu, step_size_sigma, chrom_window_size, noise_mu, noise_sigma, baseline_height,
+					n_peaks, emg_h, emg_tau, emg_mu_offset, emg_sigma, saturation_limit, engine);
+				peak_emg_pairs.clear();
+				peak_emg_pairs_noise.clear();
+				for (int i = 0; i < emgs.size(); ++i) {
+					peak_emg_pairs.push_back(std::make_pair(peaks[i], emgs[i]));
+					peak_emg_pairs_noise.push_back(std::make_pair(peaks_noise[i], emgs[i]));
+				}
+				joinPeaks_(peak_emg_pairs);
+				joinPeaks_(peak_emg_pairs_noise);
+
+				// the noisy chromatogram is the input
+				int point_iter = 0;
+				for (int i = 0; i < peak_emg_pairs_noise.size() && point_iter < n_points; ++i) {
+					const int n_peak_points = peak_emg_pairs_noise[i].first.simulatePeak(x_peak, y_peak, peak_emg_pairs_noise[i].second, engine);
+					for (int j = 0; j < n_peak_points && point_iter < n_points; ++j, ++point_iter)
+						input_data(batch_iter, memory_iter, point_iter) = y_peak(j);
+				}
+
+				// the chromatogram without noise or its peaks are the output
+				if (output_data_type == "EMG") {
+					for (int i = 0; i < emgs.size() && i * 4 + 3 < n_outputs; ++i) {
+						loss_output_data(batch_iter, memory_iter, i * 4) = emgs[i].getH();
+						loss_output_data(batch_iter, memory_iter, i * 4 + 1) = emgs[i].getTau();
+						loss_output_data(batch_iter, memory_iter, i * 4 + 2) = emgs[i].getMu() / chrom_window_size.first;
+						loss_output_data(batch_iter, memory_iter, i * 4 + 3) = emgs[i].getSigma() / chrom_window_size.first;
+					}
+				}
+				else {
+					point_iter = 0;
+					for (int i = 0; i < peak_emg_pairs.size() && point_iter < n_points; ++i) {
+						const PeakSimulator<TensorT>& peak = peak_emg_pairs[i].first;
+						const EMGModel<TensorT>& emg = peak_emg_pairs[i].second;
+						const int n_peak_points = peak.simulatePeak(x_peak, y_peak, emg, engine);
+						std::pair<TensorT, TensorT> best_lr = std::make_pair((TensorT)0, (TensorT)0);
+						if (output_data_type == "IsPeak")
+							best_lr = peak.getBestLeftAndRight(x_peak.head(n_peak_points), y_peak.head(n_peak_points), emg.getMu());
+						for (int j = 0; j < n_peak_points && point_iter < n_points; ++j, ++point_iter) {
+							TensorT output = y_peak(j);
+							if (output_data_type == "IsApex") {
+								output = (TensorT)0;
+								for (const std::pair<PeakSimulator<TensorT>, EMGModel<TensorT>>& peak_emg : peak_emg_pairs)
+									if (std::abs(x_peak(j) - peak_emg.second.getMu()) < 1e-6) output = (TensorT)1;
+							}
+							else if (output_data_type == "IsPeak") {
+								output = (best_lr.first != best_lr.second && x_peak(j) >= best_lr.first && x_peak(j) <= best_lr.second) ? (TensorT)1 : (TensorT)0;
+							}
+							loss_output_data(batch_iter, memory_iter, point_iter) = output;
+						}
+					}
+				}
+			}
+		};
+		const int n_threads_used = std::max(1, std::min<int>((n_threads > 0) ? n_threads : std::thread::hardware_concurrency(), batch_size * memory_size));
+		std::vector<std::thread> threads;
+		for (int i = 1; i < n_threads_used; ++i)
+			threads.push_back(std::thread(simulateSamples));
+		simulateSamples();
+		for (std::thread& thread : threads)
+			thread.join();
+		metric_output_data = loss_output_data;
+	}
 }
 
 #endif //SMARTPEAK_CHROMATOGRAMSIMULATOR_H
\ No newline at end of file
@@ -3,8 +3,13 @@
 #ifndef SMARTPEAK_EMGMODEL_H
 #define SMARTPEAK_EMGMODEL_H
 
+// .h
+#include <Eigen/Dense>
+#include <vector>
+
 //.cpp
 #include <cmath>
+#include <stdexcept>
 
 namespace SmartPeak
 {
@@ -61,6 +66,36 @@ namespace SmartPeak
 		*/
 		TensorT PDF(const TensorT& x_I) const;
 
+		/**
+			@brief Calculates points from an EMG PDF for an array of X values
+
+			The PDF is evaluated branch-free (i.e., SIMD-friendly) as
+				h*sigma/tau*sqrt(PI/2)*exp(-0.5*((x-mu)/sigma)^2)*erfcx(z) for z >= 0 and
+				h*sigma/tau*sqrt(PI/2)*exp(0.5*(sigma/tau)^2-(x-mu)/tau)*(2-erfc(-z)) for z < 0
+				where erfcx(z) = exp(z^2)*erfc(z) is approximated by the Chebyshev fit of
+				Press et al. (Numerical Recipes, erfcc) that has a relative error below 1.2e-7 for all z >= 0,
+				and exp is the vectorized exp of Eigen.  The relative error compared to the exact EMG PDF
+				is below 2e-7 (plus the rounding error of TensorT).  Peaks with sigma/tau >= 1e4
+				(including tau == 0) are evaluated as in `EMGPDF3_` whose relative error is below 4/(sigma/tau)^2
+				wherever the intensity is not negligible.
+
+			@param[in] x_I X values of the EMG PDF
+			@param[out] y_O Y values of the EMG PDF (preallocated to the size of x_I)
+		*/
+		void PDF(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_I,
+			Eigen::Ref<Eigen::Array<TensorT, Eigen::Dynamic, 1>> y_O) const;
+
+		/**
+			@brief Calculates points from the EMG PDFs of many peaks for the same array of X values
+
+			@param[in] x_I X values of the EMG PDFs [n_points]
+			@param[in] emgs The EMG model of each peak
+			@param[out] y_O Y values of the EMG PDFs (preallocated to [n_points, n_peaks])
+		*/
+		static void PDFs(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_I,
+			const std::vector<EMGModel<TensorT>>& emgs,
+			Eigen::Ref<Eigen::Array<TensorT, Eigen::Dynamic, Eigen::Dynamic>> y_O);
+
 	protected:
 		/**
 			@brief Calculates points from an EMG PDF using method 1
@@ -222,6 +257,51 @@ namespace SmartPeak
 		}
 		return y;
 	}
+
+	template <typename TensorT>
+	void EMGModel<TensorT>::PDF(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_I,
+		Eigen::Ref<Eigen::Array<TensorT, Eigen::Dynamic, 1>> y_O) const
+	{
+		if (y_O.size() != x_I.size()) {
+			const std::string error = "The output array has " + std::to_string(y_O.size()) + " points but the input array has " + std::to_string(x_I.size()) + " points.";
+			throw std::runtime_error(error);
+		}
+		const auto u = (x_I - emg_mu_) / emg_sigma_;
+
+		// sharp peaks (i.e., the limit tau -> 0)
+		const TensorT s = emg_sigma_ / emg_tau_;
+		if (emg_tau_ <= TensorT(0) || s >= TensorT(1e4)) {
+			y_O = emg_h_ * (TensorT(-0.5) * u.square()).exp() / (TensorT(1) - (x_I - emg_mu_) * (emg_tau_ / (emg_sigma_ * emg_sigma_)));
+			return;
+		}
+
+		// erfcx(|z|) = q*exp(P(q)) with q = 1/(1+|z|/2)
+		const auto z = (s - u) * TensorT(0.7071067811865476);
+		const auto q = (TensorT(1) + TensorT(0.5) * z.abs()).inverse();
+		const auto P = TensorT(-1.26551223) + q * (TensorT(1.00002368) + q * (TensorT(0.37409196) + q * (TensorT(0.09678418) +
+			q * (TensorT(-0.18628806) + q * (TensorT(0.27886807) + q * (TensorT(-1.13520398) + q * (TensorT(1.48851587) +
+			q * (TensorT(-0.82215223) + q * TensorT(0.17087277)))))))));
+		const auto negative = (z < TensorT(0)).template cast<TensorT>();
+
+		// for z < 0, exp(-0.5*u^2)*erfcx(z) = 2*exp(z^2-0.5*u^2) - exp(-0.5*u^2)*erfcx(-z)
+		// (the exponent is clipped so that the masked out term cannot overflow for z >= 0)
+		const TensorT A = emg_h_ * s * TensorT(1.2533141373155003);
+		y_O = A * (negative * TensorT(2) * (TensorT(0.5) * s * s - s * u).min(TensorT(0)).exp() +
+			(TensorT(1) - TensorT(2) * negative) * q * (P - TensorT(0.5) * u.square()).exp());
+	}
+
+	template <typename TensorT>
+	void EMGModel<TensorT>::PDFs(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_I,
+		const std::vector<EMGModel<TensorT>>& emgs,
+		Eigen::Ref<Eigen::Array<TensorT, Eigen::Dynamic, Eigen::Dynamic>> y_O)
+	{
+		if (y_O.cols() != emgs.size()) {
+			const std::string error = "The output array has " + std::to_string(y_O.cols()) + " columns but there are " + std::to_string(emgs.size()) + " peaks.";
+			throw std::runtime_error(error);
+		}
+		for (int i = 0; i < emgs.size(); ++i)
+			emgs[i].PDF(x_I, y_O.col(i));
+	}
 }
 
 #endif //SMARTPEAK_EMGMODEL_H
\ No newline at end of file
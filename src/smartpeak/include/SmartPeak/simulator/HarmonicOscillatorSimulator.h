@@ -6,6 +6,9 @@
 #include <SmartPeak/simulator/DataSimulator.h>
 #include <SmartPeak/core/Preprocessing.h>
 
+// .cpp
+#include <random>
+
 namespace SmartPeak
 {
   /**
@@ -151,8 +154,84 @@ namespace SmartPeak
       const TensorT& x1o, const TensorT& x2o,
       const TensorT& k1);
 
+    /*
+    @brief Batch of 3 weight and 2 spring systems (1D) without damping
+
+    The closed-form solutions of `WeightSpring3W2S1D` are evaluated for all trajectories and time-steps
+      at once over the time axis t = i * time_intervals (i.e., without accumulating the time-steps)
+
+    @param[in, out] time_steps (dim0: n_time_steps)
+    @param[in, out] displacements (dim0: batch, dim1: n_time_steps, dim2: x1...x3 displacements)
+    @param[in] time_intervals The spacing between time-steps
+    @param[in] A1...A3 The amplitudes for each of the mass oscillations (dim0: batch)
+    @param[in] m1...m3 The mass values (dim0: batch)
+    @param[in] x1o...x3o The starting mass displacements from their starting positions (dim0: batch)
+    @param[in] k The spring constant (dim0: batch)
+    **/
+    static void WeightSpring3W2S1DBatch(
+      Eigen::Tensor<TensorT, 1>& time_steps,
+      Eigen::Tensor<TensorT, 3>& displacements,
+      const TensorT& time_intervals,
+      const Eigen::Tensor<TensorT, 1>& A1, const Eigen::Tensor<TensorT, 1>& A2, const Eigen::Tensor<TensorT, 1>& A3,
+      const Eigen::Tensor<TensorT, 1>& m1, const Eigen::Tensor<TensorT, 1>& m2, const Eigen::Tensor<TensorT, 1>& m3,
+      const Eigen::Tensor<TensorT, 1>& x1o, const Eigen::Tensor<TensorT, 1>& x2o, const Eigen::Tensor<TensorT, 1>& x3o,
+      const Eigen::Tensor<TensorT, 1>& k);
+
+    /*
+    @brief Batch of 1 weight and 1 spring systems (1D) without damping (see `WeightSpring1W1S1D`)
+
+    @param[in, out] time_steps (dim0: n_time_steps)
+    @param[in, out] displacements (dim0: batch, dim1: n_time_steps, dim2: x1 displacement)
+    @param[in] time_intervals The spacing between time-steps
+    @param[in] m1, k1, x1o, v1o The mass, spring constant, starting displacement, and starting velocity (dim0: batch)
+    **/
+    static void WeightSpring1W1S1DBatch(
+      Eigen::Tensor<TensorT, 1>& time_steps,
+      Eigen::Tensor<TensorT, 3>& displacements,
+      const TensorT& time_intervals,
+      const Eigen::Tensor<TensorT, 1>& m1, const Eigen::Tensor<TensorT, 1>& k1,
+      const Eigen::Tensor<TensorT, 1>& x1o, const Eigen::Tensor<TensorT, 1>& v1o);
+
+    /*
+    @brief Batch of 1 weight and 1 spring systems (1D) with damping (see `WeightSpring1W1S1DwDamping`)
+
+    The under, critically, and over damped solutions are written as
+      x1 = exp(r1 * t) * (C1 * cos(g * t) + C2 * sin(g * t) + C4 * t) + C3 * exp(r2 * t)
+      so that the coefficients of each trajectory are computed once and all trajectories are evaluated together
+
+    @param[in, out] time_steps (dim0: n_time_steps)
+    @param[in, out] displacements (dim0: batch, dim1: n_time_steps, dim2: x1 displacement)
+    @param[in] time_intervals The spacing between time-steps
+    @param[in] m1, k1, beta1, x1o, v1o The mass, spring constant, damping constant, starting displacement, and starting velocity (dim0: batch)
+    **/
+    static void WeightSpring1W1S1DwDampingBatch(
+      Eigen::Tensor<TensorT, 1>& time_steps,
+      Eigen::Tensor<TensorT, 3>& displacements,
+      const TensorT& time_intervals,
+      const Eigen::Tensor<TensorT, 1>& m1, const Eigen::Tensor<TensorT, 1>& k1, const Eigen::Tensor<TensorT, 1>& beta1,
+      const Eigen::Tensor<TensorT, 1>& x1o, const Eigen::Tensor<TensorT, 1>& v1o);
+
+    /*
+    @brief Random parameters for a batch of trajectories
+
+    @param[in] batch_size
+    @param[in] bounds The lower and upper bounds of the uniform distribution
+    @param[in] engine The random number generator
+
+    @returns The parameters (dim0: batch)
+    **/
+    static Eigen::Tensor<TensorT, 1> makeRandomParameters(const int& batch_size, const std::pair<TensorT, TensorT>& bounds, std::mt19937& engine);
+
     // [TODO: add option for gaussian_noise]
     TensorT gaussian_noise_ = 0;  ///< the amount of gaussian noise to add to the oscillator trajectories
+
+  private:
+    /// time = i * time_intervals
+    static void makeTimeSteps_(Eigen::Tensor<TensorT, 1>& time_steps, const TensorT& time_intervals);
+    /// [batch, time] broadcast of the batch parameters
+    static Eigen::Tensor<TensorT, 2> broadcastBatch_(const Eigen::Tensor<TensorT, 1>& values, const int& n_time_steps);
+    /// [batch, time] outer product of the batch parameters and the time-steps
+    static Eigen::Tensor<TensorT, 2> outerTime_(const Eigen::Tensor<TensorT, 1>& values, const Eigen::Tensor<TensorT, 1>& time_steps);
   };
 
   template<typename TensorT>
@@ -270,6 +349,132 @@ namespace SmartPeak
       displacements(iter, 0) = x1_lambda(time_steps(iter), k1, beta1, m1, x1o, v1o);
     }
   }
+  template<typename TensorT>
+  inline void HarmonicOscillatorSimulator<TensorT>::makeTimeSteps_(Eigen::Tensor<TensorT, 1>& time_steps, const TensorT& time_intervals)
+  {
+    time_steps = time_steps.constant(TensorT(1)).cumsum(0, true) * time_steps.constant(time_intervals);
+  }
+  template<typename TensorT>
+  inline Eigen::Tensor<TensorT, 2> HarmonicOscillatorSimulator<TensorT>::broadcastBatch_(const Eigen::Tensor<TensorT, 1>& values, const int& n_time_steps)
+  {
+    return values.reshape(Eigen::array<Eigen::Index, 2>({ values.dimension(0), 1 })).broadcast(Eigen::array<Eigen::Index, 2>({ 1, n_time_steps }));
+  }
+  template<typename TensorT>
+  inline Eigen::Tensor<TensorT, 2> HarmonicOscillatorSimulator<TensorT>::outerTime_(const Eigen::Tensor<TensorT, 1>& values, const Eigen::Tensor<TensorT, 1>& time_steps)
+  {
+    return broadcastBatch_(values, time_steps.dimension(0)) *
+      time_steps.reshape(Eigen::array<Eigen::Index, 2>({ 1, time_steps.dimension(0) })).broadcast(Eigen::array<Eigen::Index, 2>({ values.dimension(0), 1 }));
+  }
+  template<typename TensorT>
+  inline Eigen::Tensor<TensorT, 1> HarmonicOscillatorSimulator<TensorT>::makeRandomParameters(const int& batch_size, const std::pair<TensorT, TensorT>& bounds, std::mt19937& engine)
+  {
+    std::uniform_real_distribution<TensorT> distribution(bounds.first, bounds.second);
+    Eigen::Tensor<TensorT, 1> parameters(batch_size);
+    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+      parameters(batch_iter) = (bounds.first < bounds.second) ? distribution(engine) : bounds.first;
+    return parameters;
+  }
+  template<typename TensorT>
+  void HarmonicOscillatorSimulator<TensorT>::WeightSpring3W2S1DBatch(
+    Eigen::Tensor<TensorT, 1>& time_steps, Eigen::Tensor<TensorT, 3>& displacements, const TensorT& time_intervals,
+    const Eigen::Tensor<TensorT, 1>& A1, const Eigen::Tensor<TensorT, 1>& A2, const Eigen::Tensor<TensorT, 1>& A3,
+    const Eigen::Tensor<TensorT, 1>& m1, const Eigen::Tensor<TensorT, 1>& m2, const Eigen::Tensor<TensorT, 1>& m3,
+    const Eigen::Tensor<TensorT, 1>& x1o, const Eigen::Tensor<TensorT, 1>& x2o, const Eigen::Tensor<TensorT, 1>& x3o,
+    const Eigen::Tensor<TensorT, 1>& k) {
+    // Quick checks
+    const int batch_size = displacements.dimension(0);
+    const int n_time_steps = displacements.dimension(1);
+    assert(n_time_steps == time_steps.dimension(0));
+    assert(displacements.dimension(2) == 3);
+    assert(batch_size == k.dimension(0));
+
+    // Analytical solutions for each mass
+    makeTimeSteps_(time_steps, time_intervals);
+    Eigen::Tensor<TensorT, 2> w1t = outerTime_((k / m1).sqrt(), time_steps);
+    Eigen::Tensor<TensorT, 2> w2t = outerTime_((k / m2).sqrt() * k.constant(TensorT(sqrt(2))), time_steps);
+    Eigen::Tensor<TensorT, 2> w3t = outerTime_((k / m3).sqrt(), time_steps);
+    Eigen::Tensor<TensorT, 2> x2o_bcast = broadcastBatch_(x2o, n_time_steps);
+    displacements.chip(0, 2) = x2o_bcast + broadcastBatch_(A1, n_time_steps) * (w1t.unaryExpr(Eigen::internal::scalar_sin_op<TensorT>()) + w1t.unaryExpr(Eigen::internal::scalar_cos_op<TensorT>()));
+    displacements.chip(2, 2) = x2o_bcast + broadcastBatch_(A3, n_time_steps) * (w3t.unaryExpr(Eigen::internal::scalar_sin_op<TensorT>()) + w3t.unaryExpr(Eigen::internal::scalar_cos_op<TensorT>()));
+    displacements.chip(1, 2) = broadcastBatch_((k * x1o + k * x3o) / (k * k.constant(TensorT(2))), n_time_steps) +
+      broadcastBatch_(A2, n_time_steps) * (w2t.unaryExpr(Eigen::internal::scalar_sin_op<TensorT>()) + w2t.unaryExpr(Eigen::internal::scalar_cos_op<TensorT>()));
+
+    // Starting displacements
+    if (n_time_steps > 0) {
+      displacements.chip(0, 1).chip(0, 1) = x1o;
+      displacements.chip(0, 1).chip(1, 1) = x2o;
+      displacements.chip(0, 1).chip(2, 1) = x3o;
+    }
+  }
+  template<typename TensorT>
+  void HarmonicOscillatorSimulator<TensorT>::WeightSpring1W1S1DBatch(
+    Eigen::Tensor<TensorT, 1>& time_steps, Eigen::Tensor<TensorT, 3>& displacements, const TensorT& time_intervals,
+    const Eigen::Tensor<TensorT, 1>& m1, const Eigen::Tensor<TensorT, 1>& k1,
+    const Eigen::Tensor<TensorT, 1>& x1o, const Eigen::Tensor<TensorT, 1>& v1o) {
+    // Quick checks
+    const int n_time_steps = displacements.dimension(1);
+    assert(n_time_steps == time_steps.dimension(0));
+    assert(displacements.dimension(2) == 1);
+    assert(displacements.dimension(0) == m1.dimension(0));
+
+    // Analytical solution
+    makeTimeSteps_(time_steps, time_intervals);
+    Eigen::Tensor<TensorT, 1> w = (k1 / m1).sqrt();
+    Eigen::Tensor<TensorT, 2> wt = outerTime_(w, time_steps);
+    displacements.chip(0, 2) = broadcastBatch_(x1o, n_time_steps) * wt.unaryExpr(Eigen::internal::scalar_cos_op<TensorT>()) +
+      broadcastBatch_(v1o / w, n_time_steps) * wt.unaryExpr(Eigen::internal::scalar_sin_op<TensorT>());
+  }
+  template<typename TensorT>
+  void HarmonicOscillatorSimulator<TensorT>::WeightSpring1W1S1DwDampingBatch(
+    Eigen::Tensor<TensorT, 1>& time_steps, Eigen::Tensor<TensorT, 3>& displacements, const TensorT& time_intervals,
+    const Eigen::Tensor<TensorT, 1>& m1, const Eigen::Tensor<TensorT, 1>& k1, const Eigen::Tensor<TensorT, 1>& beta1,
+    const Eigen::Tensor<TensorT, 1>& x1o, const Eigen::Tensor<TensorT, 1>& v1o) {
+    // Quick checks
+    const int batch_size = displacements.dimension(0);
+    const int n_time_steps = displacements.dimension(1);
+    assert(n_time_steps == time_steps.dimension(0));
+    assert(displacements.dimension(2) == 1);
+    assert(batch_size == m1.dimension(0));
+
+    // Coefficients of the under, critically, or over damped solution of each trajectory
+    Eigen::Tensor<TensorT, 1> r1(batch_size), r2(batch_size), g(batch_size), C1(batch_size), C2(batch_size), C3(batch_size), C4(batch_size);
+    r2.setZero(); g.setZero(); C2.setZero(); C3.setZero(); C4.setZero();
+    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+      const TensorT w = sqrt(k1(batch_iter) / m1(batch_iter));
+      const TensorT beta = beta1(batch_iter);
+      const TensorT x = x1o(batch_iter);
+      const TensorT v = v1o(batch_iter);
+      const TensorT check = pow(beta, 2) - 4 * pow(w, 2);
+      C1(batch_iter) = x;
+      if (check < 0) {
+        const TensorT gamma = 0.5 * sqrt(4 * pow(w, 2) - pow(beta, 2));
+        r1(batch_iter) = -beta / 2;
+        g(batch_iter) = gamma;
+        C2(batch_iter) = beta * x / (2 * gamma) + v / gamma;
+      }
+      else if (check == 0) {
+        r1(batch_iter) = -w;
+        C4(batch_iter) = w * x + v;
+      }
+      else {
+        const TensorT rneg = 0.5 * (-beta - sqrt(check));
+        const TensorT rpos = 0.5 * (-beta + sqrt(check));
+        r1(batch_iter) = rneg;
+        r2(batch_iter) = rpos;
+        C3(batch_iter) = (rneg * x - v) / (rneg - rpos);
+        C1(batch_iter) = x - C3(batch_iter);
+      }
+    }
+
+    // Analytical solution
+    makeTimeSteps_(time_steps, time_intervals);
+    Eigen::Tensor<TensorT, 2> gt = outerTime_(g, time_steps);
+    displacements.chip(0, 2) = outerTime_(r1, time_steps).exp() * (
+      broadcastBatch_(C1, n_time_steps) * gt.unaryExpr(Eigen::internal::scalar_cos_op<TensorT>()) +
+      broadcastBatch_(C2, n_time_steps) * gt.unaryExpr(Eigen::internal::scalar_sin_op<TensorT>()) +
+      outerTime_(C4, time_steps)) +
+      broadcastBatch_(C3, n_time_steps) * outerTime_(r2, time_steps).exp();
+  }
 }
 
 #endif //SMARTPEAK_HARMONICOSCILLATORSIMULATOR_H
\ No newline at end of file
@@ -6,6 +6,18 @@
 #include <SmartPeak/simulator/DataSimulator.h>
 #include <SmartPeak/core/Preprocessing.h>
 
+// .cpp
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <sys/stat.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace SmartPeak
 {
   /**
@@ -39,6 +51,51 @@ public:
   void readData(const std::string& filename_data, const std::string& filename_labels, const bool& is_training,
     const int& data_size, const int& input_size);
 
+	/*
+	@brief Read in the MNIST data set from a memory-mapped IDX file.
+
+	The big-endian header is decoded once and the images are converted and scaled in bulk.
+		The output data dimensions are the same as for `ReadMNIST`.
+
+	@param[in] filename
+	@param[in, out] data The tensor to hold the data
+	@param[in] is_labels True if the file corresponds to class labels, False otherwise
+	@param[in] pixel_range The range that the pixel intensities [0, 255] are linearly scaled to (not used for labels)
+	*/
+  void ReadMNISTMapped(const std::string& filename, Eigen::Tensor<TensorT, 2>& data, const bool& is_labels,
+    const std::pair<TensorT, TensorT>& pixel_range = std::make_pair(TensorT(0), TensorT(255)));
+
+  /*
+  @brief Read in the MNIST images and labels as in `readData` using `ReadMNISTMapped`
+
+  The pixel intensities are scaled to the pixel_range as they are read
+    (e.g., [0, 1] instead of calling `unitScaleData` or [-1, 1] instead of calling `centerUnitScaleData`).
+    If a cache filename is given, the scaled images are read from the cache when it was made from the same
+    IDX file with the same dimensions and pixel range, and the cache is (re)written otherwise.
+
+  @param[in] pixel_range The range that the pixel intensities [0, 255] are linearly scaled to
+  @param[in] cache_filename The binary cache of the scaled images (or "" to not use a cache)
+  */
+  void readDataMapped(const std::string& filename_data, const std::string& filename_labels, const bool& is_training,
+    const int& data_size, const int& input_size, const std::pair<TensorT, TensorT>& pixel_range = std::make_pair(TensorT(0), TensorT(1)),
+    const std::string& cache_filename = "");
+
+  /*
+  @brief Read the scaled images from a binary cache
+
+  @returns True if the cache was made from the IDX file with the dimensions of data and the pixel range, False otherwise
+  */
+  bool readCache(const std::string& cache_filename, const std::string& filename_data, Eigen::Tensor<TensorT, 2>& data,
+    const std::pair<TensorT, TensorT>& pixel_range);
+
+  /*
+  @brief Write the scaled images to a binary cache
+
+  @returns True if the cache was written, False otherwise
+  */
+  bool writeCache(const std::string& cache_filename, const std::string& filename_data, const Eigen::Tensor<TensorT, 2>& data,
+    const std::pair<TensorT, TensorT>& pixel_range);
+
   void smoothLabels(const TensorT& zero_offset, const TensorT& one_offset); ///< Read in the MNIST data set from an IDX file format
 
   void unitScaleData(); ///< Unit scale training and test pixels
@@ -81,6 +138,77 @@ public:
   Eigen::Tensor<TensorT, 2> training_labels; ///< Training labels with dimensions dim 0: sample; dim 1: class label
   Eigen::Tensor<TensorT, 2> validation_labels; ///< Validation labels with dimensions dim 0: sample; dim 1: class label
  private:
+  /// Read-only view of the bytes of a file (memory-mapped where available)
+  class MappedFile_
+  {
+  public:
+    explicit MappedFile_(const std::string& filename)
+    {
+#if !defined(_WIN32)
+      const int fd = open(filename.c_str(), O_RDONLY);
+      if (fd >= 0) {
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+          void* mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (mapping != MAP_FAILED) {
+            mapping_ = mapping;
+            size_ = file_stat.st_size;
+            data_ = (const unsigned char*)mapping;
+          }
+        }
+        close(fd);
+      }
+      if (mapping_ != nullptr) return;
+#endif
+      // read the whole file into memory instead
+      std::ifstream file(filename, std::ios::binary | std::ios::ate);
+      if (!file.is_open()) {
+        const std::string error = "The file " + filename + " could not be opened.";
+        throw std::runtime_error(error);
+      }
+      buffer_.resize(file.tellg());
+      file.seekg(0);
+      file.read((char*)buffer_.data(), buffer_.size());
+      size_ = buffer_.size();
+      data_ = buffer_.data();
+    }
+    ~MappedFile_()
+    {
+#if !defined(_WIN32)
+      if (mapping_ != nullptr) munmap(mapping_, size_);
+#endif
+    }
+    MappedFile_(const MappedFile_&) = delete;
+    MappedFile_& operator=(const MappedFile_&) = delete;
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+  private:
+    void* mapping_ = nullptr;
+    std::vector<unsigned char> buffer_;
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+  };
+
+  /// Decode a big-endian 32-bit integer
+  static int readBigEndianInt_(const unsigned char* bytes) {
+    return ((int)bytes[0] << 24) + ((int)bytes[1] << 16) + ((int)bytes[2] << 8) + (int)bytes[3];
+  }
+
+  /// Header of the binary cache of scaled images
+  struct CacheHeader_
+  {
+    char magic[8] = { 'S', 'P', 'M', 'N', 'I', 'S', 'T', '1' };
+    int64_t tensor_size = sizeof(TensorT);
+    int64_t n_samples = 0;
+    int64_t n_pixels = 0;
+    double range_min = 0;
+    double range_max = 0;
+    int64_t source_size = 0;
+    int64_t source_mtime = 0;
+  };
+  static bool makeCacheHeader_(const std::string& filename_data, const Eigen::Tensor<TensorT, 2>& data,
+    const std::pair<TensorT, TensorT>& pixel_range, CacheHeader_& header);
+
 	// Internal iterators
 	int mnist_sample_start_training = 0;
 	int mnist_sample_end_training = 0;
@@ -177,6 +305,117 @@ public:
     }
   }
 
+  template<typename TensorT>
+  inline void MNISTSimulator<TensorT>::ReadMNISTMapped(const std::string& filename, Eigen::Tensor<TensorT, 2>& data, const bool& is_labels,
+    const std::pair<TensorT, TensorT>& pixel_range) {
+    MappedFile_ file(filename);
+
+    // decode the header
+    const int header_size = (is_labels) ? 8 : 16;
+    if (file.size() < header_size) {
+      const std::string error = "The file " + filename + " is not an IDX file.";
+      throw std::runtime_error(error);
+    }
+    const int magic_number = readBigEndianInt_(file.data());
+    const int number_of_images = readBigEndianInt_(file.data() + 4);
+    const int n_rows = (is_labels) ? 1 : readBigEndianInt_(file.data() + 8);
+    const int n_cols = (is_labels) ? 1 : readBigEndianInt_(file.data() + 12);
+    if (magic_number != ((is_labels) ? 2049 : 2051) || number_of_images < 0 || n_rows < 0 || n_cols < 0) {
+      const std::string error = "The file " + filename + " is not an IDX " + ((is_labels) ? "label" : "image") + " file.";
+      throw std::runtime_error(error);
+    }
+    const int n_pixels = n_rows * n_cols;
+    if (n_pixels > data.dimension(1)) {
+      const std::string error = "The images in " + filename + " have " + std::to_string(n_pixels) + " pixels but the data has only " + std::to_string(data.dimension(1)) + " columns.";
+      throw std::runtime_error(error);
+    }
+    const int n_images = std::min(number_of_images, (int)data.dimension(0));
+    if (file.size() < header_size + (size_t)n_images * n_pixels) {
+      const std::string error = "The file " + filename + " is truncated.";
+      throw std::runtime_error(error);
+    }
+    if (n_images < data.dimension(0) || n_pixels < data.dimension(1)) data.setZero();
+
+    // convert the data in bulk (read row-wise; returned col-wise)
+    Eigen::TensorMap<const Eigen::Tensor<unsigned char, 3>> bytes(file.data() + header_size, n_cols, n_rows, n_images);
+    const Eigen::array<Eigen::Index, 2> offsets = { 0, 0 };
+    const Eigen::array<Eigen::Index, 2> extents = { n_images, n_pixels };
+    if (is_labels) {
+      data.slice(offsets, extents) = bytes.cast<TensorT>().reshape(extents);
+    }
+    else {
+      const TensorT scale = (pixel_range.second - pixel_range.first) / TensorT(255);
+      data.slice(offsets, extents) = (bytes.shuffle(Eigen::array<int, 3>({ 2, 1, 0 })).cast<TensorT>() * scale + pixel_range.first).reshape(extents);
+    }
+  }
+
+  template<typename TensorT>
+  inline void MNISTSimulator<TensorT>::readDataMapped(const std::string& filename_data, const std::string& filename_labels, const bool& is_training,
+    const int& data_size, const int& input_size, const std::pair<TensorT, TensorT>& pixel_range, const std::string& cache_filename) {
+    // Read input images
+    Eigen::Tensor<TensorT, 2> input_data(data_size, input_size);
+    if (cache_filename.empty() || !readCache(cache_filename, filename_data, input_data, pixel_range)) {
+      ReadMNISTMapped(filename_data, input_data, false, pixel_range);
+      if (!cache_filename.empty() && !writeCache(cache_filename, filename_data, input_data, pixel_range))
+        std::cout << "The cache " << cache_filename << " could not be written." << std::endl;
+    }
+
+    // Read input labels
+    Eigen::Tensor<TensorT, 2> labels(data_size, 1);
+    ReadMNISTMapped(filename_labels, labels, true);
+
+    // Convert labels to 1 hot encoding
+    Eigen::Tensor<TensorT, 2> labels_encoded = OneHotEncoder<TensorT, TensorT>(labels, mnist_labels);
+
+    if (is_training)
+    {
+      training_data = input_data;
+      training_labels = labels_encoded;
+    }
+    else
+    {
+      validation_data = input_data;
+      validation_labels = labels_encoded;
+    }
+  }
+
+  template<typename TensorT>
+  inline bool MNISTSimulator<TensorT>::makeCacheHeader_(const std::string& filename_data, const Eigen::Tensor<TensorT, 2>& data,
+    const std::pair<TensorT, TensorT>& pixel_range, CacheHeader_& header) {
+    struct stat file_stat;
+    if (stat(filename_data.c_str(), &file_stat) != 0) return false;
+    header.n_samples = data.dimension(0);
+    header.n_pixels = data.dimension(1);
+    header.range_min = pixel_range.first;
+    header.range_max = pixel_range.second;
+    header.source_size = file_stat.st_size;
+    header.source_mtime = file_stat.st_mtime;
+    return true;
+  }
+
+  template<typename TensorT>
+  inline bool MNISTSimulator<TensorT>::readCache(const std::string& cache_filename, const std::string& filename_data, Eigen::Tensor<TensorT, 2>& data,
+    const std::pair<TensorT, TensorT>& pixel_range) {
+    CacheHeader_ header_expected, header;
+    if (!makeCacheHeader_(filename_data, data, pixel_range, header_expected)) return false;
+    std::ifstream file(cache_filename, std::ios::binary);
+    if (!file.is_open() || !file.read((char*)&header, sizeof(header))) return false;
+    if (std::memcmp(&header, &header_expected, sizeof(header)) != 0) return false;
+    return (bool)file.read((char*)data.data(), data.size() * sizeof(TensorT));
+  }
+
+  template<typename TensorT>
+  inline bool MNISTSimulator<TensorT>::writeCache(const std::string& cache_filename, const std::string& filename_data, const Eigen::Tensor<TensorT, 2>& data,
+    const std::pair<TensorT, TensorT>& pixel_range) {
+    CacheHeader_ header;
+    if (!makeCacheHeader_(filename_data, data, pixel_range, header)) return false;
+    std::ofstream file(cache_filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)data.data(), data.size() * sizeof(TensorT));
+    return (bool)file;
+  }
+
   template<typename TensorT>
   inline void MNISTSimulator<TensorT>::smoothLabels(const TensorT& zero_offset, const TensorT& one_offset) {
     training_labels = training_labels.unaryExpr(LabelSmoother<TensorT>(zero_offset, one_offset));
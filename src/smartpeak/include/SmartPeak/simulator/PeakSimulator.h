@@ -55,6 +55,8 @@ namespace SmartPeak
 			@returns std::pair<TensorT, TensorT> of best left and right points for the peak
 		*/
 		std::pair<TensorT, TensorT> getBestLeftAndRight(std::vector<TensorT>& x_O, std::vector<TensorT>& y_O, const TensorT& rt, const TensorT& detection_threshold = 1e-2) const;
+		std::pair<TensorT, TensorT> getBestLeftAndRight(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_O,
+			const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& y_O, const TensorT& rt, const TensorT& detection_threshold = 1e-2) const;
 
 		/**
 			@brief simulates two vector of points that correspond to x and y values that
@@ -67,6 +69,34 @@ namespace SmartPeak
 		void simulatePeak(std::vector<TensorT>& x_O, std::vector<TensorT>& y_O,
 			const EMGModel<TensorT>& emg) const;
 
+		/**
+			@brief simulates the x and y values of a peak into reusable arrays using a caller-owned random engine
+
+			The arrays are only grown when the peak has more points than they can hold
+				so that repeated calls do not allocate.
+
+			@param[in,out] x_O Array of x values representing time or m/z (the first n values are set)
+			@param[in,out] y_O Array of y values representing the intensity at time t or m/z m (the first n values are set)
+			@param[in] emg An emg model class
+			@param[in,out] engine The random engine used for the step size and detector noise
+
+			@returns The number of points n of the peak
+		*/
+		int simulatePeak(Eigen::Array<TensorT, Eigen::Dynamic, 1>& x_O, Eigen::Array<TensorT, Eigen::Dynamic, 1>& y_O,
+			const EMGModel<TensorT>& emg, std::mt19937& engine) const;
+
+		/**
+			@brief simulates the intensities of many peaks at the same x values in one call
+				(see `EMGModel::PDFs`) including the baselines, detector noise, and saturation of `simulatePeak`
+
+			@param[in] x_I The x values representing time or m/z [n_points]
+			@param[in] emgs The emg model of each peak
+			@param[out] y_O The intensities of each peak (preallocated to [n_points, n_peaks])
+		*/
+		void simulatePeaks(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_I,
+			const std::vector<EMGModel<TensorT>>& emgs,
+			Eigen::Ref<Eigen::Array<TensorT, Eigen::Dynamic, Eigen::Dynamic>> y_O) const;
+
 		/**
 			@brief Generates a range of values with noise sampled from a normal distribution
 
@@ -387,12 +417,20 @@ namespace SmartPeak
 
 	template<typename TensorT>
 	inline std::pair<TensorT, TensorT> PeakSimulator<TensorT>::getBestLeftAndRight(std::vector<TensorT>& x_O, std::vector<TensorT>& y_O, const TensorT& rt, const TensorT& detection_threshold) const
+	{
+		return getBestLeftAndRight(Eigen::Map<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>(x_O.data(), x_O.size()),
+			Eigen::Map<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>(y_O.data(), y_O.size()), rt, detection_threshold);
+	}
+
+	template<typename TensorT>
+	inline std::pair<TensorT, TensorT> PeakSimulator<TensorT>::getBestLeftAndRight(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_O,
+		const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& y_O, const TensorT& rt, const TensorT& detection_threshold) const
 	{
 		TensorT best_left = (TensorT)0;
 		TensorT best_right = (TensorT)0;
 
 		// iterate from the left
-		for (int i = 1; i < x_O.size() - 1; ++i) {
+		for (int i = 1; i < (int)x_O.size() - 1; ++i) {
 			if (y_O[i] > baseline_left_ + noise_sigma_ + detection_threshold) {
 				best_left = x_O[i - 1];
 				break;
@@ -402,7 +440,7 @@ namespace SmartPeak
 		}
 
 		// iterate from the right
-		for (int i = x_O.size() - 2; i >= 0; --i) {
+		for (int i = (int)x_O.size() - 2; i >= 0; --i) {
 			if (y_O[i] > baseline_right_ + noise_sigma_ + detection_threshold) {
 				best_right = x_O[i + 1];
 				break;
@@ -425,10 +463,9 @@ namespace SmartPeak
 		// make the time array
 		x_O = generateRangeWithNoise(window_start_, step_size_mu_, step_size_sigma_, window_end_);
 		// make the intensity array
-		for (TensorT x : x_O)
-		{
-			y_O.push_back(emg.PDF(x));
-		}
+		y_O.resize(x_O.size());
+		emg.PDF(Eigen::Map<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>(x_O.data(), x_O.size()),
+			Eigen::Map<Eigen::Array<TensorT, Eigen::Dynamic, 1>>(y_O.data(), y_O.size()));
 		// add a baseline to the intensity array
 		addBaseline(x_O, y_O, baseline_left_, baseline_right_, emg.getMu());
 		// add noise to the intensity array
@@ -436,6 +473,80 @@ namespace SmartPeak
 		// add saturation limit
 		flattenPeak(y_O, saturation_limit_);
 	}
+
+	template <typename TensorT>
+	int PeakSimulator<TensorT>::simulatePeak(Eigen::Array<TensorT, Eigen::Dynamic, 1>& x_O, Eigen::Array<TensorT, Eigen::Dynamic, 1>& y_O,
+		const EMGModel<TensorT>& emg, std::mt19937& engine) const
+	{
+		// make the time array (see `generateRangeWithNoise`)
+		TensorT step_mu_used = step_size_mu_;
+		TensorT step_sigma_used = step_size_sigma_;
+		if (step_size_mu_ <= (TensorT)0) {
+			step_mu_used = (TensorT)1.0;
+			step_sigma_used = (TensorT)0;
+		}
+		else if (step_size_mu_ - (TensorT)5 * step_size_sigma_ <= (TensorT)0) {
+			step_sigma_used = (TensorT)0;
+		}
+		std::normal_distribution<> d{ step_mu_used, step_sigma_used > (TensorT)0 ? step_sigma_used : (TensorT)1 };
+		int n_points = 0;
+		TensorT value = window_start_;
+		while (value <= window_end_) {
+			if (n_points >= x_O.size()) {
+				x_O.conservativeResize(std::max<int>(2 * x_O.size(), 64));
+			}
+			x_O(n_points) = value;
+			value += (step_sigma_used > (TensorT)0) ? (TensorT)d(engine) : step_mu_used;
+			++n_points;
+		}
+		if (y_O.size() < x_O.size()) y_O.resize(x_O.size());
+
+		// make the intensity array
+		auto x = x_O.head(n_points);
+		auto y = y_O.head(n_points);
+		emg.PDF(x, y);
+		// add a baseline to the intensity array
+		y = (x <= emg.getMu()).select(y.max(baseline_left_), y.max(baseline_right_));
+		// add noise to the intensity array
+		if (noise_sigma_ > 0) {
+			std::normal_distribution<> noise{ noise_mu_, noise_sigma_ };
+			for (int i = 0; i < n_points; ++i)
+				y(i) += noise(engine);
+		}
+		else {
+			y += noise_mu_;
+		}
+		// add saturation limit
+		y = y.min(saturation_limit_);
+		return n_points;
+	}
+
+	template <typename TensorT>
+	void PeakSimulator<TensorT>::simulatePeaks(const Eigen::Ref<const Eigen::Array<TensorT, Eigen::Dynamic, 1>>& x_I,
+		const std::vector<EMGModel<TensorT>>& emgs,
+		Eigen::Ref<Eigen::Array<TensorT, Eigen::Dynamic, Eigen::Dynamic>> y_O) const
+	{
+		// make the intensity arrays
+		EMGModel<TensorT>::PDFs(x_I, emgs, y_O);
+
+		std::random_device rd{};
+		std::mt19937 gen{ rd() };
+		for (int i = 0; i < emgs.size(); ++i) {
+			// add a baseline to the intensity array
+			y_O.col(i) = (x_I <= emgs[i].getMu()).select(y_O.col(i).max(baseline_left_), y_O.col(i).max(baseline_right_));
+			// add noise to the intensity array
+			if (noise_sigma_ > 0) {
+				std::normal_distribution<> d{ noise_mu_, noise_sigma_ };
+				for (int j = 0; j < y_O.rows(); ++j)
+					y_O(j, i) += d(gen);
+			}
+			else {
+				y_O.col(i) += noise_mu_;
+			}
+		}
+		// add saturation limit
+		y_O = y_O.min(saturation_limit_);
+	}
 }
 
 #endif //SMARTPEAK_PEAKSIMULATOR_H
\ No newline at end of file
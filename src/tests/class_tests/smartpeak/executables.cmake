@@ -10,6 +10,7 @@ set(io_executables_list
   CSVWriter_test
   DataFile_test
   LinkFile_test
+  MessageTransport_test
   ModelFile_test
   ModelInterpreterFile_test
   ModelInterpreterFileGpu_test
@@ -21,12 +22,14 @@ set(io_executables_list
 
 set(graph_executables_list
   CircuitFinder_test
+  CycleFinder_test
 )
 
 set(ml_executables_list
   ActivationFunction_test
   ActivationFunctionTensor_test
   ActivationFunctionTensorGpu_test
+  EvaluationAccumulator_test
   IntegrationFunction_test
   IntegrationFunctionTensor_test
   IntegrationFunctionTensorGpu_test
@@ -40,7 +43,9 @@ set(ml_executables_list
   ModelBuilder_test
   ModelBuilderCpu_test
   ModelBuilderExperimental_test
+  ModelEnsemble_test
   ModelErrorTensorData_test
+  ModelGraph_test
   ModelInterpreter_DAG_test
   ModelInterpreter_DCG_test
   ModelInterpreter_IG_test
@@ -59,6 +64,7 @@ set(ml_executables_list
   OpToTensorOp_test
   PopulationLogger_test
   PopulationTrainer_test
+  PopulationTrainerDistributed_test
   PopulationTrainerGpu_test
   Solver_test
   SolverTensor_test
@@ -68,11 +74,13 @@ set(ml_executables_list
 )
 
 set(simulator_executables_list
+  AddProbSimulator_test
   BiochemicalDataSimulator_test
   BiochemicalReaction_test
   ChromatogramSimulator_test
   DataSimulator_test
   EMGModel_test
+  HarmonicOscillatorSimulator_test
   PeakSimulator_test
   MetabolomicsClassificationDataSimulator_test
   MetabolomicsReconstructionDataSimulator_test
@@ -0,0 +1,66 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE AddProbSimulator test suite 
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/simulator/AddProbSimulator.h>
+
+using namespace SmartPeak;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(addProbSimulator)
+
+BOOST_AUTO_TEST_CASE(AddProb)
+{
+  Eigen::Tensor<float, 1> random_sequence(25), mask_sequence(25);
+  const float result = AddProbSimulator<float>::AddProb(random_sequence, mask_sequence, 5);
+  Eigen::Tensor<float, 0> n_masks = mask_sequence.sum();
+  Eigen::Tensor<float, 0> result_expected = (random_sequence * mask_sequence).sum();
+  BOOST_CHECK_EQUAL(n_masks(0), 5);
+  BOOST_CHECK_CLOSE(result, result_expected(0), 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(AddProbBatch)
+{
+  const int batch_size = 64, sequence_length = 25, n_masks = 5;
+  Eigen::Tensor<float, 2> random_sequences(batch_size, sequence_length), mask_sequences(batch_size, sequence_length);
+  Eigen::Tensor<float, 1> results(batch_size);
+  for (const int& n_threads : { 1, 4 }) {
+    std::mt19937 engine(1);
+    AddProbSimulator<float>::AddProbBatch(random_sequences, mask_sequences, results, n_masks, engine, n_threads);
+    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+      float n_masks_batch = 0, result = 0;
+      for (int i = 0; i < sequence_length; ++i) {
+        BOOST_CHECK_GE(random_sequences(batch_iter, i), 0);
+        BOOST_CHECK_LT(random_sequences(batch_iter, i), 1);
+        BOOST_CHECK(mask_sequences(batch_iter, i) == 0 || mask_sequences(batch_iter, i) == 1);
+        n_masks_batch += mask_sequences(batch_iter, i);
+        result += mask_sequences(batch_iter, i) * random_sequences(batch_iter, i);
+      }
+      BOOST_CHECK_EQUAL(n_masks_batch, n_masks);
+      BOOST_CHECK_CLOSE(results(batch_iter), result, 1e-4);
+    }
+
+    // reproducible for the same engine state
+    Eigen::Tensor<float, 2> random_sequences_2(batch_size, sequence_length), mask_sequences_2(batch_size, sequence_length);
+    Eigen::Tensor<float, 1> results_2(batch_size);
+    std::mt19937 engine_2(1);
+    AddProbSimulator<float>::AddProbBatch(random_sequences_2, mask_sequences_2, results_2, n_masks, engine_2, n_threads);
+    BOOST_CHECK_EQUAL(random_sequences(3, 7), random_sequences_2(3, 7));
+    BOOST_CHECK_EQUAL(results(batch_size - 1), results_2(batch_size - 1));
+
+    // the engine is advanced
+    AddProbSimulator<float>::AddProbBatch(random_sequences_2, mask_sequences_2, results_2, n_masks, engine_2, n_threads);
+    BOOST_CHECK_NE(random_sequences(3, 7), random_sequences_2(3, 7));
+  }
+
+  // all positions masked
+  std::mt19937 engine(1);
+  AddProbSimulator<float>::AddProbBatch(random_sequences, mask_sequences, results, sequence_length, engine);
+  Eigen::Tensor<float, 0> n_masks_total = mask_sequences.sum();
+  BOOST_CHECK_EQUAL(n_masks_total(0), batch_size * sequence_length);
+
+  // too many masks
+  BOOST_CHECK_THROW(AddProbSimulator<float>::AddProbBatch(random_sequences, mask_sequences, results, sequence_length + 1, engine), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
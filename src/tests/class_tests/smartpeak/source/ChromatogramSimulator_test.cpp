@@ -37,6 +37,14 @@ BOOST_AUTO_TEST_CASE(destructor)
   delete ptr;
 }
 
+BOOST_AUTO_TEST_CASE(gettersAndSetters)
+{
+	ChromatogramSimulatorExt<double> chromsimulator;
+	BOOST_CHECK(!chromsimulator.getDensePeaks());
+	chromsimulator.setDensePeaks(true);
+	BOOST_CHECK(chromsimulator.getDensePeaks());
+}
+
 BOOST_AUTO_TEST_CASE(findPeakOverlap)
 {
   ChromatogramSimulatorExt<double> chromsimulator;
@@ -501,4 +509,119 @@ BOOST_AUTO_TEST_CASE(simulateChromatogram)
   BOOST_CHECK_EQUAL(emgs.size(), 3);
 }
 
+
+BOOST_AUTO_TEST_CASE(simulateChromatograms)
+{
+	ChromatogramSimulatorExt<double> chromsimulator;
+	const int batch_size = 3, memory_size = 2, n_points = 33;
+	Eigen::Tensor<double, 3> input_data(batch_size, memory_size, n_points), loss_output_data(batch_size, memory_size, n_points), metric_output_data(batch_size, memory_size, n_points);
+
+	// Perfect gaussian peaks without noise
+	auto simulate = [&](const std::string& output_data_type) {
+		chromsimulator.simulateChromatograms(input_data, loss_output_data, metric_output_data, output_data_type,
+			std::make_pair(1.0, 1.0), std::make_pair(0.0, 0.0), std::make_pair(30.0, 30.0),
+			std::make_pair(0.0, 0.0), std::make_pair(0.0, 0.0), std::make_pair(1.0, 1.0),
+			std::make_pair(3.0, 3.0), std::make_pair(10.0, 10.0), std::make_pair(0.0, 0.0), std::make_pair(0.0, 0.0), std::make_pair(1.0, 1.0),
+			100, 2);
+	};
+	simulate("Points");
+	std::vector<double> y_test = { 1, 1, 1, 1.35335, 6.06531, 10, 6.06531, 1.35335, 1, 1, 1, 1, 1, 1, 1.35335, 6.06531, 10, 6.06531, 1.35335, 1, 1, 1, 1, 1, 1, 1.35335, 6.06531, 10, 6.06531, 1.35335, 1, 1, 1 };
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+			for (int i = 0; i < n_points; ++i) {
+				BOOST_CHECK_CLOSE(input_data(batch_iter, memory_iter, i), y_test[i], 1e-3);
+				BOOST_CHECK_CLOSE(loss_output_data(batch_iter, memory_iter, i), y_test[i], 1e-3);
+				BOOST_CHECK_CLOSE(metric_output_data(batch_iter, memory_iter, i), y_test[i], 1e-3);
+			}
+		}
+	}
+
+	simulate("IsApex");
+	Eigen::Tensor<double, 0> n_apices = loss_output_data.sum();
+	BOOST_CHECK_EQUAL(n_apices(0), 3 * batch_size * memory_size);
+	BOOST_CHECK_EQUAL(loss_output_data(1, 1, 5), 1);
+	BOOST_CHECK_EQUAL(loss_output_data(1, 1, 16), 1);
+	BOOST_CHECK_EQUAL(loss_output_data(1, 1, 27), 1);
+
+	simulate("IsPeak");
+	Eigen::Tensor<double, 0> n_peak_points = loss_output_data.sum();
+	BOOST_CHECK_EQUAL(n_peak_points(0), 21 * batch_size * memory_size);
+	BOOST_CHECK_EQUAL(loss_output_data(2, 0, 1), 0);
+	BOOST_CHECK_EQUAL(loss_output_data(2, 0, 2), 1);
+	BOOST_CHECK_EQUAL(loss_output_data(2, 0, 8), 1);
+	BOOST_CHECK_EQUAL(loss_output_data(2, 0, 9), 0);
+	BOOST_CHECK_EQUAL(metric_output_data(2, 0, 13), 1);
+
+	// EMG parameters
+	Eigen::Tensor<double, 3> input_emg(batch_size, memory_size, n_points), loss_output_emg(batch_size, memory_size, 12), metric_output_emg(batch_size, memory_size, 12);
+	chromsimulator.simulateChromatograms(input_emg, loss_output_emg, metric_output_emg, "EMG",
+		std::make_pair(1.0, 1.0), std::make_pair(0.1, 0.2), std::make_pair(30.0, 30.0),
+		std::make_pair(0.1, 0.2), std::make_pair(0.1, 0.2), std::make_pair(1.0, 1.0),
+		std::make_pair(3.0, 3.0), std::make_pair(10.0, 10.0), std::make_pair(0.0, 1.0), std::make_pair(0.0, 0.0), std::make_pair(1.0, 1.0));
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+			for (int i = 0; i < 3; ++i) {
+				BOOST_CHECK_EQUAL(loss_output_emg(batch_iter, memory_iter, i * 4), 10);
+				BOOST_CHECK_GE(loss_output_emg(batch_iter, memory_iter, i * 4 + 1), 0);
+				BOOST_CHECK_LE(loss_output_emg(batch_iter, memory_iter, i * 4 + 1), 1);
+				BOOST_CHECK_CLOSE(loss_output_emg(batch_iter, memory_iter, i * 4 + 2), (i * 10.0 + 5.0) / 30.0, 1e-3);
+				BOOST_CHECK_CLOSE(metric_output_emg(batch_iter, memory_iter, i * 4 + 3), 1.0 / 30.0, 1e-3);
+			}
+			BOOST_CHECK_GE(input_emg(batch_iter, memory_iter, 0), 0);
+		}
+	}
+
+	// unsupported output and mismatched tensors
+	BOOST_CHECK_THROW(simulate("Unknown"), std::runtime_error);
+	Eigen::Tensor<double, 3> loss_output_bad(batch_size, memory_size, 12);
+	BOOST_CHECK_THROW(chromsimulator.simulateChromatograms(input_data, loss_output_bad, loss_output_bad, "Points",
+		std::make_pair(1.0, 1.0), std::make_pair(0.0, 0.0), std::make_pair(30.0, 30.0),
+		std::make_pair(0.0, 0.0), std::make_pair(0.0, 0.0), std::make_pair(1.0, 1.0),
+		std::make_pair(3.0, 3.0), std::make_pair(10.0, 10.0), std::make_pair(0.0, 0.0), std::make_pair(0.0, 0.0), std::make_pair(1.0, 1.0)), std::runtime_error);
+}
+
+
+BOOST_AUTO_TEST_CASE(simulateChromatogramDense)
+{
+	ChromatogramSimulatorExt<double> chromsimulator;
+	chromsimulator.setDensePeaks(true);
+	std::vector<double> chrom_time, chrom_intensity, chrom_time_noise, chrom_intensity_noise;
+	std::vector<std::pair<double, double>> best_lr;
+	std::vector<double> peak_apices;
+	std::vector<EMGModel<double>> emgs;
+
+	// hundreds of co-eluting peaks
+	chromsimulator.simulateChromatogram(chrom_time, chrom_intensity, chrom_time_noise, chrom_intensity_noise, best_lr, peak_apices, emgs,
+		std::make_pair(1.0, 1.0), std::make_pair(0.0, 0.0), std::make_pair(1000.0, 1000.0),
+		std::make_pair(0.0, 0.0), std::make_pair(0.0, 0.0), std::make_pair(0.0, 1.0),
+		std::make_pair(300.0, 300.0), std::make_pair(1.0, 10.0), std::make_pair(0.0, 1.0), std::make_pair(0.0, 0.0), std::make_pair(1.0, 3.0)
+	);
+	BOOST_CHECK_EQUAL(emgs.size(), 300);
+	BOOST_CHECK_EQUAL(peak_apices.size(), 300);
+	BOOST_CHECK_LE(best_lr.size(), 300);
+	BOOST_CHECK_GT(best_lr.size(), 0);
+	BOOST_CHECK_EQUAL(chrom_time.size(), chrom_intensity.size());
+	BOOST_CHECK_EQUAL(chrom_time_noise.size(), chrom_intensity_noise.size());
+	BOOST_CHECK_GE(chrom_time.front(), 0);
+	BOOST_CHECK_LE(chrom_time.back(), 1000);
+	for (int i = 1; i < chrom_time.size(); ++i)
+		BOOST_CHECK_LE(chrom_time[i - 1], chrom_time[i]);
+	for (const EMGModel<double>& emg : emgs)
+	{
+		BOOST_CHECK_GE(emg.getMu(), 0);
+		BOOST_CHECK_LE(emg.getMu(), 1000);
+	}
+
+	// batched simulation
+	Eigen::Tensor<double, 3> input_data(2, 1, 512), loss_output_data(2, 1, 512), metric_output_data(2, 1, 512);
+	chromsimulator.simulateChromatograms(input_data, loss_output_data, metric_output_data, "IsPeak",
+		std::make_pair(1.0, 1.0), std::make_pair(0.0, 0.0), std::make_pair(512.0, 512.0),
+		std::make_pair(0.0, 0.0), std::make_pair(0.0, 0.2), std::make_pair(0.0, 0.0),
+		std::make_pair(100.0, 200.0), std::make_pair(1.0, 10.0), std::make_pair(0.0, 1.0), std::make_pair(0.0, 0.0), std::make_pair(1.0, 3.0));
+	Eigen::Tensor<double, 0> n_peak_points = loss_output_data.sum();
+	BOOST_CHECK_GT(n_peak_points(0), 0);
+	Eigen::Tensor<bool, 0> is_finite = input_data.isfinite().all();
+	BOOST_CHECK(is_finite(0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
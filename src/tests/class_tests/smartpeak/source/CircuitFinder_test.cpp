@@ -60,4 +60,32 @@ BOOST_AUTO_TEST_CASE(test)
 	BOOST_CHECK_EQUAL(CF2.getCycles()[4].second, 2);
 }
 
+BOOST_AUTO_TEST_CASE(selfLoopLastVertex)
+{
+	// acyclic graph with a self-loop on the highest numbered vertex
+	std::list<int> A1[4];
+	A1[0].push_back(2); A1[0].push_back(3);
+	A1[1].push_back(4);
+	A1[2].push_back(4);
+	A1[3].push_back(4);
+
+	CircuitFinder CF1(A1, 4);
+	CF1.run();
+
+	BOOST_CHECK_EQUAL(CF1.getCycles().size(), 1);
+	BOOST_CHECK_EQUAL(CF1.getCycles()[0].first, 4);
+	BOOST_CHECK_EQUAL(CF1.getCycles()[0].second, 4);
+
+	// single vertex with a self-loop
+	std::list<int> A2[1];
+	A2[0].push_back(1);
+
+	CircuitFinder CF2(A2, 1);
+	CF2.run();
+
+	BOOST_CHECK_EQUAL(CF2.getCycles().size(), 1);
+	BOOST_CHECK_EQUAL(CF2.getCycles()[0].first, 1);
+	BOOST_CHECK_EQUAL(CF2.getCycles()[0].second, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
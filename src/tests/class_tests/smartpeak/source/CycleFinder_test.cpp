@@ -0,0 +1,142 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE CycleFinder test suite 
+// #include <boost/test/unit_test.hpp> // changes every so often...
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/graph/CycleFinder.h>
+#include <SmartPeak/graph/CircuitFinder.h>
+
+#include <set>
+
+#include <vector>
+#include <iostream>
+
+using namespace SmartPeak;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(cycleFinder)
+
+BOOST_AUTO_TEST_CASE(adjacencyCSR)
+{
+	AdjacencyCSR adj;
+	adj.build(3, { {1, 2}, {2, 3}, {1, 3}, {3, 1} });
+	BOOST_CHECK_EQUAL(adj.n_nodes, 3);
+	BOOST_CHECK_EQUAL(adj.offsets.size(), 4);
+	BOOST_CHECK_EQUAL(adj.targets.size(), 4);
+	BOOST_CHECK_EQUAL(adj.begin(1), 0);
+	BOOST_CHECK_EQUAL(adj.end(1), 2);
+	BOOST_CHECK_EQUAL(adj.targets[0], 2);
+	BOOST_CHECK_EQUAL(adj.targets[1], 3);
+	BOOST_CHECK_EQUAL(adj.begin(2), 2);
+	BOOST_CHECK_EQUAL(adj.end(2), 3);
+	BOOST_CHECK_EQUAL(adj.targets[2], 3);
+	BOOST_CHECK_EQUAL(adj.begin(3), 3);
+	BOOST_CHECK_EQUAL(adj.end(3), 4);
+	BOOST_CHECK_EQUAL(adj.targets[3], 1);
+}
+
+BOOST_AUTO_TEST_CASE(test)
+{
+	// same graph as the CircuitFinder test
+	AdjacencyCSR A1;
+	A1.build(5, { {1, 2}, {2, 2}, {2, 3}, {2, 4}, {3, 5}, {4, 3}, {5, 1} });
+	CycleFinder CF1(A1);
+	CF1.run();
+
+	BOOST_CHECK_EQUAL(CF1.getNComponents(), 1);
+	BOOST_CHECK_EQUAL(CF1.getCycles().size(), 2); // 5 -> 1 is reported only once
+	BOOST_CHECK_EQUAL(CF1.getCycles()[0].first, 5);
+	BOOST_CHECK_EQUAL(CF1.getCycles()[0].second, 1);
+	BOOST_CHECK_EQUAL(CF1.getCycles()[1].first, 2);
+	BOOST_CHECK_EQUAL(CF1.getCycles()[1].second, 2);
+
+	// same graph as the CircuitFinder test
+	AdjacencyCSR A4;
+	A4.build(6, { {1, 2}, {1, 5}, {2, 3}, {3, 1}, {3, 2}, {3, 4}, {3, 6}, {4, 5}, {5, 2}, {6, 4} });
+	CycleFinder CF4(A4);
+	CF4.run();
+
+	BOOST_CHECK_EQUAL(CF4.getCycles().size(), 3);
+	BOOST_CHECK_EQUAL(CF4.getCycles()[0].first, 3);
+	BOOST_CHECK_EQUAL(CF4.getCycles()[0].second, 1);
+	BOOST_CHECK_EQUAL(CF4.getCycles()[1].first, 3);
+	BOOST_CHECK_EQUAL(CF4.getCycles()[1].second, 2);
+	BOOST_CHECK_EQUAL(CF4.getCycles()[2].first, 5);
+	BOOST_CHECK_EQUAL(CF4.getCycles()[2].second, 2);
+
+	// acyclic graph with a self-loop on the last vertex
+	AdjacencyCSR A2;
+	A2.build(4, { {1, 2}, {1, 3}, {2, 4}, {3, 4}, {4, 4} });
+	CycleFinder CF2(A2);
+	CF2.run();
+
+	BOOST_CHECK_EQUAL(CF2.getNComponents(), 4);
+	BOOST_CHECK_EQUAL(CF2.getCycles().size(), 1);
+	BOOST_CHECK_EQUAL(CF2.getCycles()[0].first, 4);
+	BOOST_CHECK_EQUAL(CF2.getCycles()[0].second, 4);
+
+	// two components
+	AdjacencyCSR A3;
+	A3.build(5, { {1, 2}, {2, 1}, {2, 3}, {3, 4}, {4, 5}, {5, 3} });
+	CycleFinder CF3(A3);
+	CF3.run();
+
+	BOOST_CHECK_EQUAL(CF3.getNComponents(), 2);
+	BOOST_CHECK(CF3.getComponents()[0] == CF3.getComponents()[1]);
+	BOOST_CHECK(CF3.getComponents()[2] == CF3.getComponents()[4]);
+	BOOST_CHECK(CF3.getComponents()[0] != CF3.getComponents()[2]);
+	std::vector<std::pair<int, int>> cycles = CF3.getCycles();
+	std::sort(cycles.begin(), cycles.end());
+	BOOST_CHECK_EQUAL(cycles.size(), 2);
+	BOOST_CHECK_EQUAL(cycles[0].first, 2);
+	BOOST_CHECK_EQUAL(cycles[0].second, 1);
+	BOOST_CHECK_EQUAL(cycles[1].first, 5);
+	BOOST_CHECK_EQUAL(cycles[1].second, 3);
+}
+
+BOOST_AUTO_TEST_CASE(sameCyclesAsCircuitFinder)
+{
+	const std::vector<std::pair<int, std::vector<std::pair<int, int>>>> graphs = {
+		{ 5, { {1, 2}, {2, 2}, {2, 3}, {2, 4}, {3, 5}, {4, 3}, {5, 1} } },
+		{ 6, { {1, 2}, {1, 5}, {2, 3}, {3, 1}, {3, 2}, {3, 4}, {3, 6}, {4, 5}, {5, 2}, {6, 4} } },
+		{ 4, { {1, 2}, {1, 3}, {2, 4}, {3, 4}, {4, 4} } }, // self-loop on the last vertex
+		{ 5, { {1, 2}, {2, 1}, {2, 3}, {3, 4}, {4, 5}, {5, 3}, {5, 5} } }
+	};
+	for (const auto& graph : graphs) {
+		AdjacencyCSR adj;
+		adj.build(graph.first, graph.second);
+		CycleFinder CF(adj);
+		CF.run();
+		const std::vector<std::pair<int, int>> cycles = CF.getCycles();
+
+		std::vector<std::list<int>> adj_list(graph.first);
+		for (const auto& edge : graph.second) adj_list[edge.first - 1].push_back(edge.second);
+		CircuitFinder CF_exact(adj_list.data(), graph.first);
+		CF_exact.run();
+		const std::vector<std::pair<int, int>> circuits = CF_exact.getCycles();
+
+		const std::set<std::pair<int, int>> cycles_set(cycles.begin(), cycles.end());
+		const std::set<std::pair<int, int>> circuits_set(circuits.begin(), circuits.end());
+		BOOST_CHECK(cycles_set == circuits_set);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(longChain)
+{
+	// a single long cycle would exhaust the stack of a recursive search
+	const int n = 100000;
+	std::vector<std::pair<int, int>> edges;
+	for (int i = 1; i < n; ++i) edges.emplace_back(i, i + 1);
+	edges.emplace_back(n, 1);
+	AdjacencyCSR adj;
+	adj.build(n, edges);
+	CycleFinder CF(adj);
+	CF.run();
+
+	BOOST_CHECK_EQUAL(CF.getNComponents(), 1);
+	BOOST_CHECK_EQUAL(CF.getCycles().size(), 1);
+	BOOST_CHECK_EQUAL(CF.getCycles()[0].first, n);
+	BOOST_CHECK_EQUAL(CF.getCycles()[0].second, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -15,19 +15,19 @@ class EMGModel_test: public EMGModel<TensorT>
 public:
 	TensorT z_(const TensorT& x_I) const
   {
-    return EMGModel::z_(x_I);
+    return EMGModel<TensorT>::z_(x_I);
   }
 	TensorT EMGPDF1_(const TensorT& x_I) const
   {
-    return EMGModel::EMGPDF1_(x_I);
+    return EMGModel<TensorT>::EMGPDF1_(x_I);
   }
 	TensorT EMGPDF2_(const TensorT& x_I) const
   {
-    return EMGModel::EMGPDF2_(x_I);
+    return EMGModel<TensorT>::EMGPDF2_(x_I);
   }
 	TensorT EMGPDF3_(const TensorT& x_I) const
   {
-    return EMGModel::EMGPDF3_(x_I);
+    return EMGModel<TensorT>::EMGPDF3_(x_I);
   }
 };
 
@@ -135,4 +135,53 @@ BOOST_AUTO_TEST_CASE(emgpdf)
   BOOST_CHECK_CLOSE(emg.PDF(0), 1.0, 1e-6);
 }
 
+BOOST_AUTO_TEST_CASE(emgpdfArray)
+{
+  Eigen::Array<double, Eigen::Dynamic, 1> x(401);
+  for (int i = 0; i < x.size(); ++i) x(i) = -10.0 + 0.05 * i;
+  Eigen::Array<double, Eigen::Dynamic, 1> y(x.size());
+
+  // tailing peaks with z < 0 and z >= 0 and a Gaussian peak (tau == 0)
+  std::vector<EMGModel<double>> emgs = { EMGModel<double>(1.0, 0.1, 0.0, 1.0), EMGModel<double>(10.0, 0.5, 5.0, 1.0),
+    EMGModel<double>(2.0, 3.0, -2.0, 0.5), EMGModel<double>(10.0, 0.0, 5.0, 1.0) };
+  for (const EMGModel<double>& emg : emgs) {
+    emg.PDF(x, y);
+    for (int i = 0; i < x.size(); ++i) {
+      const double y_expected = emg.PDF(x(i));
+      if (y_expected > 1e-200)
+        BOOST_CHECK_CLOSE(y(i), y_expected, 2e-5); // relative error of 2e-7
+      else
+        BOOST_CHECK_SMALL(y(i), 1e-200);
+    }
+  }
+
+  // sharp peak
+  EMGModel<double> emg(1.0, 1e-12, 0.0, 1.0);
+  emg.PDF(x, y);
+  BOOST_CHECK_CLOSE(y(200), 1.0, 1e-6);
+
+  // single precision
+  Eigen::Array<float, Eigen::Dynamic, 1> x_float = x.cast<float>();
+  Eigen::Array<float, Eigen::Dynamic, 1> y_float(x.size());
+  EMGModel<float> emg_float(10.0f, 0.5f, 5.0f, 1.0f);
+  emg_float.PDF(x_float, y_float);
+  for (int i = 0; i < x.size(); ++i)
+    BOOST_CHECK_SMALL(y_float(i) - emg_float.PDF(x_float(i)), 1e-5f);
+
+  // all peaks in one call
+  Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic> y_peaks(x.size(), emgs.size());
+  EMGModel<double>::PDFs(x, emgs, y_peaks);
+  for (int j = 0; j < emgs.size(); ++j) {
+    emgs[j].PDF(x, y);
+    for (int i = 0; i < x.size(); ++i)
+      BOOST_CHECK_EQUAL(y_peaks(i, j), y(i));
+  }
+
+  // the output arrays must be preallocated
+  Eigen::Array<double, Eigen::Dynamic, 1> y_bad(3);
+  BOOST_CHECK_THROW(emgs[0].PDF(x, y_bad), std::runtime_error);
+  Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic> y_peaks_bad(x.size(), 1);
+  BOOST_CHECK_THROW(EMGModel<double>::PDFs(x, emgs, y_peaks_bad), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
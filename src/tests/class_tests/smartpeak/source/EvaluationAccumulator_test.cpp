@@ -0,0 +1,153 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE EvaluationAccumulator test suite
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/ml/EvaluationAccumulator.h>
+
+#include <fstream>
+
+using namespace SmartPeak;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(evaluationAccumulator)
+
+/// Model output of dims batch_size = 3, memory_size = 2, output nodes = 2 that changes with the epoch
+Eigen::Tensor<float, 3> makeEpochOutput(const int& epoch)
+{
+  Eigen::Tensor<float, 3> model_output(3, 2, 2);
+  for (int batch_iter = 0; batch_iter < 3; ++batch_iter)
+    for (int memory_iter = 0; memory_iter < 2; ++memory_iter)
+      for (int node_iter = 0; node_iter < 2; ++node_iter)
+        model_output(batch_iter, memory_iter, node_iter) = float(epoch * 3 + batch_iter) + 10.0f * memory_iter + 100.0f * node_iter;
+  return model_output;
+}
+
+BOOST_AUTO_TEST_CASE(constructorOutputStatisticsAccumulator)
+{
+  OutputStatisticsAccumulator<float>* ptr = nullptr;
+  OutputStatisticsAccumulator<float>* nullPointer = nullptr;
+  ptr = new OutputStatisticsAccumulator<float>();
+  BOOST_CHECK_NE(ptr, nullPointer);
+  BOOST_CHECK_EQUAL(ptr->getName(), "OutputStatisticsAccumulator");
+  delete ptr;
+}
+
+BOOST_AUTO_TEST_CASE(accumulateOutputStatisticsAccumulator)
+{
+  OutputStatisticsAccumulator<float> accumulator;
+  accumulator.initAccumulator(3, 2, { "o1", "o2" }, {});
+  const int n_epochs = 4;
+  for (int epoch = 0; epoch < n_epochs; ++epoch)
+    accumulator.accumulate(epoch, makeEpochOutput(epoch), Eigen::Tensor<float, 1>(0));
+
+  // the outputs of node 0 and memory 0 are 0, 1, ..., 11
+  BOOST_CHECK_EQUAL(accumulator.getNSamples(), 12);
+  BOOST_CHECK_CLOSE(accumulator.getMean()(0, 0), 5.5, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMean()(1, 0), 15.5, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMean()(1, 1), 115.5, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getVariance()(0, 0), 13.0, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getVariance()(1, 1), 13.0, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMin()(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMax()(0, 0), 11, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMin()(1, 1), 110, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMax()(1, 1), 121, 1e-4);
+
+  // reset
+  accumulator.initAccumulator(3, 2, { "o1", "o2" }, {});
+  BOOST_CHECK_EQUAL(accumulator.getNSamples(), 0);
+  BOOST_CHECK_CLOSE(accumulator.getMean()(0, 0), 0, 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(accumulateMetricAccumulator)
+{
+  MetricAccumulator<float> accumulator;
+  BOOST_CHECK_EQUAL(accumulator.getName(), "MetricAccumulator");
+  accumulator.initAccumulator(3, 2, { "o1", "o2" }, { "MAE", "Accuracy" });
+  BOOST_CHECK_EQUAL(accumulator.getMetricNames().at(1), "Accuracy");
+  for (int epoch = 0; epoch < 4; ++epoch) {
+    Eigen::Tensor<float, 1> metrics(2);
+    metrics.setValues({ float(epoch), 1.0f - 0.1f * epoch });
+    accumulator.accumulate(epoch, makeEpochOutput(epoch), metrics);
+  }
+  BOOST_CHECK_EQUAL(accumulator.getNEpochs(), 4);
+  BOOST_CHECK_CLOSE(accumulator.getSum()(0), 6, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMean()(0), 1.5, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMean()(1), 0.85, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMin()(1), 0.7, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getMax()(1), 1.0, 1e-4);
+
+  // epochs without metrics are skipped
+  accumulator.accumulate(4, makeEpochOutput(4), Eigen::Tensor<float, 1>(0));
+  BOOST_CHECK_EQUAL(accumulator.getNEpochs(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(accumulateOutputHistogramAccumulator)
+{
+  OutputHistogramAccumulator<float> accumulator(4, 0, 8);
+  BOOST_CHECK_EQUAL(accumulator.getName(), "OutputHistogramAccumulator");
+  BOOST_CHECK_EQUAL(accumulator.getNBins(), 4);
+  BOOST_CHECK_CLOSE(accumulator.getLowerBound(), 0, 1e-4);
+  BOOST_CHECK_CLOSE(accumulator.getUpperBound(), 8, 1e-4);
+  accumulator.initAccumulator(3, 2, { "o1", "o2" }, {});
+  for (int epoch = 0; epoch < 4; ++epoch)
+    accumulator.accumulate(epoch, makeEpochOutput(epoch), Eigen::Tensor<float, 1>(0));
+
+  // node 0: memory 0 holds 0, ..., 11 and memory 1 holds 10, ..., 21
+  Eigen::Tensor<long long, 2> counts = accumulator.getCounts();
+  BOOST_CHECK_EQUAL(counts(0, 0), 2);
+  BOOST_CHECK_EQUAL(counts(0, 1), 2);
+  BOOST_CHECK_EQUAL(counts(0, 2), 2);
+  BOOST_CHECK_EQUAL(counts(0, 3), 18);
+  BOOST_CHECK_EQUAL(counts(1, 3), 24);
+  const Eigen::Tensor<long long, 0> total = counts.sum();
+  BOOST_CHECK_EQUAL(total(0), 48);
+
+  OutputHistogramAccumulator<float> accumulator_bad(0, 0, 8);
+  BOOST_CHECK_THROW(accumulator_bad.initAccumulator(3, 2, { "o1", "o2" }, {}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(accumulateTopKAccumulator)
+{
+  TopKAccumulator<float> accumulator(3, 1);
+  BOOST_CHECK_EQUAL(accumulator.getName(), "TopKAccumulator");
+  BOOST_CHECK_EQUAL(accumulator.getK(), 3);
+  BOOST_CHECK_EQUAL(accumulator.getMemoryIndex(), 1);
+  accumulator.initAccumulator(3, 2, { "o1", "o2" }, {});
+  for (int epoch = 0; epoch < 4; ++epoch)
+    accumulator.accumulate(epoch, makeEpochOutput(epoch), Eigen::Tensor<float, 1>(0));
+
+  std::vector<TopKAccumulator<float>::TopKEntry> top_k = accumulator.getTopK(1);
+  BOOST_CHECK_EQUAL(top_k.size(), 3);
+  BOOST_CHECK_CLOSE(top_k.at(0).value, 121, 1e-4);
+  BOOST_CHECK_EQUAL(top_k.at(0).epoch, 3);
+  BOOST_CHECK_EQUAL(top_k.at(0).batch_index, 2);
+  BOOST_CHECK_CLOSE(top_k.at(1).value, 120, 1e-4);
+  BOOST_CHECK_CLOSE(top_k.at(2).value, 119, 1e-4);
+  BOOST_CHECK_EQUAL(top_k.at(2).batch_index, 0);
+
+  TopKAccumulator<float> accumulator_bad(3, 2);
+  BOOST_CHECK_THROW(accumulator_bad.initAccumulator(3, 2, { "o1", "o2" }, {}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(accumulateOutputFileAccumulator)
+{
+  const std::string filename = "EvaluationAccumulatorTest.csv";
+  OutputFileAccumulator<float> accumulator(filename);
+  BOOST_CHECK_EQUAL(accumulator.getName(), "OutputFileAccumulator");
+  BOOST_CHECK_EQUAL(accumulator.getFilename(), filename);
+  accumulator.initAccumulator(3, 2, { "o1", "o2" }, {});
+  for (int epoch = 0; epoch < 2; ++epoch)
+    accumulator.accumulate(epoch, makeEpochOutput(epoch), Eigen::Tensor<float, 1>(0));
+  accumulator.finalizeAccumulator();
+
+  std::ifstream file(filename);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line)) lines.push_back(line);
+  BOOST_CHECK_EQUAL(lines.size(), 13);
+  BOOST_CHECK_EQUAL(lines.at(0), "Epoch,BatchIndex,MemoryIndex,o1,o2");
+  BOOST_CHECK_EQUAL(lines.at(1), "0,0,0,0.000000,100.000000");
+  BOOST_CHECK_EQUAL(lines.at(12), "1,2,1,15.000000,115.000000");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE HarmonicOscillatorSimulator test suite 
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/simulator/HarmonicOscillatorSimulator.h>
+
+using namespace SmartPeak;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(harmonicOscillatorSimulator)
+
+BOOST_AUTO_TEST_CASE(makeRandomParameters)
+{
+  std::mt19937 engine(1);
+  Eigen::Tensor<double, 1> parameters = HarmonicOscillatorSimulator<double>::makeRandomParameters(100, std::make_pair(0.5, 2.0), engine);
+  BOOST_CHECK_EQUAL(parameters.dimension(0), 100);
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK_GE(parameters(i), 0.5);
+    BOOST_CHECK_LE(parameters(i), 2.0);
+  }
+  parameters = HarmonicOscillatorSimulator<double>::makeRandomParameters(3, std::make_pair(1.0, 1.0), engine);
+  BOOST_CHECK_EQUAL(parameters(2), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(WeightSpring3W2S1DBatch)
+{
+  const int batch_size = 4, n_time_steps = 50;
+  std::mt19937 engine(1);
+  Eigen::Tensor<double, 1> A1 = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(0.5, 1.5), engine);
+  Eigen::Tensor<double, 1> A2 = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(0.5, 1.5), engine);
+  Eigen::Tensor<double, 1> A3 = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(0.5, 1.5), engine);
+  Eigen::Tensor<double, 1> m1 = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(0.5, 2.0), engine);
+  Eigen::Tensor<double, 1> m2 = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(0.5, 2.0), engine);
+  Eigen::Tensor<double, 1> m3 = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(0.5, 2.0), engine);
+  Eigen::Tensor<double, 1> x1o = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(-1.0, 1.0), engine);
+  Eigen::Tensor<double, 1> x2o = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(-1.0, 1.0), engine);
+  Eigen::Tensor<double, 1> x3o = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(-1.0, 1.0), engine);
+  Eigen::Tensor<double, 1> k = HarmonicOscillatorSimulator<double>::makeRandomParameters(batch_size, std::make_pair(0.5, 2.0), engine);
+
+  Eigen::Tensor<double, 1> time_steps(n_time_steps);
+  Eigen::Tensor<double, 3> displacements(batch_size, n_time_steps, 3);
+  HarmonicOscillatorSimulator<double>::WeightSpring3W2S1DBatch(time_steps, displacements, 0.1, A1, A2, A3, m1, m2, m3, x1o, x2o, x3o, k);
+  BOOST_CHECK_EQUAL(time_steps(0), 0);
+  BOOST_CHECK_EQUAL(time_steps(n_time_steps - 1), 0.1 * (n_time_steps - 1));
+
+  // same trajectories as the scalar simulation
+  for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+    Eigen::Tensor<double, 1> time_steps_expected(n_time_steps);
+    Eigen::Tensor<double, 2> displacements_expected(n_time_steps, 3);
+    HarmonicOscillatorSimulator<double>::WeightSpring3W2S1D(time_steps_expected, displacements_expected, n_time_steps, 0.1,
+      A1(batch_iter), A2(batch_iter), A3(batch_iter), m1(batch_iter), m2(batch_iter), m3(batch_iter),
+      x1o(batch_iter), x2o(batch_iter), x3o(batch_iter), k(batch_iter));
+    for (int time_iter = 0; time_iter < n_time_steps; ++time_iter) {
+      BOOST_CHECK_CLOSE(time_steps(time_iter), time_steps_expected(time_iter), 1e-6);
+      for (int mass_iter = 0; mass_iter < 3; ++mass_iter)
+        BOOST_CHECK_SMALL(displacements(batch_iter, time_iter, mass_iter) - displacements_expected(time_iter, mass_iter), 1e-9);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(WeightSpring1W1S1DBatch)
+{
+  const int batch_size = 3, n_time_steps = 40;
+  Eigen::Tensor<double, 1> m1(batch_size), k1(batch_size), x1o(batch_size), v1o(batch_size);
+  m1.setValues({ 1, 2, 0.5 });
+  k1.setValues({ 1, 0.5, 2 });
+  x1o.setValues({ 1, -0.5, 0 });
+  v1o.setValues({ 0, 0.5, 1 });
+
+  Eigen::Tensor<double, 1> time_steps(n_time_steps);
+  Eigen::Tensor<double, 3> displacements(batch_size, n_time_steps, 1);
+  HarmonicOscillatorSimulator<double>::WeightSpring1W1S1DBatch(time_steps, displacements, 0.1, m1, k1, x1o, v1o);
+  for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+    Eigen::Tensor<double, 1> time_steps_expected(n_time_steps);
+    Eigen::Tensor<double, 2> displacements_expected(n_time_steps, 1);
+    HarmonicOscillatorSimulator<double>::WeightSpring1W1S1D(time_steps_expected, displacements_expected, n_time_steps, 0.1,
+      m1(batch_iter), k1(batch_iter), x1o(batch_iter), v1o(batch_iter));
+    for (int time_iter = 0; time_iter < n_time_steps; ++time_iter)
+      BOOST_CHECK_SMALL(displacements(batch_iter, time_iter, 0) - displacements_expected(time_iter, 0), 1e-9);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(WeightSpring1W1S1DwDampingBatch)
+{
+  // under, critically, and over damped
+  const int batch_size = 3, n_time_steps = 40;
+  Eigen::Tensor<double, 1> m1(batch_size), k1(batch_size), beta1(batch_size), x1o(batch_size), v1o(batch_size);
+  m1.setValues({ 1, 1, 1 });
+  k1.setValues({ 1, 1, 1 });
+  beta1.setValues({ 0.5, 2, 3 });
+  x1o.setValues({ 1, -0.5, 0.5 });
+  v1o.setValues({ 0, 0.5, 1 });
+
+  Eigen::Tensor<double, 1> time_steps(n_time_steps);
+  Eigen::Tensor<double, 3> displacements(batch_size, n_time_steps, 1);
+  HarmonicOscillatorSimulator<double>::WeightSpring1W1S1DwDampingBatch(time_steps, displacements, 0.1, m1, k1, beta1, x1o, v1o);
+  for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+    Eigen::Tensor<double, 1> time_steps_expected(n_time_steps);
+    Eigen::Tensor<double, 2> displacements_expected(n_time_steps, 1);
+    HarmonicOscillatorSimulator<double>::WeightSpring1W1S1DwDamping(time_steps_expected, displacements_expected, n_time_steps, 0.1,
+      m1(batch_iter), k1(batch_iter), beta1(batch_iter), x1o(batch_iter), v1o(batch_iter));
+    for (int time_iter = 0; time_iter < n_time_steps; ++time_iter)
+      BOOST_CHECK_SMALL(displacements(batch_iter, time_iter, 0) - displacements_expected(time_iter, 0), 1e-9);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
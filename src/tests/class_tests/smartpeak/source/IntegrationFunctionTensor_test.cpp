@@ -700,6 +700,347 @@ BOOST_AUTO_TEST_CASE(getNameCountTensorOp)
 	BOOST_CHECK_EQUAL(operation.getName(), "CountTensorOp");
 }
 
+/**
+LSTMCellTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorLSTMCellTensorOp)
+{
+	LSTMCellTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	LSTMCellTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorLSTMCellTensorOp)
+{
+	LSTMCellTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new LSTMCellTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionLSTMCellTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 2;
+	const int source_layer_size = 4;
+	const int sink_layer_size = 2;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// input, forget, block input, and output gates
+	Eigen::Tensor<float, 3> source_output(batch_size, memory_size, source_layer_size);
+	source_output.setValues({ {{0, 0, 1, 1}, {0, 0, 0, 0}} });
+	// memory cell and output gate nodes
+	Eigen::Tensor<float, 2> weights(source_layer_size, sink_layer_size);
+	weights.setValues({ {1, 0}, {2, 0}, {3, 0}, {0, 4} });
+	Eigen::Tensor<float, 3> sink_input(batch_size, memory_size, sink_layer_size);
+	sink_input.setValues({ {{0, 0}, {2, 0}} });
+
+	Eigen::DefaultDevice device;
+
+	LSTMCellTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 3> expected(batch_size, memory_size, sink_layer_size);
+	expected.setValues({ {{1.38079703, 0.731058598}, {2, 0}} });
+
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+			for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+				BOOST_CHECK_CLOSE(sink_input(batch_iter, memory_iter, layer_iter), expected(batch_iter, memory_iter, layer_iter), 1e-4);
+			}
+		}
+	}
+
+	// gates that are not linked as expected
+	weights.setValues({ {1, 0}, {2, 0}, {0, 0}, {0, 4} });
+	LSTMCellTensorOp<float, Eigen::DefaultDevice> operation_missing;
+	BOOST_CHECK_THROW(operation_missing(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device), std::runtime_error);
+
+	// gates that are linked twice (e.g., by a replicated link)
+	Eigen::Tensor<float, 2> weights_duplicate(source_layer_size + 1, sink_layer_size);
+	weights_duplicate.setValues({ {1, 0}, {2, 0}, {3, 0}, {0, 4}, {2, 0} });
+	Eigen::Tensor<float, 3> source_output_duplicate(batch_size, memory_size, source_layer_size + 1);
+	source_output_duplicate.setZero();
+	LSTMCellTensorOp<float, Eigen::DefaultDevice> operation_duplicate_gate;
+	BOOST_CHECK_THROW(operation_duplicate_gate(source_output_duplicate.data(), weights_duplicate.data(), sink_input.data(), batch_size, memory_size, source_layer_size + 1, sink_layer_size, source_time_step, sink_time_step, device), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(getNameLSTMCellTensorOp)
+{
+	LSTMCellTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "LSTMCellTensorOp");
+}
+
+/**
+LSTMOutputTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorLSTMOutputTensorOp)
+{
+	LSTMOutputTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	LSTMOutputTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorLSTMOutputTensorOp)
+{
+	LSTMOutputTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new LSTMOutputTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionLSTMOutputTensorOp)
+{
+	const int batch_size = 2;
+	const int memory_size = 1;
+	const int source_layer_size = 2;
+	const int sink_layer_size = 1;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// memory cell and output gate nodes
+	Eigen::Tensor<float, 3> source_output(batch_size, memory_size, source_layer_size);
+	source_output.setValues({ {{1, 0.5}}, {{0, 1}} });
+	Eigen::Tensor<float, 2> weights(source_layer_size, sink_layer_size);
+	weights.setValues({ {1}, {2} });
+	Eigen::Tensor<float, 3> sink_input(batch_size, memory_size, sink_layer_size);
+	sink_input.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	LSTMOutputTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	BOOST_CHECK_CLOSE(sink_input(0, 0, 0), 0.380797078, 1e-4);
+	BOOST_CHECK_CLOSE(sink_input(1, 0, 0), 0, 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(getNameLSTMOutputTensorOp)
+{
+	LSTMOutputTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "LSTMOutputTensorOp");
+}
+
+/**
+GRUCellTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorGRUCellTensorOp)
+{
+	GRUCellTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	GRUCellTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorGRUCellTensorOp)
+{
+	GRUCellTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new GRUCellTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionGRUCellTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 2;
+	const int source_layer_size = 4;
+	const int sink_layer_size = 1;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// update, reset, input candidate, and recurrent candidate gates
+	Eigen::Tensor<float, 3> source_output(batch_size, memory_size, source_layer_size);
+	source_output.setValues({ {{0, 0, 0.5, 1}, {0, 0, 0, 0}} });
+	Eigen::Tensor<float, 2> weights(source_layer_size, sink_layer_size);
+	weights.setValues({ {1}, {2}, {3}, {4} });
+	Eigen::Tensor<float, 3> sink_input(batch_size, memory_size, sink_layer_size);
+	sink_input.setValues({ {{0}, {2}} });
+
+	Eigen::DefaultDevice device;
+
+	GRUCellTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	BOOST_CHECK_CLOSE(sink_input(0, 0, 0), 1.38079703, 1e-4);
+	BOOST_CHECK_CLOSE(sink_input(0, 1, 0), 2, 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(getNameGRUCellTensorOp)
+{
+	GRUCellTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "GRUCellTensorOp");
+}
+
+/**
+DotProdAttentionTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorDotProdAttentionTensorOp)
+{
+	DotProdAttentionTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	DotProdAttentionTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorDotProdAttentionTensorOp)
+{
+	DotProdAttentionTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new DotProdAttentionTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionDotProdAttentionTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 1;
+	const int source_layer_size = 6;
+	const int sink_layer_size = 2;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// queries, keys, and values of a single head
+	Eigen::Tensor<float, 3> source_output(batch_size, memory_size, source_layer_size);
+	source_output.setValues({ {{1, 2, 2, 0.5, 3, 4}} });
+	Eigen::Tensor<float, 2> weights(source_layer_size, sink_layer_size);
+	weights.setValues({ {1, 1}, {4, 4}, {2, 2}, {5, 5}, {3, 0}, {0, 6} });
+	Eigen::Tensor<float, 3> sink_input(batch_size, memory_size, sink_layer_size);
+	sink_input.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	DotProdAttentionTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	BOOST_CHECK_CLOSE(sink_input(0, 0, 0), 2.00928465, 1e-4);
+	BOOST_CHECK_CLOSE(sink_input(0, 0, 1), 1.3209538, 1e-4);
+
+	// values that are not linked
+	weights.setValues({ {1, 1}, {4, 4}, {2, 2}, {5, 5}, {3, 0}, {0, 0} });
+	DotProdAttentionTensorOp<float, Eigen::DefaultDevice> operation_missing;
+	BOOST_CHECK_THROW(operation_missing(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(getNameDotProdAttentionTensorOp)
+{
+	DotProdAttentionTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "DotProdAttentionTensorOp");
+}
+
+/**
+SoftMaxTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorSoftMaxTensorOp)
+{
+	SoftMaxTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	SoftMaxTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorSoftMaxTensorOp)
+{
+	SoftMaxTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new SoftMaxTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionSoftMaxTensorOp)
+{
+	const int batch_size = 2;
+	const int memory_size = 1;
+	const int source_layer_size = 3;
+	const int sink_layer_size = 3;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// the second batch would overflow without the max offset
+	Eigen::Tensor<float, 3> source_output(batch_size, memory_size, source_layer_size);
+	source_output.setValues({ {{1, 2, 3}}, {{1000, 1001, 1002}} });
+	Eigen::Tensor<float, 2> weights(source_layer_size, sink_layer_size);
+	weights.setValues({ {2, 1, 1}, {1, 2, 1}, {1, 1, 2} });
+	Eigen::Tensor<float, 3> sink_input(batch_size, memory_size, sink_layer_size);
+	sink_input.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	SoftMaxTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 1> expected(sink_layer_size);
+	expected.setValues({ 0.0900305732, 0.244728471, 0.665240956 });
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+			BOOST_CHECK_CLOSE(sink_input(batch_iter, 0, layer_iter), expected(layer_iter), 1e-3);
+		}
+	}
+
+	// softmax node without its own input
+	weights.setValues({ {2, 1, 1}, {1, 2, 1}, {1, 1, 1} });
+	SoftMaxTensorOp<float, Eigen::DefaultDevice> operation_missing;
+	BOOST_CHECK_THROW(operation_missing(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(getNameSoftMaxTensorOp)
+{
+	SoftMaxTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "SoftMaxTensorOp");
+}
+
+/**
+LogSoftMaxTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorLogSoftMaxTensorOp)
+{
+	LogSoftMaxTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	LogSoftMaxTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorLogSoftMaxTensorOp)
+{
+	LogSoftMaxTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new LogSoftMaxTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionLogSoftMaxTensorOp)
+{
+	const int batch_size = 2;
+	const int memory_size = 1;
+	const int source_layer_size = 3;
+	const int sink_layer_size = 3;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	Eigen::Tensor<float, 3> source_output(batch_size, memory_size, source_layer_size);
+	source_output.setValues({ {{1, 2, 3}}, {{1000, 1001, 1002}} });
+	Eigen::Tensor<float, 2> weights(source_layer_size, sink_layer_size);
+	weights.setValues({ {2, 1, 1}, {1, 2, 1}, {1, 1, 2} });
+	Eigen::Tensor<float, 3> sink_input(batch_size, memory_size, sink_layer_size);
+	sink_input.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	LogSoftMaxTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_output.data(), weights.data(), sink_input.data(), batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 1> expected(sink_layer_size);
+	expected.setValues({ -2.40760596, -1.40760596, -0.407605964 });
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+			BOOST_CHECK_CLOSE(sink_input(batch_iter, 0, layer_iter), expected(layer_iter), 1e-3);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(getNameLogSoftMaxTensorOp)
+{
+	LogSoftMaxTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "LogSoftMaxTensorOp");
+}
+
 /**
 SumErrorTensorOp Tests
 */
@@ -1409,6 +1750,459 @@ BOOST_AUTO_TEST_CASE(getNameCountErrorTensorOp)
 	BOOST_CHECK_EQUAL(operation.getName(), "CountErrorTensorOp");
 }
 
+/**
+LSTMCellErrorTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorLSTMCellErrorTensorOp)
+{
+	LSTMCellErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	LSTMCellErrorTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorLSTMCellErrorTensorOp)
+{
+	LSTMCellErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new LSTMCellErrorTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionLSTMCellErrorTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 2;
+	const int source_layer_size = 2;
+	const int sink_layer_size = 4;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// memory cell and output gate nodes
+	Eigen::Tensor<float, 3> source_error(batch_size, memory_size, source_layer_size);
+	source_error.setValues({ {{1, 1}, {0, 0}} });
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setValues({ {{1.38079703, 0.5}, {2, 0}} });
+	// input, forget, block input, and output gates
+	Eigen::Tensor<float, 2> weights(sink_layer_size, source_layer_size);
+	weights.setValues({ {1, 0}, {2, 0}, {3, 0}, {0, 4} });
+	Eigen::Tensor<float, 3> sink_output(batch_size, memory_size, sink_layer_size);
+	sink_output.setValues({ {{0, 0, 1, 1}, {0, 0, 0, 0}} });
+	Eigen::Tensor<float, 3> sink_derivative(batch_size, memory_size, sink_layer_size);
+	sink_derivative.setConstant(1);
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	LSTMCellErrorTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 3> expected(batch_size, memory_size, sink_layer_size);
+	expected.setValues({ {{0.190398544, 0.5, 0.209987, 0.25}, {0, 0, 0, 0}} });
+
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+			for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+				BOOST_CHECK_CLOSE(sink_error(batch_iter, memory_iter, layer_iter), expected(batch_iter, memory_iter, layer_iter), 1e-3);
+			}
+		}
+	}
+
+	// the memory cell error is carried to the previous time step through the forget gate
+	BOOST_CHECK_CLOSE(source_error(0, 1, 0), 0.5, 1e-4);
+	BOOST_CHECK_CLOSE(source_error(0, 1, 1), 0, 1e-4);
+
+	// gates that are not linked as expected
+	weights.setValues({ {1, 0}, {2, 0}, {0, 0}, {0, 4} });
+	LSTMCellErrorTensorOp<float, Eigen::DefaultDevice> operation_missing;
+	BOOST_CHECK_THROW(operation_missing(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(getNameLSTMCellErrorTensorOp)
+{
+	LSTMCellErrorTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "LSTMCellErrorTensorOp");
+}
+
+/**
+LSTMOutputErrorTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorLSTMOutputErrorTensorOp)
+{
+	LSTMOutputErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	LSTMOutputErrorTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorLSTMOutputErrorTensorOp)
+{
+	LSTMOutputErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new LSTMOutputErrorTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionLSTMOutputErrorTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 1;
+	const int source_layer_size = 1;
+	const int sink_layer_size = 2;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// output nodes
+	Eigen::Tensor<float, 3> source_error(batch_size, memory_size, source_layer_size);
+	source_error.setConstant(1);
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setConstant(0);
+	// memory cell and output gate nodes
+	Eigen::Tensor<float, 2> weights(sink_layer_size, source_layer_size);
+	weights.setValues({ {1}, {2} });
+	Eigen::Tensor<float, 3> sink_output(batch_size, memory_size, sink_layer_size);
+	sink_output.setValues({ {{1, 0.5}} });
+	Eigen::Tensor<float, 3> sink_derivative(batch_size, memory_size, sink_layer_size);
+	sink_derivative.setConstant(1);
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	LSTMOutputErrorTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	BOOST_CHECK_CLOSE(sink_error(0, 0, 0), 0.209987, 1e-3);
+	BOOST_CHECK_CLOSE(sink_error(0, 0, 1), 0.761594176, 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(getNameLSTMOutputErrorTensorOp)
+{
+	LSTMOutputErrorTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "LSTMOutputErrorTensorOp");
+}
+
+/**
+GRUCellErrorTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorGRUCellErrorTensorOp)
+{
+	GRUCellErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	GRUCellErrorTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorGRUCellErrorTensorOp)
+{
+	GRUCellErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new GRUCellErrorTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionGRUCellErrorTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 2;
+	const int source_layer_size = 1;
+	const int sink_layer_size = 4;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// output nodes
+	Eigen::Tensor<float, 3> source_error(batch_size, memory_size, source_layer_size);
+	source_error.setValues({ {{1}, {0}} });
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setValues({ {{1.38079703}, {2}} });
+	// update, reset, input candidate, and recurrent candidate gates
+	Eigen::Tensor<float, 2> weights(sink_layer_size, source_layer_size);
+	weights.setValues({ {1}, {2}, {3}, {4} });
+	Eigen::Tensor<float, 3> sink_output(batch_size, memory_size, sink_layer_size);
+	sink_output.setValues({ {{0, 0, 0.5, 1}, {0, 0, 0, 0}} });
+	Eigen::Tensor<float, 3> sink_derivative(batch_size, memory_size, sink_layer_size);
+	sink_derivative.setConstant(1);
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	GRUCellErrorTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 3> expected(batch_size, memory_size, sink_layer_size);
+	expected.setValues({ {{0.309601456, 0.0524967499, 0.209987, 0.1049935}, {0, 0, 0, 0}} });
+
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+			for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+				BOOST_CHECK_CLOSE(sink_error(batch_iter, memory_iter, layer_iter), expected(batch_iter, memory_iter, layer_iter), 1e-3);
+			}
+		}
+	}
+
+	// the output error is carried to the previous time step through the update gate
+	BOOST_CHECK_CLOSE(source_error(0, 1, 0), 0.5, 1e-4);
+
+	// gates that are not linked as expected
+	weights.setValues({ {1}, {2}, {3}, {0} });
+	GRUCellErrorTensorOp<float, Eigen::DefaultDevice> operation_missing;
+	BOOST_CHECK_THROW(operation_missing(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(getNameGRUCellErrorTensorOp)
+{
+	GRUCellErrorTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "GRUCellErrorTensorOp");
+}
+
+/**
+DotProdAttentionErrorTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorDotProdAttentionErrorTensorOp)
+{
+	DotProdAttentionErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	DotProdAttentionErrorTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorDotProdAttentionErrorTensorOp)
+{
+	DotProdAttentionErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new DotProdAttentionErrorTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionDotProdAttentionErrorTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 1;
+	const int source_layer_size = 2;
+	const int sink_layer_size = 6;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// attention nodes
+	Eigen::Tensor<float, 3> source_error(batch_size, memory_size, source_layer_size);
+	source_error.setConstant(1);
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setConstant(0);
+	// queries, keys, and values of a single head
+	Eigen::Tensor<float, 2> weights(sink_layer_size, source_layer_size);
+	weights.setValues({ {1, 1}, {4, 4}, {2, 2}, {5, 5}, {3, 0}, {0, 6} });
+	Eigen::Tensor<float, 3> sink_output(batch_size, memory_size, sink_layer_size);
+	sink_output.setValues({ {{1, 2, 2, 0.5, 3, 4}} });
+	Eigen::Tensor<float, 3> sink_derivative(batch_size, memory_size, sink_layer_size);
+	sink_derivative.setConstant(1);
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	DotProdAttentionErrorTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 3> expected(batch_size, memory_size, sink_layer_size);
+	expected.setValues({ {{-0.312797193, 0.0781992983, -0.156398597, 0.312797193, 0.669761549, 0.330238451}} });
+	for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+		BOOST_CHECK_CLOSE(sink_error(0, 0, layer_iter), expected(0, 0, layer_iter), 1e-3);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(getNameDotProdAttentionErrorTensorOp)
+{
+	DotProdAttentionErrorTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "DotProdAttentionErrorTensorOp");
+}
+
+/**
+SoftMaxErrorTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorSoftMaxErrorTensorOp)
+{
+	SoftMaxErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	SoftMaxErrorTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorSoftMaxErrorTensorOp)
+{
+	SoftMaxErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new SoftMaxErrorTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionSoftMaxErrorTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 1;
+	const int source_layer_size = 3;
+	const int sink_layer_size = 3;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// softmax nodes
+	Eigen::Tensor<float, 3> source_error(batch_size, memory_size, source_layer_size);
+	source_error.setValues({ {{1, 2, 0}} });
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setConstant(0);
+	// inputs of the softmax
+	Eigen::Tensor<float, 2> weights(sink_layer_size, source_layer_size);
+	weights.setValues({ {2, 1, 1}, {1, 2, 1}, {1, 1, 2} });
+	Eigen::Tensor<float, 3> sink_output(batch_size, memory_size, sink_layer_size);
+	sink_output.setValues({ {{1, 2, 3}} });
+	Eigen::Tensor<float, 3> sink_derivative(batch_size, memory_size, sink_layer_size);
+	sink_derivative.setConstant(1);
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	SoftMaxErrorTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 3> expected(batch_size, memory_size, sink_layer_size);
+	expected.setValues({ {{0.03785898, 0.347639848, -0.385498829}} });
+	for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+		BOOST_CHECK_CLOSE(sink_error(0, 0, layer_iter), expected(0, 0, layer_iter), 1e-3);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(getNameSoftMaxErrorTensorOp)
+{
+	SoftMaxErrorTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "SoftMaxErrorTensorOp");
+}
+
+/**
+LogSoftMaxErrorTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorLogSoftMaxErrorTensorOp)
+{
+	LogSoftMaxErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	LogSoftMaxErrorTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorLogSoftMaxErrorTensorOp)
+{
+	LogSoftMaxErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new LogSoftMaxErrorTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionLogSoftMaxErrorTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 1;
+	const int source_layer_size = 3;
+	const int sink_layer_size = 3;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// softmax nodes
+	Eigen::Tensor<float, 3> source_error(batch_size, memory_size, source_layer_size);
+	source_error.setValues({ {{1, 2, 0}} });
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setConstant(0);
+	// inputs of the softmax
+	Eigen::Tensor<float, 2> weights(sink_layer_size, source_layer_size);
+	weights.setValues({ {2, 1, 1}, {1, 2, 1}, {1, 1, 2} });
+	Eigen::Tensor<float, 3> sink_output(batch_size, memory_size, sink_layer_size);
+	sink_output.setValues({ {{1, 2, 3}} });
+	Eigen::Tensor<float, 3> sink_derivative(batch_size, memory_size, sink_layer_size);
+	sink_derivative.setConstant(1);
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	LogSoftMaxErrorTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 3> expected(batch_size, memory_size, sink_layer_size);
+	expected.setValues({ {{0.72990828, 1.26581459, -1.99572287}} });
+	for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+		BOOST_CHECK_CLOSE(sink_error(0, 0, layer_iter), expected(0, 0, layer_iter), 1e-3);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(getNameLogSoftMaxErrorTensorOp)
+{
+	LogSoftMaxErrorTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "LogSoftMaxErrorTensorOp");
+}
+
+/**
+SoftMaxCrossEntropyErrorTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorSoftMaxCrossEntropyErrorTensorOp)
+{
+	SoftMaxCrossEntropyErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	SoftMaxCrossEntropyErrorTensorOp<float, Eigen::DefaultDevice>* nullPointerReLU = nullptr;
+	BOOST_CHECK_EQUAL(ptrReLU, nullPointerReLU);
+}
+
+BOOST_AUTO_TEST_CASE(destructorSoftMaxCrossEntropyErrorTensorOp)
+{
+	SoftMaxCrossEntropyErrorTensorOp<float, Eigen::DefaultDevice>* ptrReLU = nullptr;
+	ptrReLU = new SoftMaxCrossEntropyErrorTensorOp<float, Eigen::DefaultDevice>();
+	delete ptrReLU;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionSoftMaxCrossEntropyErrorTensorOp)
+{
+	const int batch_size = 1;
+	const int memory_size = 1;
+	const int source_layer_size = 3;
+	const int sink_layer_size = 3;
+	const int source_time_step = 0;
+	const int sink_time_step = 0;
+
+	// softmax nodes
+	Eigen::Tensor<float, 3> source_error(batch_size, memory_size, source_layer_size);
+	source_error.setValues({ {{1, 2, 0}} });
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setConstant(0);
+	// inputs of the softmax
+	Eigen::Tensor<float, 2> weights(sink_layer_size, source_layer_size);
+	weights.setValues({ {2, 1, 1}, {1, 2, 1}, {1, 1, 2} });
+	Eigen::Tensor<float, 3> sink_output(batch_size, memory_size, sink_layer_size);
+	sink_output.setValues({ {{1, 2, 3}} });
+	Eigen::Tensor<float, 3> sink_derivative(batch_size, memory_size, sink_layer_size);
+	sink_derivative.setConstant(1);
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(0);
+
+	Eigen::DefaultDevice device;
+
+	SoftMaxCrossEntropyErrorTensorOp<float, Eigen::DefaultDevice> operation;
+	operation(source_error.data(), source_input.data(), weights.data(), sink_output.data(), sink_error.data(), sink_derivative.data(), 1,
+		batch_size, memory_size, source_layer_size, sink_layer_size, source_time_step, sink_time_step, device);
+
+	Eigen::Tensor<float, 3> expected(batch_size, memory_size, sink_layer_size);
+	expected.setValues({ {{1, 2, 0}} });
+	for (int layer_iter = 0; layer_iter < sink_layer_size; ++layer_iter) {
+		BOOST_CHECK_CLOSE(sink_error(0, 0, layer_iter), expected(0, 0, layer_iter), 1e-3);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(getNameSoftMaxCrossEntropyErrorTensorOp)
+{
+	SoftMaxCrossEntropyErrorTensorOp<float, Eigen::DefaultDevice> operation;
+
+	BOOST_CHECK_EQUAL(operation.getName(), "SoftMaxCrossEntropyErrorTensorOp");
+}
+
 /**
 SumWeightGradTensorOp Tests
 */
@@ -2219,4 +3013,46 @@ BOOST_AUTO_TEST_CASE(getNameCountWeightGradTensorOp)
 	BOOST_CHECK_EQUAL(operation.getName(), "CountWeightGradTensorOp");
 }
 
+/**
+LSTMCellWeightGradTensorOp, LSTMOutputWeightGradTensorOp, and GRUCellWeightGradTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(operationfunctionFusedCellWeightGradTensorOp)
+{
+	const int batch_size = 2;
+	const int memory_size = 2;
+	const int source_layer_size = 4;
+	const int sink_layer_size = 2;
+
+	Eigen::Tensor<float, 3> sink_error(batch_size, memory_size, sink_layer_size);
+	sink_error.setConstant(1);
+	Eigen::Tensor<float, 3> source_output(batch_size, memory_size, source_layer_size);
+	source_output.setConstant(2);
+	Eigen::Tensor<float, 3> source_input(batch_size, memory_size, source_layer_size);
+	source_input.setConstant(2);
+	Eigen::Tensor<float, 2> weights(source_layer_size, sink_layer_size);
+	weights.setValues({ {1, 0}, {2, 0}, {3, 0}, {0, 4} });
+	Eigen::Tensor<float, 2> weight_error(source_layer_size, sink_layer_size);
+
+	Eigen::DefaultDevice device;
+
+	// the fixed gate to cell links are not trained so their errors are zeroed
+	std::vector<std::shared_ptr<IntegrationWeightGradTensorOp<float, Eigen::DefaultDevice>>> operations = {
+		std::make_shared<LSTMCellWeightGradTensorOp<float, Eigen::DefaultDevice>>(),
+		std::make_shared<LSTMOutputWeightGradTensorOp<float, Eigen::DefaultDevice>>(),
+		std::make_shared<GRUCellWeightGradTensorOp<float, Eigen::DefaultDevice>>() };
+	for (auto& operation : operations) {
+		weight_error.setConstant(3);
+		(*operation)(sink_error.data(), source_output.data(), weights.data(), source_input.data(), weight_error.data(), source_layer_size,
+			batch_size, memory_size, source_layer_size, sink_layer_size, device);
+		for (int source_iter = 0; source_iter < source_layer_size; ++source_iter) {
+			for (int sink_iter = 0; sink_iter < sink_layer_size; ++sink_iter) {
+				BOOST_CHECK_EQUAL(weight_error(source_iter, sink_iter), 0);
+			}
+		}
+	}
+	BOOST_CHECK_EQUAL(operations.at(0)->getName(), "LSTMCellWeightGradTensorOp");
+	BOOST_CHECK_EQUAL(operations.at(1)->getName(), "LSTMOutputWeightGradTensorOp");
+	BOOST_CHECK_EQUAL(operations.at(2)->getName(), "GRUCellWeightGradTensorOp");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -1665,4 +1665,66 @@ BOOST_AUTO_TEST_CASE(operationfunctionMAPELossGradOp)
   BOOST_CHECK_CLOSE(error(1, 1, 1), 0.0, 1e-4);
 }
 
+/**
+  evaluateSequence Tests
+*/
+/// Check that evaluating all time steps in a single call matches evaluating each time step
+template<typename OperationT>
+void checkEvaluateSequence(OperationT& operation, const int& error_layer_size)
+{
+  const int memory_size = 4;
+  const int batch_size = 2;
+  const int layer_size = 3;
+  const int time_step_start = 1;
+  const int n_time_steps = 2;
+  Eigen::Tensor<float, 3> y_true(batch_size, layer_size, n_time_steps);
+  Eigen::Tensor<float, 3> y_pred(batch_size, memory_size, layer_size);
+  for (int i = 0; i < y_true.size(); ++i) y_true.data()[i] = (i % 3 == 0) ? 1.0f : 0.0f;
+  for (int i = 0; i < y_pred.size(); ++i) y_pred.data()[i] = 0.05f + 0.9f * float((i * 7) % 11) / 11.0f;
+  Eigen::DefaultDevice device;
+
+  Eigen::Tensor<float, 3> error_sequence(batch_size, memory_size, error_layer_size);
+  error_sequence.setConstant(0.5f);
+  operation.evaluateSequence(y_pred.data(), y_true.data(), error_sequence.data(), batch_size, memory_size, layer_size, time_step_start, n_time_steps, device);
+
+  Eigen::Tensor<float, 3> error_step(batch_size, memory_size, error_layer_size);
+  error_step.setConstant(0.5f);
+  for (int iter = 0; iter < n_time_steps; ++iter) {
+    Eigen::Tensor<float, 2> y_true_step = y_true.chip(iter, 2);
+    operation(y_pred.data(), y_true_step.data(), error_step.data(), batch_size, memory_size, layer_size, time_step_start + iter, device);
+  }
+
+  for (int i = 0; i < error_step.size(); ++i)
+    BOOST_CHECK_CLOSE(error_sequence.data()[i], error_step.data()[i], 1e-3);
+  BOOST_CHECK_CLOSE(error_sequence(0, 0, 0), 0.5, 1e-4); // time steps outside of the sequence are untouched
+}
+
+BOOST_AUTO_TEST_CASE(evaluateSequenceLossOps)
+{
+  MSELossTensorOp<float, Eigen::DefaultDevice> mse;
+  checkEvaluateSequence(mse, 1);
+  MAELossTensorOp<float, Eigen::DefaultDevice> mae;
+  checkEvaluateSequence(mae, 1);
+  BCELossTensorOp<float, Eigen::DefaultDevice> bce;
+  checkEvaluateSequence(bce, 1);
+  CrossEntropyWithLogitsLossTensorOp<float, Eigen::DefaultDevice> ce_logits;
+  checkEvaluateSequence(ce_logits, 1);
+  ManhattanDistanceLossTensorOp<float, Eigen::DefaultDevice> manhattan; // default implementation
+  checkEvaluateSequence(manhattan, 1);
+}
+
+BOOST_AUTO_TEST_CASE(evaluateSequenceLossGradOps)
+{
+  MSELossGradTensorOp<float, Eigen::DefaultDevice> mse;
+  checkEvaluateSequence(mse, 3);
+  MAELossGradTensorOp<float, Eigen::DefaultDevice> mae;
+  checkEvaluateSequence(mae, 3);
+  BCELossGradTensorOp<float, Eigen::DefaultDevice> bce;
+  checkEvaluateSequence(bce, 3);
+  CrossEntropyWithLogitsLossGradTensorOp<float, Eigen::DefaultDevice> ce_logits;
+  checkEvaluateSequence(ce_logits, 3);
+  ManhattanDistanceLossGradTensorOp<float, Eigen::DefaultDevice> manhattan; // default implementation
+  checkEvaluateSequence(manhattan, 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <SmartPeak/simulator/MNISTSimulator.h>
 #include <SmartPeak/test_config.h>
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 
 using namespace SmartPeak;
@@ -72,6 +74,101 @@ BOOST_AUTO_TEST_CASE(ReadMNIST)
   }
 }
 
+/// Write an IDX file with n_images images of n_rows x n_cols pixels (or labels if n_rows and n_cols are 0)
+void writeIDX(const std::string& filename, const int& n_images, const int& n_rows, const int& n_cols)
+{
+  std::ofstream file(filename, std::ios::binary);
+  auto writeInt = [&file](const int& i) {
+    const unsigned char bytes[4] = { (unsigned char)(i >> 24), (unsigned char)(i >> 16), (unsigned char)(i >> 8), (unsigned char)i };
+    file.write((const char*)bytes, 4);
+  };
+  const bool is_labels = n_rows == 0 && n_cols == 0;
+  writeInt((is_labels) ? 2049 : 2051);
+  writeInt(n_images);
+  if (!is_labels) {
+    writeInt(n_rows);
+    writeInt(n_cols);
+  }
+  const int n_bytes = (is_labels) ? n_images : n_images * n_rows * n_cols;
+  for (int i = 0; i < n_bytes; ++i) {
+    const unsigned char byte = (is_labels) ? i % 10 : (i * 37) % 256;
+    file.write((const char*)&byte, 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ReadMNISTMapped)
+{
+  MNISTSimulatorExt<float> datasimulator;
+  const std::string images_filename = "MNISTSimulator_test_images.idx3-ubyte";
+  const std::string labels_filename = "MNISTSimulator_test_labels.idx1-ubyte";
+  writeIDX(images_filename, 5, 4, 4);
+  writeIDX(labels_filename, 5, 0, 0);
+
+  // same data as ReadMNIST
+  Eigen::Tensor<float, 2> images_expected(4, 16), images(4, 16), labels_expected(4, 1), labels(4, 1);
+  datasimulator.ReadMNIST(images_filename, images_expected, false);
+  datasimulator.ReadMNISTMapped(images_filename, images, false);
+  datasimulator.ReadMNIST(labels_filename, labels_expected, true);
+  datasimulator.ReadMNISTMapped(labels_filename, labels, true);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 16; ++j)
+      BOOST_CHECK_EQUAL(images(i, j), images_expected(i, j));
+    BOOST_CHECK_EQUAL(labels(i, 0), labels_expected(i, 0));
+  }
+  BOOST_CHECK_EQUAL(images(1, 4), 37 * 17 % 256); // image 1, row 0, col 1
+  BOOST_CHECK_EQUAL(labels(3, 0), 3);
+
+  // scaled pixels and fewer images than samples
+  Eigen::Tensor<float, 2> images_scaled(6, 16);
+  datasimulator.ReadMNISTMapped(images_filename, images_scaled, false, std::make_pair(-1.0f, 1.0f));
+  BOOST_CHECK_CLOSE(images_scaled(2, 3), images_expected(2, 3) / 255 * 2 - 1, 1e-4);
+  BOOST_CHECK_EQUAL(images_scaled(5, 3), 0);
+
+  // bad files
+  BOOST_CHECK_THROW(datasimulator.ReadMNISTMapped("MNISTSimulator_test_missing.idx3-ubyte", images, false), std::runtime_error);
+  BOOST_CHECK_THROW(datasimulator.ReadMNISTMapped(labels_filename, images, false), std::runtime_error);
+  Eigen::Tensor<float, 2> images_small(4, 8);
+  BOOST_CHECK_THROW(datasimulator.ReadMNISTMapped(images_filename, images_small, false), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(readDataMapped)
+{
+  MNISTSimulatorExt<float> datasimulator;
+  const std::string images_filename = "MNISTSimulator_test_images.idx3-ubyte";
+  const std::string labels_filename = "MNISTSimulator_test_labels.idx1-ubyte";
+  const std::string cache_filename = "MNISTSimulator_test_images.cache";
+  writeIDX(images_filename, 5, 4, 4);
+  writeIDX(labels_filename, 5, 0, 0);
+  std::remove(cache_filename.data());
+
+  // without and with the cache
+  datasimulator.readDataMapped(images_filename, labels_filename, true, 5, 16);
+  datasimulator.readDataMapped(images_filename, labels_filename, false, 5, 16, std::make_pair(0.0f, 1.0f), cache_filename);
+  for (int i = 0; i < 5; ++i) {
+    BOOST_CHECK_EQUAL(datasimulator.training_labels(i, i % 10), 1);
+    for (int j = 0; j < 16; ++j) {
+      BOOST_CHECK_GE(datasimulator.training_data(i, j), 0);
+      BOOST_CHECK_LE(datasimulator.training_data(i, j), 1);
+      BOOST_CHECK_EQUAL(datasimulator.validation_data(i, j), datasimulator.training_data(i, j));
+    }
+  }
+
+  // the cache is only used for the same dimensions and pixel range
+  Eigen::Tensor<float, 2> images(5, 16), images_other(4, 16);
+  BOOST_CHECK(datasimulator.readCache(cache_filename, images_filename, images, std::make_pair(0.0f, 1.0f)));
+  BOOST_CHECK_EQUAL(images(2, 3), datasimulator.training_data(2, 3));
+  BOOST_CHECK(!datasimulator.readCache(cache_filename, images_filename, images, std::make_pair(-1.0f, 1.0f)));
+  BOOST_CHECK(!datasimulator.readCache(cache_filename, images_filename, images_other, std::make_pair(0.0f, 1.0f)));
+  BOOST_CHECK(!datasimulator.readCache("MNISTSimulator_test_missing.cache", images_filename, images, std::make_pair(0.0f, 1.0f)));
+
+  // the cache is read instead of the IDX file
+  images.setConstant(0.5f);
+  BOOST_CHECK(datasimulator.writeCache(cache_filename, images_filename, images, std::make_pair(0.0f, 1.0f)));
+  datasimulator.readDataMapped(images_filename, labels_filename, false, 5, 16, std::make_pair(0.0f, 1.0f), cache_filename);
+  BOOST_CHECK_EQUAL(datasimulator.validation_data(4, 15), 0.5f);
+  std::remove(cache_filename.data());
+}
+
 BOOST_AUTO_TEST_CASE(readData)
 {
   MNISTSimulatorExt<float> datasimulator;
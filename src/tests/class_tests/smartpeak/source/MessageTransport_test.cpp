@@ -0,0 +1,73 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE MessageTransport test suite
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/io/MessageTransport.h>
+
+#include <thread>
+
+using namespace SmartPeak;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(messageTransport)
+
+/// Exchange messages between two connected endpoints
+void checkTransportPair(MessageTransport& transport_1, MessageTransport& transport_2)
+{
+  std::string message;
+  BOOST_CHECK(transport_1.sendMessage("Hello"));
+  BOOST_CHECK(transport_1.sendMessage(""));
+  BOOST_CHECK(transport_2.receiveMessage(message, 1000));
+  BOOST_CHECK_EQUAL(message, "Hello");
+  BOOST_CHECK(transport_2.receiveMessage(message, 1000));
+  BOOST_CHECK_EQUAL(message, "");
+
+  // binary messages that are larger than the socket buffers
+  std::string message_large(1 << 22, '\0');
+  for (size_t i = 0; i < message_large.size(); ++i) message_large[i] = char(i % 251);
+  std::thread sender([&]() { transport_2.sendMessage(message_large); });
+  BOOST_CHECK(transport_1.receiveMessage(message, 10000));
+  sender.join();
+  BOOST_CHECK(message == message_large);
+
+  // timeout
+  BOOST_CHECK(!transport_1.receiveMessage(message, 10));
+
+  // closed channel
+  transport_2.closeTransport();
+  BOOST_CHECK(!transport_1.receiveMessage(message, 1000));
+  BOOST_CHECK(!transport_2.sendMessage("Hello"));
+}
+
+BOOST_AUTO_TEST_CASE(localQueueTransport)
+{
+  auto transport_pair = LocalQueueTransport::makeTransportPair();
+  checkTransportPair(*transport_pair.first, *transport_pair.second);
+}
+
+BOOST_AUTO_TEST_CASE(unixSocketTransport)
+{
+  auto transport_pair = UnixSocketTransport::makeSocketPair();
+  BOOST_CHECK_GE(transport_pair.first->getSocketFd(), 0);
+  checkTransportPair(*transport_pair.first, *transport_pair.second);
+  BOOST_CHECK_EQUAL(transport_pair.second->getSocketFd(), -1);
+}
+
+BOOST_AUTO_TEST_CASE(unixSocketTransportListenAndConnect)
+{
+  const std::string path = "MessageTransport_test.sock";
+  const int listen_fd = UnixSocketTransport::listenSocket(path);
+  BOOST_CHECK_GE(listen_fd, 0);
+  BOOST_CHECK(UnixSocketTransport::acceptSocket(listen_fd, 10) == nullptr);
+  BOOST_CHECK(UnixSocketTransport::connectSocket("MessageTransport_test_missing.sock") == nullptr);
+
+  std::shared_ptr<UnixSocketTransport> client = UnixSocketTransport::connectSocket(path);
+  BOOST_CHECK(client != nullptr);
+  std::shared_ptr<UnixSocketTransport> server = UnixSocketTransport::acceptSocket(listen_fd, 1000);
+  BOOST_CHECK(server != nullptr);
+  checkTransportPair(*client, *server);
+  close(listen_fd);
+  unlink(path.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -430,14 +430,15 @@ void test_operationfunctionAUROCOp()
     });
   Eigen::Tensor<double, 3> y_pred(batch_size, memory_size, layer_size);
   y_pred.setValues({
-    {{3, 2, 1, 0}, {0, 0, 0, 0}},
-    {{0, 1, 2, 3}, {0, 0, 0, 0}}
+    {{1, 0.75, 0.5, 0}, {0, 0, 0, 0}},
+    {{0, 0.5, 0.75, 1}, {0, 0, 0, 0}}
     });
 
   double error_ptr[] = { 0, 0, 0, 0 };
   cudaStream_t stream; AssertPrint(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) == cudaSuccess); Eigen::GpuStreamDevice stream_device(&stream, 0.0); Eigen::GpuDevice device(&stream_device);
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
+  operation.finalizeMetric(error_ptr, layer_size, memory_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<double, 2>> error(error_ptr, n_metrics, memory_size);
   //AssertPrint(assert_close(error(0, 0), 0.0));
   //AssertPrint(assert_close(error(1, 0), 0.5));
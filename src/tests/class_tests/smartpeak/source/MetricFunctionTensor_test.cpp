@@ -149,10 +149,10 @@ BOOST_AUTO_TEST_CASE(operationfunctionAccuracyMCMacroOp)
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
-  //BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
-  //BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.75, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
 
 /**
@@ -293,10 +293,10 @@ BOOST_AUTO_TEST_CASE(operationfunctionPrecisionMCMacroOp)
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
-  //BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
-  //BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.25, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
 
 /**
@@ -437,10 +437,10 @@ BOOST_AUTO_TEST_CASE(operationfunctionRecallMCMacroOp)
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
-  //BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
-  //BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.125, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
 
 /**
@@ -534,7 +534,7 @@ BOOST_AUTO_TEST_CASE(operationfunctionF1ScoreBCOp)
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
   BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  BOOST_CHECK_CLOSE(error(1, 0), 0, 1e-4); // FIXME
+  BOOST_CHECK_CLOSE(error(1, 0), 0.333333343, 1e-4);
   BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
   BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
@@ -582,7 +582,7 @@ BOOST_AUTO_TEST_CASE(operationfunctionF1ScoreMCMicroOp)
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
   BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  BOOST_CHECK_CLOSE(error(1, 0), 0, 1e-4); // FIXME
+  BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
   BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
   BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
@@ -629,10 +629,10 @@ BOOST_AUTO_TEST_CASE(operationfunctionF1ScoreMCMacroOp)
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
-  //BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 0), 0.66666667, 1e-4);
-  //BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.166666672, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
 
 /**
@@ -668,8 +668,8 @@ BOOST_AUTO_TEST_CASE(operationfunctionAUROCOp)
     });
   Eigen::Tensor<float, 3> y_pred(batch_size, memory_size, layer_size);
   y_pred.setValues({
-    {{3, 2, 1, 0}, {0, 0, 0, 0}},
-    {{0, 1, 2, 3}, {0, 0, 0, 0}}
+    {{1, 0.75, 0.5, 0}, {0, 0, 0, 0}},
+    {{0, 0.5, 0.75, 1}, {0, 0, 0, 0}}
     });
 
   float error_ptr[] = { 0, 0, 0, 0 };
@@ -677,10 +677,101 @@ BOOST_AUTO_TEST_CASE(operationfunctionAUROCOp)
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
-  //BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
-  //BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0, 1e-4); // not finalized
+
+  operation.finalizeMetric(error_ptr, layer_size, memory_size, n_metrics, time_step, metric_index, device);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(evaluateSequenceAUROCOp)
+{
+  AUROCTensorOp<float, Eigen::DefaultDevice> operation;
+
+  const int memory_size = 2;
+  const int batch_size = 2;
+  const int layer_size = 2;
+  const int n_metrics = 2;
+  const int time_step_start = 0;
+  const int n_time_steps = 2;
+  const int metric_index = 1;
+  Eigen::Tensor<float, 3> y_true(batch_size, layer_size, n_time_steps);
+  y_true.setZero();
+  y_true.chip(0, 1).setConstant(1);
+  Eigen::Tensor<float, 3> y_pred(batch_size, memory_size, layer_size);
+  y_pred.setValues({
+    {{0.9, 0.1}, {0.3, 0.4}},
+    {{0.8, 0.2}, {0.6, 0.7}}
+    });
+
+  Eigen::Tensor<float, 2> error(n_metrics, memory_size);
+  error.setZero();
+  Eigen::DefaultDevice device;
+
+  // the counts of both time steps are accumulated (i.e., not the average of AUROC = 1 and AUROC = 0.25)
+  operation.evaluateSequence(y_pred.data(), y_true.data(), error.data(), batch_size, memory_size, layer_size, n_metrics, time_step_start, n_time_steps, metric_index, device);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.8125, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+
+  // the accumulated counts are reset after finalizing
+  error.setZero();
+  operation.evaluateSequence(y_pred.data(), y_true.data(), error.data(), batch_size, memory_size, layer_size, n_metrics, time_step_start, 1, metric_index, device);
+  BOOST_CHECK_CLOSE(error(1, 0), 1, 1e-4);
+}
+
+/**
+  AUPRCOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorAUPRCOp)
+{
+  AUPRCTensorOp<float, Eigen::DefaultDevice>* ptrAUPRC = nullptr;
+  AUPRCTensorOp<float, Eigen::DefaultDevice>* nullPointerAUPRC = nullptr;
+  BOOST_CHECK_EQUAL(ptrAUPRC, nullPointerAUPRC);
+}
+
+BOOST_AUTO_TEST_CASE(destructorAUPRCOp)
+{
+  AUPRCTensorOp<float, Eigen::DefaultDevice>* ptrAUPRC = nullptr;
+  ptrAUPRC = new AUPRCTensorOp<float, Eigen::DefaultDevice>();
+  delete ptrAUPRC;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionAUPRCOp)
+{
+  AUPRCTensorOp<float, Eigen::DefaultDevice> operation;
+
+  const int memory_size = 2;
+  const int batch_size = 2;
+  const int layer_size = 4;
+  const int n_metrics = 2;
+  const int time_step = 0;
+  const int metric_index = 1;
+  Eigen::Tensor<float, 2> y_true(batch_size, layer_size);
+  y_true.setValues({
+    {1, 0, 0, 0}, {1, 0, 0, 0}
+    });
+  Eigen::Tensor<float, 3> y_pred(batch_size, memory_size, layer_size);
+  y_pred.setValues({
+    {{1, 0.75, 0.5, 0}, {0, 0, 0, 0}},
+    {{0, 0.5, 0.75, 1}, {0, 0, 0, 0}}
+    });
+
+  float error_ptr[] = { 0, 0, 0, 0 };
+  Eigen::DefaultDevice device;
+
+  operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
+  Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
+  BOOST_CHECK_CLOSE(error(1, 0), 0, 1e-4); // not finalized
+
+  operation.finalizeMetric(error_ptr, layer_size, memory_size, n_metrics, time_step, metric_index, device);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.375, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
 
 /**
@@ -725,10 +816,10 @@ BOOST_AUTO_TEST_CASE(operationfunctionMCCBCTensorOp)
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
-  //BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
-  //BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), -0.333333343, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
 
 /**
@@ -773,10 +864,82 @@ BOOST_AUTO_TEST_CASE(operationfunctionMCCMCMicroTensorOp)
 
   operation(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
   Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
-  //BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 0), 0.5, 1e-4);
-  //BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
-  //BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.333333343, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
+}
+
+/**
+  ClassificationMetricsTensorOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorClassificationMetricsTensorOp)
+{
+  ClassificationMetricsTensorOp<float, Eigen::DefaultDevice>* ptrMetrics = nullptr;
+  ClassificationMetricsTensorOp<float, Eigen::DefaultDevice>* nullPointerMetrics = nullptr;
+  BOOST_CHECK_EQUAL(ptrMetrics, nullPointerMetrics);
+}
+
+BOOST_AUTO_TEST_CASE(destructorClassificationMetricsTensorOp)
+{
+  ClassificationMetricsTensorOp<float, Eigen::DefaultDevice>* ptrMetrics = nullptr;
+  ptrMetrics = new ClassificationMetricsTensorOp<float, Eigen::DefaultDevice>();
+  delete ptrMetrics;
+}
+
+BOOST_AUTO_TEST_CASE(operationfunctionClassificationMetricsTensorOp)
+{
+  ClassificationMetricsTensorOp<float, Eigen::DefaultDevice> operation;
+  operation.addMetric(std::make_shared<AccuracyMCMicroTensorOp<float, Eigen::DefaultDevice>>(), 0);
+  operation.addMetric(std::make_shared<AUROCTensorOp<float, Eigen::DefaultDevice>>(), 1);
+  operation.addMetric(std::make_shared<PrecisionMCMicroTensorOp<float, Eigen::DefaultDevice>>(), 2);
+  operation.addMetric(std::make_shared<MCCBCTensorOp<float, Eigen::DefaultDevice>>(0.5), 3);
+  operation.addMetric(std::make_shared<F1ScoreMCMacroTensorOp<float, Eigen::DefaultDevice>>(), 4);
+  operation.addMetric(std::make_shared<AUPRCTensorOp<float, Eigen::DefaultDevice>>(), 5);
+  BOOST_CHECK_EQUAL(operation.getNMetrics(), 6);
+  BOOST_CHECK_EQUAL(operation.getName(), "ClassificationMetricsTensorOp");
+
+  const int memory_size = 2;
+  const int batch_size = 2;
+  const int layer_size = 4;
+  const int n_metrics = 7;
+  const int time_step = 0;
+  const int metric_index = 1;
+  Eigen::Tensor<float, 2> y_true(batch_size, layer_size);
+  y_true.setValues({
+    {1, 0, 0, 0}, {1, 0, 0, 0}
+    });
+  Eigen::Tensor<float, 3> y_pred(batch_size, memory_size, layer_size);
+  y_pred.setValues({
+    {{1, 0.75, 0.5, 0}, {0, 0, 0, 0}},
+    {{0, 0.5, 0.75, 1}, {0, 0, 0, 0}}
+    });
+
+  Eigen::Tensor<float, 2> error(n_metrics, memory_size);
+  error.setZero();
+  Eigen::DefaultDevice device;
+
+  operation(y_pred.data(), y_true.data(), error.data(), batch_size, memory_size, layer_size, n_metrics, time_step, metric_index, device);
+  BOOST_CHECK_CLOSE(error(2, 0), 0, 1e-4); // not finalized
+  BOOST_CHECK_CLOSE(error(6, 0), 0, 1e-4); // not finalized
+  operation.finalizeMetric(error.data(), layer_size, memory_size, n_metrics, time_step, metric_index, device);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0.75, 1e-4);
+  BOOST_CHECK_CLOSE(error(2, 0), 0.5, 1e-4);
+  BOOST_CHECK_CLOSE(error(3, 0), 0.5, 1e-4);
+  BOOST_CHECK_CLOSE(error(4, 0), -0.333333343, 1e-4);
+  BOOST_CHECK_CLOSE(error(5, 0), 0.166666672, 1e-4);
+  BOOST_CHECK_CLOSE(error(6, 0), 0.375, 1e-4);
+  for (int i = 0; i < n_metrics; ++i)
+    BOOST_CHECK_CLOSE(error(i, 1), 0, 1e-4);
+
+  // the same results as the individual metric functions
+  Eigen::Tensor<float, 2> error_single(n_metrics, memory_size);
+  error_single.setZero();
+  AccuracyMCMicroTensorOp<float, Eigen::DefaultDevice>()(y_pred.data(), y_true.data(), error_single.data(), batch_size, memory_size, layer_size, n_metrics, time_step, 1, device);
+  MCCBCTensorOp<float, Eigen::DefaultDevice>(0.5)(y_pred.data(), y_true.data(), error_single.data(), batch_size, memory_size, layer_size, n_metrics, time_step, 4, device);
+  BOOST_CHECK_CLOSE(error_single(1, 0), error(1, 0), 1e-4);
+  BOOST_CHECK_CLOSE(error_single(4, 0), error(4, 0), 1e-4);
 }
 
 /**
@@ -827,6 +990,40 @@ BOOST_AUTO_TEST_CASE(operationfunctionMAEOp)
   BOOST_CHECK_CLOSE(error(1, 1), 0, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(evaluateSequenceMAEOp)
+{
+  MAETensorOp<float, Eigen::DefaultDevice> operation;
+
+  const int memory_size = 3;
+  const int batch_size = 2;
+  const int layer_size = 4;
+  const int n_metrics = 2;
+  const int time_step_start = 1;
+  const int n_time_steps = 2;
+  const int metric_index = 1;
+  Eigen::Tensor<float, 3> y_true(batch_size, layer_size, n_time_steps);
+  y_true.setZero();
+  y_true.chip(0, 2).chip(0, 1).setConstant(1);
+  y_true.chip(1, 2).chip(3, 1).setConstant(1);
+  Eigen::Tensor<float, 3> y_pred(batch_size, memory_size, layer_size);
+  y_pred.setValues({
+    {{0, 0, 0, 0}, {3, 2, 1, 0}, {1, 0, 0, 0}},
+    {{0, 0, 0, 0}, {0, 1, 2, 3}, {0, 0, 0, 1}}
+    });
+
+  float error_ptr[] = { 0, 0, 0, 0, 0, 0 };
+  Eigen::DefaultDevice device;
+
+  operation.evaluateSequence(y_pred.data(), y_true.data(), error_ptr, batch_size, memory_size, layer_size, n_metrics, time_step_start, n_time_steps, metric_index, device);
+  Eigen::TensorMap<Eigen::Tensor<float, 2>> error(error_ptr, n_metrics, memory_size);
+  BOOST_CHECK_CLOSE(error(0, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 0), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 1), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 1), 1.5, 1e-4);
+  BOOST_CHECK_CLOSE(error(0, 2), 0, 1e-4);
+  BOOST_CHECK_CLOSE(error(1, 2), 0.25, 1e-4);
+}
+
 /**
   CosineSimilarityOp Tests
 */
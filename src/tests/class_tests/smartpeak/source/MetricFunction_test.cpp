@@ -359,6 +359,34 @@ BOOST_AUTO_TEST_CASE(gettersAndSettersAUROCOp)
   BOOST_CHECK_CLOSE(operation2.getClassificationThreshold(), 0.1, 1e-3);
 }
 
+/**
+  AUPRCOp Tests
+*/
+BOOST_AUTO_TEST_CASE(constructorAUPRCOp)
+{
+  AUPRCOp<double>* ptrAUPRC = nullptr;
+  AUPRCOp<double>* nullPointerAUPRC = nullptr;
+  BOOST_CHECK_EQUAL(ptrAUPRC, nullPointerAUPRC);
+}
+
+BOOST_AUTO_TEST_CASE(destructorAUPRCOp)
+{
+  AUPRCOp<double>* ptrAUPRC = nullptr;
+  ptrAUPRC = new AUPRCOp<double>();
+  delete ptrAUPRC;
+}
+
+BOOST_AUTO_TEST_CASE(gettersAndSettersAUPRCOp)
+{
+  AUPRCOp<float> operation;
+  BOOST_CHECK_EQUAL(operation.getName(), "AUPRCOp");
+  BOOST_CHECK_EQUAL(operation.getParameters().at(0), 0.5);
+  BOOST_CHECK_CLOSE(operation.getClassificationThreshold(), 0.5, 1e-3);
+
+  AUPRCOp<float> operation2(0.1);
+  BOOST_CHECK_CLOSE(operation2.getClassificationThreshold(), 0.1, 1e-3);
+}
+
 /**
   MCCBCOp Tests
 */
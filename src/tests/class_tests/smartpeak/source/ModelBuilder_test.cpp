@@ -593,6 +593,65 @@ BOOST_AUTO_TEST_CASE(addStableSoftMax)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(addSoftMaxFused)
+{
+	ModelBuilder<float> model_builder;
+	Model<float> model;
+	std::vector<std::string> node_names;
+
+	// make the input
+	node_names = model_builder.addInputNodes(model, "Input", "Input", 2);
+
+	// make the fused softmax
+	node_names = model_builder.addSoftMaxFused(model, "SoftMax", "Mod1", node_names, false, false, true);
+
+	std::vector<std::string> node_names_test = { "SoftMax-Out_000000000000", "SoftMax-Out_000000000001" };
+	BOOST_CHECK_EQUAL(node_names.size(), node_names_test.size());
+	std::map<std::string, float> codes_test = {
+		{"Input_000000000000_to_SoftMax-Out_000000000000", 2}, {"Input_000000000001_to_SoftMax-Out_000000000000", 1},
+		{"Input_000000000000_to_SoftMax-Out_000000000001", 1}, {"Input_000000000001_to_SoftMax-Out_000000000001", 2} };
+
+	// check the nodes
+	BOOST_CHECK_EQUAL(model.getNodes().size(), 2 + 2);
+	for (size_t node_iter = 0; node_iter < node_names_test.size(); ++node_iter) {
+		BOOST_CHECK_EQUAL(node_names[node_iter], node_names_test[node_iter]);
+		const std::shared_ptr<Node<float>>& node = model.getNodesMap().at(node_names_test[node_iter]);
+		BOOST_CHECK_EQUAL(node->getModuleName(), "Mod1");
+		BOOST_CHECK_EQUAL(node->getLayerName(), "Mod1-SoftMax");
+		BOOST_CHECK_EQUAL(node->getActivation()->getName(), "LinearOp");
+		BOOST_CHECK_EQUAL(node->getActivationGrad()->getName(), "LinearGradOp");
+		BOOST_CHECK_EQUAL(node->getIntegration()->getName(), "SoftMaxOp");
+		BOOST_CHECK_EQUAL(node->getIntegrationError()->getName(), "SoftMaxErrorOp");
+		BOOST_CHECK_EQUAL(node->getIntegrationWeightGrad()->getName(), "SoftMaxWeightGradOp");
+	}
+
+	// check the links and the fixed input codes
+	BOOST_CHECK_EQUAL(model.getLinks().size(), codes_test.size());
+	for (const auto& code : codes_test) {
+		std::vector<std::string> test = SplitString(code.first, "_to_");
+		BOOST_CHECK_EQUAL(model.getLink(code.first).getSourceNodeName(), test[0]);
+		BOOST_CHECK_EQUAL(model.getLink(code.first).getSinkNodeName(), test[1]);
+		BOOST_CHECK_EQUAL(model.getLink(code.first).getModuleName(), "Mod1");
+		const std::shared_ptr<Weight<float>>& weight = model.getWeightsMap().at(code.first);
+		BOOST_CHECK_EQUAL(weight->getWeightInitOp()->getName(), "ConstWeightInitOp");
+		BOOST_CHECK_EQUAL(weight->getWeightInitOp()->getParamsAsStr(), "n:" + std::to_string(code.second));
+		BOOST_CHECK_EQUAL(weight->getSolverOp()->getName(), "DummySolverOp");
+	}
+
+	// the log softmax and the softmax fused with the loss function gradient
+	Model<float> model_log;
+	node_names = model_builder.addInputNodes(model_log, "Input", "Input", 2);
+	node_names = model_builder.addSoftMaxFused(model_log, "SoftMax", "Mod1", node_names, true, false);
+	BOOST_CHECK_EQUAL(model_log.getNode(node_names.front()).getIntegration()->getName(), "LogSoftMaxOp");
+	BOOST_CHECK_EQUAL(model_log.getNode(node_names.front()).getIntegrationError()->getName(), "LogSoftMaxErrorOp");
+	Model<float> model_loss;
+	node_names = model_builder.addInputNodes(model_loss, "Input", "Input", 2);
+	node_names = model_builder.addSoftMaxFused(model_loss, "SoftMax", "Mod1", node_names, false, true);
+	BOOST_CHECK_EQUAL(model_loss.getNode(node_names.front()).getIntegration()->getName(), "SoftMaxOp");
+	BOOST_CHECK_EQUAL(model_loss.getNode(node_names.front()).getIntegrationError()->getName(), "SoftMaxCrossEntropyErrorOp");
+	BOOST_CHECK_THROW(model_builder.addSoftMaxFused(model_loss, "SoftMaxLog", "Mod1", node_names, true, true), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(addConvolution1)
 {
 	ModelBuilder<float> model_builder;
@@ -1804,6 +1863,103 @@ BOOST_AUTO_TEST_CASE(addLSTM)
 		BOOST_CHECK_EQUAL(node_names[node_iter], node_names_test[node_iter]);
 }
 
+BOOST_AUTO_TEST_CASE(addLSTMFused)
+{
+	ModelBuilder<float> model_builder;
+	Model<float> model;
+	std::vector<std::string> node_names;
+
+	// make the input
+	node_names = model_builder.addInputNodes(model, "Input", "Input", 2);
+
+	// make the fused LSTM
+	node_names = model_builder.addLSTMFused(model, "LSTM", "Mod1", node_names, 2,
+		std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(1.0)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, true, true, true);
+
+	std::vector<std::string> node_names_test = { "LSTM-Output_000000000000", "LSTM-Output_000000000001" };
+	BOOST_CHECK_EQUAL(node_names.size(), node_names_test.size());
+	for (size_t node_iter = 0; node_iter < node_names_test.size(); ++node_iter)
+		BOOST_CHECK_EQUAL(node_names[node_iter], node_names_test[node_iter]);
+
+	// check the nodes (inputs, gates, gate biases, memory cells, output gates, and outputs)
+	BOOST_CHECK_EQUAL(model.getNodes().size(), 2 + 8 + 8 + 2 + 2 + 2);
+	const std::shared_ptr<Node<float>>& gate = model.getNodesMap().at("LSTM-Gates-Forget_000000000001");
+	BOOST_CHECK_EQUAL(gate->getIntegration()->getName(), "SumOp");
+	BOOST_CHECK_EQUAL(gate->getLayerName(), "Mod1-Gates");
+	const std::shared_ptr<Node<float>>& memory_cell = model.getNodesMap().at("LSTM-MemoryCell_000000000001");
+	BOOST_CHECK_EQUAL(memory_cell->getIntegration()->getName(), "LSTMCellOp");
+	BOOST_CHECK_EQUAL(memory_cell->getLayerName(), "Mod1-Cells");
+	const std::shared_ptr<Node<float>>& output_gate = model.getNodesMap().at("LSTM-OutputGate_000000000001");
+	BOOST_CHECK_EQUAL(output_gate->getIntegration()->getName(), "LSTMCellOp");
+	BOOST_CHECK_EQUAL(output_gate->getLayerName(), "Mod1-Cells");
+	const std::shared_ptr<Node<float>>& output = model.getNodesMap().at("LSTM-Output_000000000001");
+	BOOST_CHECK_EQUAL(output->getIntegration()->getName(), "LSTMOutputOp");
+	BOOST_CHECK_EQUAL(output->getLayerName(), "Mod1-Output");
+
+	// check the links (inputs, biases, recurrent, gates to cells, and cells to outputs)
+	BOOST_CHECK_EQUAL(model.getLinks().size(), 16 + 8 + 16 + 16 + 4);
+	BOOST_CHECK_EQUAL(model.getCyclicPairs().size(), 16);
+	BOOST_CHECK_EQUAL(model.getLinksMap().at("LSTM-Output_000000000000_to_LSTM-Gates-Input_000000000001")->getSourceNodeName(), "LSTM-Output_000000000000");
+
+	// check the fixed gate codes
+	std::map<std::string, float> codes_test = {
+		{"LSTM-Gates-Input_000000000001_to_LSTM-MemoryCell_000000000001", 1},
+		{"LSTM-Gates-Forget_000000000001_to_LSTM-MemoryCell_000000000001", 2},
+		{"LSTM-Gates-BlockInput_000000000001_to_LSTM-MemoryCell_000000000001", 3},
+		{"LSTM-Gates-Output_000000000001_to_LSTM-MemoryCell_000000000001", 0},
+		{"LSTM-Gates-Input_000000000001_to_LSTM-OutputGate_000000000001", 0},
+		{"LSTM-Gates-Output_000000000001_to_LSTM-OutputGate_000000000001", 4},
+		{"LSTM-MemoryCell_000000000001_to_LSTM-Output_000000000001", 1},
+		{"LSTM-OutputGate_000000000001_to_LSTM-Output_000000000001", 2} };
+	for (const auto& code : codes_test) {
+		const std::shared_ptr<Weight<float>>& weight = model.getWeightsMap().at(code.first);
+		BOOST_CHECK_EQUAL(weight->getSolverOp()->getName(), "DummySolverOp");
+		BOOST_CHECK_EQUAL(weight->getWeightInitOp()->getParamsAsStr(), "n:" + std::to_string(code.second));
+		BOOST_CHECK_EQUAL(weight->getLayerName(), "Mod1-Cells");
+	}
+}
+
+BOOST_AUTO_TEST_CASE(addGRUFused)
+{
+	ModelBuilder<float> model_builder;
+	Model<float> model;
+	std::vector<std::string> node_names;
+
+	// make the input
+	node_names = model_builder.addInputNodes(model, "Input", "Input", 2);
+
+	// make the fused GRU
+	node_names = model_builder.addGRUFused(model, "GRU", "Mod1", node_names, 2,
+		std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(1.0)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, true, true, true);
+
+	std::vector<std::string> node_names_test = { "GRU-Output_000000000000", "GRU-Output_000000000001" };
+	BOOST_CHECK_EQUAL(node_names.size(), node_names_test.size());
+	for (size_t node_iter = 0; node_iter < node_names_test.size(); ++node_iter)
+		BOOST_CHECK_EQUAL(node_names[node_iter], node_names_test[node_iter]);
+
+	// check the nodes (inputs, gates, gate biases, and outputs)
+	BOOST_CHECK_EQUAL(model.getNodes().size(), 2 + 8 + 8 + 2);
+	const std::shared_ptr<Node<float>>& output = model.getNodesMap().at("GRU-Output_000000000001");
+	BOOST_CHECK_EQUAL(output->getIntegration()->getName(), "GRUCellOp");
+	BOOST_CHECK_EQUAL(output->getLayerName(), "Mod1-Output");
+
+	// check the links (inputs, biases, recurrent, and gates to outputs)
+	BOOST_CHECK_EQUAL(model.getLinks().size(), 16 + 8 + 16 + 8);
+	BOOST_CHECK_EQUAL(model.getCyclicPairs().size(), 16);
+
+	// check the fixed gate codes
+	std::map<std::string, float> codes_test = {
+		{"GRU-Gates-Update_000000000001_to_GRU-Output_000000000001", 1},
+		{"GRU-Gates-Reset_000000000001_to_GRU-Output_000000000001", 2},
+		{"GRU-Gates-InputCandidate_000000000001_to_GRU-Output_000000000001", 3},
+		{"GRU-Gates-RecurrentCandidate_000000000001_to_GRU-Output_000000000001", 4} };
+	for (const auto& code : codes_test) {
+		const std::shared_ptr<Weight<float>>& weight = model.getWeightsMap().at(code.first);
+		BOOST_CHECK_EQUAL(weight->getSolverOp()->getName(), "DummySolverOp");
+		BOOST_CHECK_EQUAL(weight->getWeightInitOp()->getParamsAsStr(), "n:" + std::to_string(code.second));
+	}
+}
+
 BOOST_AUTO_TEST_CASE(addDotProdAttention1)
 { // [TODO: update mod names]
 	ModelBuilder<float> model_builder;
@@ -2209,6 +2365,53 @@ BOOST_AUTO_TEST_CASE(addMultiHeadAttention1)
 	BOOST_CHECK_EQUAL(model.weights_.size(), 116); // two attention heads + fully connected
 }
 
+BOOST_AUTO_TEST_CASE(addMultiHeadAttentionFused)
+{
+	ModelBuilder<float> model_builder;
+	Model<float> model;
+	std::vector<std::string> node_names;
+
+	// make the input
+	node_names = model_builder.addInputNodes(model, "Input", "Input", 2);
+
+	// make the fused attention
+	node_names = model_builder.addMultiHeadAttentionFused(model, "Hidden", "Mod1", node_names, 2, 2, 3,
+		std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()),
+		std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(1.0)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, 0.0f, false, true);
+
+	std::vector<std::string> node_names_test = { "Hidden_MultiHead_000000000000", "Hidden_MultiHead_000000000001" };
+	BOOST_CHECK_EQUAL(node_names.size(), node_names_test.size());
+	for (size_t node_iter = 0; node_iter < node_names_test.size(); ++node_iter)
+		BOOST_CHECK_EQUAL(node_names[node_iter], node_names_test[node_iter]);
+
+	// check the nodes (inputs, projections, attention, and outputs)
+	BOOST_CHECK_EQUAL(model.getNodes().size(), 2 + 18 + 6 + 2);
+	const std::shared_ptr<Node<float>>& projection = model.getNodesMap().at("Hidden-Projections-Values-000000000001_000000000002");
+	BOOST_CHECK_EQUAL(projection->getIntegration()->getName(), "SumOp");
+	BOOST_CHECK_EQUAL(projection->getLayerName(), "Mod1-Projections");
+	const std::shared_ptr<Node<float>>& attention = model.getNodesMap().at("Hidden-Attention-000000000001_000000000002");
+	BOOST_CHECK_EQUAL(attention->getIntegration()->getName(), "DotProdAttentionOp");
+	BOOST_CHECK_EQUAL(attention->getLayerName(), "Mod1-Attention");
+
+	// check the links (inputs to projections, projections to attention, and attention to outputs)
+	BOOST_CHECK_EQUAL(model.getLinks().size(), 36 + 54 + 12);
+
+	// check the fixed projection codes
+	std::map<std::string, float> codes_test = {
+		{"Hidden-Projections-Query-000000000001_000000000000_to_Hidden-Attention-000000000001_000000000002", 1},
+		{"Hidden-Projections-Key-000000000001_000000000000_to_Hidden-Attention-000000000001_000000000002", 2},
+		{"Hidden-Projections-Values-000000000001_000000000000_to_Hidden-Attention-000000000001_000000000002", 0},
+		{"Hidden-Projections-Query-000000000001_000000000002_to_Hidden-Attention-000000000001_000000000002", 7},
+		{"Hidden-Projections-Key-000000000001_000000000002_to_Hidden-Attention-000000000001_000000000002", 8},
+		{"Hidden-Projections-Values-000000000001_000000000002_to_Hidden-Attention-000000000001_000000000002", 9} };
+	for (const auto& code : codes_test) {
+		const std::shared_ptr<Weight<float>>& weight = model.getWeightsMap().at(code.first);
+		BOOST_CHECK_EQUAL(weight->getSolverOp()->getName(), "DummySolverOp");
+		BOOST_CHECK_EQUAL(weight->getWeightInitOp()->getParamsAsStr(), "n:" + std::to_string(code.second));
+	}
+	BOOST_CHECK(model.getWeightsMap().count("Hidden-Projections-Query-000000000000_000000000000_to_Hidden-Attention-000000000001_000000000000") == 0);
+}
+
 BOOST_AUTO_TEST_CASE(addScalar)
 {
 	//TODO
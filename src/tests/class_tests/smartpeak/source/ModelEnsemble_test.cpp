@@ -0,0 +1,165 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE ModelEnsemble test suite
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/ml/ModelEnsemble.h>
+#include <SmartPeak/ml/ModelBuilder.h>
+#include <SmartPeak/ml/ModelInterpreterDefaultDevice.h>
+
+using namespace SmartPeak;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(modelEnsemble)
+
+/// Fully connected model with 2 inputs, 3 hidden nodes, and 2 outputs
+Model<float> makeModelFC(const std::string& name)
+{
+  Model<float> model;
+  model.setName(name);
+  ModelBuilder<float> model_builder;
+  std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", 2, true);
+  node_names = model_builder.addFullyConnected(model, "Hidden", "Hidden", node_names, 3,
+    std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()),
+    std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+    std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(2)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, 0.0f, true, true);
+  node_names = model_builder.addFullyConnected(model, "Output", "Output", node_names, 2,
+    std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()),
+    std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+    std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(3)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, 0.0f, true, true);
+  for (const std::string& node_name : node_names)
+    model.nodes_.at(node_name)->setType(NodeType::output);
+  model.setInputAndOutputNodes();
+  return model;
+}
+
+BOOST_AUTO_TEST_CASE(constructor)
+{
+  ModelEnsemble<float, ModelInterpreterDefaultDevice<float>>* ptr = nullptr;
+  ModelEnsemble<float, ModelInterpreterDefaultDevice<float>>* nullPointer = nullptr;
+  ptr = new ModelEnsemble<float, ModelInterpreterDefaultDevice<float>>();
+  BOOST_CHECK_NE(ptr, nullPointer);
+  BOOST_CHECK(ptr->getReduction() == EnsembleReduction::Mean);
+  BOOST_CHECK_EQUAL(ptr->getStackingWeights().size(), 0);
+  BOOST_CHECK_EQUAL(ptr->getNMembers(), 0);
+  delete ptr;
+}
+
+BOOST_AUTO_TEST_CASE(makeEnsembleModel)
+{
+  ModelEnsemble<float, ModelInterpreterDefaultDevice<float>> model_ensemble;
+  std::vector<Model<float>> models = { makeModelFC("0"), makeModelFC("1") };
+  Model<float> ensemble_model = model_ensemble.makeEnsembleModel(models);
+  BOOST_CHECK_EQUAL(model_ensemble.getNMembers(), 2);
+  BOOST_CHECK_EQUAL(ensemble_model.getName(), "0@Ensemble");
+
+  // the input and bias nodes are shared and the remaining nodes, links, and weights are copied
+  BOOST_CHECK_EQUAL(ensemble_model.getNodes().size(), 2 + 5 + 2 * (3 + 2)); // inputs, biases, and the hidden and output nodes of each member
+  BOOST_CHECK_EQUAL(ensemble_model.getLinks().size(), 2 * models.front().getLinks().size());
+  BOOST_CHECK_EQUAL(ensemble_model.getWeights().size(), 2 * models.front().getWeights().size());
+  BOOST_CHECK_EQUAL(model_ensemble.makeMemberName("Hidden_000000000000", 1), "Hidden_000000000000@Ensemble1");
+  const Link link = ensemble_model.getLink(model_ensemble.makeMemberName("Input_000000000000_to_Hidden_000000000000", 1));
+  BOOST_CHECK_EQUAL(link.getSourceNodeName(), "Input_000000000000");
+  BOOST_CHECK_EQUAL(link.getSinkNodeName(), "Hidden_000000000000@Ensemble1");
+  BOOST_CHECK_EQUAL(link.getWeightName(), "Input_000000000000_to_Hidden_000000000000@Ensemble1");
+
+  // incompatible models
+  Model<float> model_bad = makeModelFC("2");
+  model_bad.removeLinks({ "Input_000000000000_to_Hidden_000000000000" });
+  models.push_back(model_bad);
+  BOOST_CHECK_THROW(model_ensemble.makeEnsembleModel(models), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(evaluateEnsemble)
+{
+  const int batch_size = 4, memory_size = 1, n_members = 3;
+  const std::vector<std::string> input_nodes = { "Input_000000000000", "Input_000000000001" };
+  const std::vector<std::string> output_nodes = { "Output_000000000000", "Output_000000000001" };
+  Eigen::Tensor<float, 3> input(batch_size, memory_size, (int)input_nodes.size());
+  for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+    input(batch_iter, 0, 0) = batch_iter + 1;
+    input(batch_iter, 0, 1) = 2 - batch_iter;
+  }
+
+  // evaluate each member on its own interpreter
+  ModelResources model_resources = { ModelDevice(0, 1) };
+  std::vector<Model<float>> models;
+  Eigen::Tensor<float, 4> member_outputs_expected(batch_size, memory_size, (int)output_nodes.size(), n_members);
+  std::vector<std::map<std::string, std::vector<int>>> tensor_ops_steps;
+  auto getWeightTensorsSize = [](Model<float>& model, ModelInterpreterDefaultDevice<float>& model_interpreter) {
+    std::set<int> weight_tensor_indices;
+    for (auto& weight_map : model.getWeightsMap())
+      weight_tensor_indices.insert(std::get<0>(weight_map.second->getTensorIndex().at(0)));
+    int weight_tensors_size = 0;
+    for (const int& weight_tensor_index : weight_tensor_indices)
+      weight_tensors_size += model_interpreter.getWeightTensor(weight_tensor_index)->getWeight().size();
+    return weight_tensors_size;
+  };
+  int weight_tensors_size = 0;
+  for (int member = 0; member < n_members; ++member) {
+    Model<float> model = makeModelFC(std::to_string(member));
+    ModelInterpreterDefaultDevice<float> model_interpreter(model_resources);
+    model_interpreter.getForwardPropogationOperations(model, batch_size, memory_size, false, false, true, true);
+    model_interpreter.initBiases(model);
+    model_interpreter.mapValuesToLayers(model, input, input_nodes, "output");
+    model_interpreter.mapValuesToLayers(model, input, input_nodes, "input");
+    model_interpreter.FPTT(memory_size);
+    model_interpreter.getModelResults(model, true, true, false, false);
+    for (int node_iter = 0; node_iter < output_nodes.size(); ++node_iter)
+      for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+        member_outputs_expected(batch_iter, 0, node_iter, member) = model.getNodesMap().at(output_nodes.at(node_iter))->getOutput()(batch_iter, 0);
+    tensor_ops_steps = model_interpreter.getTensorOpsSteps();
+    weight_tensors_size = getWeightTensorsSize(model, model_interpreter);
+    models.push_back(model);
+  }
+
+  // evaluate all members in a single forward propogation
+  ModelEnsemble<float, ModelInterpreterDefaultDevice<float>> model_ensemble;
+  Model<float> ensemble_model = model_ensemble.makeEnsembleModel(models);
+  ModelInterpreterDefaultDevice<float> model_interpreter(model_resources);
+  Eigen::Tensor<float, 4> member_outputs = model_ensemble.evaluateMembers(ensemble_model, model_interpreter, input, input_nodes, output_nodes);
+  // the members are evaluated in parallel tensors in the same steps (i.e., no block-diagonal weight tensors)
+  BOOST_CHECK_EQUAL(model_interpreter.getTensorOpsSteps().size(), tensor_ops_steps.size());
+  for (int step = 0; step < tensor_ops_steps.size(); ++step)
+    BOOST_CHECK_EQUAL(model_interpreter.getTensorOpsSteps().at(step).size(), n_members * tensor_ops_steps.at(step).size());
+  for (int member = 1; member < n_members; ++member) {
+    BOOST_CHECK_NE(ensemble_model.getNodesMap().at(model_ensemble.makeMemberName(output_nodes.at(0), member))->getTensorIndex().first,
+      ensemble_model.getNodesMap().at(model_ensemble.makeMemberName(output_nodes.at(0), 0))->getTensorIndex().first);
+  }
+  BOOST_CHECK_EQUAL(getWeightTensorsSize(ensemble_model, model_interpreter), n_members * weight_tensors_size);
+  BOOST_CHECK_EQUAL(member_outputs.dimension(3), n_members);
+  for (int member = 0; member < n_members; ++member)
+    for (int node_iter = 0; node_iter < output_nodes.size(); ++node_iter)
+      for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+        BOOST_CHECK_CLOSE(member_outputs(batch_iter, 0, node_iter, member), member_outputs_expected(batch_iter, 0, node_iter, member), 1e-4);
+
+  // mean
+  Eigen::Tensor<float, 3> ensemble_output = model_ensemble.evaluateEnsemble(ensemble_model, model_interpreter, input, input_nodes, output_nodes);
+  BOOST_CHECK_CLOSE(ensemble_output(1, 0, 1), (member_outputs_expected(1, 0, 1, 0) + member_outputs_expected(1, 0, 1, 1) + member_outputs_expected(1, 0, 1, 2)) / 3, 1e-4);
+
+  // vote
+  model_ensemble.setReduction(EnsembleReduction::Vote);
+  ensemble_output = model_ensemble.reduceMemberOutputs(member_outputs);
+  for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+    float votes_0 = 0;
+    for (int member = 0; member < n_members; ++member)
+      if (member_outputs(batch_iter, 0, 0, member) >= member_outputs(batch_iter, 0, 1, member)) votes_0 += 1;
+    BOOST_CHECK_CLOSE(ensemble_output(batch_iter, 0, 0), votes_0 / n_members, 1e-4);
+    BOOST_CHECK_CLOSE(ensemble_output(batch_iter, 0, 0) + ensemble_output(batch_iter, 0, 1), 1, 1e-4);
+  }
+
+  // stacking
+  model_ensemble.setReduction(EnsembleReduction::Stacking);
+  BOOST_CHECK_THROW(model_ensemble.reduceMemberOutputs(member_outputs), std::runtime_error);
+  model_ensemble.setStackingWeights({ 0.0f, 1.0f, 0.0f });
+  ensemble_output = model_ensemble.reduceMemberOutputs(member_outputs);
+  BOOST_CHECK_CLOSE(ensemble_output(2, 0, 0), member_outputs_expected(2, 0, 0, 1), 1e-4);
+
+  // the stacking weights of an expected output of 2 * member 0 - member 2
+  Eigen::Tensor<float, 3> expected = member_outputs.chip(0, 3) * member_outputs.chip(0, 3).constant(2.0f) - member_outputs.chip(2, 3);
+  model_ensemble.fitStackingWeights(member_outputs, expected, 0.0f);
+  BOOST_CHECK_CLOSE(model_ensemble.getStackingWeights().at(0), 2.0f, 1e-2);
+  BOOST_CHECK_SMALL(model_ensemble.getStackingWeights().at(1), 1e-3f);
+  BOOST_CHECK_CLOSE(model_ensemble.getStackingWeights().at(2), -1.0f, 1e-2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
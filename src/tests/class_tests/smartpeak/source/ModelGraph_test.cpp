@@ -0,0 +1,105 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE ModelGraph test suite 
+// #include <boost/test/unit_test.hpp> // changes every so often...
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/ml/ModelGraph.h>
+
+#include <vector>
+#include <iostream>
+
+using namespace SmartPeak;
+using namespace std;
+
+Model<float> makeModelGraphToy()
+{
+  // i -> h (+ b -> h) -> o and a recurrent link h -> h
+  Node<float> i, h, o, b;
+  i = Node<float>("i", NodeType::input, NodeStatus::activated, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  h = Node<float>("h", NodeType::hidden, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  o = Node<float>("o", NodeType::output, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  b = Node<float>("b", NodeType::bias, NodeStatus::activated, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  std::shared_ptr<WeightInitOp<float>> weight_init = std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(1.0));
+  std::shared_ptr<SolverOp<float>> solver = std::make_shared<SGDOp<float>>(SGDOp<float>(0.01, 0.9));
+  Weight<float> w_i_h("w_i_h", weight_init, solver), w_b_h("w_b_h", weight_init, solver), w_h_h("w_h_h", weight_init, solver), w_h_o("w_h_o", weight_init, solver);
+  Link l_i_h("l_i_h", "i", "h", "w_i_h"), l_b_h("l_b_h", "b", "h", "w_b_h"), l_h_h("l_h_h", "h", "h", "w_h_h"), l_h_o("l_h_o", "h", "o", "w_h_o");
+  Model<float> model;
+  model.addNodes({ i, h, o, b });
+  model.addWeights({ w_i_h, w_b_h, w_h_h, w_h_o });
+  model.addLinks({ l_i_h, l_b_h, l_h_h, l_h_o });
+  return model;
+}
+
+BOOST_AUTO_TEST_SUITE(modelGraph)
+
+BOOST_AUTO_TEST_CASE(constructor) 
+{
+  ModelGraph<float>* ptr = nullptr;
+  ModelGraph<float>* nullPointer = nullptr;
+  ptr = new ModelGraph<float>();
+  BOOST_CHECK_NE(ptr, nullPointer);
+  BOOST_CHECK_EQUAL(ptr->getNNodes(), 0);
+  BOOST_CHECK_EQUAL(ptr->getNLinks(), 0);
+  BOOST_CHECK_EQUAL(ptr->getNWeights(), 0);
+  delete ptr;
+}
+
+BOOST_AUTO_TEST_CASE(setGraph)
+{
+  Model<float> model = makeModelGraphToy();
+  ModelGraph<float> graph(model);
+
+  // indices follow the name order of the model maps
+  BOOST_CHECK_EQUAL(graph.getNNodes(), 4);
+  BOOST_CHECK_EQUAL(graph.getNLinks(), 4);
+  BOOST_CHECK_EQUAL(graph.getNWeights(), 4);
+  BOOST_CHECK_EQUAL(graph.getNodeIndex("b"), 0);
+  BOOST_CHECK_EQUAL(graph.getNodeIndex("h"), 1);
+  BOOST_CHECK_EQUAL(graph.getNodeIndex("i"), 2);
+  BOOST_CHECK_EQUAL(graph.getNodeIndex("o"), 3);
+  BOOST_CHECK_EQUAL(graph.getNodeIndex("x"), -1);
+  BOOST_CHECK_EQUAL(graph.getLinkIndex("l_b_h"), 0);
+  BOOST_CHECK_EQUAL(graph.getLinkIndex("l_h_o"), 2);
+  BOOST_CHECK_EQUAL(graph.getWeightIndex("w_i_h"), 3);
+  BOOST_CHECK_EQUAL(graph.getWeightIndex("x"), -1);
+
+  // the graph shares the model elements
+  BOOST_CHECK(graph.getNode(1) == model.nodes_.at("h"));
+  BOOST_CHECK(graph.getLink(0) == model.links_.at("l_b_h"));
+  BOOST_CHECK(graph.getWeight(3) == model.weights_.at("w_i_h"));
+
+  // link endpoints
+  const int l_h_h = graph.getLinkIndex("l_h_h");
+  BOOST_CHECK_EQUAL(graph.getLinkSource(l_h_h), graph.getNodeIndex("h"));
+  BOOST_CHECK_EQUAL(graph.getLinkSink(l_h_h), graph.getNodeIndex("h"));
+  BOOST_CHECK_EQUAL(graph.getLinkWeight(l_h_h), graph.getWeightIndex("w_h_h"));
+
+  // adjacency
+  auto in_links = graph.getInLinks(graph.getNodeIndex("h"));
+  BOOST_CHECK_EQUAL(in_links.second - in_links.first, 3);
+  BOOST_CHECK_EQUAL(graph.getLink(in_links.first[0])->getName(), "l_b_h");
+  BOOST_CHECK_EQUAL(graph.getLink(in_links.first[1])->getName(), "l_h_h");
+  BOOST_CHECK_EQUAL(graph.getLink(in_links.first[2])->getName(), "l_i_h");
+  auto out_links = graph.getOutLinks(graph.getNodeIndex("h"));
+  BOOST_CHECK_EQUAL(out_links.second - out_links.first, 2);
+  BOOST_CHECK_EQUAL(graph.getLink(out_links.first[0])->getName(), "l_h_h");
+  BOOST_CHECK_EQUAL(graph.getLink(out_links.first[1])->getName(), "l_h_o");
+  in_links = graph.getInLinks(graph.getNodeIndex("i"));
+  BOOST_CHECK(in_links.first == in_links.second);
+  out_links = graph.getOutLinks(graph.getNodeIndex("o"));
+  BOOST_CHECK(out_links.first == out_links.second);
+
+  // rebuild after a structural change
+  model.removeLinks({ "l_h_h" });
+  graph.setGraph(model);
+  BOOST_CHECK_EQUAL(graph.getNLinks(), 3);
+  BOOST_CHECK_EQUAL(graph.getLinkIndex("l_h_h"), -1);
+  in_links = graph.getInLinks(graph.getNodeIndex("h"));
+  BOOST_CHECK_EQUAL(in_links.second - in_links.first, 2);
+
+  graph.clear();
+  BOOST_CHECK_EQUAL(graph.getNNodes(), 0);
+  BOOST_CHECK_EQUAL(graph.getNodeIndex("h"), -1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
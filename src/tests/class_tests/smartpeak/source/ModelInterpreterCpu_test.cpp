@@ -3,6 +3,7 @@
 #define BOOST_TEST_MODULE ModelInterpreterCpu test suite 
 #include <boost/test/included/unit_test.hpp>
 #include <SmartPeak/ml/ModelInterpreterDefaultDevice.h>
+#include <SmartPeak/ml/ModelBuilder.h>
 #include <SmartPeak/simulator/HarmonicOscillatorSimulator.h>
 
 using namespace SmartPeak;
@@ -343,6 +344,75 @@ BOOST_AUTO_TEST_CASE(getForwardPropogationOperations)
   }
 }
 
+BOOST_AUTO_TEST_CASE(getForwardPropogationOperationsCompiledModelCache)
+{
+  const int batch_size = 4;
+  const int memory_size = 1;
+  const bool train = true;
+  std::shared_ptr<CompiledModelCache> compiled_model_cache = std::make_shared<CompiledModelCache>();
+
+  // compile the first model and add the schedule to the cache
+  Model<float> model1 = makeModelToy1();
+  const std::size_t model1_structure_hash = model1.getStructureHash(); // before the tensor indices are assigned
+  ModelInterpreterDefaultDevice<float> model_interpreter1;
+  model_interpreter1.setCompiledModelCache(compiled_model_cache);
+  model_interpreter1.getForwardPropogationOperations(model1, batch_size, memory_size, train, false, true, true);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getSize(), 1);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getNHits(), 0);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getNMisses(), 1);
+
+  // re-instantiate the schedule with a structurally identical model with different weights
+  Model<float> model2 = makeModelToy1();
+  model2.setId(2);
+  model2.setName("2");
+  for (auto& weight_map : model2.weights_) {
+    weight_map.second->setWeight(2.0);
+    weight_map.second->setInitWeight(false);
+  }
+  BOOST_CHECK_EQUAL(model1_structure_hash, model2.getStructureHash());
+  ModelInterpreterDefaultDevice<float> model_interpreter2 = model_interpreter1;
+  BOOST_CHECK(model_interpreter2.getCompiledModelCache() == compiled_model_cache);
+  model_interpreter2.getForwardPropogationOperations(model2, batch_size, memory_size, train, false, true, true);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getSize(), 1);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getNHits(), 1);
+
+  // the operations are bound to the new model
+  std::vector<OperationList<float>> FP_operations1 = model_interpreter1.getFPOperations();
+  std::vector<OperationList<float>> FP_operations2 = model_interpreter2.getFPOperations();
+  BOOST_CHECK_EQUAL(FP_operations1.size(), FP_operations2.size());
+  for (int i = 0; i < FP_operations2.size(); ++i) {
+    BOOST_CHECK_EQUAL(FP_operations1[i].result.sink_node->getName(), FP_operations2[i].result.sink_node->getName());
+    BOOST_CHECK(FP_operations2[i].result.sink_node == model2.nodes_.at(FP_operations2[i].result.sink_node->getName()));
+    BOOST_CHECK_EQUAL(FP_operations1[i].arguments.size(), FP_operations2[i].arguments.size());
+    for (int j = 0; j < FP_operations2[i].arguments.size(); ++j) {
+      BOOST_CHECK(FP_operations2[i].arguments[j].source_node == model2.nodes_.at(FP_operations2[i].arguments[j].source_node->getName()));
+      BOOST_CHECK(FP_operations2[i].arguments[j].weight == model2.weights_.at(FP_operations2[i].arguments[j].weight->getName()));
+    }
+  }
+  BOOST_CHECK(model_interpreter1.getTensorOpsSteps() == model_interpreter2.getTensorOpsSteps());
+
+  // the tensors are allocated with the new weight values
+  for (int i = 0; i < 3; ++i) {
+    BOOST_CHECK_CLOSE(model_interpreter1.getWeightTensor(i)->getWeight()(0, 0), 1.0, 1e-4);
+    BOOST_CHECK_CLOSE(model_interpreter2.getWeightTensor(i)->getWeight()(0, 0), 2.0, 1e-4);
+  }
+
+  // a model with a different structure is compiled
+  Model<float> model3 = makeModelToy1();
+  model3.links_.at("5")->setWeightName("4");
+  BOOST_CHECK_NE(model1_structure_hash, model3.getStructureHash());
+  ModelInterpreterDefaultDevice<float> model_interpreter3;
+  model_interpreter3.setCompiledModelCache(compiled_model_cache);
+  model_interpreter3.getForwardPropogationOperations(model3, batch_size, memory_size, train, false, true, true);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getSize(), 2);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getNHits(), 1);
+  BOOST_CHECK_EQUAL(compiled_model_cache->getNMisses(), 2);
+
+  // clearing the interpreter cache does not clear the compiled model cache
+  model_interpreter1.clear_cache();
+  BOOST_CHECK_EQUAL(compiled_model_cache->getSize(), 2);
+}
+
 Model<float> model_mapValuesToLayers = makeModelToy1();
 BOOST_AUTO_TEST_CASE(mapValuesToLayers)
 {
@@ -966,6 +1036,15 @@ BOOST_AUTO_TEST_CASE(CETT)
 			}
 		}
 	}
+
+	// the converted loss functions are re-used and the errors are accumulated
+	model_interpreter.CETT(model_CETT, expected, output_nodes, loss_function, loss_function_grad, 4);
+	BOOST_CHECK_CLOSE(model_interpreter.getModelError()->getError()(0, 0), 484, 1e-6);
+	BOOST_CHECK_CLOSE(model_interpreter.getModelError()->getError()(4, 3), 16, 1e-6);
+	BOOST_CHECK_CLOSE(model_interpreter.getModelError()->getError()(4, 4), 0, 1e-6);
+	model_interpreter.clearTensorOpsCache();
+	model_interpreter.CETT(model_CETT, expected, output_nodes, loss_function, loss_function_grad, 4);
+	BOOST_CHECK_CLOSE(model_interpreter.getModelError()->getError()(0, 0), 726, 1e-6);
 }
 
 Model<float> model_CMTT = makeModelToy2();
@@ -1023,6 +1102,26 @@ BOOST_AUTO_TEST_CASE(CMTT)
       BOOST_CHECK_CLOSE(model_interpreter.getModelError()->getMetric()(j, k), model_metric(j, k), 1e-3);
     }
   }
+
+  // calculate multiple metrics at once
+  const int n_metrics_fused = 3;
+  model_interpreter.allocateModelErrorTensor(batch_size, memory_size, n_metrics_fused);
+  std::vector<std::shared_ptr<MetricFunctionOp<float>>> metric_functions = {
+    std::make_shared<AccuracyBCOp<float>>(AccuracyBCOp<float>(0.5)),
+    std::make_shared<MAEOp<float>>(MAEOp<float>()),
+    std::make_shared<PrecisionBCOp<float>>(PrecisionBCOp<float>(0.5)) };
+  model_interpreter.CMTT(model_CMTT, expected, output_nodes, metric_functions, 4, 0);
+
+  Eigen::Tensor<float, 2> model_metric_fused(n_metrics_fused, memory_size);
+  model_metric_fused.setValues({
+    {1,1,1,1,0,0,0,0},
+    {28.7999,19.2,10.8,3.2,0,0,0,0},
+    {1,1,1,1,0,0,0,0} });
+  for (int j = 0; j < n_metrics_fused; ++j) {
+    for (int k = 0; k < memory_size; ++k) {
+      BOOST_CHECK_CLOSE(model_interpreter.getModelError()->getMetric()(j, k), model_metric_fused(j, k), 1e-3);
+    }
+  }
 }
 
 Model<float> model_TBPTT = makeModelToy2();
@@ -1160,6 +1259,226 @@ BOOST_AUTO_TEST_CASE(updateWeights)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(checkpointedBPTTAndWindowedTBPTT)
+{
+	const int batch_size = 5;
+	const int sequence_length = 8;
+	const int n_metrics = 1;
+	const std::vector<std::string> input_ids = { "0", "3", "4" };
+	const std::vector<std::string> output_nodes = { "2" };
+	const std::vector<std::string> weight_ids = { "0", "1", "2", "3", "4" };
+	std::shared_ptr<LossFunctionOp<float>> loss_function = std::make_shared<MSELossOp<float>>(MSELossOp<float>());
+	std::shared_ptr<LossFunctionGradOp<float>> loss_function_grad = std::make_shared<MSELossGradOp<float>>(MSELossGradOp<float>());
+
+	// create the input and expected output sequences
+	Eigen::Tensor<float, 3> input(batch_size, sequence_length, (int)input_ids.size());
+	Eigen::Tensor<float, 3> expected(batch_size, sequence_length, (int)output_nodes.size());
+	input.setZero();
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < sequence_length; ++memory_iter) {
+			input(batch_iter, memory_iter, 0) = 8 + batch_iter - memory_iter;
+			expected(batch_iter, memory_iter, 0) = 4 + (batch_iter + 1) / 2 - (memory_iter + batch_iter % 2) / 2;
+		}
+	}
+
+	auto getWeightErrors = [&weight_ids](Model<float>& model, ModelInterpreterDefaultDevice<float>& model_interpreter) {
+		std::vector<float> weight_errors;
+		for (const std::string& weight_id : weight_ids) {
+			auto tensor_index = model.getWeightsMap().at(weight_id)->getTensorIndex()[0];
+			weight_errors.push_back(model_interpreter.getWeightTensor(std::get<0>(tensor_index))->getError()(std::get<1>(tensor_index), std::get<2>(tensor_index)));
+		}
+		return weight_errors;
+	};
+
+	// reference: TBPTT over the complete sequence
+	Model<float> model_full = makeModelToy2();
+	ModelInterpreterDefaultDevice<float> model_interpreter_full;
+	model_interpreter_full.getForwardPropogationOperations(model_full, batch_size, sequence_length, true, false, true, true);
+	model_interpreter_full.allocateModelErrorTensor(batch_size, sequence_length, n_metrics);
+	model_interpreter_full.mapValuesToLayers(model_full, input, input_ids, "output");
+	model_interpreter_full.mapValuesToLayers(model_full, input, input_ids, "input");
+	model_interpreter_full.FPTT(sequence_length);
+	model_interpreter_full.CETT(model_full, expected, output_nodes, loss_function, loss_function_grad, sequence_length);
+	model_interpreter_full.TBPTT(sequence_length);
+	model_interpreter_full.executeWeightErrorOperations();
+	model_interpreter_full.getModelResults(model_full, false, false, true, false);
+	const Eigen::Tensor<float, 0> total_error_full = model_full.getError().sum();
+	const std::vector<float> weight_errors_full = getWeightErrors(model_full, model_interpreter_full);
+
+	// windows of 3 time steps
+	const int window_size = 3;
+	auto makeCalcModelErrors = [&](Model<float>& model, ModelInterpreterDefaultDevice<float>& model_interpreter) {
+		return [&](const int& time_step_start, const int& n_time_steps) {
+			Eigen::Tensor<float, 3> expected_window(batch_size, window_size, (int)output_nodes.size());
+			expected_window.setZero();
+			Eigen::array<Eigen::Index, 3> spans = { batch_size, n_time_steps, (int)output_nodes.size() };
+			expected_window.slice(Eigen::array<Eigen::Index, 3>({ 0, 0, 0 }), spans) = expected.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), spans);
+			model_interpreter.CETT(model, expected_window, output_nodes, loss_function, loss_function_grad, n_time_steps);
+		};
+	};
+
+	// checkpointed BPTT gives the same weight errors as the complete sequence
+	Model<float> model_checkpointed = makeModelToy2();
+	ModelInterpreterDefaultDevice<float> model_interpreter_checkpointed;
+	model_interpreter_checkpointed.getForwardPropogationOperations(model_checkpointed, batch_size, window_size, true, false, true, true);
+	model_interpreter_checkpointed.allocateModelErrorTensor(batch_size, window_size, n_metrics);
+	const float total_error_checkpointed = model_interpreter_checkpointed.checkpointedBPTT(model_checkpointed, input, input_ids,
+		makeCalcModelErrors(model_checkpointed, model_interpreter_checkpointed));
+	BOOST_CHECK_CLOSE(total_error_checkpointed, total_error_full(0), 1e-3);
+	const std::vector<float> weight_errors_checkpointed = getWeightErrors(model_checkpointed, model_interpreter_checkpointed);
+	for (int i = 0; i < weight_ids.size(); ++i)
+		BOOST_CHECK_CLOSE(weight_errors_checkpointed.at(i), weight_errors_full.at(i), 1e-3);
+
+	// windowed TBPTT gives the same forward pass but truncates the weight errors to each window
+	Model<float> model_windowed = makeModelToy2();
+	ModelInterpreterDefaultDevice<float> model_interpreter_windowed;
+	model_interpreter_windowed.getForwardPropogationOperations(model_windowed, batch_size, window_size, true, false, true, true);
+	model_interpreter_windowed.allocateModelErrorTensor(batch_size, window_size, n_metrics);
+	const float total_error_windowed = model_interpreter_windowed.windowedTBPTT(model_windowed, input, input_ids,
+		makeCalcModelErrors(model_windowed, model_interpreter_windowed));
+	BOOST_CHECK_CLOSE(total_error_windowed, total_error_full(0), 1e-3);
+	const std::vector<float> weight_errors_windowed = getWeightErrors(model_windowed, model_interpreter_windowed);
+	BOOST_CHECK_CLOSE(weight_errors_windowed.at(1), weight_errors_full.at(1), 1e-3); // the output weights do not depend on the recurrent history
+	BOOST_CHECK_CLOSE(weight_errors_windowed.at(4), weight_errors_full.at(4), 1e-3);
+	BOOST_CHECK(std::abs(weight_errors_windowed.at(2)) < std::abs(weight_errors_full.at(2))); // the recurrent weight
+}
+
+Model<float> makeModelToy2Shared(const bool& share_weights)
+{
+	/**
+	 * Directed Cyclic Graph Toy Network Model with two recurrent hidden nodes
+	 *  that share the input weight (or use separate input weights "0" and "8")
+	*/
+	Model<float> model;
+	std::vector<Node<float>> nodes;
+	for (const std::string& name : { "1", "2", "5" })
+		nodes.push_back(Node<float>(name, (name == "2") ? NodeType::output : NodeType::hidden, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>())));
+	nodes.push_back(Node<float>("0", NodeType::input, NodeStatus::activated, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>())));
+	for (const std::string& name : { "3", "4" })
+		nodes.push_back(Node<float>(name, NodeType::bias, NodeStatus::activated, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>())));
+	std::vector<Weight<float>> weights;
+	std::vector<std::string> weight_names = { "0", "1", "2", "3", "4", "5", "6", "7" };
+	if (!share_weights) weight_names.push_back("8");
+	for (const std::string& name : weight_names)
+		weights.push_back(Weight<float>(name, std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(1.0)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.01, 0.9))));
+	// links
+	std::vector<Link> links = {
+		Link("0", "0", "1", "0"), Link("1", "1", "2", "1"), Link("2", "1", "1", "2"), Link("3", "3", "1", "3"), Link("4", "4", "2", "4"),
+		Link("5", "0", "5", "0"), Link("6", "5", "2", "5"), Link("7", "5", "5", "6"), Link("8", "3", "5", "7") };
+	if (!share_weights) links.at(5).setWeightName("8");
+	model.setId(2);
+	model.addNodes(nodes);
+	model.addWeights(weights);
+	model.addLinks(links);
+	model.findCycles();
+	return model;
+}
+
+BOOST_AUTO_TEST_CASE(checkpointedBPTTAndWindowedTBPTTSharedWeights)
+{
+	const int batch_size = 5;
+	const int sequence_length = 8;
+	const int window_size = 2; // 4 windows
+	const int n_metrics = 1;
+	const std::vector<std::string> input_ids = { "0", "3", "4" };
+	const std::vector<std::string> output_nodes = { "2" };
+	std::shared_ptr<LossFunctionOp<float>> loss_function = std::make_shared<MSELossOp<float>>(MSELossOp<float>());
+	std::shared_ptr<LossFunctionGradOp<float>> loss_function_grad = std::make_shared<MSELossGradOp<float>>(MSELossGradOp<float>());
+
+	// create the input and expected output sequences
+	Eigen::Tensor<float, 3> input(batch_size, sequence_length, (int)input_ids.size());
+	Eigen::Tensor<float, 3> expected(batch_size, sequence_length, (int)output_nodes.size());
+	input.setZero();
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < sequence_length; ++memory_iter) {
+			input(batch_iter, memory_iter, 0) = 8 + batch_iter - memory_iter;
+			expected(batch_iter, memory_iter, 0) = 4 + (batch_iter + 1) / 2 - (memory_iter + batch_iter % 2) / 2;
+		}
+	}
+
+	auto getWeightError = [](Model<float>& model, ModelInterpreterDefaultDevice<float>& model_interpreter, const std::string& weight_id, const int& index) {
+		auto tensor_index = model.getWeightsMap().at(weight_id)->getTensorIndex().at(index);
+		return model_interpreter.getWeightTensor(std::get<0>(tensor_index))->getError()(std::get<1>(tensor_index), std::get<2>(tensor_index));
+	};
+
+	// back propogate the sequence in windows with and without sharing the input weight
+	for (const bool& checkpointed : { true, false }) {
+		std::vector<Model<float>> models = { makeModelToy2Shared(false), makeModelToy2Shared(true) };
+		std::vector<ModelInterpreterDefaultDevice<float>> model_interpreters(2);
+		for (int i = 0; i < 2; ++i) {
+			Model<float>& model = models.at(i);
+			ModelInterpreterDefaultDevice<float>& model_interpreter = model_interpreters.at(i);
+			model_interpreter.getForwardPropogationOperations(model, batch_size, window_size, true, false, true, true);
+			model_interpreter.allocateModelErrorTensor(batch_size, window_size, n_metrics);
+			auto calc_model_errors = [&](const int& time_step_start, const int& n_time_steps) {
+				Eigen::Tensor<float, 3> expected_window(batch_size, window_size, (int)output_nodes.size());
+				expected_window.setZero();
+				Eigen::array<Eigen::Index, 3> spans = { batch_size, n_time_steps, (int)output_nodes.size() };
+				expected_window.slice(Eigen::array<Eigen::Index, 3>({ 0, 0, 0 }), spans) = expected.slice(Eigen::array<Eigen::Index, 3>({ 0, time_step_start, 0 }), spans);
+				model_interpreter.CETT(model, expected_window, output_nodes, loss_function, loss_function_grad, n_time_steps);
+			};
+			if (checkpointed) model_interpreter.checkpointedBPTT(model, input, input_ids, calc_model_errors);
+			else model_interpreter.windowedTBPTT(model, input, input_ids, calc_model_errors);
+		}
+
+		// the error of the shared weight is the sum of the errors of the separate weights
+		const float weight_error_separate = getWeightError(models.at(0), model_interpreters.at(0), "0", 0) + getWeightError(models.at(0), model_interpreters.at(0), "8", 0);
+		BOOST_CHECK(weight_error_separate != 0);
+		BOOST_CHECK_EQUAL(models.at(1).getWeightsMap().at("0")->getTensorIndex().size(), 2);
+		BOOST_CHECK_CLOSE(getWeightError(models.at(1), model_interpreters.at(1), "0", 0), weight_error_separate, 1e-3);
+		BOOST_CHECK_CLOSE(getWeightError(models.at(1), model_interpreters.at(1), "0", 1), weight_error_separate, 1e-3);
+		BOOST_CHECK_CLOSE(getWeightError(models.at(1), model_interpreters.at(1), "1", 0), getWeightError(models.at(0), model_interpreters.at(0), "1", 0), 1e-3);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(stepStreaming)
+{
+	const int batch_size = 5;
+	const int sequence_length = 8;
+	const std::vector<std::string> input_ids = { "0", "3", "4" };
+	const std::vector<std::string> output_nodes = { "2" };
+
+	// create the input sequence (t=n to t=0)
+	Eigen::Tensor<float, 3> input(batch_size, sequence_length, (int)input_ids.size());
+	input.setZero();
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+		for (int memory_iter = 0; memory_iter < sequence_length; ++memory_iter)
+			input(batch_iter, memory_iter, 0) = 8 + batch_iter - memory_iter;
+
+	// reference: FPTT over the complete sequence
+	Model<float> model_full = makeModelToy2();
+	ModelInterpreterDefaultDevice<float> model_interpreter_full;
+	model_interpreter_full.getForwardPropogationOperations(model_full, batch_size, sequence_length, false, false, true, true);
+	model_interpreter_full.mapValuesToLayers(model_full, input, input_ids, "output");
+	model_interpreter_full.mapValuesToLayers(model_full, input, input_ids, "input");
+	model_interpreter_full.FPTT(sequence_length);
+	model_interpreter_full.getModelResults(model_full, true, false, false, false);
+	Eigen::Tensor<float, 2> output_full = model_full.getNodesMap().at("2")->getOutput();
+
+	// stream the sequence one time step at a time through a memory of 3 time steps (4 memory indices including the buffer)
+	Model<float> model_streaming = makeModelToy2();
+	ModelInterpreterDefaultDevice<float> model_interpreter_streaming;
+	model_interpreter_streaming.getForwardPropogationOperations(model_streaming, batch_size, 3, false, false, true, true);
+	BOOST_CHECK_THROW(model_interpreter_streaming.stepStreaming(Eigen::Tensor<float, 2>(batch_size, (int)input_ids.size())), std::runtime_error);
+	model_interpreter_streaming.initStreaming(model_streaming, input_ids, output_nodes);
+	BOOST_CHECK_EQUAL(model_interpreter_streaming.getStreamingTimeStep(), -1);
+	BOOST_CHECK_THROW(model_interpreter_streaming.stepStreaming(Eigen::Tensor<float, 2>(batch_size, 1)), std::runtime_error);
+	for (int step = 0; step < sequence_length; ++step) {
+		const Eigen::Tensor<float, 2> values = input.chip(sequence_length - 1 - step, 1);
+		const Eigen::Tensor<float, 2> outputs = model_interpreter_streaming.stepStreaming(values);
+		BOOST_CHECK_EQUAL(model_interpreter_streaming.getStreamingTimeStep(), 3 - step % 4);
+		BOOST_CHECK_EQUAL(outputs.dimension(0), batch_size);
+		BOOST_CHECK_EQUAL(outputs.dimension(1), 1);
+		for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+			BOOST_CHECK_CLOSE(outputs(batch_iter, 0), output_full(batch_iter, sequence_length - 1 - step), 1e-4);
+	}
+
+	// re-initializing resets the recurrent state
+	model_interpreter_streaming.initStreaming(model_streaming, input_ids, output_nodes);
+	const Eigen::Tensor<float, 2> outputs = model_interpreter_streaming.stepStreaming(input.chip(sequence_length - 1, 1));
+	BOOST_CHECK_CLOSE(outputs(0, 0), output_full(0, sequence_length - 1), 1e-4);
+}
+
 Model<float> model_modelTrainer2 = makeModelToy2();
 BOOST_AUTO_TEST_CASE(modelTrainer2)
 {
@@ -1481,4 +1800,407 @@ BOOST_AUTO_TEST_CASE(modelTrainer3)
 	BOOST_CHECK(total_error(0) <= 10.6);
 }
 
+/*
+The following tests check fused LSTM and GRU layers against a reference implementation and finite differences
+*/
+Model<double> makeModelFusedCell(const bool& gru, const std::string& perturbed_weight = "", const double& eps = 0)
+{
+	Model<double> model;
+	ModelBuilder<double> model_builder;
+	std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", 2);
+	if (gru)
+		node_names = model_builder.addGRUFused(model, "GRU", "GRU", node_names, 2,
+			std::make_shared<ConstWeightInitOp<double>>(ConstWeightInitOp<double>(1)), std::make_shared<SGDOp<double>>(SGDOp<double>(0.1, 0.9)), 0, true, true, true);
+	else
+		node_names = model_builder.addLSTMFused(model, "LSTM", "LSTM", node_names, 2,
+			std::make_shared<ConstWeightInitOp<double>>(ConstWeightInitOp<double>(1)), std::make_shared<SGDOp<double>>(SGDOp<double>(0.1, 0.9)), 0, true, true, true);
+	node_names = model_builder.addFullyConnected(model, "Output", "Output", node_names, 1,
+		std::make_shared<LinearOp<double>>(LinearOp<double>()), std::make_shared<LinearGradOp<double>>(LinearGradOp<double>()),
+		std::make_shared<SumOp<double>>(SumOp<double>()), std::make_shared<SumErrorOp<double>>(SumErrorOp<double>()), std::make_shared<SumWeightGradOp<double>>(SumWeightGradOp<double>()),
+		std::make_shared<ConstWeightInitOp<double>>(ConstWeightInitOp<double>(1)), std::make_shared<SGDOp<double>>(SGDOp<double>(0.1, 0.9)), 0, 0, false, true);
+	for (const std::string& node_name : node_names) model.getNodesMap().at(node_name)->setType(NodeType::output);
+
+	// assign deterministic trainable weights
+	int weight_iter = 0;
+	for (auto& weight : model.getWeightsMap()) {
+		if (weight.second->getSolverOp()->getName() == "DummySolverOp") continue;
+		weight.second->setWeight(0.5 * std::sin(1.7 * weight_iter + 0.3) + ((weight.first == perturbed_weight) ? eps : 0));
+		weight.second->setInitWeight(false);
+		++weight_iter;
+	}
+	return model;
+}
+
+/// Run the forward (and backward) pass and return the total model error
+double runModelFusedCell(Model<double>& model, ModelInterpreterDefaultDevice<double>& model_interpreter, const Eigen::Tensor<double, 3>& input, const Eigen::Tensor<double, 3>& expected, const bool& train)
+{
+	const int batch_size = input.dimension(0);
+	const int memory_size = input.dimension(1);
+	model_interpreter.getForwardPropogationOperations(model, batch_size, memory_size, true, false, true, true);
+	model_interpreter.allocateModelErrorTensor(batch_size, memory_size, 1);
+	model_interpreter.initBiases(model);
+	model_interpreter.mapValuesToLayers(model, input, { "Input_000000000000", "Input_000000000001" }, "output");
+	model_interpreter.FPTT(memory_size);
+	std::shared_ptr<LossFunctionOp<double>> loss_function = std::make_shared<MSELossOp<double>>(MSELossOp<double>());
+	std::shared_ptr<LossFunctionGradOp<double>> loss_function_grad = std::make_shared<MSELossGradOp<double>>(MSELossGradOp<double>());
+	model_interpreter.CETT(model, expected, { "Output_000000000000" }, loss_function, loss_function_grad, memory_size);
+	if (train) {
+		model_interpreter.TBPTT(memory_size);
+		model_interpreter.executeWeightErrorOperations();
+	}
+	Eigen::Tensor<double, 0> total_error = model_interpreter.getModelError()->getError().sum();
+	return total_error(0);
+}
+
+/// Make the input and expected output of the fused cell tests
+void makeDataFusedCell(Eigen::Tensor<double, 3>& input, Eigen::Tensor<double, 3>& expected)
+{
+	for (int batch_iter = 0; batch_iter < input.dimension(0); ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < input.dimension(1); ++memory_iter) {
+			input(batch_iter, memory_iter, 0) = std::sin(batch_iter + 0.7 * memory_iter);
+			input(batch_iter, memory_iter, 1) = std::cos(0.3 * batch_iter - memory_iter);
+			expected(batch_iter, memory_iter, 0) = 0.2 * batch_iter - 0.1 * memory_iter;
+		}
+	}
+}
+
+/**
+  @brief Check the gradients of the weights of a trained fused cell model against central finite differences
+
+  The weight error tensors pair the errors of the sink layer with the outputs of the source layer at the same time step,
+    which is only exact for the acyclic links.  The gradients of the recurrent weights are therefore computed from the
+    back propogated errors of the gates and the outputs of the previous time step (i.e., the next memory index).
+*/
+void checkGradientsFusedCell(const bool& gru, Model<double>& model, ModelInterpreterDefaultDevice<double>& model_interpreter,
+	const Eigen::Tensor<double, 3>& input, const Eigen::Tensor<double, 3>& expected, const std::vector<std::string>& weight_names, const std::vector<std::string>& recurrent_weight_names)
+{
+	const int batch_size = input.dimension(0);
+	const int memory_size = input.dimension(1);
+	const double eps = 1e-5;
+	auto checkGradient = [&](const std::string& weight_name, const double& gradient) {
+		Model<double> model_plus = makeModelFusedCell(gru, weight_name, eps), model_minus = makeModelFusedCell(gru, weight_name, -eps);
+		ModelInterpreterDefaultDevice<double> model_interpreter_plus, model_interpreter_minus;
+		const double gradient_numeric = (runModelFusedCell(model_plus, model_interpreter_plus, input, expected, false) - runModelFusedCell(model_minus, model_interpreter_minus, input, expected, false)) / (2 * eps);
+		BOOST_CHECK_CLOSE(gradient, gradient_numeric, 1e-2);
+	};
+	for (const std::string& weight_name : weight_names) {
+		const auto weight_index = model.getWeightsMap().at(weight_name)->getTensorIndex().front();
+		checkGradient(weight_name, model_interpreter.getWeightTensor(std::get<0>(weight_index))->getError()(std::get<1>(weight_index), std::get<2>(weight_index)) * batch_size);
+	}
+	for (const std::string& weight_name : recurrent_weight_names) {
+		const auto& link = model.getLinksMap().at(weight_name);
+		const auto& source_index = model.getNodesMap().at(link->getSourceNodeName())->getTensorIndex();
+		const auto& sink_index = model.getNodesMap().at(link->getSinkNodeName())->getTensorIndex();
+		double gradient = 0;
+		for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+			for (int memory_iter = 0; memory_iter < memory_size - 1; ++memory_iter)
+				gradient -= model_interpreter.getLayerTensor(sink_index.first)->getError()(batch_iter, memory_iter, sink_index.second) *
+					model_interpreter.getLayerTensor(source_index.first)->getOutput()(batch_iter, memory_iter + 1, source_index.second);
+		checkGradient(weight_name, gradient);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(FPTTAndTBPTTFusedLSTM)
+{
+	const int batch_size = 2;
+	const int memory_size = 3;
+	Eigen::Tensor<double, 3> input(batch_size, memory_size, 2), expected(batch_size, memory_size, 1);
+	makeDataFusedCell(input, expected);
+
+	Model<double> model = makeModelFusedCell(false);
+	ModelInterpreterDefaultDevice<double> model_interpreter;
+	runModelFusedCell(model, model_interpreter, input, expected, true);
+
+	// the cells of all units are computed by a single tensor operation
+	auto nodes_map = model.getNodesMap();
+	BOOST_CHECK_EQUAL(nodes_map.at("LSTM-MemoryCell_000000000000")->getTensorIndex().first, nodes_map.at("LSTM-OutputGate_000000000001")->getTensorIndex().first);
+	BOOST_CHECK_EQUAL(nodes_map.at("LSTM-Gates-Input_000000000000")->getTensorIndex().first, nodes_map.at("LSTM-Gates-Output_000000000001")->getTensorIndex().first);
+	BOOST_CHECK_EQUAL(nodes_map.at("LSTM-Output_000000000000")->getTensorIndex().first, nodes_map.at("LSTM-Output_000000000001")->getTensorIndex().first);
+
+	// test the outputs against the reference implementation
+	auto weights_map = model.getWeightsMap();
+	auto sigmoid = [](const double& x) { return 1 / (1 + std::exp(-x)); };
+	const std::vector<std::string> gate_types = { "Input", "Forget", "BlockInput", "Output" };
+	char gate_name[512], source_name[512];
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		std::vector<double> h(2, 0), c(2, 0);
+		for (int memory_iter = memory_size - 1; memory_iter >= 0; --memory_iter) {
+			std::vector<double> h_next(2), c_next(2);
+			for (int unit_iter = 0; unit_iter < 2; ++unit_iter) {
+				std::vector<double> gates;
+				for (const std::string& gate_type : gate_types) {
+					sprintf(gate_name, "LSTM-Gates-%s_%012d", gate_type.data(), unit_iter);
+					double gate = weights_map.at(std::string(gate_name) + "-bias_to_" + gate_name)->getWeight();
+					for (int source_iter = 0; source_iter < 2; ++source_iter) {
+						sprintf(source_name, "Input_%012d_to_%s", source_iter, gate_name);
+						gate += weights_map.at(source_name)->getWeight() * input(batch_iter, memory_iter, source_iter);
+						sprintf(source_name, "LSTM-Output_%012d_to_%s", source_iter, gate_name);
+						gate += weights_map.at(source_name)->getWeight() * h[source_iter];
+					}
+					gates.push_back(gate);
+				}
+				c_next[unit_iter] = sigmoid(gates[1]) * c[unit_iter] + sigmoid(gates[0]) * std::tanh(gates[2]);
+				h_next[unit_iter] = sigmoid(gates[3]) * std::tanh(c_next[unit_iter]);
+			}
+			h = h_next;
+			c = c_next;
+			double output = 0;
+			for (int unit_iter = 0; unit_iter < 2; ++unit_iter) {
+				sprintf(source_name, "LSTM-Output_%012d_to_Output_000000000000", unit_iter);
+				output += weights_map.at(source_name)->getWeight() * h[unit_iter];
+			}
+			const auto& output_index = nodes_map.at("Output_000000000000")->getTensorIndex();
+			BOOST_CHECK_CLOSE(model_interpreter.getLayerTensor(output_index.first)->getOutput()(batch_iter, memory_iter, output_index.second), output, 1e-6);
+		}
+	}
+
+	// test the gradients of the input, bias, recurrent, and output weights against finite differences
+	checkGradientsFusedCell(false, model, model_interpreter, input, expected,
+		{ "Input_000000000000_to_LSTM-Gates-Input_000000000000", "Input_000000000001_to_LSTM-Gates-Forget_000000000001",
+		"Input_000000000000_to_LSTM-Gates-BlockInput_000000000001", "Input_000000000001_to_LSTM-Gates-Output_000000000000",
+		"LSTM-Gates-Forget_000000000000-bias_to_LSTM-Gates-Forget_000000000000", "LSTM-Output_000000000001_to_Output_000000000000" },
+		{ "LSTM-Output_000000000000_to_LSTM-Gates-Input_000000000001", "LSTM-Output_000000000001_to_LSTM-Gates-Forget_000000000000",
+		"LSTM-Output_000000000000_to_LSTM-Gates-BlockInput_000000000000", "LSTM-Output_000000000001_to_LSTM-Gates-Output_000000000001" });
+}
+
+BOOST_AUTO_TEST_CASE(FPTTAndTBPTTFusedGRU)
+{
+	const int batch_size = 2;
+	const int memory_size = 3;
+	Eigen::Tensor<double, 3> input(batch_size, memory_size, 2), expected(batch_size, memory_size, 1);
+	makeDataFusedCell(input, expected);
+
+	Model<double> model = makeModelFusedCell(true);
+	ModelInterpreterDefaultDevice<double> model_interpreter;
+	runModelFusedCell(model, model_interpreter, input, expected, true);
+
+	// the gates of all units are computed by a single tensor operation
+	auto nodes_map = model.getNodesMap();
+	BOOST_CHECK_EQUAL(nodes_map.at("GRU-Gates-Update_000000000000")->getTensorIndex().first, nodes_map.at("GRU-Gates-RecurrentCandidate_000000000001")->getTensorIndex().first);
+	BOOST_CHECK_EQUAL(nodes_map.at("GRU-Output_000000000000")->getTensorIndex().first, nodes_map.at("GRU-Output_000000000001")->getTensorIndex().first);
+
+	// test the gradients of the input, bias, recurrent, and output weights against finite differences
+	checkGradientsFusedCell(true, model, model_interpreter, input, expected,
+		{ "Input_000000000000_to_GRU-Gates-Update_000000000000", "Input_000000000001_to_GRU-Gates-Reset_000000000001",
+		"Input_000000000000_to_GRU-Gates-InputCandidate_000000000001", "Input_000000000001_to_GRU-Gates-RecurrentCandidate_000000000000",
+		"GRU-Gates-Reset_000000000000-bias_to_GRU-Gates-Reset_000000000000", "GRU-Output_000000000001_to_Output_000000000000" },
+		{ "GRU-Output_000000000000_to_GRU-Gates-Update_000000000001", "GRU-Output_000000000001_to_GRU-Gates-Reset_000000000000",
+		"GRU-Output_000000000000_to_GRU-Gates-InputCandidate_000000000000", "GRU-Output_000000000001_to_GRU-Gates-RecurrentCandidate_000000000001" });
+}
+
+/*
+The following tests check a fused multi-head attention layer against finite differences
+*/
+Model<double> makeModelFusedAttention(const std::string& perturbed_weight = "", const double& eps = 0)
+{
+	Model<double> model;
+	ModelBuilder<double> model_builder;
+	std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", 3);
+	node_names = model_builder.addMultiHeadAttentionFused(model, "Attention", "Attention", node_names, 2, 2, 3,
+		std::make_shared<LinearOp<double>>(LinearOp<double>()), std::make_shared<LinearGradOp<double>>(LinearGradOp<double>()),
+		std::make_shared<ConstWeightInitOp<double>>(ConstWeightInitOp<double>(1)), std::make_shared<SGDOp<double>>(SGDOp<double>(0.1, 0.9)), 0, 0, true, true);
+	for (const std::string& node_name : node_names) model.getNodesMap().at(node_name)->setType(NodeType::output);
+
+	// assign deterministic trainable weights
+	int weight_iter = 0;
+	for (auto& weight : model.getWeightsMap()) {
+		if (weight.second->getSolverOp()->getName() == "DummySolverOp") continue;
+		weight.second->setWeight(0.9 * std::sin(1.7 * weight_iter + 0.3) + ((weight.first == perturbed_weight) ? eps : 0));
+		weight.second->setInitWeight(false);
+		++weight_iter;
+	}
+	return model;
+}
+
+/// Run the forward (and backward) pass and return the total model error
+double runModelFusedAttention(Model<double>& model, ModelInterpreterDefaultDevice<double>& model_interpreter, const Eigen::Tensor<double, 3>& input, const Eigen::Tensor<double, 3>& expected, const bool& train)
+{
+	const int batch_size = input.dimension(0);
+	const int memory_size = input.dimension(1);
+	model_interpreter.getForwardPropogationOperations(model, batch_size, memory_size, true, false, true, true);
+	model_interpreter.allocateModelErrorTensor(batch_size, memory_size, 1);
+	model_interpreter.initBiases(model);
+	model_interpreter.mapValuesToLayers(model, input, { "Input_000000000000", "Input_000000000001", "Input_000000000002" }, "output");
+	model_interpreter.FPTT(memory_size);
+	std::shared_ptr<LossFunctionOp<double>> loss_function = std::make_shared<MSELossOp<double>>(MSELossOp<double>());
+	std::shared_ptr<LossFunctionGradOp<double>> loss_function_grad = std::make_shared<MSELossGradOp<double>>(MSELossGradOp<double>());
+	model_interpreter.CETT(model, expected, { "Attention_MultiHead_000000000000", "Attention_MultiHead_000000000001" }, loss_function, loss_function_grad, memory_size);
+	if (train) {
+		model_interpreter.TBPTT(memory_size);
+		model_interpreter.executeWeightErrorOperations();
+	}
+	Eigen::Tensor<double, 0> total_error = model_interpreter.getModelError()->getError().sum();
+	return total_error(0);
+}
+
+BOOST_AUTO_TEST_CASE(stepStreamingFusedCell)
+{
+	const int batch_size = 2;
+	const int sequence_length = 7;
+	Eigen::Tensor<double, 3> input(batch_size, sequence_length, 2), expected(batch_size, sequence_length, 1);
+	makeDataFusedCell(input, expected);
+	for (const bool gru : { false, true }) {
+		// reference: FPTT over the complete sequence
+		Model<double> model_full = makeModelFusedCell(gru);
+		ModelInterpreterDefaultDevice<double> model_interpreter_full;
+		runModelFusedCell(model_full, model_interpreter_full, input, expected, false);
+		const std::pair<int, int> output_index = model_full.getNodesMap().at("Output_000000000000")->getTensorIndex();
+		const Eigen::Tensor<double, 2> output_full = model_interpreter_full.getLayerTensor(output_index.first)->getOutput().chip(output_index.second, 2);
+
+		// stream through the smallest memory so that the cell state wraps around the ring buffer at every other step
+		Model<double> model_streaming = makeModelFusedCell(gru);
+		ModelInterpreterDefaultDevice<double> model_interpreter_streaming;
+		model_interpreter_streaming.getForwardPropogationOperations(model_streaming, batch_size, 1, false, false, true, true);
+		model_interpreter_streaming.initStreaming(model_streaming, { "Input_000000000000", "Input_000000000001" }, { "Output_000000000000" });
+		for (int step = 0; step < sequence_length; ++step) {
+			const Eigen::Tensor<double, 2> values = input.chip(sequence_length - 1 - step, 1);
+			const Eigen::Tensor<double, 2> outputs = model_interpreter_streaming.stepStreaming(values);
+			BOOST_CHECK_EQUAL(model_interpreter_streaming.getStreamingTimeStep(), 1 - step % 2);
+			for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+				BOOST_CHECK_CLOSE(outputs(batch_iter, 0), output_full(batch_iter, sequence_length - 1 - step), 1e-6);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(FPTTAndTBPTTFusedAttention)
+{
+	const int batch_size = 2;
+	const int memory_size = 2;
+	Eigen::Tensor<double, 3> input(batch_size, memory_size, 3), expected(batch_size, memory_size, 2);
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+			for (int input_iter = 0; input_iter < 3; ++input_iter)
+				input(batch_iter, memory_iter, input_iter) = std::sin(batch_iter + 0.7 * memory_iter + 1.3 * input_iter);
+			expected(batch_iter, memory_iter, 0) = 0.2 * batch_iter - 0.1 * memory_iter;
+			expected(batch_iter, memory_iter, 1) = 0.3;
+		}
+	}
+
+	Model<double> model = makeModelFusedAttention();
+	ModelInterpreterDefaultDevice<double> model_interpreter;
+	runModelFusedAttention(model, model_interpreter, input, expected, true);
+
+	// the projections and the attention of all heads are computed by a single tensor operation each
+	auto nodes_map = model.getNodesMap();
+	BOOST_CHECK_EQUAL(nodes_map.at("Attention-Projections-Query-000000000000_000000000000")->getTensorIndex().first, nodes_map.at("Attention-Projections-Values-000000000001_000000000002")->getTensorIndex().first);
+	BOOST_CHECK_EQUAL(nodes_map.at("Attention-Attention-000000000000_000000000000")->getTensorIndex().first, nodes_map.at("Attention-Attention-000000000001_000000000002")->getTensorIndex().first);
+
+	// test the gradients of the projection and output weights against finite differences
+	auto weights_map = model.getWeightsMap();
+	const double eps = 1e-5;
+	for (const std::string& weight_name : { "Input_000000000000_to_Attention-Projections-Query-000000000000_000000000001", "Input_000000000002_to_Attention-Projections-Key-000000000001_000000000002",
+		"Input_000000000001_to_Attention-Projections-Values-000000000000_000000000000", "Attention-Attention-000000000001_000000000001_to_Attention_MultiHead_000000000000" }) {
+		const auto weight_index = weights_map.at(weight_name)->getTensorIndex().front();
+		const double gradient = model_interpreter.getWeightTensor(std::get<0>(weight_index))->getError()(std::get<1>(weight_index), std::get<2>(weight_index)) * batch_size;
+		Model<double> model_plus = makeModelFusedAttention(weight_name, eps), model_minus = makeModelFusedAttention(weight_name, -eps);
+		ModelInterpreterDefaultDevice<double> model_interpreter_plus, model_interpreter_minus;
+		const double gradient_numeric = (runModelFusedAttention(model_plus, model_interpreter_plus, input, expected, false) - runModelFusedAttention(model_minus, model_interpreter_minus, input, expected, false)) / (2 * eps);
+		BOOST_CHECK_CLOSE(gradient, gradient_numeric, 1e-2);
+	}
+}
+
+/*
+The following tests check a fused softmax layer against finite differences
+*/
+Model<double> makeModelFusedSoftMax(const bool& log_softmax, const bool& fuse_with_loss, const std::string& perturbed_weight = "", const double& eps = 0)
+{
+	Model<double> model;
+	ModelBuilder<double> model_builder;
+	std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", 2);
+	node_names = model_builder.addFullyConnected(model, "Logits", "Logits", node_names, 3,
+		std::make_shared<LinearOp<double>>(LinearOp<double>()), std::make_shared<LinearGradOp<double>>(LinearGradOp<double>()),
+		std::make_shared<SumOp<double>>(SumOp<double>()), std::make_shared<SumErrorOp<double>>(SumErrorOp<double>()), std::make_shared<SumWeightGradOp<double>>(SumWeightGradOp<double>()),
+		std::make_shared<ConstWeightInitOp<double>>(ConstWeightInitOp<double>(1)), std::make_shared<SGDOp<double>>(SGDOp<double>(0.1, 0.9)), 0, 0, true, true);
+	node_names = model_builder.addSoftMaxFused(model, "SoftMax", "SoftMax", node_names, log_softmax, fuse_with_loss, true);
+	for (const std::string& node_name : node_names) model.getNodesMap().at(node_name)->setType(NodeType::output);
+
+	// assign deterministic trainable weights
+	int weight_iter = 0;
+	for (auto& weight : model.getWeightsMap()) {
+		if (weight.second->getSolverOp()->getName() == "DummySolverOp") continue;
+		weight.second->setWeight(0.9 * std::sin(1.7 * weight_iter + 0.3) + ((weight.first == perturbed_weight) ? eps : 0));
+		weight.second->setInitWeight(false);
+		++weight_iter;
+	}
+	return model;
+}
+
+/// Run the forward (and backward) pass and return the total model error
+double runModelFusedSoftMax(Model<double>& model, ModelInterpreterDefaultDevice<double>& model_interpreter, const Eigen::Tensor<double, 3>& input, const Eigen::Tensor<double, 3>& expected,
+	std::shared_ptr<LossFunctionOp<double>>& loss_function, std::shared_ptr<LossFunctionGradOp<double>>& loss_function_grad, const bool& train)
+{
+	const int batch_size = input.dimension(0);
+	const int memory_size = input.dimension(1);
+	model_interpreter.getForwardPropogationOperations(model, batch_size, memory_size, true, false, true, true);
+	model_interpreter.allocateModelErrorTensor(batch_size, memory_size, 1);
+	model_interpreter.initBiases(model);
+	model_interpreter.mapValuesToLayers(model, input, { "Input_000000000000", "Input_000000000001" }, "output");
+	model_interpreter.FPTT(memory_size);
+	model_interpreter.CETT(model, expected, { "SoftMax-Out_000000000000", "SoftMax-Out_000000000001", "SoftMax-Out_000000000002" }, loss_function, loss_function_grad, memory_size);
+	if (train) {
+		model_interpreter.TBPTT(memory_size);
+		model_interpreter.executeWeightErrorOperations();
+	}
+	Eigen::Tensor<double, 0> total_error = model_interpreter.getModelError()->getError().sum();
+	return total_error(0);
+}
+
+BOOST_AUTO_TEST_CASE(FPTTAndTBPTTFusedSoftMax)
+{
+	const int batch_size = 2;
+	const int memory_size = 1;
+	Eigen::Tensor<double, 3> input(batch_size, memory_size, 2), expected(batch_size, memory_size, 3);
+	input.setValues({ {{0.5, -1.2}}, {{2.0, 0.3}} });
+	expected.setValues({ {{0, 1, 0}}, {{0, 0, 1}} });
+
+	// the softmax, the log softmax, and the softmax fused with the cross entropy with logits loss function gradient
+	//   (the loss of the fused softmax is the negative log likelihood of the softmax outputs)
+	std::vector<std::pair<bool, bool>> options = { {false, false}, {true, false}, {false, true} };
+	ModelInterpreterDefaultDevice<double> model_interpreter_reused;
+	for (const auto& option : options) {
+		std::shared_ptr<LossFunctionOp<double>> loss_function = std::make_shared<MSELossOp<double>>(MSELossOp<double>());
+		std::shared_ptr<LossFunctionGradOp<double>> loss_function_grad = std::make_shared<MSELossGradOp<double>>(MSELossGradOp<double>());
+		if (option.second) {
+			loss_function = std::make_shared<NegativeLogLikelihoodLossOp<double>>(NegativeLogLikelihoodLossOp<double>());
+			loss_function_grad = std::make_shared<CrossEntropyWithLogitsLossGradOp<double>>(CrossEntropyWithLogitsLossGradOp<double>());
+		}
+		Model<double> model = makeModelFusedSoftMax(option.first, option.second);
+		ModelInterpreterDefaultDevice<double> model_interpreter;
+		const double error = runModelFusedSoftMax(model, model_interpreter, input, expected, loss_function, loss_function_grad, true);
+
+		// the softmax of all outputs is computed by a single tensor operation
+		auto nodes_map = model.getNodesMap();
+		BOOST_CHECK_EQUAL(nodes_map.at("SoftMax-Out_000000000000")->getTensorIndex().first, nodes_map.at("SoftMax-Out_000000000002")->getTensorIndex().first);
+		for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+			double sum = 0;
+			for (const std::string& node_name : { "SoftMax-Out_000000000000", "SoftMax-Out_000000000001", "SoftMax-Out_000000000002" }) {
+				const double output = model_interpreter.getLayerTensor(nodes_map.at(node_name)->getTensorIndex().first)->getOutput()(batch_iter, 0, nodes_map.at(node_name)->getTensorIndex().second);
+				sum += (option.first) ? std::exp(output) : output;
+			}
+			BOOST_CHECK_CLOSE(sum, 1.0, 1e-6);
+		}
+
+		// test the gradients of the logit weights against finite differences
+		auto weights_map = model.getWeightsMap();
+		const double eps = 1e-5;
+		for (const std::string& weight_name : { "Input_000000000000_to_Logits_000000000001", "Input_000000000001_to_Logits_000000000002", "Logits-bias_000000000000_to_Logits_000000000000" }) {
+			const auto weight_index = weights_map.at(weight_name)->getTensorIndex().front();
+			const double gradient = model_interpreter.getWeightTensor(std::get<0>(weight_index))->getError()(std::get<1>(weight_index), std::get<2>(weight_index)) * batch_size;
+			Model<double> model_plus = makeModelFusedSoftMax(option.first, option.second, weight_name, eps), model_minus = makeModelFusedSoftMax(option.first, option.second, weight_name, -eps);
+			ModelInterpreterDefaultDevice<double> model_interpreter_plus, model_interpreter_minus;
+			const double gradient_numeric = (runModelFusedSoftMax(model_plus, model_interpreter_plus, input, expected, loss_function, loss_function_grad, false) - runModelFusedSoftMax(model_minus, model_interpreter_minus, input, expected, loss_function, loss_function_grad, false)) / (2 * eps);
+			BOOST_CHECK_CLOSE(gradient, gradient_numeric, 1e-2);
+		}
+
+		// an interpreter that is reused for the models of all options gives the same results as a new interpreter
+		model_interpreter_reused.clear_cache();
+		Model<double> model_reused = makeModelFusedSoftMax(option.first, option.second);
+		const double error_reused = runModelFusedSoftMax(model_reused, model_interpreter_reused, input, expected, loss_function, loss_function_grad, true);
+		BOOST_CHECK_CLOSE(error_reused, error, 1e-6);
+		const auto weight_index = model_reused.getWeightsMap().at("Input_000000000000_to_Logits_000000000001")->getTensorIndex().front();
+		BOOST_CHECK_CLOSE(model_interpreter_reused.getWeightTensor(std::get<0>(weight_index))->getError()(std::get<1>(weight_index), std::get<2>(weight_index)),
+			model_interpreter.getWeightTensor(std::get<0>(weight_index))->getError()(std::get<1>(weight_index), std::get<2>(weight_index)), 1e-6);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
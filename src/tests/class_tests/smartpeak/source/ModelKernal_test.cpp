@@ -516,6 +516,87 @@ BOOST_AUTO_TEST_CASE(modelErrorDefaultDevice)
   delete[] d_node_errors;
 }
 
+BOOST_AUTO_TEST_CASE(modelErrorSequenceDefaultDevice)
+{
+	ModelKernalDefaultDevice<float> kernal;
+
+	std::shared_ptr<LossFunctionTensorOp<float, Eigen::DefaultDevice>> loss_function = std::make_shared<MSELossTensorOp<float, Eigen::DefaultDevice>>(MSELossTensorOp<float, Eigen::DefaultDevice>());
+	std::shared_ptr<LossFunctionGradTensorOp<float, Eigen::DefaultDevice>> loss_grad_function = std::make_shared<MSELossGradTensorOp<float, Eigen::DefaultDevice>>(MSELossGradTensorOp<float, Eigen::DefaultDevice>());
+	const int batch_size = 4;
+	const int memory_size = 2;
+	const int layer_size = 2;
+	const int time_step_start = 0;
+	const int n_time_steps = 2;
+
+	float* h_predicted = new float[batch_size * memory_size * layer_size];
+	float* d_predicted = new float[batch_size * memory_size * layer_size];
+	float* h_node_errors = new float[batch_size * memory_size * layer_size];
+	float* d_node_errors = new float[batch_size * memory_size * layer_size];
+	float* h_model_error = new float[batch_size * memory_size];
+	float* d_model_error = new float[batch_size * memory_size];
+
+	Eigen::TensorMap<Eigen::Tensor<float, 3>> predicted(h_predicted, batch_size, memory_size, layer_size);
+	predicted.setValues({ {{1, 1}, {0, 0}},
+		{{2, 2}, {0, 0}},
+		{{3, 3}, {0, 0}},
+		{{4, 4}, {0, 0}} });
+	Eigen::TensorMap<Eigen::Tensor<float, 2>> model_error(h_model_error, batch_size, memory_size);
+	model_error.setConstant(0);
+	Eigen::TensorMap<Eigen::Tensor<float, 3>> node_error(h_node_errors, batch_size, memory_size, layer_size);
+	node_error.setConstant(0);
+	Eigen::Tensor<float, 3> expected(batch_size, layer_size, n_time_steps);
+	expected.setConstant(1);
+
+	// Set up the device
+	Eigen::DefaultDevice device;
+
+	bool success = kernal.executeModelErrors(
+		expected,
+		h_predicted,
+		d_predicted,
+		h_model_error,
+		d_model_error,
+		h_node_errors,
+		d_node_errors,
+		loss_function,
+		loss_grad_function,
+		batch_size,
+		memory_size,
+		layer_size,
+		time_step_start,
+		n_time_steps,
+		device,
+		true,
+		true);
+	BOOST_CHECK(success);
+
+	Eigen::Tensor<float, 2> expected_model_error(batch_size, memory_size);
+	expected_model_error.setValues({ {0, 0.5}, {0.5, 0.5}, {2.0, 0.5}, {4.5, 0.5} });
+	Eigen::Tensor<float, 3> expected_node_error(batch_size, memory_size, layer_size);
+	expected_node_error.setValues({
+		{ {0, 0 }, { 0.5, 0.5 } },
+		{ {-0.5, -0.5 }, { 0.5, 0.5 } },
+		{ {-1, -1 }, { 0.5, 0.5 } },
+		{ {-1.5, -1.5 }, { 0.5, 0.5 } } });
+
+	for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter) {
+		for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter) {
+			BOOST_CHECK_CLOSE(model_error(batch_iter, memory_iter), expected_model_error(batch_iter, memory_iter), 1e-4);
+			for (int node_iter = 0; node_iter < layer_size; ++node_iter) {
+				BOOST_CHECK_CLOSE(node_error(batch_iter, memory_iter, node_iter), expected_node_error(batch_iter, memory_iter, node_iter), 1e-4);
+			}
+		}
+	}
+
+  // release resources
+  delete[] h_predicted;
+  delete[] d_predicted;
+  delete[] h_model_error;
+  delete[] d_model_error;
+  delete[] h_node_errors;
+  delete[] d_node_errors;
+}
+
 BOOST_AUTO_TEST_CASE(modelMetricDefaultDevice)
 {
   const int device_id = 0;
@@ -3,6 +3,7 @@
 #define BOOST_TEST_MODULE ModelReplicator test suite 
 #include <boost/test/included/unit_test.hpp>
 #include <SmartPeak/ml/ModelReplicator.h>
+#include <SmartPeak/ml/ModelBuilder.h>
 
 #include <iostream>
 
@@ -1091,6 +1092,60 @@ BOOST_AUTO_TEST_CASE(deleteLink)
   // [TODO: additional tests needed?]
 }
 
+BOOST_AUTO_TEST_CASE(fusedRoutingNodes)
+{
+  ModelReplicatorExt<float> model_replicator;
+
+  // a fused LSTM layer followed by a fully connected layer
+  Model<float> model;
+  ModelBuilder<float> model_builder;
+  std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", 2);
+  node_names = model_builder.addLSTMFused(model, "LSTM", "LSTM", node_names, 2,
+    std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(1.0)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, true, true, true);
+  node_names = model_builder.addFullyConnected(model, "FC", "FC", node_names, 2,
+    std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()),
+    std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+    std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(1.0)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, 0.0f, false);
+
+  // the memory cells, output gates, and outputs recover the routing from their input links
+  BOOST_CHECK(model_replicator.isFusedRoutingNode(*model.nodes_.at("LSTM-Output_000000000000")));
+  BOOST_CHECK(!model_replicator.isFusedRoutingNode(*model.nodes_.at("FC_000000000000")));
+  std::set<std::string> routing_links;
+  for (const auto& link_map : model.links_)
+    if (model_replicator.isFusedRoutingNode(*model.nodes_.at(link_map.second->getSinkNodeName())))
+      routing_links.insert(link_map.first);
+  BOOST_CHECK_EQUAL(routing_links.size(), 2 * 8 + 2 * 2);
+
+  // the gates, memory cells, output gates, and outputs are excluded from the random modifications
+  const std::set<std::string> fused_routing_nodes = model_replicator.selectFusedRoutingNodes(model);
+  BOOST_CHECK_EQUAL(fused_routing_nodes.size(), 8 + 2 + 2 + 2);
+  BOOST_CHECK(fused_routing_nodes.count("LSTM-Output_000000000000"));
+  BOOST_CHECK(!fused_routing_nodes.count("Input_000000000000"));
+  BOOST_CHECK(!fused_routing_nodes.count("FC_000000000000"));
+  for (int iter = 0; iter < 20; ++iter) {
+    const std::string random_node = model_replicator.selectRandomNode(model, { NodeType::bias, NodeType::input }, {});
+    BOOST_CHECK(fused_routing_nodes.count(random_node) == 0);
+    const std::string random_link = model_replicator.selectRandomLink(model, {}, {}, {}, {});
+    BOOST_CHECK(routing_links.count(random_link) == 0);
+  }
+
+  // the routing links are neither added, copied, nor deleted
+  for (int iter = 0; iter < 20; ++iter) {
+    Model<float> model_copy(model);
+    const std::string unique_str = std::to_string(iter);
+    model_replicator.addLink(model_copy, unique_str);
+    model_replicator.copyLink(model_copy, unique_str);
+    model_replicator.addNodeRight(model_copy, unique_str);
+    model_replicator.addNodeDown(model_copy, unique_str);
+    model_replicator.deleteLink(model_copy, 0);
+    std::set<std::string> routing_links_copy;
+    for (const auto& link_map : model_copy.links_)
+      if (model_replicator.isFusedRoutingNode(*model_copy.nodes_.at(link_map.second->getSinkNodeName())))
+        routing_links_copy.insert(link_map.first);
+    BOOST_CHECK(routing_links_copy == routing_links);
+  }
+}
+
 Model<float> model_changeNodeActivation = makeModel1();
 BOOST_AUTO_TEST_CASE(changeNodeActivation)
 {
@@ -35,6 +35,16 @@ public:
     loss_output_data.setValues({ {{1, 0}}, {{1, 0}}, {{1, 0}}, {{1, 0}} });
     metric_output_data.setValues({ {{0, 1}}, {{0, 1}}, {{0, 1}}, {{0, 1}} });
 
+    // Make the simulation time_steps
+    time_steps.setConstant(1);
+  };
+  void simulateEvaluationData(Eigen::Tensor<TensorT, 3>& input_data, Eigen::Tensor<TensorT, 3>& metric_output_data, Eigen::Tensor<TensorT, 2>& time_steps) override {
+    // Make the input data
+    input_data.setValues({ {{1, 5, 1, 1}}, {{2, 6, 1, 1}}, {{3, 7, 1, 1}}, {{4, 8, 1, 1}} });
+
+    // Make the output data
+    metric_output_data.setValues({ {{0, 1}}, {{0, 1}}, {{0, 1}}, {{0, 1}} });
+
     // Make the simulation time_steps
     time_steps.setConstant(1);
   };
@@ -122,6 +132,8 @@ BOOST_AUTO_TEST_CASE(gettersAndSetters)
   BOOST_CHECK_EQUAL(trainer.getInterpretModel(), true);
   BOOST_CHECK_EQUAL(trainer.getResetModel(), true);
   BOOST_CHECK_EQUAL(trainer.getResetInterpreter(), true);
+  BOOST_CHECK(trainer.getBPTTMode() == BPTTMode::TBPTT);
+  BOOST_CHECK_EQUAL(trainer.getNWindowSteps(), -1);
 
   // Test setters/getters
   trainer.setBatchSize(4);
@@ -139,6 +151,8 @@ BOOST_AUTO_TEST_CASE(gettersAndSetters)
   trainer.setInterpretModel(false);
   trainer.setResetModel(false);
   trainer.setResetInterpreter(false);
+  trainer.setBPTTMode(BPTTMode::CheckpointedBPTT);
+  trainer.setNWindowSteps(3);
 
   BOOST_CHECK_EQUAL(trainer.getBatchSize(), 4);
   BOOST_CHECK_EQUAL(trainer.getMemorySize(), 1);
@@ -157,6 +171,8 @@ BOOST_AUTO_TEST_CASE(gettersAndSetters)
   BOOST_CHECK_EQUAL(trainer.getInterpretModel(), false);
   BOOST_CHECK_EQUAL(trainer.getResetModel(), false);
   BOOST_CHECK_EQUAL(trainer.getResetInterpreter(), false);
+  BOOST_CHECK(trainer.getBPTTMode() == BPTTMode::CheckpointedBPTT);
+  BOOST_CHECK_EQUAL(trainer.getNWindowSteps(), 3);
 
   // Test loss and metric function getters and setters
   std::vector<LossFunctionHelper<float>> loss_function_helpers;
@@ -545,7 +561,32 @@ BOOST_AUTO_TEST_CASE(DAGToy2)
   BOOST_CHECK_LE(validation_errors.first.back(), 749.853395);
   BOOST_CHECK_LE(validation_errors.second.back(), 455.849305);
 
-  // TODO evaluateModel
+  // evaluate the model and keep the outputs of all epochs
+  trainer.setNEpochsEvaluation(5);
+  Eigen::Tensor<float, 4> model_output = trainer.evaluateModel(model1, data_simulator,
+    input_nodes, ModelLogger<float>(), ModelInterpreterDefaultDevice<float>(model_resources));
+  BOOST_CHECK_EQUAL(model_output.dimension(0), 4);
+  BOOST_CHECK_EQUAL(model_output.dimension(2), 2);
+  BOOST_CHECK_EQUAL(model_output.dimension(3), 5);
+
+  // evaluate the model and only stream the outputs to the evaluation accumulators
+  std::shared_ptr<OutputStatisticsAccumulator<float>> output_statistics = std::make_shared<OutputStatisticsAccumulator<float>>();
+  std::shared_ptr<MetricAccumulator<float>> metric_statistics = std::make_shared<MetricAccumulator<float>>();
+  trainer.setEvaluationAccumulators({ output_statistics, metric_statistics });
+  trainer.setStreamEvaluation(true);
+  BOOST_CHECK(trainer.getStreamEvaluation());
+  BOOST_CHECK_EQUAL(trainer.getEvaluationAccumulators().size(), 2);
+  Eigen::Tensor<float, 4> model_output_streamed = trainer.evaluateModel(model1, data_simulator,
+    input_nodes, ModelLogger<float>(), ModelInterpreterDefaultDevice<float>(model_resources));
+  BOOST_CHECK_EQUAL(model_output_streamed.dimension(3), 0);
+  BOOST_CHECK_EQUAL(output_statistics->getNSamples(), 20);
+  BOOST_CHECK_EQUAL(metric_statistics->getNEpochs(), 5);
+  BOOST_CHECK_EQUAL(metric_statistics->getMetricNames().at(0), "MAE");
+  for (int node_iter = 0; node_iter < 2; ++node_iter) {
+    Eigen::Tensor<float, 0> mean_expected = model_output.chip(node_iter, 2).chip(0, 1).mean();
+    BOOST_CHECK_CLOSE(output_statistics->getMean()(0, node_iter), mean_expected(0), 1e-3);
+  }
+  BOOST_CHECK_CLOSE(metric_statistics->getMean()(0), metric_statistics->getSum()(0) / 5, 1e-3);
 }
 
 template<typename TensorT>
@@ -688,6 +729,66 @@ BOOST_AUTO_TEST_CASE(DCGToy1)
 	// TODO evaluateModel
 }
 
+BOOST_AUTO_TEST_CASE(DCGToyBPTTModes)
+{
+  DCGToyModelTrainer<float> trainer;
+  ModelResources model_resources = { ModelDevice(0, 1) };
+  trainer.setBatchSize(5);
+  trainer.setMemorySize(8);
+  trainer.setNEpochsTraining(5);
+  const std::vector<std::string> input_nodes = { "0", "3", "4" }; // true inputs + biases
+  const std::vector<std::string> output_nodes = { "2" };
+
+  std::vector<LossFunctionHelper<float>> loss_function_helpers;
+  LossFunctionHelper<float> loss_function_helper1;
+  loss_function_helper1.output_nodes_ = output_nodes;
+  loss_function_helper1.loss_functions_ = { std::make_shared<MSELossOp<float>>(MSELossOp<float>(1e-6, 1.0)) };
+  loss_function_helper1.loss_function_grads_ = { std::make_shared<MSELossGradOp<float>>(MSELossGradOp<float>(1e-6, 1.0)) };
+  loss_function_helpers.push_back(loss_function_helper1);
+  trainer.setLossFunctionHelpers(loss_function_helpers);
+
+  // Make the input, output, and time step data (y = x - floor(t/2))
+  Eigen::Tensor<float, 4> input_data(trainer.getBatchSize(), trainer.getMemorySize(), (int)input_nodes.size(), trainer.getNEpochsTraining());
+  Eigen::Tensor<float, 4> output_data(trainer.getBatchSize(), trainer.getMemorySize(), (int)output_nodes.size(), trainer.getNEpochsTraining());
+  Eigen::Tensor<float, 3> time_steps(trainer.getBatchSize(), trainer.getMemorySize(), trainer.getNEpochsTraining());
+  input_data.setZero();
+  time_steps.setConstant(1);
+  for (int batch_iter = 0; batch_iter < trainer.getBatchSize(); ++batch_iter) {
+    for (int memory_iter = 0; memory_iter < trainer.getMemorySize(); ++memory_iter) {
+      for (int epochs_iter = 0; epochs_iter < trainer.getNEpochsTraining(); ++epochs_iter) {
+        input_data(batch_iter, memory_iter, 0, epochs_iter) = 8 + batch_iter - memory_iter;
+        output_data(batch_iter, memory_iter, 0, epochs_iter) = 4 + (batch_iter + 1) / 2 - (memory_iter + batch_iter % 2) / 2;
+      }
+    }
+  }
+
+  // Full TBPTT
+  Model<float> model1 = trainer.makeModel();
+  std::vector<float> errors1 = trainer.trainModel(model1, input_data, output_data, time_steps,
+    input_nodes, ModelLogger<float>(), ModelInterpreterDefaultDevice<float>(model_resources));
+
+  // Checkpointed BPTT gives the same model errors and weights with only 3 of the 8 time steps in memory
+  trainer.setBPTTMode(BPTTMode::CheckpointedBPTT);
+  trainer.setNWindowSteps(3);
+  Model<float> model2 = trainer.makeModel();
+  std::vector<float> errors2 = trainer.trainModel(model2, input_data, output_data, time_steps,
+    input_nodes, ModelLogger<float>(), ModelInterpreterDefaultDevice<float>(model_resources));
+  BOOST_CHECK_EQUAL(errors2.size(), errors1.size());
+  for (int i = 0; i < errors1.size(); ++i)
+    BOOST_CHECK_CLOSE(errors2.at(i), errors1.at(i), 1e-3);
+  for (auto& weight_map : model1.getWeightsMap())
+    BOOST_CHECK_CLOSE(model2.getWeightsMap().at(weight_map.first)->getWeight(), weight_map.second->getWeight(), 1e-3);
+
+  // windowed TBPTT gives the same forward pass but a truncated gradient
+  trainer.setBPTTMode(BPTTMode::WindowedTBPTT);
+  Model<float> model3 = trainer.makeModel();
+  std::vector<float> errors3 = trainer.trainModel(model3, input_data, output_data, time_steps,
+    input_nodes, ModelLogger<float>(), ModelInterpreterDefaultDevice<float>(model_resources));
+  BOOST_CHECK_EQUAL(errors3.size(), errors1.size());
+  BOOST_CHECK_CLOSE(errors3.at(0), errors1.at(0), 1e-3);
+  BOOST_CHECK(errors3.back() < errors3.front());
+}
+
 BOOST_AUTO_TEST_CASE(DCGToy2)
 {
   // Define the makeModel and trainModel scripts
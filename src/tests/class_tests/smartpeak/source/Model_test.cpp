@@ -476,6 +476,173 @@ BOOST_AUTO_TEST_CASE(copy)
   BOOST_CHECK_EQUAL(model1.getLink("1").getName(), "1");
 }
 
+BOOST_AUTO_TEST_CASE(getStructureHash)
+{
+  Node<float> source1, sink1;
+  source1 = Node<float>("1.1", NodeType::hidden, NodeStatus::activated, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  sink1 = Node<float>("1.2", NodeType::hidden, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  std::shared_ptr<WeightInitOp<float>> weight_init = std::make_shared<RandWeightInitOp<float>>(RandWeightInitOp<float>(1));
+  std::shared_ptr<SolverOp<float>> solver = std::make_shared<SGDOp<float>>(SGDOp<float>(0.01, 0.9));
+  Weight<float> weight1("1", weight_init, solver);
+  Link link1("1", source1.getName(), sink1.getName(), weight1.getName());
+  Model<float> model1(1);
+  model1.addNodes({ source1, sink1 });
+  model1.addWeights({ weight1 });
+  model1.addLinks({ link1 });
+
+  // independent of the id, name, and weight values
+  Model<float> model2(model1);
+  model2.setId(2);
+  model2.setName("2");
+  model2.weights_.at("1")->setWeight(10);
+  BOOST_CHECK_EQUAL(model1.getStructureHash(), model2.getStructureHash());
+
+  // dependent on the node operators
+  model2.nodes_.at("1.2")->setActivation(std::make_shared<TanHOp<float>>(TanHOp<float>()));
+  BOOST_CHECK_NE(model1.getStructureHash(), model2.getStructureHash());
+
+  // dependent on the layer names
+  Model<float> model3(model1);
+  model3.nodes_.at("1.2")->setLayerName("Layer1");
+  BOOST_CHECK_NE(model1.getStructureHash(), model3.getStructureHash());
+
+  // dependent on the links
+  Model<float> model4(model1);
+  model4.links_.at("1")->setSinkNodeName("1.1");
+  BOOST_CHECK_NE(model1.getStructureHash(), model4.getStructureHash());
+
+  // dependent on the cyclic pairs
+  Model<float> model5(model1);
+  model5.addCyclicPairs(std::make_pair("1.1", "1.2"));
+  BOOST_CHECK_NE(model1.getStructureHash(), model5.getStructureHash());
+
+  // dependent on the node and weight tensor indices
+  Model<float> model6(model1);
+  model6.nodes_.at("1.2")->setTensorIndex(std::make_pair(1, 0));
+  BOOST_CHECK_NE(model1.getStructureHash(), model6.getStructureHash());
+  Model<float> model7(model1);
+  model7.weights_.at("1")->addTensorIndex(std::make_tuple(0, 0, 0));
+  BOOST_CHECK_NE(model1.getStructureHash(), model7.getStructureHash());
+}
+
+BOOST_AUTO_TEST_CASE(findCycles)
+{
+  // toy recurrent model with a self-loop and a two-node cycle
+  Node<float> i, h1, h2, o, b;
+  i = Node<float>("i", NodeType::input, NodeStatus::activated, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  h1 = Node<float>("h1", NodeType::hidden, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  h2 = Node<float>("h2", NodeType::hidden, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  o = Node<float>("o", NodeType::output, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  b = Node<float>("b", NodeType::bias, NodeStatus::activated, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  std::shared_ptr<WeightInitOp<float>> weight_init = std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(1.0));
+  std::shared_ptr<SolverOp<float>> solver = std::make_shared<SGDOp<float>>(SGDOp<float>(0.01, 0.9));
+  Weight<float> w1("w1", weight_init, solver), w2("w2", weight_init, solver), w3("w3", weight_init, solver),
+    w4("w4", weight_init, solver), w5("w5", weight_init, solver), w6("w6", weight_init, solver);
+  Link l1("l1", "i", "h1", "w1"), l2("l2", "h1", "h2", "w2"), l3("l3", "h2", "h1", "w3"),
+    l4("l4", "h2", "o", "w4"), l5("l5", "h1", "h1", "w5"), l6("l6", "b", "h1", "w6");
+  Model<float> model;
+  model.addNodes({ i, h1, h2, o, b });
+  model.addWeights({ w1, w2, w3, w4, w5, w6 });
+  model.addLinks({ l1, l2, l3, l4, l5, l6 });
+
+  std::set<std::pair<std::string, std::string>> cyclic_pairs = { std::make_pair("h1", "h1"), std::make_pair("h2", "h1") };
+
+  // depth-first search over the strongly connected components
+  model.findCycles();
+  BOOST_CHECK(model.getCyclicPairs() == cyclic_pairs);
+  BOOST_CHECK_EQUAL(model.getNode("b").getId(), -1);
+
+  // all elementary circuits
+  model.findCycles(true);
+  BOOST_CHECK(model.getCyclicPairs() == cyclic_pairs);
+
+  // no cycles
+  model.removeLinks({ "l3", "l5" });
+  model.findCycles();
+  BOOST_CHECK_EQUAL(model.getCyclicPairs().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(copyOnWrite)
+{
+  Node<float> i, h, o;
+  i = Node<float>("i", NodeType::input, NodeStatus::activated, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  h = Node<float>("h", NodeType::hidden, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  o = Node<float>("o", NodeType::output, NodeStatus::initialized, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()));
+  std::shared_ptr<WeightInitOp<float>> weight_init = std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(1.0));
+  std::shared_ptr<SolverOp<float>> solver = std::make_shared<SGDOp<float>>(SGDOp<float>(0.01, 0.9));
+  Weight<float> w1("w1", weight_init, solver), w2("w2", weight_init, solver);
+  Link l1("l1", "i", "h", "w1"), l2("l2", "h", "o", "w2");
+  Model<float> model1(1);
+  model1.addNodes({ i, h, o });
+  model1.addWeights({ w1, w2 });
+  model1.addLinks({ l1, l2 });
+  model1.setInputAndOutputNodes();
+
+  // all elements are shared
+  Model<float> model2;
+  model2.copyOnWrite(model1);
+  BOOST_CHECK(model2.isShared());
+  BOOST_CHECK(!model1.isShared());
+  BOOST_CHECK_EQUAL(model2.getId(), 1);
+  BOOST_CHECK_EQUAL(model2.getSharedNodes().size(), 3);
+  BOOST_CHECK_EQUAL(model2.getSharedLinks().size(), 2);
+  BOOST_CHECK_EQUAL(model2.getSharedWeights().size(), 2);
+  BOOST_CHECK(model2.nodes_.at("h") == model1.nodes_.at("h"));
+  BOOST_CHECK(model2.links_.at("l1") == model1.links_.at("l1"));
+  BOOST_CHECK(model2.weights_.at("w1") == model1.weights_.at("w1"));
+  BOOST_CHECK(model2.getInputNodes()[0] == model1.nodes_.at("i"));
+  BOOST_CHECK(model2.getOutputNodes()[0] == model1.nodes_.at("o"));
+  BOOST_CHECK(model1 == model2);
+
+  // detached elements are private copies
+  model2.detachNode("o");
+  model2.detachLink("l1");
+  model2.detachWeight("w1");
+  BOOST_CHECK(model2.nodes_.at("o") != model1.nodes_.at("o"));
+  BOOST_CHECK(model2.getOutputNodes()[0] == model2.nodes_.at("o"));
+  BOOST_CHECK(model2.links_.at("l1") != model1.links_.at("l1"));
+  BOOST_CHECK(model2.weights_.at("w1") != model1.weights_.at("w1"));
+  BOOST_CHECK(model2.getNode("o") == model1.getNode("o"));
+  BOOST_CHECK_EQUAL(model2.getSharedNodes().count("o"), 0);
+  BOOST_CHECK_EQUAL(model2.getSharedLinks().count("l1"), 0);
+  BOOST_CHECK_EQUAL(model2.getSharedWeights().count("w1"), 0);
+  model2.weights_.at("w1")->setInitWeight(false);
+  BOOST_CHECK(model1.weights_.at("w1")->getInitWeight());
+
+  // replacing elements does not change the original model
+  Node<float> h_new = model2.getNode("h");
+  h_new.setActivation(std::make_shared<TanHOp<float>>(TanHOp<float>()));
+  model2.removeNodes({ "h" });
+  BOOST_CHECK_EQUAL(model2.getSharedNodes().count("h"), 0);
+  model2.addNodes({ h_new });
+  BOOST_CHECK_EQUAL(model2.getSharedNodes().count("h"), 0);
+  BOOST_CHECK_EQUAL(model1.getNode("h").getActivation()->getName(), "ReLUOp");
+  BOOST_CHECK_EQUAL(model2.getNode("h").getActivation()->getName(), "TanHOp");
+  model2.removeLinks({ "l2" });
+  BOOST_CHECK_EQUAL(model2.getSharedLinks().count("l2"), 0);
+  BOOST_CHECK_EQUAL(model1.links_.size(), 2);
+
+  // moves keep the sharing
+  Model<float> model3(std::move(model2));
+  BOOST_CHECK(model3.isShared());
+  BOOST_CHECK(model3.nodes_.at("i") == model1.nodes_.at("i"));
+
+  // detach the nodes only
+  model3.detachNodes();
+  BOOST_CHECK(model3.getSharedNodes().empty());
+  BOOST_CHECK(!model3.getSharedWeights().empty());
+  BOOST_CHECK(model3.nodes_.at("i") != model1.nodes_.at("i"));
+  BOOST_CHECK(model3.getInputNodes()[0] == model3.nodes_.at("i"));
+  BOOST_CHECK(model3.weights_.at("w2") == model1.weights_.at("w2"));
+
+  // detach all
+  model3.detach();
+  BOOST_CHECK(!model3.isShared());
+  BOOST_CHECK(model3.nodes_.at("i") != model1.nodes_.at("i"));
+  BOOST_CHECK(model3.getInputNodes()[0] == model3.nodes_.at("i"));
+  BOOST_CHECK(model3.weights_.at("w2") != model1.weights_.at("w2"));
+}
+
 BOOST_AUTO_TEST_CASE(pruneModel) 
 {
   // minimal toy model
@@ -744,6 +911,34 @@ BOOST_AUTO_TEST_CASE(checkCompleteInputToOutput)
 	model7.addLinks({ l_i1_h1, l_i2_h1, l_h1_o1, l_h1_o2, l_b1_h1 });
 
 	BOOST_CHECK(model7.checkCompleteInputToOutput());
+
+	// model 8: long chain (i.e., deeper than the call stack allows for recursion)
+	const int n_hidden = 100000;
+	Model<float> model8;
+	model8.addNodes({ i1, o1 });
+	std::vector<Node<float>> hidden_nodes;
+	std::vector<Weight<float>> chain_weights;
+	std::vector<Link> chain_links;
+	for (int i = 0; i <= n_hidden; ++i) {
+		const std::string source = (i == 0) ? "i1" : "h" + std::to_string(i - 1);
+		const std::string sink = (i == n_hidden) ? "o1" : "h" + std::to_string(i);
+		if (i < n_hidden) hidden_nodes.push_back(Node<float>(sink, NodeType::hidden, NodeStatus::initialized, std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()), std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>())));
+		chain_weights.push_back(Weight<float>("w" + std::to_string(i), weight_init, solver));
+		chain_links.push_back(Link("l" + std::to_string(i), source, sink, "w" + std::to_string(i)));
+	}
+	model8.addNodes(hidden_nodes);
+	model8.addWeights(chain_weights);
+	model8.addLinks(chain_links);
+	BOOST_CHECK(model8.checkCompleteInputToOutput());
+
+	// break the chain and prune the dangling links and weights
+	model8.removeNodes({ "h500" });
+	BOOST_CHECK(model8.checkCompleteInputToOutput()); // dangling links (cannot detect!)
+	model8.pruneModel();
+	BOOST_CHECK_EQUAL(model8.nodes_.size(), n_hidden + 1);
+	BOOST_CHECK_EQUAL(model8.links_.size(), n_hidden - 1);
+	BOOST_CHECK_EQUAL(model8.weights_.size(), n_hidden - 1);
+	BOOST_CHECK(!model8.checkCompleteInputToOutput());
 }
 
 BOOST_AUTO_TEST_CASE(removeIsolatedNodes)
@@ -343,6 +343,63 @@ BOOST_AUTO_TEST_CASE(getTensorParamsActivationOpToActivationTensorOp)
   BOOST_CHECK_EQUAL(params.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(sharedTensorOpsActivationOpToActivationTensorOp)
+{
+	ActivationOpToActivationTensorOp<float, Eigen::DefaultDevice> op_to_tensor_op;
+	BOOST_CHECK(op_to_tensor_op.hasConversion("ReLUOp"));
+	BOOST_CHECK(!op_to_tensor_op.hasConversion("NotAnOp"));
+	BOOST_CHECK_EQUAL(op_to_tensor_op.getNSharedTensorOps(), 0);
+
+	// identical ops share the same tensor op
+	std::shared_ptr<ActivationOp<float>> op_class1 = std::make_shared<ReLUOp<float>>(ReLUOp<float>(1, 2, 3));
+	std::shared_ptr<ActivationOp<float>> op_class2 = std::make_shared<ReLUOp<float>>(ReLUOp<float>(1, 2, 3));
+	std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>> op_tensor_class1 = op_to_tensor_op.convertOpToTensorOp(op_class1);
+	std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>> op_tensor_class2 = op_to_tensor_op.convertOpToTensorOp(op_class2);
+	BOOST_CHECK(op_tensor_class1 == op_tensor_class2);
+	BOOST_CHECK_EQUAL(op_to_tensor_op.getNSharedTensorOps(), 1);
+
+	// ops with different parameters or names do not
+	std::shared_ptr<ActivationOp<float>> op_class3 = std::make_shared<ReLUOp<float>>(ReLUOp<float>(1, 2, 4));
+	std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>> op_tensor_class3 = op_to_tensor_op.convertOpToTensorOp(op_class3);
+	BOOST_CHECK(op_tensor_class1 != op_tensor_class3);
+	BOOST_CHECK_EQUAL(op_tensor_class3->getMax(), 4);
+	std::shared_ptr<ActivationOp<float>> op_class4 = std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>(1, 2, 3));
+	std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>> op_tensor_class4 = op_to_tensor_op.convertOpToTensorOp(op_class4);
+	BOOST_CHECK_EQUAL(op_tensor_class4->getName(), "ReLUGradTensorOp");
+	BOOST_CHECK_EQUAL(op_to_tensor_op.getNSharedTensorOps(), 3);
+
+	op_to_tensor_op.clearSharedTensorOps();
+	BOOST_CHECK_EQUAL(op_to_tensor_op.getNSharedTensorOps(), 0);
+	op_tensor_class2 = op_to_tensor_op.convertOpToTensorOp(op_class2);
+	BOOST_CHECK(op_tensor_class1 != op_tensor_class2);
+}
+
+template<typename TensorT, typename DeviceT>
+class ActivationOpToActivationTensorOpStateful : public ActivationOpToActivationTensorOp<TensorT, DeviceT>
+{
+public:
+	bool isStatefulTensorOp(const std::string& op_name) const { return op_name == "ReLUOp"; }
+};
+
+BOOST_AUTO_TEST_CASE(statefulTensorOpsActivationOpToActivationTensorOp)
+{
+	ActivationOpToActivationTensorOpStateful<float, Eigen::DefaultDevice> op_to_tensor_op;
+
+	// stateful tensor ops are made for every conversion and are not shared
+	std::shared_ptr<ActivationOp<float>> op_class1 = std::make_shared<ReLUOp<float>>(ReLUOp<float>(1, 2, 3));
+	std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>> op_tensor_class1 = op_to_tensor_op.convertOpToTensorOp(op_class1);
+	std::shared_ptr<ActivationTensorOp<float, Eigen::DefaultDevice>> op_tensor_class2 = op_to_tensor_op.convertOpToTensorOp(op_class1);
+	BOOST_CHECK(op_tensor_class1 != op_tensor_class2);
+	BOOST_CHECK_EQUAL(op_tensor_class1->getName(), "ReLUTensorOp");
+	BOOST_CHECK_EQUAL(op_tensor_class2->getMax(), 3);
+	BOOST_CHECK_EQUAL(op_to_tensor_op.getNSharedTensorOps(), 0);
+
+	// stateless tensor ops are still shared
+	std::shared_ptr<ActivationOp<float>> op_class3 = std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>(1, 2, 3));
+	BOOST_CHECK(op_to_tensor_op.convertOpToTensorOp(op_class3) == op_to_tensor_op.convertOpToTensorOp(op_class3));
+	BOOST_CHECK_EQUAL(op_to_tensor_op.getNSharedTensorOps(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(constructorSolverOpToSolverTensorOp)
 {
 	SolverOpToSolverTensorOp<float, Eigen::DefaultDevice>* ptr = nullptr;
@@ -529,6 +586,36 @@ BOOST_AUTO_TEST_CASE(getTensorParamsIntegrationOpToIntegrationTensorOp)
 	BOOST_CHECK_EQUAL(params.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(statefulTensorOpsIntegrationOpToIntegrationTensorOp)
+{
+	IntegrationOpToIntegrationTensorOp<float, Eigen::DefaultDevice> op_to_tensor_op;
+	IntegrationErrorOpToIntegrationErrorTensorOp<float, Eigen::DefaultDevice> error_op_to_tensor_op;
+
+	// the fused layers hold their routing so each layer gets its own tensor op
+	std::vector<std::shared_ptr<IntegrationOp<float>>> op_classes = {
+		std::make_shared<LSTMCellOp<float>>(), std::make_shared<LSTMOutputOp<float>>(), std::make_shared<GRUCellOp<float>>(),
+		std::make_shared<DotProdAttentionOp<float>>(), std::make_shared<SoftMaxOp<float>>(), std::make_shared<LogSoftMaxOp<float>>() };
+	for (auto& op_class : op_classes) {
+		BOOST_CHECK(op_to_tensor_op.isStatefulTensorOp(op_class->getName()));
+		BOOST_CHECK(op_to_tensor_op.convertOpToTensorOp(op_class) != op_to_tensor_op.convertOpToTensorOp(op_class));
+	}
+	std::vector<std::shared_ptr<IntegrationErrorOp<float>>> error_op_classes = {
+		std::make_shared<LSTMCellErrorOp<float>>(), std::make_shared<LSTMOutputErrorOp<float>>(), std::make_shared<GRUCellErrorOp<float>>(),
+		std::make_shared<DotProdAttentionErrorOp<float>>(), std::make_shared<SoftMaxErrorOp<float>>(), std::make_shared<LogSoftMaxErrorOp<float>>(),
+		std::make_shared<SoftMaxCrossEntropyErrorOp<float>>() };
+	for (auto& op_class : error_op_classes) {
+		BOOST_CHECK(error_op_to_tensor_op.isStatefulTensorOp(op_class->getName()));
+		BOOST_CHECK(error_op_to_tensor_op.convertOpToTensorOp(op_class) != error_op_to_tensor_op.convertOpToTensorOp(op_class));
+	}
+	BOOST_CHECK_EQUAL(op_to_tensor_op.getNSharedTensorOps(), 0);
+	BOOST_CHECK_EQUAL(error_op_to_tensor_op.getNSharedTensorOps(), 0);
+
+	// the other integration ops are shared
+	std::shared_ptr<IntegrationOp<float>> op_class = std::make_shared<SumOp<float>>(SumOp<float>());
+	BOOST_CHECK(!op_to_tensor_op.isStatefulTensorOp(op_class->getName()));
+	BOOST_CHECK(op_to_tensor_op.convertOpToTensorOp(op_class) == op_to_tensor_op.convertOpToTensorOp(op_class));
+}
+
 BOOST_AUTO_TEST_CASE(constructorIntegrationErrorOpToIntegrationErrorTensorOp)
 {
 	IntegrationErrorOpToIntegrationErrorTensorOp<float, Eigen::DefaultDevice>* ptr = nullptr;
@@ -1078,6 +1165,22 @@ BOOST_AUTO_TEST_CASE(convertOpToTensorOpMetricFunctionOpToMetricFunctionTensorOp
   op_tensor_class = op_to_tensor_op.convertOpToTensorOp(op_class);
   BOOST_CHECK_EQUAL(op_tensor_class->getName(), "F1ScoreMCMacroTensorOp");
 
+  op_class = std::make_shared<AUROCOp<float>>(AUROCOp<float>());
+  op_tensor_class = op_to_tensor_op.convertOpToTensorOp(op_class);
+  BOOST_CHECK_EQUAL(op_tensor_class->getName(), "AUROCTensorOp");
+
+  op_class = std::make_shared<AUPRCOp<float>>(AUPRCOp<float>());
+  op_tensor_class = op_to_tensor_op.convertOpToTensorOp(op_class);
+  BOOST_CHECK_EQUAL(op_tensor_class->getName(), "AUPRCTensorOp");
+
+  op_class = std::make_shared<MCCBCOp<float>>(MCCBCOp<float>());
+  op_tensor_class = op_to_tensor_op.convertOpToTensorOp(op_class);
+  BOOST_CHECK_EQUAL(op_tensor_class->getName(), "MCCBCTensorOp");
+
+  op_class = std::make_shared<MCCMCMicroOp<float>>(MCCMCMicroOp<float>());
+  op_tensor_class = op_to_tensor_op.convertOpToTensorOp(op_class);
+  BOOST_CHECK_EQUAL(op_tensor_class->getName(), "MCCMCMicroTensorOp");
+
   op_class = std::make_shared<MAEOp<float>>(MAEOp<float>());
   op_tensor_class = op_to_tensor_op.convertOpToTensorOp(op_class);
   BOOST_CHECK_EQUAL(op_tensor_class->getName(), "MAETensorOp");
@@ -287,6 +287,80 @@ BOOST_AUTO_TEST_CASE(simulatePeak)
 	// std::cout<< ";" <<std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(simulatePeaks)
+{
+	Eigen::Array<double, Eigen::Dynamic, 1> x(11);
+	for (int i = 0; i < x.size(); ++i) x(i) = i;
+	std::vector<EMGModel<double>> emgs = { EMGModel<double>(10.0, 0.0, 5.0, 1.0), EMGModel<double>(10.0, 0.5, 5.0, 1.0), EMGModel<double>(20.0, 0.5, 3.0, 1.0) };
+	Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic> y(x.size(), emgs.size());
+
+	// evenly spaced points, no detector noise, baselines, and saturation
+	PeakSimulator<double> psim(1.0, 0.0,
+		0.0, 10.0,
+		0.0, 0.0,
+		1.0, 0.5,
+		15);
+	psim.simulatePeaks(x, emgs, y);
+	for (int j = 0; j < emgs.size(); ++j) {
+		std::vector<double> x_peak, y_peak;
+		psim.simulatePeak(x_peak, y_peak, emgs[j]);
+		BOOST_CHECK_EQUAL(x_peak.size(), x.size());
+		for (int i = 0; i < x.size(); ++i)
+			BOOST_CHECK_CLOSE(y(i, j), y_peak[i], 1e-6);
+	}
+	BOOST_CHECK_EQUAL(y(0, 0), 1.0);
+	BOOST_CHECK_EQUAL(y(10, 0), 0.5);
+	BOOST_CHECK_EQUAL(y(3, 2), 15);
+
+	// detector noise
+	psim.setNoiseSimga(0.5);
+	psim.simulatePeaks(x, emgs, y);
+	BOOST_CHECK(y.col(0).isFinite().all());
+	BOOST_CHECK_LE(y.maxCoeff(), 15);
+}
+
+BOOST_AUTO_TEST_CASE(simulatePeakEngine)
+{
+	std::mt19937 engine(1);
+	Eigen::Array<double, Eigen::Dynamic, 1> x, y;
+	std::vector<EMGModel<double>> emgs = { EMGModel<double>(10.0, 0.0, 5.0, 1.0), EMGModel<double>(20.0, 0.5, 3.0, 1.0) };
+
+	// evenly spaced points, no detector noise
+	PeakSimulator<double> psim(1.0, 0.0,
+		0.0, 10.0,
+		0.0, 0.0,
+		1.0, 0.5,
+		15);
+	for (const EMGModel<double>& emg : emgs) {
+		const int n_points = psim.simulatePeak(x, y, emg, engine);
+		std::vector<double> x_peak, y_peak;
+		psim.simulatePeak(x_peak, y_peak, emg);
+		BOOST_CHECK_EQUAL(n_points, x_peak.size());
+		BOOST_CHECK_GE(x.size(), n_points);
+		for (int i = 0; i < n_points; ++i) {
+			BOOST_CHECK_CLOSE(x(i), x_peak[i], 1e-6);
+			BOOST_CHECK_CLOSE(y(i), y_peak[i], 1e-4);
+		}
+		std::pair<double, double> best_lr = psim.getBestLeftAndRight(x.head(n_points), y.head(n_points), emg.getMu());
+		std::pair<double, double> best_lr_test = psim.getBestLeftAndRight(x_peak, y_peak, emg.getMu());
+		BOOST_CHECK_EQUAL(best_lr.first, best_lr_test.first);
+		BOOST_CHECK_EQUAL(best_lr.second, best_lr_test.second);
+	}
+
+	// detector noise and unevenly spaced points (step_mu - 5 * step_sigma > 0 so that the step sigma is used)
+	psim.setNoiseSimga(0.5);
+	psim.setStepSizeSigma(0.1);
+	const int n_points = psim.simulatePeak(x, y, emgs[0], engine);
+	BOOST_CHECK_GE(n_points, 3);
+	BOOST_CHECK(y.head(n_points).isFinite().all());
+	BOOST_CHECK_LE(y.head(n_points).maxCoeff(), 15);
+	BOOST_CHECK_EQUAL(x(0), 0.0);
+	BOOST_CHECK_LE(x(n_points - 1), 10.0);
+	const Eigen::Array<double, Eigen::Dynamic, 1> steps = x.segment(1, n_points - 1) - x.head(n_points - 1);
+	BOOST_CHECK_GT(steps.minCoeff(), 0.0);
+	BOOST_CHECK_GT(steps.maxCoeff() - steps.minCoeff(), 1e-6);
+}
+
 BOOST_AUTO_TEST_CASE(getBestLeftAndRight)
 {
 
@@ -30,6 +30,9 @@ BOOST_AUTO_TEST_CASE(gettersAndSetters1)
    PopulationLogger<float> population_logger(true, true);
 	BOOST_CHECK(population_logger.getLogTimeGeneration());
 	BOOST_CHECK(population_logger.getLogTrainValErrorsGeneration());
+	BOOST_CHECK(!population_logger.getLogThroughput());
+	PopulationLogger<float> population_logger_throughput(false, false, true);
+	BOOST_CHECK(population_logger_throughput.getLogThroughput());
 }
 
 BOOST_AUTO_TEST_CASE(initLogs)
@@ -71,6 +74,19 @@ BOOST_AUTO_TEST_CASE(logTrainValErrorsPerGeneration)
 	// [TODO: read in and check]
 }
 
+BOOST_AUTO_TEST_CASE(logThroughput)
+{
+	BOOST_CHECK_CLOSE(PopulationLogger<float>::calculateModelsPerHour(10, 60), 600, 1e-6);
+	BOOST_CHECK_EQUAL(PopulationLogger<float>::calculateModelsPerHour(10, 0), 0);
+
+	PopulationLogger<float> population_logger(false, false, true);
+	population_logger.initLogs("Population1");
+	BOOST_CHECK_EQUAL(population_logger.getLogThroughputCSVWriter().getFilename(), "Population1_Throughput.csv");
+	population_logger.logThroughput(8, 2.5);
+	population_logger.logThroughput(16, 4.0);
+	BOOST_CHECK_EQUAL(population_logger.getLogThroughputCSVWriter().getLineCount(), 3);
+}
+
 BOOST_AUTO_TEST_CASE(writeLogs)
 {
 	PopulationLogger<float> population_logger(true, true);
@@ -0,0 +1,348 @@
+/**TODO:  Add copyright*/
+
+#define BOOST_TEST_MODULE PopulationTrainerDistributed test suite
+#include <boost/test/included/unit_test.hpp>
+#include <SmartPeak/ml/PopulationTrainerDistributed.h>
+
+#include <SmartPeak/ml/ModelBuilder.h>
+#include <SmartPeak/ml/ModelTrainerDefaultDevice.h>
+
+#include <sys/wait.h>
+
+using namespace SmartPeak;
+using namespace std;
+
+// Extended classes used for testing
+template<typename TensorT>
+class ModelTrainerExt : public ModelTrainerDefaultDevice<TensorT>
+{};
+
+typedef PopulationTrainerDistributed<float, ModelInterpreterDefaultDevice<float>> PopulationTrainerDistributedT;
+
+BOOST_AUTO_TEST_SUITE(populationTrainerDistributed)
+
+/// Toy validation problem shared by the coordinator and the workers
+struct ValidationData
+{
+  ValidationData()
+  {
+    input_data = Eigen::Tensor<float, 4>(batch_size, memory_size, (int)input_nodes.size(), n_epochs);
+    output_data = Eigen::Tensor<float, 4>(batch_size, memory_size, (int)output_nodes.size(), n_epochs);
+    time_steps = Eigen::Tensor<float, 3>(batch_size, memory_size, n_epochs);
+    for (int batch_iter = 0; batch_iter < batch_size; ++batch_iter)
+      for (int memory_iter = 0; memory_iter < memory_size; ++memory_iter)
+        for (int epochs_iter = 0; epochs_iter < n_epochs; ++epochs_iter) {
+          input_data(batch_iter, memory_iter, 0, epochs_iter) = batch_iter + memory_iter;
+          output_data(batch_iter, memory_iter, 0, epochs_iter) = 2 * (batch_iter + memory_iter);
+          time_steps(batch_iter, memory_iter, epochs_iter) = 1;
+        }
+
+    model_trainer.setBatchSize(batch_size);
+    model_trainer.setMemorySize(memory_size);
+    model_trainer.setNEpochsValidation(n_epochs);
+    model_trainer.setVerbosityLevel(0);
+    LossFunctionHelper<float> loss_function_helper;
+    loss_function_helper.output_nodes_ = output_nodes;
+    loss_function_helper.loss_functions_ = { std::make_shared<MSELossOp<float>>(MSELossOp<float>(1e-6, 1.0)) };
+    loss_function_helper.loss_function_grads_ = { std::make_shared<MSELossGradOp<float>>(MSELossGradOp<float>(1e-6, 1.0)) };
+    model_trainer.setLossFunctionHelpers({ loss_function_helper });
+  }
+
+  /// Fully connected models that differ by their weights
+  std::vector<Model<float>> makePopulation(const int& n_models) const
+  {
+    std::vector<Model<float>> population;
+    ModelBuilder<float> model_builder;
+    for (int i = 0; i < n_models; ++i) {
+      Model<float> model;
+      std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", 1);
+      node_names = model_builder.addFullyConnected(model, "Hidden", "Hidden", node_names, 2,
+        std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()),
+        std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+        std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(0.5 * (i + 1))), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, 0.0f);
+      node_names = model_builder.addFullyConnected(model, "Output", "Output", node_names, 1,
+        std::make_shared<LinearOp<float>>(LinearOp<float>()), std::make_shared<LinearGradOp<float>>(LinearGradOp<float>()),
+        std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+        std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(1.0)), std::make_shared<SGDOp<float>>(SGDOp<float>(0.1, 0.9)), 0.0f, 0.0f);
+      for (const std::string& node_name : node_names)
+        model.getNodesMap().at(node_name)->setType(NodeType::output);
+      model.setId(i);
+      model.setName(std::to_string(i));
+      population.push_back(model);
+    }
+    return population;
+  }
+
+  /// Validate the models on the coordinator
+  std::vector<float> validateLocally(std::vector<Model<float>>& models)
+  {
+    std::vector<float> model_errors;
+    for (Model<float>& model : models) {
+      model_errors.push_back(std::get<2>(PopulationTrainerDistributedT::validateModel_(model, model_trainer, model_interpreter, model_logger,
+        input_data, output_data, time_steps, input_nodes)));
+      model_interpreter.clear_cache();
+    }
+    return model_errors;
+  }
+
+  const std::vector<std::string> input_nodes = { "Input_000000000000" };
+  const std::vector<std::string> output_nodes = { "Output_000000000000" };
+  const int batch_size = 3;
+  const int memory_size = 2;
+  const int n_epochs = 2;
+  Eigen::Tensor<float, 4> input_data;
+  Eigen::Tensor<float, 4> output_data;
+  Eigen::Tensor<float, 3> time_steps;
+  ModelTrainerExt<float> model_trainer;
+  ModelInterpreterDefaultDevice<float> model_interpreter = ModelInterpreterDefaultDevice<float>(ModelResources({ ModelDevice(0, 1) }));
+  ModelLogger<float> model_logger;
+};
+
+BOOST_AUTO_TEST_CASE(constructor)
+{
+  PopulationTrainerDistributedT* ptr = nullptr;
+  PopulationTrainerDistributedT* nullPointer = nullptr;
+  ptr = new PopulationTrainerDistributedT();
+  BOOST_CHECK_NE(ptr, nullPointer);
+  delete ptr;
+}
+
+BOOST_AUTO_TEST_CASE(gettersAndSetters)
+{
+  PopulationTrainerDistributedT population_trainer;
+  BOOST_CHECK_EQUAL(population_trainer.getNWorkers(), 0);
+  BOOST_CHECK_EQUAL(population_trainer.getWorkerTimeout(), -1);
+
+  auto transport_pair_1 = LocalQueueTransport::makeTransportPair();
+  auto transport_pair_2 = LocalQueueTransport::makeTransportPair();
+  population_trainer.setWorkerTransports({ transport_pair_1.first, transport_pair_2.first });
+  population_trainer.setWorkerTimeout(100);
+  BOOST_CHECK_EQUAL(population_trainer.getWorkerTransports().size(), 2);
+  BOOST_CHECK_EQUAL(population_trainer.getNWorkers(), 2);
+  BOOST_CHECK_EQUAL(population_trainer.getWorkerTimeout(), 100);
+  BOOST_CHECK(population_trainer.getNModelsValidatedByWorkers() == std::vector<int>({ 0, 0 }));
+
+  // stopped workers receive "STOP" and are no longer used
+  population_trainer.stopWorkers();
+  BOOST_CHECK_EQUAL(population_trainer.getNWorkers(), 0);
+  std::string message;
+  BOOST_CHECK(transport_pair_1.second->receiveMessage(message, 100));
+  BOOST_CHECK_EQUAL(message, "STOP");
+  BOOST_CHECK(!transport_pair_1.second->receiveMessage(message, 100));
+}
+
+BOOST_AUTO_TEST_CASE(messages)
+{
+  const std::string error_message = PopulationTrainerDistributedT::makeErrorMessage(3, 0.125f);
+  int model_index = -1;
+  float model_error = 0;
+  BOOST_CHECK(PopulationTrainerDistributedT::parseErrorMessage(error_message, model_index, model_error));
+  BOOST_CHECK_EQUAL(model_index, 3);
+  BOOST_CHECK_CLOSE(model_error, 0.125f, 1e-6);
+  BOOST_CHECK(!PopulationTrainerDistributedT::parseErrorMessage("STOP", model_index, model_error));
+
+  const std::string failed_message = PopulationTrainerDistributedT::makeFailedMessage(5);
+  BOOST_CHECK(PopulationTrainerDistributedT::parseFailedMessage(failed_message, model_index));
+  BOOST_CHECK_EQUAL(model_index, 5);
+  BOOST_CHECK(!PopulationTrainerDistributedT::parseFailedMessage(error_message, model_index));
+  BOOST_CHECK(!PopulationTrainerDistributedT::parseErrorMessage(failed_message, model_index, model_error));
+
+  ValidationData validation_data;
+  std::vector<Model<float>> population = validation_data.makePopulation(1);
+  const std::string validate_message = PopulationTrainerDistributedT::makeValidateMessage(7, population.front());
+  BOOST_CHECK_EQUAL(validate_message.substr(0, validate_message.find('\n')), "VALIDATE 7");
+}
+
+BOOST_AUTO_TEST_CASE(validateModelsWorkerThreads)
+{
+  const int n_models = 5, n_workers = 2;
+  ValidationData validation_data;
+  std::vector<Model<float>> population = validation_data.makePopulation(n_models);
+  const std::vector<float> model_errors_expected = validation_data.validateLocally(population);
+
+  // workers that run in threads with their own trainer, interpreter, and data
+  std::vector<std::shared_ptr<MessageTransport>> worker_transports;
+  std::vector<std::thread> worker_threads;
+  std::vector<int> n_models_validated(n_workers, 0);
+  for (int worker = 0; worker < n_workers; ++worker) {
+    auto transport_pair = LocalQueueTransport::makeTransportPair();
+    worker_transports.push_back(transport_pair.first);
+    std::shared_ptr<MessageTransport> coordinator_transport = transport_pair.second;
+    worker_threads.push_back(std::thread([coordinator_transport, worker, &n_models_validated]() {
+      ValidationData worker_data;
+      n_models_validated.at(worker) = PopulationTrainerDistributedT::runWorker(*coordinator_transport, worker_data.model_trainer, worker_data.model_interpreter, worker_data.model_logger,
+        worker_data.input_data, worker_data.output_data, worker_data.time_steps, worker_data.input_nodes);
+    }));
+  }
+
+  PopulationTrainerDistributedT population_trainer;
+  population_trainer.setWorkerTransports(worker_transports);
+  std::vector<ModelInterpreterDefaultDevice<float>> model_interpreters = { validation_data.model_interpreter };
+  std::vector<std::tuple<int, std::string, float>> models_validation_errors(n_models);
+  population_trainer.validateModels(population, validation_data.model_trainer, model_interpreters, validation_data.model_logger,
+    validation_data.input_data, validation_data.output_data, validation_data.time_steps, validation_data.input_nodes, models_validation_errors);
+  BOOST_CHECK_EQUAL(population_trainer.getNWorkers(), n_workers);
+  population_trainer.stopWorkers();
+  for (std::thread& worker_thread : worker_threads) worker_thread.join();
+
+  // all models were validated by the workers
+  const std::vector<int> n_models_validated_by_workers = population_trainer.getNModelsValidatedByWorkers();
+  BOOST_CHECK_EQUAL(std::accumulate(n_models_validated_by_workers.begin(), n_models_validated_by_workers.end(), 0), n_models);
+  BOOST_CHECK(n_models_validated == n_models_validated_by_workers);
+  for (int i = 0; i < n_models; ++i) {
+    BOOST_CHECK_EQUAL(std::get<0>(models_validation_errors.at(i)), population.at(i).getId());
+    BOOST_CHECK_EQUAL(std::get<1>(models_validation_errors.at(i)), population.at(i).getName());
+    BOOST_CHECK_CLOSE(std::get<2>(models_validation_errors.at(i)), model_errors_expected.at(i), 1e-4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(validateModelsWorkerProcesses)
+{
+  const int n_models = 4, n_workers = 2;
+  ValidationData validation_data;
+  std::vector<Model<float>> population = validation_data.makePopulation(n_models);
+  const std::vector<float> model_errors_expected = validation_data.validateLocally(population);
+
+  // forked workers where the second worker exits after receiving its first model
+  std::vector<std::shared_ptr<MessageTransport>> worker_transports;
+  std::vector<pid_t> worker_pids;
+  for (int worker = 0; worker < n_workers; ++worker) {
+    auto transport_pair = UnixSocketTransport::makeSocketPair();
+    const pid_t pid = fork();
+    BOOST_REQUIRE_GE(pid, 0);
+    if (pid == 0) {
+      worker_transports.clear();
+      transport_pair.first->closeTransport();
+      int n_models_validated = 0;
+      if (worker == 0) {
+        ValidationData worker_data;
+        n_models_validated = PopulationTrainerDistributedT::runWorker(*transport_pair.second, worker_data.model_trainer, worker_data.model_interpreter, worker_data.model_logger,
+          worker_data.input_data, worker_data.output_data, worker_data.time_steps, worker_data.input_nodes);
+      }
+      else {
+        std::string message;
+        transport_pair.second->receiveMessage(message);
+      }
+      _exit(n_models_validated);
+    }
+    transport_pair.second->closeTransport();
+    worker_transports.push_back(transport_pair.first);
+    worker_pids.push_back(pid);
+  }
+
+  PopulationTrainerDistributedT population_trainer;
+  population_trainer.setWorkerTransports(worker_transports);
+  std::vector<ModelInterpreterDefaultDevice<float>> model_interpreters = { validation_data.model_interpreter };
+  std::vector<std::tuple<int, std::string, float>> models_validation_errors(n_models);
+  population_trainer.validateModels(population, validation_data.model_trainer, model_interpreters, validation_data.model_logger,
+    validation_data.input_data, validation_data.output_data, validation_data.time_steps, validation_data.input_nodes, models_validation_errors);
+
+  // the failed worker was dropped and its model was validated by the remaining worker
+  BOOST_CHECK_EQUAL(population_trainer.getNWorkers(), 1);
+  BOOST_CHECK(population_trainer.getNModelsValidatedByWorkers() == std::vector<int>({ n_models, 0 }));
+  for (int i = 0; i < n_models; ++i) {
+    BOOST_CHECK_EQUAL(std::get<1>(models_validation_errors.at(i)), population.at(i).getName());
+    BOOST_CHECK_CLOSE(std::get<2>(models_validation_errors.at(i)), model_errors_expected.at(i), 1e-4);
+  }
+
+  population_trainer.stopWorkers();
+  for (int worker = 0; worker < n_workers; ++worker) {
+    int status = -1;
+    BOOST_CHECK_EQUAL(waitpid(worker_pids.at(worker), &status, 0), worker_pids.at(worker));
+    BOOST_CHECK(WIFEXITED(status));
+    BOOST_CHECK_EQUAL(WEXITSTATUS(status), (worker == 0) ? n_models : 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(runWorkerBrokenModel)
+{
+  ValidationData validation_data;
+  auto transport_pair = LocalQueueTransport::makeTransportPair();
+  int n_models_validated = -1;
+  std::thread worker_thread([&]() {
+    n_models_validated = PopulationTrainerDistributedT::runWorker(*transport_pair.second, validation_data.model_trainer, validation_data.model_interpreter, validation_data.model_logger,
+      validation_data.input_data, validation_data.output_data, validation_data.time_steps, validation_data.input_nodes);
+  });
+
+  // a model that cannot be loaded is reported as failed and the worker keeps serving
+  std::string reply;
+  BOOST_CHECK(transport_pair.first->sendMessage("VALIDATE 2\nnot a model"));
+  BOOST_CHECK(transport_pair.first->receiveMessage(reply, 10000));
+  BOOST_CHECK_EQUAL(reply, "FAILED 2");
+
+  std::vector<Model<float>> population = validation_data.makePopulation(1);
+  BOOST_CHECK(transport_pair.first->sendMessage(PopulationTrainerDistributedT::makeValidateMessage(0, population.front())));
+  BOOST_CHECK(transport_pair.first->receiveMessage(reply, 10000));
+  int model_index = -1;
+  float model_error = 0;
+  BOOST_CHECK(PopulationTrainerDistributedT::parseErrorMessage(reply, model_index, model_error));
+  BOOST_CHECK_EQUAL(model_index, 0);
+
+  transport_pair.first->sendMessage("STOP");
+  worker_thread.join();
+  BOOST_CHECK_EQUAL(n_models_validated, 1);
+}
+
+BOOST_AUTO_TEST_CASE(validateModelsWorkerFailures)
+{
+  const int n_models = 3;
+  ValidationData validation_data;
+  std::vector<Model<float>> population = validation_data.makePopulation(n_models);
+  const std::vector<float> model_errors_expected = validation_data.validateLocally(population);
+
+  // a worker that fails to validate every model
+  auto transport_pair = LocalQueueTransport::makeTransportPair();
+  std::shared_ptr<MessageTransport> coordinator_transport = transport_pair.second;
+  std::thread worker_thread([coordinator_transport]() {
+    std::string message;
+    while (coordinator_transport->receiveMessage(message) && message != "STOP") {
+      int model_index = -1;
+      sscanf(message.data(), "VALIDATE %d", &model_index);
+      coordinator_transport->sendMessage(PopulationTrainerDistributedT::makeFailedMessage(model_index));
+    }
+  });
+
+  PopulationTrainerDistributedT population_trainer;
+  population_trainer.setWorkerTransports({ transport_pair.first });
+  std::vector<ModelInterpreterDefaultDevice<float>> model_interpreters = { validation_data.model_interpreter };
+  std::vector<std::tuple<int, std::string, float>> models_validation_errors(n_models);
+  population_trainer.validateModels(population, validation_data.model_trainer, model_interpreters, validation_data.model_logger,
+    validation_data.input_data, validation_data.output_data, validation_data.time_steps, validation_data.input_nodes, models_validation_errors);
+
+  // the worker is kept and the models were validated by the coordinator
+  BOOST_CHECK_EQUAL(population_trainer.getNWorkers(), 1);
+  BOOST_CHECK(population_trainer.getNModelsValidatedByWorkers() == std::vector<int>({ 0 }));
+  for (int i = 0; i < n_models; ++i) {
+    BOOST_CHECK_EQUAL(std::get<0>(models_validation_errors.at(i)), population.at(i).getId());
+    BOOST_CHECK_CLOSE(std::get<2>(models_validation_errors.at(i)), model_errors_expected.at(i), 1e-4);
+  }
+  population_trainer.stopWorkers();
+  worker_thread.join();
+}
+
+BOOST_AUTO_TEST_CASE(validateModelsWithoutWorkers)
+{
+  const int n_models = 3;
+  ValidationData validation_data;
+  std::vector<Model<float>> population = validation_data.makePopulation(n_models);
+  const std::vector<float> model_errors_expected = validation_data.validateLocally(population);
+
+  // a worker that has already gone away
+  auto transport_pair = LocalQueueTransport::makeTransportPair();
+  transport_pair.second->closeTransport();
+
+  PopulationTrainerDistributedT population_trainer;
+  population_trainer.setWorkerTransports({ transport_pair.first });
+  std::vector<ModelInterpreterDefaultDevice<float>> model_interpreters = { validation_data.model_interpreter };
+  std::vector<std::tuple<int, std::string, float>> models_validation_errors(n_models);
+  population_trainer.validateModels(population, validation_data.model_trainer, model_interpreters, validation_data.model_logger,
+    validation_data.input_data, validation_data.output_data, validation_data.time_steps, validation_data.input_nodes, models_validation_errors);
+  BOOST_CHECK_EQUAL(population_trainer.getNWorkers(), 0);
+  BOOST_CHECK(population_trainer.getNModelsValidatedByWorkers() == std::vector<int>({ 0 }));
+  for (int i = 0; i < n_models; ++i) {
+    BOOST_CHECK_EQUAL(std::get<0>(models_validation_errors.at(i)), population.at(i).getId());
+    BOOST_CHECK_CLOSE(std::get<2>(models_validation_errors.at(i)), model_errors_expected.at(i), 1e-4);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
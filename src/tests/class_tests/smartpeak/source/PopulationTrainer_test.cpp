@@ -193,6 +193,40 @@ BOOST_AUTO_TEST_CASE(gettersAndSetters)
   BOOST_CHECK(population_trainer.getResetModelCopyWeights());
   BOOST_CHECK(population_trainer.getResetModelTemplateWeights());
   BOOST_CHECK_EQUAL(population_trainer.getPopulationSize(), 256);
+  BOOST_CHECK(!population_trainer.getCopyOnWriteReplicates());
+  population_trainer.setCopyOnWriteReplicates(true);
+  BOOST_CHECK(population_trainer.getCopyOnWriteReplicates());
+  BOOST_CHECK_EQUAL(population_trainer.getTournamentSize(), 2);
+  population_trainer.setTournamentSize(4);
+  BOOST_CHECK_EQUAL(population_trainer.getTournamentSize(), 4);
+  BOOST_CHECK(!population_trainer.getShareCompiledModels());
+  population_trainer.setShareCompiledModels(true);
+  BOOST_CHECK(population_trainer.getShareCompiledModels());
+}
+
+BOOST_AUTO_TEST_CASE(shareCompiledModelCache)
+{
+  PopulationTrainerExt<float> population_trainer;
+  ModelResources model_resources = { ModelDevice(0, 1) };
+  std::vector<ModelInterpreterDefaultDevice<float>> model_interpreters;
+  for (int i = 0; i < 3; ++i)
+    model_interpreters.push_back(ModelInterpreterDefaultDevice<float>(model_resources));
+
+  // a new cache is shared when none of the interpreters has one
+  population_trainer.shareCompiledModelCache(model_interpreters);
+  std::shared_ptr<CompiledModelCache> compiled_model_cache = model_interpreters.at(0).getCompiledModelCache();
+  BOOST_CHECK(compiled_model_cache != nullptr);
+  for (ModelInterpreterDefaultDevice<float>& model_interpreter : model_interpreters)
+    BOOST_CHECK(model_interpreter.getCompiledModelCache() == compiled_model_cache);
+
+  // an existing cache is re-used
+  std::shared_ptr<CompiledModelCache> existing_cache = std::make_shared<CompiledModelCache>(8);
+  model_interpreters.at(0).setCompiledModelCache(nullptr);
+  model_interpreters.at(1).setCompiledModelCache(existing_cache);
+  model_interpreters.at(2).setCompiledModelCache(nullptr);
+  population_trainer.shareCompiledModelCache(model_interpreters);
+  for (ModelInterpreterDefaultDevice<float>& model_interpreter : model_interpreters)
+    BOOST_CHECK(model_interpreter.getCompiledModelCache() == existing_cache);
 }
 
 BOOST_AUTO_TEST_CASE(setNEpochsTraining)
@@ -277,6 +311,29 @@ BOOST_AUTO_TEST_CASE(getRandomNModels_)
   // }
 }
 
+BOOST_AUTO_TEST_CASE(getTournamentModel_)
+{
+  PopulationTrainerExt<float> population_trainer;
+
+  // make dummy data
+  std::vector<std::tuple<int, std::string, float>> models_validation_errors;
+  const int n_models = 4;
+  for (int i = 0; i < n_models; ++i)
+    models_validation_errors.push_back(std::make_tuple(i + 1, std::to_string(i + 1), (float)(n_models - i)));
+
+  // a large tournament is won by the best model and a tournament of 1 is a random draw
+  std::mt19937 generator(1);
+  BOOST_CHECK_EQUAL(population_trainer.getTournamentModel_(models_validation_errors, 64, generator), n_models - 1);
+  std::vector<int> n_wins(n_models, 0);
+  for (int i = 0; i < 400; ++i)
+    ++n_wins.at(population_trainer.getTournamentModel_(models_validation_errors, 1, generator));
+  for (int i = 0; i < n_models; ++i)
+    BOOST_CHECK_GT(n_wins.at(i), 0);
+
+  models_validation_errors.clear();
+  BOOST_CHECK_THROW(population_trainer.getTournamentModel_(models_validation_errors, 2, generator), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(validateModels_) 
 {
   // PopulationTrainerExt<float> population_trainer;
@@ -317,7 +374,7 @@ BOOST_AUTO_TEST_CASE(replicateModels)
 
   // create an initial population
   std::vector<Model<float>> population1, population2, population3,
-    population4, population5, population6, population7, population8;
+    population4, population5, population6, population7, population8, population9;
 	for (int i = 0; i < 2; ++i)
 	{
 		Model<float> model;
@@ -340,7 +397,7 @@ BOOST_AUTO_TEST_CASE(replicateModels)
 		model.findCycles();
 
 		Model<float> model1(model), model2(model), model3(model), // copy the models
-      model4(model), model5(model), model6(model), model7(model), model8(model);
+      model4(model), model5(model), model6(model), model7(model), model8(model), model9(model);
 		population1.push_back(model1); // push the copies to the different test populations
 		population2.push_back(model2);
 		population3.push_back(model3);
@@ -349,6 +406,7 @@ BOOST_AUTO_TEST_CASE(replicateModels)
     population6.push_back(model6);
     population7.push_back(model7);
     population8.push_back(model8);
+    population9.push_back(model9);
 	}
 
 	// control (no modifications)
@@ -485,6 +543,41 @@ BOOST_AUTO_TEST_CASE(replicateModels)
   population_trainer.replicateModels(population8, model_replicator);
   BOOST_CHECK_EQUAL(population8.size(), 6); // check for the expected size
   // TODO: implement test
+
+  // copy_on_write_replicates = true
+  population_trainer.setCheckCompleteModelInputToOutput(true);
+  population_trainer.setResetModelTemplateWeights(true);
+  population_trainer.setCopyOnWriteReplicates(true);
+  for (auto& model : population9)
+    for (auto& weight_map : model.getWeightsMap())
+      weight_map.second->setInitWeight(false);
+  population_trainer.replicateModels(population9, model_replicator);
+  BOOST_CHECK_EQUAL(population9.size(), 6); // check for the expected size
+  for (int i = 0; i < population9.size(); ++i) {
+    if (i < 2) {
+      BOOST_CHECK(!population9.at(i).isShared());
+      for (const auto& weight_map : population9.at(i).getWeightsMap())
+        BOOST_CHECK(weight_map.second->getInitWeight());
+    }
+    else {
+      // the replicates keep the template weight values and copy the nodes and weights once;
+      // the unmodified links remain shared with the template
+      BOOST_CHECK(population9.at(i).isShared());
+      BOOST_CHECK(population9.at(i).getSharedNodes().empty());
+      BOOST_CHECK(population9.at(i).getSharedWeights().empty());
+      BOOST_CHECK(!population9.at(i).getSharedLinks().empty());
+      for (const std::string& link_name : population9.at(i).getSharedLinks()) {
+        const auto& link = population9.at(i).links_.at(link_name);
+        BOOST_CHECK(link == population9.at(0).links_.at(link_name) || link == population9.at(1).links_.at(link_name));
+      }
+      for (const auto& weight_map : population9.at(i).getWeightsMap()) {
+        BOOST_CHECK(!weight_map.second->getInitWeight());
+        for (int j = 0; j < 2; ++j)
+          if (population9.at(j).weights_.count(weight_map.first))
+            BOOST_CHECK(weight_map.second != population9.at(j).weights_.at(weight_map.first));
+      }
+    }
+  }
   
   // // check for the expected tags
   // int cnt = 0;
@@ -856,6 +949,89 @@ BOOST_AUTO_TEST_CASE(exampleUsage)
   //        i.e., correct structure and weights]
 }
 
+BOOST_AUTO_TEST_CASE(evolveModelsAsync)
+{
+	PopulationTrainerExt<float> population_trainer;
+	population_trainer.setNGenerations(3);
+	population_trainer.setPopulationSize(4);
+	population_trainer.setTournamentSize(2);
+	population_trainer.setLogging(true);
+	ModelLogger<float> model_logger;
+	PopulationLogger<float> population_logger(true, true, true);
+	DataSimulatorExt<float> data_simulator;
+
+	const std::vector<std::string> input_nodes = { "Input_000000000000" }; // true inputs + biases
+	const std::vector<std::string> output_nodes = { "Output_000000000000" };
+	const int batch_size = 5;
+	const int memory_size = 8;
+
+	std::vector<ModelInterpreterDefaultDevice<float>> model_interpreters;
+	for (size_t i = 0; i < 2; ++i) {
+		ModelResources model_resources = { ModelDevice(0, 1) };
+		model_interpreters.push_back(ModelInterpreterDefaultDevice<float>(model_resources));
+	}
+
+	ModelTrainerExt<float> model_trainer;
+	model_trainer.setBatchSize(batch_size);
+	model_trainer.setMemorySize(memory_size);
+	model_trainer.setNEpochsTraining(2);
+	model_trainer.setNEpochsValidation(2);
+	LossFunctionHelper<float> loss_function_helper1;
+	loss_function_helper1.output_nodes_ = output_nodes;
+	loss_function_helper1.loss_functions_ = { std::make_shared<MSELossOp<float>>(MSELossOp<float>(1e-6, 1.0)) };
+	loss_function_helper1.loss_function_grads_ = { std::make_shared<MSELossGradOp<float>>(MSELossGradOp<float>(1e-6, 1.0)) };
+	model_trainer.setLossFunctionHelpers({ loss_function_helper1 });
+
+	ModelReplicatorExt<float> model_replicator;
+
+	// seed the population with 2 baseline models
+	ModelBuilder<float> model_builder;
+	std::vector<Model<float>> population;
+	for (int i = 0; i < 2; ++i) {
+		Model<float> model;
+		std::vector<std::string> node_names = model_builder.addInputNodes(model, "Input", "Input", 1);
+		node_names = model_builder.addFullyConnected(model, "Hidden1", "Mod1", node_names,
+			1, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()),
+			std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+			std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(1.0)), std::make_shared<AdamOp<float>>(AdamOp<float>(0.01, 0.9, 0.999, 1e-8)), 0, 0);
+		node_names = model_builder.addFullyConnected(model, "Output", "Mod2", node_names,
+			1, std::make_shared<ReLUOp<float>>(ReLUOp<float>()), std::make_shared<ReLUGradOp<float>>(ReLUGradOp<float>()),
+			std::make_shared<SumOp<float>>(SumOp<float>()), std::make_shared<SumErrorOp<float>>(SumErrorOp<float>()), std::make_shared<SumWeightGradOp<float>>(SumWeightGradOp<float>()),
+			std::make_shared<ConstWeightInitOp<float>>(ConstWeightInitOp<float>(1.0)), std::make_shared<AdamOp<float>>(AdamOp<float>(0.01, 0.9, 0.999, 1e-8)), 0, 0);
+		for (const std::string& node_name : node_names)
+			model.getNodesMap().at(node_name)->setType(NodeType::output);
+		model.setId(i);
+		model.setName(std::to_string(i));
+		population.push_back(model);
+	}
+
+	// 3 generations of 4 models each
+	std::vector<std::vector<std::tuple<int, std::string, float>>> models_validation_errors_per_generation = population_trainer.evolveModelsAsync(
+		population, "Test_population_async", model_trainer, model_interpreters, model_replicator, data_simulator, model_logger, population_logger, input_nodes);
+	BOOST_CHECK_EQUAL(models_validation_errors_per_generation.size(), 3);
+	BOOST_CHECK_GE(population.size(), 2); // replicates that are broken are not inserted
+	BOOST_CHECK_LE(population.size(), 4);
+	BOOST_CHECK_EQUAL(population_logger.getLogThroughputCSVWriter().getLineCount(), 4);
+
+	// the population holds the best models evaluated so far
+	const std::vector<std::tuple<int, std::string, float>>& models_validation_errors = models_validation_errors_per_generation.back();
+	BOOST_CHECK_EQUAL(models_validation_errors.size(), population.size());
+	float max_error = 0, max_error_first = 0;
+	for (int i = 0; i < population.size(); ++i) {
+		BOOST_CHECK_EQUAL(std::get<0>(models_validation_errors.at(i)), population.at(i).getId());
+		BOOST_CHECK_EQUAL(std::get<1>(models_validation_errors.at(i)), population.at(i).getName());
+		max_error = std::max(max_error, std::get<2>(models_validation_errors.at(i)));
+	}
+	for (const std::tuple<int, std::string, float>& model_validation_error : models_validation_errors_per_generation.front())
+		max_error_first = std::max(max_error_first, std::get<2>(model_validation_error));
+	BOOST_CHECK_LE(max_error, max_error_first);
+
+	// seeding with no models is an error
+	std::vector<Model<float>> population_empty;
+	BOOST_CHECK_THROW(population_trainer.evolveModelsAsync(
+		population_empty, "Test_population_async", model_trainer, model_interpreters, model_replicator, data_simulator, model_logger, population_logger, input_nodes), std::runtime_error);
+}
+
 // [TODO: test for evaluatePopulation]
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -80,6 +80,13 @@ BOOST_AUTO_TEST_CASE(storeAndLoadCsv)
 		//BOOST_CHECK(weight_map.second == weights.at(weight_map.first)); // Broken
 		++i;
   }
+
+  // identical weight init and solver ops are shared between weights
+  BOOST_CHECK(weights_test.at("Weight_0")->getWeightInitOp() == weights_test.at("Weight_2")->getWeightInitOp());
+  BOOST_CHECK(weights_test.at("Weight_0")->getSolverOp() == weights_test.at("Weight_2")->getSolverOp());
+  BOOST_CHECK_EQUAL(weights_test.at("Weight_0")->getSolverOp()->getName(), "SGDOp");
+  BOOST_CHECK(WeightFile<float>::getSolverOpRegistry().count("AdamOp"));
+  BOOST_CHECK(!WeightFile<float>::getWeightInitOpRegistry().count("NotAnOp"));
 }
 
 BOOST_AUTO_TEST_CASE(storeAndLoadWeightValuesCsv)